@@ -0,0 +1,104 @@
+#include "ata.h"
+#include "bootimg.h"
+#include "x86-64.h"
+
+// Primary ATA channel registers
+#define ATA_DATA        0x1F0
+#define ATA_NSECT       0x1F2
+#define ATA_LBA0        0x1F3
+#define ATA_LBA1        0x1F4
+#define ATA_LBA2        0x1F5
+#define ATA_DEVICE      0x1F6
+#define ATA_STATUS      0x1F7   // read
+#define ATA_COMMAND     0x1F7   // write
+#define ATA_ALTSTATUS   0x3F6   // read
+#define ATA_CONTROL     0x3F6   // write
+
+#define ATA_SR_ERR      0x01
+#define ATA_SR_DRQ      0x08
+#define ATA_SR_DF       0x20
+#define ATA_SR_BSY      0x80
+
+#define ATA_CMD_READ    0x20
+#define ATA_CMD_WRITE   0x30
+
+#define ATA_CTL_NIEN    0x02
+
+#define ATA_SECTS_PER_PAGE (PAGESIZE / SECTORSIZE)
+
+void ata_init() { outb(ATA_CONTROL, ATA_CTL_NIEN); }
+
+// ata_wait()
+//    Wait until the disk is not busy. Returns its status, or -1 on error.
+static int ata_wait() {
+  uint8_t status;
+  while ((status = inb(ATA_STATUS)) & ATA_SR_BSY) {
+  }
+  return status & (ATA_SR_ERR | ATA_SR_DF) ? -1 : status;
+}
+
+// ata_delay()
+//    Give the disk the 400 ns it may take to raise BSY after a command or
+//    a sector transfer: each alternate-status read takes about 100 ns,
+//    and unlike a status read it acknowledges nothing.
+static void ata_delay() {
+  for (int i = 0; i < 4; ++i) {
+    (void)inb(ATA_ALTSTATUS);
+  }
+}
+
+// ata_wait_drq()
+//    Wait until the disk is ready to transfer a sector (not busy, DRQ
+//    set). Returns -1 if it reports an error instead.
+static int ata_wait_drq() {
+  ata_delay();
+  int status = ata_wait();
+  return status < 0 || !(status & ATA_SR_DRQ) ? -1 : 0;
+}
+
+// ata_command(cmd, sect, nsect)
+//    Issue `cmd` for `nsect` (1 to ATA_MAXSECTS) sectors from `sect`.
+static int ata_command(int cmd, uint32_t sect, unsigned nsect) {
+  if (ata_wait() < 0) {
+    return -1;
+  }
+  outb(ATA_NSECT, nsect); // 256 is sent as 0
+  outb(ATA_LBA0, sect);
+  outb(ATA_LBA1, sect >> 8);
+  outb(ATA_LBA2, sect >> 16);
+  outb(ATA_DEVICE, ((sect >> 24) & 0x0F) | 0xE0);
+  outb(ATA_COMMAND, cmd);
+  return 0;
+}
+
+int ata_read(uint32_t sect, void *dst, unsigned nsect) {
+  if (ata_command(ATA_CMD_READ, sect, nsect) < 0) {
+    return -1;
+  }
+  // the disk raises DRQ once per sector
+  for (char *p = (char *)dst; nsect > 0; --nsect, p += SECTORSIZE) {
+    if (ata_wait_drq() < 0) {
+      return -1;
+    }
+    insl(ATA_DATA, p, SECTORSIZE / 4);
+  }
+  return 0;
+}
+
+int ata_write_pages(uint32_t sect, void *const *srcs, unsigned npages) {
+  if (ata_command(ATA_CMD_WRITE, sect, npages * ATA_SECTS_PER_PAGE) < 0) {
+    return -1;
+  }
+  for (unsigned i = 0; i < npages; ++i) {
+    const char *p = (const char *)srcs[i];
+    for (unsigned s = 0; s < ATA_SECTS_PER_PAGE; ++s, p += SECTORSIZE) {
+      if (ata_wait_drq() < 0) {
+        return -1;
+      }
+      outsl(ATA_DATA, p, SECTORSIZE / 4);
+    }
+  }
+  // the last sector is on its way to the disk once BSY clears
+  ata_delay();
+  return ata_wait() < 0 ? -1 : 0;
+}
@@ -0,0 +1,28 @@
+#ifndef SIGNALOS_ATA_H
+#define SIGNALOS_ATA_H
+#include "types.h"
+
+// ata.h
+//
+//   Polled programmed-I/O driver for the primary ATA disk (the boot
+//   disk), using 28-bit LBA. Each call is one ATA command of at most
+//   ATA_MAXSECTS sectors.
+
+#define ATA_MAXSECTS            256
+
+// ata_init()
+//    Mask the disk's interrupt; the driver polls the status register.
+void ata_init();
+
+// ata_read(sect, dst, nsect)
+//    Read `nsect` sectors starting at `sect` into `dst`. Returns 0, or -1
+//    if the disk reports an error.
+int ata_read(uint32_t sect, void* dst, unsigned nsect);
+
+// ata_write_pages(sect, srcs, npages)
+//    Write the pages `srcs[0]`, ..., `srcs[npages - 1]`, which need not be
+//    contiguous in memory, to consecutive sectors starting at `sect` with
+//    a single command. Returns 0, or -1 if the disk reports an error.
+int ata_write_pages(uint32_t sect, void* const* srcs, unsigned npages);
+
+#endif // SIGNALOS_ATA_H
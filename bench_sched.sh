@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# Usage: bench_sched.sh "CPUS..." QEMU [QEMU ARGS...]
+# Boot a `SCHEDSCALE=1` image headless once per CPU count, collect the
+# `schedscale` line the kernel writes to the parallel port, and print job
+# throughput and speedup over the first CPU count.
+
+cpus=$1
+shift
+timeout=${BENCH_SCHED_TIMEOUT:-30}
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+for n in $cpus; do
+    log="$dir/log.$n"
+    # the kernel never exits; stop QEMU once the report is complete
+    "$@" -smp "$n" -display none -parallel "file:$log" &
+    qemu=$!
+    for _ in $(seq 1 $((timeout * 10))); do
+        grep -q '^schedscale end' "$log" 2>/dev/null && break
+        sleep 0.1
+    done
+    kill "$qemu" 2>/dev/null
+    wait "$qemu" 2>/dev/null
+    if ! grep -q '^schedscale end' "$log" 2>/dev/null; then
+        echo "bench_sched.sh: -smp $n produced no report" 1>&2
+    fi
+done
+
+for n in $cpus; do
+    grep -h '^schedscale cpus' "$dir/log.$n" 2>/dev/null | head -n 1
+done | awk '
+    BEGIN { printf "%-6s %8s %12s %8s\n", "cpus", "jobs", "jobs/s", "speedup" }
+    # schedscale cpus N procs P jobs J rate R jobs/s
+    {
+        if (!base) { base = $9 }
+        printf "%-6s %8d %12d %8.2f\n", $3, $7, $9, base ? $9 / base : 0
+    }'
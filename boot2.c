@@ -0,0 +1,112 @@
+#include "bootimg.h"
+#include "boottime.h"
+#include "types.h"
+#include "x86-64.h"
+
+// boot2.c
+//
+//   Second-stage boot loader. The boot sector loads this code at
+//   BOOT2_ADDR and jumps to `boot2`, which reads the compressed kernel
+//   image written by build/mkbootdisk.cc, decompresses each extent into
+//   place, and jumps to the kernel.
+
+#define BOOTIMGHDR ((struct bootimg_header *)0x3000) // scratch space
+#define BOOT2_STAGING 0x10000 // compressed extent data, BOOTIMG_BLOCKSIZE bytes
+#define BOOTTIME ((boottime_t *)BOOTTIME_ADDR)
+
+__attribute__((noreturn)) void boot2();
+static void boot2_loadextent(struct bootimg_extent *ext);
+static void boot2_lz4(uint8_t *dst, const uint8_t *src, size_t csize);
+
+// defined in boot.c, resident in the boot sector
+void boot_readsects(uintptr_t dst, uint32_t src_sect, uint32_t nsect);
+
+// boot2
+// 	Load the kernel and jump to it.
+__section(".text.entry") __attribute__((noreturn)) void boot2() {
+  BOOTTIME->tsc[BOOTTIME_STAGE2] = rdtsc();
+  BOOTTIME->magic = BOOTTIME_MAGIC;
+
+  boot_readsects((uintptr_t)BOOTIMGHDR, KERNEL_START_SECTOR,
+                 BOOTIMG_HDRSIZE / SECTORSIZE);
+  while (BOOTIMGHDR->magic != BOOTIMG_MAGIC) {
+  }
+
+  struct bootimg_extent *ext = BOOTIMGHDR->extents;
+  struct bootimg_extent *eext = ext + BOOTIMGHDR->nextents;
+  for (; ext < eext; ++ext) {
+    boot2_loadextent(ext);
+  }
+
+  // jump to kernel, never to return
+  typedef __attribute__((noreturn)) void (*KernelEntry)();
+  KernelEntry kernel_entry = (KernelEntry)BOOTIMGHDR->entry;
+  kernel_entry();
+}
+
+// boot2_loadextent(ext)
+//	Read extent `ext` into the staging buffer with one ATA command, then
+//	expand it to its load address `ext->va`.
+static void boot2_loadextent(struct bootimg_extent *ext) {
+  uint8_t *dst = (uint8_t *)ext->va;
+  const uint8_t *src = (const uint8_t *)BOOT2_STAGING;
+
+  if (ext->type == BOOTIMG_ZERO) {
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+      dst[i] = 0;
+    }
+    return;
+  }
+
+  boot_readsects(BOOT2_STAGING, KERNEL_START_SECTOR + ext->sect,
+                 (ext->csize + SECTORSIZE - 1) / SECTORSIZE);
+  if (ext->type == BOOTIMG_LZ4) {
+    boot2_lz4(dst, src, ext->csize);
+  } else {
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+// boot2_lz4_length(src, len)
+//	Finish decoding an LZ4 literal or match length whose 4-bit token
+//	field was `len`. Advances `*src` past any extension bytes.
+static size_t boot2_lz4_length(const uint8_t **src, size_t len) {
+  if (len == 15) {
+    uint8_t b;
+    do {
+      b = *(*src)++;
+      len += b;
+    } while (b == 255);
+  }
+  return len;
+}
+
+// boot2_lz4(dst, src, csize)
+//	Decompress the `csize`-byte LZ4 block at `src` into `dst`.
+//	Matches may overlap their output, so copies go byte by byte.
+static void boot2_lz4(uint8_t *dst, const uint8_t *src, size_t csize) {
+  const uint8_t *end = src + csize;
+  while (src < end) {
+    unsigned token = *src++;
+
+    // literals
+    size_t len = boot2_lz4_length(&src, token >> 4);
+    for (; len > 0; --len) {
+      *dst++ = *src++;
+    }
+    // the last sequence has no match part
+    if (src >= end) {
+      break;
+    }
+
+    // match
+    const uint8_t *match = dst - (src[0] | (src[1] << 8));
+    src += 2;
+    len = boot2_lz4_length(&src, token & 15) + 4;
+    for (; len > 0; --len) {
+      *dst++ = *match++;
+    }
+  }
+}
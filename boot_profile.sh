@@ -0,0 +1,53 @@
+#!/bin/bash
+
+# Usage: boot_profile.sh RUNS QEMU [QEMU ARGS...]
+# Boot the image RUNS times headless, collect the `bootprof` lines the
+# kernel writes to the parallel port, and print per-phase medians
+# (TSC cycles).
+
+runs=$1
+shift
+timeout=${BOOTPROF_TIMEOUT:-5}
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+for i in $(seq 1 "$runs"); do
+    log="$dir/log.$i"
+    # the kernel never exits; stop QEMU once the report is complete
+    "$@" -display none -parallel "file:$log" &
+    qemu=$!
+    for _ in $(seq 1 $((timeout * 10))); do
+        grep -q '^bootprof end' "$log" 2>/dev/null && break
+        sleep 0.1
+    done
+    kill "$qemu" 2>/dev/null
+    wait "$qemu" 2>/dev/null
+    if ! grep -q '^bootprof end' "$log" 2>/dev/null; then
+        echo "boot_profile.sh: run $i produced no report" 1>&2
+    fi
+done
+
+cat "$dir"/log.* | awk -v runs="$runs" '
+    $1 == "bootprof" && $2 == "phase" { key = $3; val = $4 }
+    $1 == "bootprof" && $2 == "total" { key = "total"; val = $3 }
+    $1 == "bootprof" && ($2 == "phase" || $2 == "total") {
+        if (!(key in n)) { order[++nkeys] = key }
+        v[key, ++n[key]] = val
+    }
+    END {
+        printf "%-12s %8s %14s\n", "phase", "runs", "median_cycles"
+        for (k = 1; k <= nkeys; ++k) {
+            key = order[k]
+            # insertion sort the samples
+            for (i = 2; i <= n[key]; ++i) {
+                x = v[key, i]
+                for (j = i - 1; j >= 1 && v[key, j] > x; --j) {
+                    v[key, j + 1] = v[key, j]
+                }
+                v[key, j + 1] = x
+            }
+            m = n[key] % 2 ? v[key, (n[key] + 1) / 2] \
+                : (v[key, n[key] / 2] + v[key, n[key] / 2 + 1]) / 2
+            printf "%-12s %8d %14d\n", key, n[key], m
+        }
+    }'
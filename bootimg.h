@@ -0,0 +1,55 @@
+#ifndef SIGNALOS_BOOTIMG_H
+#define SIGNALOS_BOOTIMG_H
+#include "types.h"
+
+// bootimg.h
+//
+//   Boot disk layout and compressed kernel image format, shared by the
+//   boot loader (boot.c, boot2.c) and build/mkbootdisk.cc.
+//
+//   sector 0                  boot sector (stage 1, boot.c)
+//   sectors 1-16              second-stage loader (boot2.c)
+//   KERNEL_START_SECTOR       kernel image header, then extent data
+//   SWAP_START_SECTOR         swap area, SWAP_SECTORS sectors (swap.c)
+//
+//   The kernel's loadable segments are cut into extents of at most
+//   BOOTIMG_BLOCKSIZE bytes. Each extent is an independent LZ4 block,
+//   stored verbatim if it does not compress, or (for the part of a
+//   segment past p_filesz) a run of zeroes with no data on disk.
+
+#define SECTORSIZE              512
+
+#define BOOT2_ADDR              0x8000  // stage 2 load address
+#define BOOT2_START_SECTOR      1
+#define BOOT2_SECTORS           16
+#define KERNEL_START_SECTOR     (BOOT2_START_SECTOR + BOOT2_SECTORS)
+#define SWAP_START_SECTOR       4096    // 2 MiB; the kernel image ends first
+#define SWAP_SECTORS            65536   // 32 MiB
+
+#define BOOTIMG_MAGIC           0x5A4C4F53U // "SOLZ" in little endian
+#define BOOTIMG_HDRSIZE         4096
+#define BOOTIMG_BLOCKSIZE       0x10000 // 128 sectors, one ATA command
+#define BOOTIMG_MAXEXTENTS      ((BOOTIMG_HDRSIZE - 16) / 24)
+
+// Values for bootimg_extent::type
+#define BOOTIMG_ZERO            0       // fill `usize` bytes with zero
+#define BOOTIMG_STORED          1       // `usize` bytes stored verbatim
+#define BOOTIMG_LZ4             2       // LZ4 block, `csize` bytes on disk
+
+struct bootimg_extent {
+    uint64_t va;            // @0x00 address of the decompressed bytes
+    uint32_t sect;          // @0x08 first sector, relative to the header
+    uint32_t type;          // @0x0c see BOOTIMG_ZERO etc. above
+    uint32_t csize;         // @0x10 number of bytes on disk
+    uint32_t usize;         // @0x14 number of bytes in memory
+};
+
+// image header (occupies the first BOOTIMG_HDRSIZE bytes of the image)
+struct bootimg_header {
+    uint32_t magic;         // @0x00 must equal BOOTIMG_MAGIC
+    uint32_t nextents;      // @0x04 number of valid `extents`
+    uint64_t entry;         // @0x08 kernel entry point (from e_entry)
+    struct bootimg_extent extents[BOOTIMG_MAXEXTENTS];
+};
+
+#endif /* !SIGNALOS_BOOTIMG_H */
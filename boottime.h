@@ -0,0 +1,34 @@
+#ifndef SIGNALOS_BOOTTIME_H
+#define SIGNALOS_BOOTTIME_H
+
+// boottime.h
+//
+//   Boot timeline: `rdtsc` timestamps taken at each boot phase boundary.
+//   The boot loader fills in the table at BOOTTIME_ADDR; the kernel copies
+//   it early in `kernel_main`, adds its own phases, and reports the result
+//   on the parallel-port log.
+
+#define BOOTTIME_ADDR           0x4000
+#define BOOTTIME_MAGIC          0x454D4954U // "TIME" in little endian
+
+// Indexes into boottime::tsc
+#define BOOTTIME_START          0   // boot_start (stage 1, real mode)
+#define BOOTTIME_STAGE2         1   // boot2 entry
+#define BOOTTIME_KERNEL         2   // kernel_main entry
+#define BOOTTIME_MEMORY         3   // after init_kernel_memory
+#define BOOTTIME_INTERRUPTS     4   // after init_interrupts
+#define BOOTTIME_CPU_STATE      5   // after init_cpu_state
+#define BOOTTIME_VGA            6   // after VGA console setup
+#define NBOOTTIME               7
+
+#ifndef __ASSEMBLER__
+#include "types.h"
+
+typedef struct boottime {
+    uint32_t magic;             // BOOTTIME_MAGIC once stage 2 has run
+    uint32_t reserved;
+    uint64_t tsc[NBOOTTIME];    // 0 if the phase was not reached
+} boottime_t;
+#endif
+
+#endif /* !SIGNALOS_BOOTTIME_H */
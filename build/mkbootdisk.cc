@@ -3,7 +3,6 @@
 #include <sys/types.h>
 #include <inttypes.h>
 #include <fcntl.h>
-#include "elf.h"
 #include <unistd.h>
 #include <stdio.h>
 #include <string.h>
@@ -14,6 +13,8 @@
 # include <fcntl.h>
 # include <io.h>
 #endif
+#include "elf.h"
+#include "bootimg.h"
 
 /* This program makes a boot image.
  * It takes at least one argument, the boot sector file.
@@ -23,6 +24,10 @@
  * two bytes in the sector equal 0x55 and 0xAA.
  * This code makes sure the code intended for the boot sector is at most
  * 512 - 2 = 510 bytes long, then appends the 0x55-0xAA signature.
+ *
+ * An argument "-z KERNELFILE" writes the ELF kernel as a compressed
+ * kernel image (see bootimg.h) for the second-stage loader, starting at
+ * KERNEL_START_SECTOR, where that loader looks for it.
  */
 
 int diskfd;
@@ -31,11 +36,12 @@ off_t curoff = 0;
 
 int find_partition(off_t partition_sect, off_t extended_sect, int partoff);
 void do_multiboot(const char *filename);
+size_t write_kernel_image(const char *filename);
 
 
 void usage(void) {
-    fprintf(stderr, "Usage: mkbootdisk BOOTSECTORFILE [FILE | @SECNUM]...\n");
-    fprintf(stderr, "   or: mkbootdisk -p DISK [FILE | @SECNUM]...\n");
+    fprintf(stderr, "Usage: mkbootdisk BOOTSECTORFILE [FILE | @SECNUM | -z KERNELFILE]...\n");
+    fprintf(stderr, "   or: mkbootdisk -p DISK [FILE | @SECNUM | -z KERNELFILE]...\n");
     fprintf(stderr, "   or: mkbootdisk -m KERNELFILE\n");
     exit(1);
 }
@@ -163,6 +169,23 @@ int main(int argc, char *argv[]) {
             continue;
         }
 
+        // "-z KERNELFILE" means "write a compressed kernel image".
+        if (strcmp(argv[i], "-z") == 0) {
+            if (i + 1 >= argc) {
+                usage();
+            }
+            if (nsectors > KERNEL_START_SECTOR) {
+                fprintf(stderr, "mkbootdisk: kernel image must start at sector %u, already at sector %u\n", (unsigned) KERNEL_START_SECTOR, (unsigned) nsectors);
+                exit(1);
+            }
+            while (nsectors < KERNEL_START_SECTOR) {
+                diskwrite(zerobuf, 512);
+                nsectors++;
+            }
+            nsectors += write_kernel_image(argv[++i]);
+            continue;
+        }
+
         // Otherwise, read the file.
         f = fopencheck(argv[i]);
         pos = 0;
@@ -178,8 +201,17 @@ int main(int argc, char *argv[]) {
         fclose(f);
     }
 
-    // Fill out to 1024 sectors with 0 blocks
-    while (nsectors < 1024) {
+    // Fill out to 1024 sectors with 0 blocks; a whole disk also gets the
+    // swap area (see bootimg.h)
+    size_t end_sector = 1024;
+    if (bootsector_special) {
+        if (nsectors > SWAP_START_SECTOR) {
+            fprintf(stderr, "mkbootdisk: image overlaps swap area at sector %u\n", (unsigned) SWAP_START_SECTOR);
+            usage();
+        }
+        end_sector = SWAP_START_SECTOR + SWAP_SECTORS;
+    }
+    while (nsectors < end_sector) {
         diskwrite(zerobuf, 512);
         nsectors++;
     }
@@ -315,3 +347,179 @@ void do_multiboot(const char *filename) {
     diskwrite(multiboot_header, sizeof(multiboot_header));
     exit(0);
 }
+
+
+// Compressed kernel images
+
+// LZ4 block format limits
+#define LZ4_MINMATCH            4
+#define LZ4_LASTLITERALS        5       // last 5 bytes are always literals
+#define LZ4_MFLIMIT             12      // last match starts >= 12 bytes from end
+#define LZ4_MAXOFFSET           65535
+#define LZ4_HASHBITS            12
+
+static uint8_t *lz4_putlength(uint8_t *op, size_t len) {
+    for (; len >= 255; len -= 255) {
+        *op++ = 255;
+    }
+    *op++ = len;
+    return op;
+}
+
+static uint8_t *lz4_sequence(uint8_t *op, const uint8_t *lit, size_t nlit,
+                             size_t offset, size_t mlen) {
+    uint8_t *token = op++;
+    *token = (nlit >= 15 ? 15 : nlit) << 4;
+    if (nlit >= 15) {
+        op = lz4_putlength(op, nlit - 15);
+    }
+    memcpy(op, lit, nlit);
+    op += nlit;
+    if (mlen) {
+        *op++ = offset;
+        *op++ = offset >> 8;
+        mlen -= LZ4_MINMATCH;
+        *token |= mlen >= 15 ? 15 : mlen;
+        if (mlen >= 15) {
+            op = lz4_putlength(op, mlen - 15);
+        }
+    }
+    return op;
+}
+
+static uint32_t lz4_read32(const uint8_t *p) {
+    uint32_t x;
+    memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+// lz4_compress(dst, src, n)
+//    Compress `n` bytes at `src` into one LZ4 block at `dst` with a greedy
+//    hash-table matcher. `dst` must hold `n + n / 255 + 16` bytes.
+//    Returns the compressed size.
+static size_t lz4_compress(uint8_t *dst, const uint8_t *src, size_t n) {
+    uint32_t table[1 << LZ4_HASHBITS];  // position + 1, 0 if empty
+    memset(table, 0, sizeof(table));
+    uint8_t *op = dst;
+    size_t anchor = 0, i = 0;
+
+    while (n >= LZ4_MFLIMIT && i + LZ4_MFLIMIT <= n) {
+        uint32_t seq = lz4_read32(src + i);
+        uint32_t h = (seq * 2654435761U) >> (32 - LZ4_HASHBITS);
+        size_t cand = table[h];
+        table[h] = i + 1;
+        if (cand == 0 || i - (cand - 1) > LZ4_MAXOFFSET
+            || lz4_read32(src + cand - 1) != seq) {
+            ++i;
+            continue;
+        }
+        --cand;
+        size_t mlen = LZ4_MINMATCH;
+        while (i + mlen < n - LZ4_LASTLITERALS
+               && src[cand + mlen] == src[i + mlen]) {
+            ++mlen;
+        }
+        op = lz4_sequence(op, src + anchor, i - anchor, i - cand, mlen);
+        i += mlen;
+        anchor = i;
+    }
+    op = lz4_sequence(op, src + anchor, n - anchor, 0, 0);
+    return op - dst;
+}
+
+// write_kernel_image(filename)
+//    Write the loadable segments of ELF kernel `filename` as a compressed
+//    kernel image: a BOOTIMG_HDRSIZE-byte header followed by sector-aligned
+//    extent data. Returns the number of sectors written.
+size_t write_kernel_image(const char *filename) {
+    FILE *f = fopencheck(filename);
+    if (fseek(f, 0, SEEK_END) != 0) {
+        perror("fseek");
+        usage();
+    }
+    long fsize = ftell(f);
+    rewind(f);
+    uint8_t *elf = (uint8_t *) malloc(fsize);
+    if (!elf || fread(elf, 1, fsize, f) != size_t(fsize)) {
+        fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+        usage();
+    }
+    fclose(f);
+
+    elf_header *elfh = (elf_header *) elf;
+    if (size_t(fsize) < sizeof(elf_header) || elfh->e_magic != ELF_MAGIC) {
+        fprintf(stderr, "%s: not an ELF executable file\n", filename);
+        usage();
+    }
+
+    static bootimg_header hdr;
+    static uint8_t cbuf[BOOTIMG_BLOCKSIZE + BOOTIMG_BLOCKSIZE / 255 + 16];
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = BOOTIMG_MAGIC;
+    hdr.entry = elfh->e_entry;
+
+    // First pass: lay out extents. Data follows the header.
+    const uint8_t *data[BOOTIMG_MAXEXTENTS];
+    size_t sect = BOOTIMG_HDRSIZE / SECTORSIZE;
+    size_t usize_total = 0, csize_total = 0;
+    elf_program *ph = (elf_program *) (elf + elfh->e_phoff);
+    for (int i = 0; i < elfh->e_phnum; ++i, ++ph) {
+        if (ph->p_type != ELF_PTYPE_LOAD
+            || ph->p_offset + ph->p_filesz > size_t(fsize)) {
+            continue;
+        }
+        for (uint64_t off = 0; off < ph->p_memsz; ) {
+            if (hdr.nextents == BOOTIMG_MAXEXTENTS) {
+                fprintf(stderr, "%s: too many extents for kernel image\n", filename);
+                usage();
+            }
+            bootimg_extent *ext = &hdr.extents[hdr.nextents];
+            ext->va = ph->p_va + off;
+            if (off < ph->p_filesz) {
+                uint64_t n = ph->p_filesz - off;
+                ext->usize = n > BOOTIMG_BLOCKSIZE ? BOOTIMG_BLOCKSIZE : n;
+                data[hdr.nextents] = elf + ph->p_offset + off;
+                ext->csize = lz4_compress(cbuf, data[hdr.nextents], ext->usize);
+                if (ext->csize < ext->usize) {
+                    ext->type = BOOTIMG_LZ4;
+                } else {
+                    ext->type = BOOTIMG_STORED;
+                    ext->csize = ext->usize;
+                }
+                ext->sect = sect;
+                sect += (ext->csize + SECTORSIZE - 1) / SECTORSIZE;
+            } else {
+                ext->type = BOOTIMG_ZERO;
+                ext->usize = ph->p_memsz - off;
+            }
+            usize_total += ext->usize;
+            csize_total += ext->csize;
+            off += ext->usize;
+            ++hdr.nextents;
+        }
+    }
+
+    // Second pass: write header and extent data.
+    char zerobuf[SECTORSIZE];
+    memset(zerobuf, 0, sizeof(zerobuf));
+    diskwrite(&hdr, sizeof(hdr));
+    for (uint32_t i = 0; i < hdr.nextents; ++i) {
+        bootimg_extent *ext = &hdr.extents[i];
+        if (ext->type == BOOTIMG_ZERO) {
+            continue;
+        } else if (ext->type == BOOTIMG_LZ4) {
+            lz4_compress(cbuf, data[i], ext->usize);
+            diskwrite(cbuf, ext->csize);
+        } else {
+            diskwrite(data[i], ext->csize);
+        }
+        if (ext->csize % SECTORSIZE != 0) {
+            diskwrite(zerobuf, SECTORSIZE - ext->csize % SECTORSIZE);
+        }
+    }
+
+    fprintf(stderr, "%s: %u extents, %zu bytes -> %zu bytes (%zu sectors)\n",
+            filename, (unsigned) hdr.nextents, usize_total, csize_total, sect);
+    free(elf);
+    return sect;
+}
@@ -135,7 +135,7 @@ always:
 .PHONY: all always clean realclean distclean cleanfs fsck \
 	run run-graphic run-console run-monitor \
 	run-gdb run-gdb-graphic run-gdb-console \
-	check-qemu-console check-qemu kill \
+	check-qemu-console check-qemu kill boot-profile bench-sched \
 	run-% run-graphic-% run-console-% run-monitor-% \
 	run-gdb-% run-gdb-graphic-% run-gdb-console-%
 
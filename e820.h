@@ -0,0 +1,35 @@
+#ifndef SIGNALOS_E820_H
+#define SIGNALOS_E820_H
+
+// e820.h
+//
+//   Physical memory map from the BIOS (INT 15h, EAX=E820h). bootentry.S
+//   stores the entry count at E820_ADDR and the entries right after it;
+//   the kernel reads them in `init_physical_memory`.
+
+#define E820_ADDR               0x5000
+#define E820_MAXENTRIES         64
+#define E820_ENTRYSIZE          24
+#define E820_SMAP               0x534D4150  // "SMAP"
+
+// Values for e820_entry::type
+#define E820_RAM                1           // usable memory
+
+#ifndef __ASSEMBLER__
+#include "types.h"
+
+typedef struct e820_entry {
+    uint64_t addr;              // start of region
+    uint64_t size;              // length in bytes
+    uint32_t type;              // see E820_RAM above
+    uint32_t acpi;              // ACPI 3.0 extended attributes
+} e820_entry_t;
+
+typedef struct e820_map {
+    uint32_t nentries;
+    uint32_t reserved;
+    e820_entry_t entries[E820_MAXENTRIES];
+} e820_map_t;
+#endif
+
+#endif /* !SIGNALOS_E820_H */
@@ -1,7 +1,10 @@
+#define AP_TRAMPOLINE_ADDR 0x7000
 #define COLOR_ERROR 0xC000
 #define CONSOLE_ADDR 0xB8000
 #define CONSOLE_COLUMNS 80
 #define CONSOLE_ROWS 25
+#define CPUSTATE_KSTACK_TOP 8
+#define CPUSTATE_SYSCALL_RSP 16
 #define CR0_AM 0x00040000
 #define CR0_CD 0x40000000
 #define CR0_EM 0x00000004
@@ -64,6 +67,7 @@
 #define IRQ_KEYBOARD 1
 #define IRQ_SPURIOUS 31
 #define IRQ_TIMER 0
+#define IRQ_WAKEUP 2
 #define KERNEL_STACK_TOP 0x80000
 #define KERNEL_START_ADDR 0x40000
 #define KEYBOARD_DATAREG 0x60
@@ -79,6 +83,7 @@
 #define KEY_PAGEUP 0306
 #define KEY_RIGHT 0301
 #define KEY_UP 0300
+#define MAXCPU 8
 #define MEMSIZE_PHYSICAL 0x200000
 #define MEMSIZE_VIRTUAL 0x300000
 #define MSR_IA32_APIC_BASE 0x1B
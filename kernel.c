@@ -1,5 +1,8 @@
 #include "kernel.h"
+#include "boottime.h"
+#include "e820.h"
 #include "lapic.h"
+#include "log.h"
 #include "vmiter.h"
 #include "x86-64.h"
 #include <stddef.h>
@@ -14,42 +17,41 @@ static const int VGA_HEIGHT = 25;
 
 proc ptable[NPROC]; // array of process descriptors
                     // Note that `ptable[0]` is never used.
-proc *current;      // pointer to currently executing proc
 
-#define HZ 100 // timer interrupt frequency (interrupts/sec)
-int ticks;     // # timer interrupts so far
+int ticks;             // timer ticks since boot (see `timer_update`)
+uint64_t tsc_per_tick; // TSC cycles per timer tick
+static uint32_t lapic_timer_count; // LAPIC timer counts per tick
+static uint64_t tsc_boot;          // TSC at tick 0
+static bool tsc_deadline_supported;
 
 // Memory state
 //    Information about physical page with address `pa` is stored in
-//    `pages[pa / PAGESIZE]`. In the handout code, each `pages` entry
-//    holds an `refcount` member, which is 0 for free pages.
-//    You can change this as you see fit.
-
-typedef struct pageinfo {
-  uint8_t refcount;
-} pageinfo;
+//    `pages[pa / PAGESIZE]` (see `pageinfo` in kernel.h). `pages` has
+//    `npages` entries and is sized at boot from the firmware memory map
+//    (see `init_physical_memory`).
 
 bool pageinfo_used(pageinfo *page) { return page->refcount != 0; }
 
-pageinfo pages[NPAGES];
+uintptr_t memsize_physical;
+size_t npages;
+pageinfo *pages;
+
+// Usable RAM regions, page-aligned
+typedef struct ram_region {
+  uintptr_t start;
+  uintptr_t end;
+} ram_region;
+static ram_region ram_regions[E820_MAXENTRIES];
+static int nram_regions;
 
 void syscall_entry();
 
 static void init_kernel_memory();
 static void init_interrupts();
-static void init_cpu_state();
 uintptr_t syscall(regstate *regs);
 
-x86_64_pagetable kernel_pagetable[5];
+x86_64_pagetable kernel_pagetable[4];
 uint64_t kernel_gdt_segments[7];
-static x86_64_taskstate kernel_taskstate;
-
-void *memset(void *v, int c, size_t n) {
-  for (char *p = (char *)v; n > 0; ++p, --n) {
-    *p = c;
-  }
-  return v;
-}
 
 // reserved_physical_address(pa)
 //    Returns true iff `pa` is a reserved physical address.
@@ -69,76 +71,322 @@ uintptr_t round_up(uintptr_t ptr, unsigned long incr) {
   return ptr;
 }
 
+static bool ram_physical_address(uintptr_t pa) {
+  for (int i = 0; i < nram_regions; ++i) {
+    if (pa >= ram_regions[i].start && pa < ram_regions[i].end) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // allocatable_physical_address(pa)
 //    Returns true iff `pa` is an allocatable physical address, i.e.,
-//    not reserved or holding kernel data.
+//    usable RAM that is not reserved or holding kernel data.
 
 bool allocatable_physical_address(uintptr_t pa) {
   extern char _kernel_end[];
+  uintptr_t pages_pa = (uintptr_t)pages;
   return !reserved_physical_address(pa) &&
          (pa < KERNEL_START_ADDR ||
           pa >= round_up((uintptr_t)_kernel_end, PAGESIZE)) &&
          (pa < KERNEL_STACK_TOP - PAGESIZE || pa >= KERNEL_STACK_TOP) &&
-         pa < MEMSIZE_PHYSICAL;
+         (pa < AP_TRAMPOLINE_ADDR || pa >= AP_TRAMPOLINE_ADDR + PAGESIZE) &&
+         (pa < pages_pa ||
+          pa >= round_up(pages_pa + npages * sizeof(pageinfo), PAGESIZE)) &&
+         pa < memsize_physical && ram_physical_address(pa);
+}
+
+// init_physical_memory()
+//    Size physical memory from the BIOS E820 map left by bootentry.S,
+//    falling back to [0, MEMSIZE_PHYSICAL) minus the ISA hole if the map
+//    is missing. Then place `pages[]` in the largest stretch of RAM above
+//    1 MiB that the boot page table maps (the first 1 GiB). If `pages[]`
+//    does not fit there, only the memory it can describe is used.
+
+static void init_physical_memory() {
+  const e820_map_t *map = (const e820_map_t *)E820_ADDR;
+  uint32_t n = map->nentries <= E820_MAXENTRIES ? map->nentries : 0;
+
+  for (uint32_t i = 0; i < n; ++i) {
+    const e820_entry_t *e = &map->entries[i];
+    uintptr_t start = round_up(e->addr, PAGESIZE);
+    uintptr_t end = (e->addr + e->size) & ~PAGEOFFMASK;
+    if (e->type != E820_RAM || !(e->acpi & 1) || start >= end) {
+      continue;
+    }
+    if (end > MEMSIZE_MAX) {
+      end = MEMSIZE_MAX;
+    }
+    if (start < end) {
+      ram_regions[nram_regions].start = start;
+      ram_regions[nram_regions].end = end;
+      ++nram_regions;
+    }
+  }
+  if (nram_regions == 0) {
+    ram_regions[0].start = 0;
+    ram_regions[0].end = IOPHYSMEM;
+    ram_regions[1].start = EXTPHYSMEM;
+    ram_regions[1].end = MEMSIZE_PHYSICAL;
+    nram_regions = 2;
+  }
+
+  memsize_physical = 0;
+  for (int i = 0; i < nram_regions; ++i) {
+    if (ram_regions[i].end > memsize_physical) {
+      memsize_physical = ram_regions[i].end;
+    }
+  }
+  npages = memsize_physical / PAGESIZE;
+
+  size_t room = 0;
+  for (int i = 0; i < nram_regions; ++i) {
+    uintptr_t start = ram_regions[i].start > EXTPHYSMEM ? ram_regions[i].start
+                                                       : EXTPHYSMEM;
+    uintptr_t end = ram_regions[i].end < (1UL << 30) ? ram_regions[i].end
+                                                     : (1UL << 30);
+    if (start < end && end - start > room) {
+      pages = (pageinfo *)start;
+      room = end - start;
+    }
+  }
+  // assert(pages);
+  if (npages * sizeof(pageinfo) > room) {
+    npages = room / sizeof(pageinfo);
+    memsize_physical = npages * PAGESIZE;
+    int keep = 0;
+    for (int i = 0; i < nram_regions; ++i) {
+      if (ram_regions[i].start < memsize_physical) {
+        ram_regions[keep].start = ram_regions[i].start;
+        ram_regions[keep].end = ram_regions[i].end < memsize_physical
+                                    ? ram_regions[i].end
+                                    : memsize_physical;
+        ++keep;
+      }
+    }
+    nram_regions = keep;
+  }
+  memset(pages, 0, npages * sizeof(pageinfo));
+}
+
+// Free physical pages
+//    Free memory is managed by a buddy allocator. A free block of order
+//    `k` is 2^k pages, starts at a page number that is a multiple of 2^k,
+//    and sits on the doubly linked list `free_area[k]`, threaded through
+//    `pages[]`. Page 0 is never free, so page number 0 ends a list.
+//    Freeing a block merges it with its buddy (`pn ^ 2^k`) while the
+//    buddy is free too. Single pages come straight off `free_area[0]`
+//    whenever it is non-empty.
+
+#define PAGE_MAXORDER 9 // largest block: 2^9 pages = 2 MiB
+#define PAGE_NORDERS (PAGE_MAXORDER + 1)
+
+static uint32_t free_area[PAGE_NORDERS];
+static size_t nfree_pages;
+
+// The boot page table (set up in bootentry.S) stays live until
+// `init_kernel_memory` loads `kernel_pagetable`.
+#define BOOT_PAGETABLE_START 0x1000
+#define BOOT_PAGETABLE_END 0x3000
+
+static void free_area_push(uint32_t pn, int order) {
+  pageinfo *pi = &pages[pn];
+  pi->free = true;
+  pi->order = order;
+  pi->prev = 0;
+  pi->next = free_area[order];
+  if (pi->next) {
+    pages[pi->next].prev = pn;
+  }
+  free_area[order] = pn;
+}
+
+static void free_area_remove(uint32_t pn) {
+  pageinfo *pi = &pages[pn];
+  if (pi->prev) {
+    pages[pi->prev].next = pi->next;
+  } else {
+    free_area[pi->order] = pi->next;
+  }
+  if (pi->next) {
+    pages[pi->next].prev = pi->prev;
+  }
+  pi->free = false;
+}
+
+// buddy_free(pn, order)
+//    Return the order-`order` block starting at page `pn` to the free
+//    lists, coalescing it with free buddies.
+static void buddy_free(uint32_t pn, int order) {
+  nfree_pages += 1UL << order;
+  while (order < PAGE_MAXORDER) {
+    uint32_t buddy = pn ^ (1U << order);
+    if (buddy >= npages || !pages[buddy].free || pages[buddy].order != order) {
+      break;
+    }
+    free_area_remove(buddy);
+    pn &= ~(1U << order);
+    ++order;
+  }
+  free_area_push(pn, order);
+}
+
+// buddy_alloc(order)
+//    Allocate an order-`order` block, splitting a larger block if
+//    needed. Returns its first page number, or 0 if none is free.
+static uint32_t buddy_alloc(int order) {
+  int k = order;
+  while (k < PAGE_NORDERS && !free_area[k]) {
+    ++k;
+  }
+  if (k == PAGE_NORDERS) {
+    return 0;
+  }
+
+  uint32_t pn = free_area[k];
+  free_area_remove(pn);
+  // give back the upper half at each level
+  while (k > order) {
+    --k;
+    free_area_push(pn + (1U << k), k);
+  }
+  pages[pn].order = order;
+  nfree_pages -= 1UL << order;
+  return pn;
+}
+
+// init_free_pages()
+//    Free every allocatable, unused physical page except the boot page
+//    table into the buddy allocator. Pages are freed from the top down so
+//    the lowest blocks end up at the heads of the free lists: page tables
+//    allocated before `kernel_pagetable` is loaded must lie in the first
+//    GiB, the only memory the boot page table maps.
+static void init_free_pages() {
+  for (uintptr_t pa = memsize_physical; pa > 0;) {
+    pa -= PAGESIZE;
+    if (allocatable_physical_address(pa) &&
+        !pageinfo_used(&pages[pa / PAGESIZE]) &&
+        (pa < BOOT_PAGETABLE_START || pa >= BOOT_PAGETABLE_END)) {
+      buddy_free(pa / PAGESIZE, 0);
+    }
+  }
+}
+
+// Pre-zeroed pages
+//    `zero_pool` is a stack of up to ZERO_POOL_MAX free pages that are
+//    already filled with zeroes. `zero_pool_refill` tops it up when the
+//    kernel is idle, so `kalloc_zeroed(PAGESIZE)` (page tables, fresh
+//    process pages) does not pay for the clear on the allocation path.
+//    Pool pages have refcount 0 but are off the buddy free lists; `kalloc`
+//    falls back on them when the buddy allocator runs dry.
+
+#define ZERO_POOL_MAX 64
+
+static uint32_t zero_pool[ZERO_POOL_MAX];
+static int zero_pool_count;
+
+// zero_pool_refill()
+//    Zero one free page into the pool. Returns false if the pool is full
+//    or no memory is free.
+bool zero_pool_refill() {
+  if (zero_pool_count == ZERO_POOL_MAX) {
+    return false;
+  }
+  uint32_t pn = buddy_alloc(0);
+  if (!pn) {
+    return false;
+  }
+  // bypass the cache: pool pages may sit unused for a long time
+  memzero_nt((void *)((uintptr_t)pn * PAGESIZE), PAGESIZE);
+  zero_pool[zero_pool_count++] = pn;
+  return true;
+}
+
+static void *kalloc_claim(uint32_t pn, int order) {
+  for (uint32_t i = 0; i < (1U << order); ++i) {
+    pages[pn + i].refcount = 1;
+    pages[pn + i].merged = false;
+  }
+  return (void *)((uintptr_t)pn * PAGESIZE);
 }
 
 // kalloc(sz)
 //    Kernel memory allocator. Allocates `sz` contiguous bytes and
 //    returns a pointer to the allocated memory, or `nullptr` on failure.
 //
-//    The returned memory is initialized to 0xCC, which corresponds to
-//    the x86 instruction `int3` (this may help you debug). You'll
-//    probably want to reset it to something more useful.
+//    The returned memory is not initialized. In kernels built with
+//    `POISON=1` it is filled with 0xCC, which corresponds to the x86
+//    instruction `int3` (this may help you debug).
 //
-//    Currently, `kalloc` is a page-based allocator: if `sz > PAGESIZE`
-//    the allocation fails; if `sz < PAGESIZE` it allocates a whole page
-//    anyway.
-//
-//    The handout code returns the next allocatable free page it can find.
-//    It never reuses pages or supports freeing memory (you'll change that).
-
-static uintptr_t next_alloc_pa;
+//    `kalloc` is a page-based allocator: `sz` is rounded up to a
+//    power-of-two number of pages (at most 2^PAGE_MAXORDER), and the
+//    block is physically contiguous and aligned to its size.
 
 void *kalloc(size_t sz) {
-  if (sz > PAGESIZE) {
-    return NULL;
+  int order = 0;
+  while ((PAGESIZE << order) < sz) {
+    if (++order > PAGE_MAXORDER) {
+      return NULL;
+    }
   }
 
-  uintptr_t counter = 0;
-  while (next_alloc_pa < MEMSIZE_PHYSICAL) {
-    uintptr_t pa = next_alloc_pa;
-    next_alloc_pa += PAGESIZE;
-    counter += PAGESIZE;
+  uint32_t pn = buddy_alloc(order);
+  if (!pn && order == 0 && zero_pool_count > 0) {
+    pn = zero_pool[--zero_pool_count];
+  }
+  if (!pn) {
+    return NULL;
+  }
+  void *ptr = kalloc_claim(pn, order);
+#ifdef KALLOC_POISON
+  memset(ptr, 0xCC, PAGESIZE << order);
+#endif
+  return ptr;
+}
 
-    if (allocatable_physical_address(pa) &&
-        !pageinfo_used(&pages[pa / PAGESIZE])) {
-      pages[pa / PAGESIZE].refcount++;
-      memset((void *)pa, 0xCC, PAGESIZE);
-      return (void *)pa;
-    }
+// kalloc_zeroed(sz)
+//    Like `kalloc`, but the memory is filled with zeroes. Single pages
+//    come from the pre-zeroed pool when it is not empty.
 
-    if (next_alloc_pa == MEMSIZE_PHYSICAL) {
-      next_alloc_pa = PAGESIZE;
-    }
-    if (counter > MEMSIZE_PHYSICAL + PAGESIZE)
-      return NULL;
+void *kalloc_zeroed(size_t sz) {
+  if (sz <= PAGESIZE && zero_pool_count > 0) {
+    return kalloc_claim(zero_pool[--zero_pool_count], 0);
   }
-  return NULL;
+  void *ptr = kalloc(sz);
+  if (ptr) {
+    memset(ptr, 0, sz <= PAGESIZE ? PAGESIZE : sz);
+  }
+  return ptr;
 }
 
 // kfree(kptr)
 //    Free `kptr`, which must have been previously returned by `kalloc`.
-//    If `kptr == nullptr` does nothing.
+//    If `kptr == nullptr` does nothing. The whole block returns to the
+//    allocator when its first page's last reference is dropped.
 void kfree(void *kptr) {
   // assert((uintptr_t)kptr % PAGESIZE == 0);
   // assert((uintptr_t)kptr < MEMSIZE_VIRTUAL);
-  // assert((uintptr_t)kptr != 0);
   // assert(pages[(size_t)kptr / PAGESIZE].refcount > 0);
+  if (!kptr || kptr == zero_frame) {
+    return;
+  }
 
-  pages[(size_t)kptr / PAGESIZE].refcount--;
-  next_alloc_pa = 0;
+  uint32_t pn = (uintptr_t)kptr / PAGESIZE;
+  if (--pages[pn].refcount == 0) {
+    if (pages[pn].swapslot) {
+      swap_forget(pn);
+    }
+    int order = pages[pn].order;
+    for (uint32_t i = 1; i < (1U << order); ++i) {
+      pages[pn + i].refcount = 0;
+    }
+    buddy_free(pn, order);
+  }
 }
 
+size_t kalloc_nfree() { return nfree_pages + zero_pool_count; }
+
 // VGA color attributes
 enum vga_color {
   COLOR_BLACK = 0,
@@ -184,11 +432,13 @@ void vga_print(const char *str, uint8_t color) {
   static size_t index = 0;
   for (size_t i = 0; str[i] != '\0'; i++) {
     if (index >= VGA_WIDTH * VGA_HEIGHT) {
-      // If we reach the end of the screen, reset the index (simple scroll
-      // simulation)
-      // TODO: instead of wrapping to beginning, shift text up like a normal
-      // terminal
-      index = 0;
+      // scroll up one line
+      memmove(VGA_BUFFER, VGA_BUFFER + VGA_WIDTH,
+              VGA_WIDTH * (VGA_HEIGHT - 1) * sizeof(uint16_t));
+      index = VGA_WIDTH * (VGA_HEIGHT - 1);
+      for (int x = 0; x < VGA_WIDTH; ++x) {
+        VGA_BUFFER[index + x] = vga_entry(' ', color);
+      }
     }
     char c = str[i];
     if (c == '\n') {
@@ -213,26 +463,506 @@ static void set_gate(x86_64_gatedescriptor *gate, uintptr_t addr, int type,
   gate->gd_high = addr >> 32;
 }
 
+// Process-context identifiers
+//    With CR4_PCIDE, TLB entries are tagged with the PCID in the low bits
+//    of %cr3, and a %cr3 load with CR3_NOFLUSH keeps every PCID's entries.
+//    PCID 0 is the kernel's. Each CPU hands out PCIDs from its own
+//    counter, and a process's PCID is valid only on the CPU and in the
+//    generation it was assigned in. A PCID is never reused within a
+//    generation, so its first load needs no flush; when a CPU's counter
+//    runs out, it starts a new generation and flushes all its
+//    PCID-tagged entries at once. A process that moves to another CPU
+//    gets a fresh PCID there, so no CPU ever flushes another's TLB.
+#define PCID_COUNT 4096
+
+static bool pcid_enabled;
+static bool invpcid_supported;
+
+static void init_pcid() {
+  if (!(cpuid(1).ecx & (1U << 17))) {
+    return;
+  }
+  wrcr4(rdcr4() | CR4_PCIDE);
+  pcid_enabled = true;
+  invpcid_supported =
+      cpuid(0).eax >= 7 && (cpuid_subleaf(7, 0).ebx & (1U << 10));
+}
+
+// pcid_flush_all()
+//    Flush non-global TLB entries for every PCID.
+static void pcid_flush_all() {
+  if (invpcid_supported) {
+    struct {
+      uint64_t pcid;
+      uint64_t addr;
+    } desc = {0, 0};
+    asm volatile("invpcid %0, %1" : : "m"(desc), "r"(3UL) : "memory");
+  } else {
+    // toggling CR4_PGE flushes everything, global entries included
+    uint64_t cr4 = rdcr4();
+    wrcr4(cr4 & ~CR4_PGE);
+    wrcr4(cr4);
+  }
+}
+
+void proc_load_pagetable(proc *p) {
+  uintptr_t cr3 = (uintptr_t)p->pagetable;
+  if (pcid_enabled) {
+    cpustate *c = this_cpu();
+    if (p->pcid_generation != c->pcid_generation ||
+        p->pcid_cpu != c->index) {
+      if (c->pcid_next == PCID_COUNT) {
+        ++c->pcid_generation;
+        c->pcid_next = 1;
+        pcid_flush_all();
+      }
+      p->pcid = c->pcid_next++;
+      p->pcid_generation = c->pcid_generation;
+      p->pcid_cpu = c->index;
+    }
+    cr3 |= p->pcid | CR3_NOFLUSH;
+  }
+  wrcr3(cr3);
+  this_cpu()->pagetable = p->pagetable;
+}
+
+void proc_tlb_invalidate(proc *p) {
+  // the old PCID is never used again before the next generation's flush
+  p->pcid_generation = 0;
+}
+
+bool proc_claim(proc *p) {
+  return p == current || spinlock_try_acquire(&p->cpu_lock);
+}
+
+void proc_unclaim(proc *p) {
+  if (p != current) {
+    spinlock_release(&p->cpu_lock);
+  }
+}
+
+// Page-fault statistics: handled faults of each kind and their total
+// cost in TSC cycles, from entry to `kernel_exception`'s fault case
+typedef struct pfstat {
+  const char *name;
+  uint64_t count;
+  uint64_t cycles;
+  uint64_t reported; // `count` at the last `pagefault_report`
+} pfstat;
+static pfstat pfstat_demand = {.name = "demand"};
+static pfstat pfstat_cow = {.name = "cow"};
+static pfstat pfstat_swap = {.name = "swap"};
+
+static void pfstat_add(pfstat *st, uint64_t start) {
+  ++st->count;
+  st->cycles += rdtsc() - start;
+}
+
+void pagefault_report() {
+  pfstat *stats[] = {&pfstat_demand, &pfstat_cow, &pfstat_swap};
+  for (int i = 0; i < 3; ++i) {
+    pfstat *st = stats[i];
+    if (st->count && st->count >= 2 * st->reported) {
+      log_printf("pfstat %s %lu faults %lu cycles/fault\n", st->name,
+                 st->count, st->cycles / st->count);
+      st->reported = st->count;
+    }
+  }
+}
+
+int proc_reserve(proc *p, uintptr_t start, uintptr_t end, int perm) {
+  if (((start | end) & PAGEOFFMASK) || start < PROC_START_ADDR ||
+      end > VA_LOWEND || start >= end) {
+    return -1;
+  }
+  perm |= PTE_P | PTE_U;
+  // regions never overlap, so `demand_fault` finds the only one for `va`
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    vmregion *r = &p->regions[i];
+    if (r->start < end && start < r->end) {
+      bool covered = !r->shm && r->perm == perm && r->start <= start &&
+                     end <= r->end;
+      return covered ? 0 : -1;
+    }
+  }
+  vmregion *slot = NULL;
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    vmregion *r = &p->regions[i];
+    if (r->start == r->end) {
+      slot = slot ? slot : r;
+    } else if (!r->shm && r->perm == perm &&
+               (r->end == start || r->start == end)) {
+      // extend an adjacent region
+      r->start = r->start < start ? r->start : start;
+      r->end = r->end > end ? r->end : end;
+      return 0;
+    }
+  }
+  if (!slot) {
+    return -1;
+  }
+  slot->start = start;
+  slot->end = end;
+  slot->perm = perm;
+  slot->shm = 0;
+  return 0;
+}
+
+void *proc_page_alloc(bool zeroed) {
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    void *page = zeroed ? kalloc_zeroed(PAGESIZE) : kalloc(PAGESIZE);
+    if (page || swap_reclaim(1) == 0) {
+      return page;
+    }
+  }
+  return NULL;
+}
+
+// demand_fault(p, va, err)
+//    Resolve a fault on unmapped address `va` in a region reserved by
+//    process `p` by mapping a fresh zero page, or `zero_frame` (copy-on-
+//    write) for a read. Returns false if `va` is outside `p`'s regions,
+//    the access is not allowed (error code `err`), the page is swapped
+//    out, or no memory is free.
+static bool demand_fault(proc *p, uintptr_t va, uint64_t err) {
+  vmregion *r = NULL;
+  for (int i = 0; i < PROC_NREGIONS && !r; ++i) {
+    if (va >= p->regions[i].start && va < p->regions[i].end) {
+      r = &p->regions[i];
+    }
+  }
+  if (!r || r->shm || ((err & PFERR_WRITE) && !(r->perm & PTE_W))) {
+    return false;
+  }
+  vmiter_t it = vmiter_init(p->pagetable);
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+  if (it.level == 0 && (*(it.pep) & PTE_SWAP)) {
+    return false;
+  }
+  void *page = zero_frame;
+  int perm = r->perm & ~PTE_W;
+  if (r->perm & PTE_W) {
+    perm |= PTE_COW;
+  }
+  if (err & PFERR_WRITE) {
+    page = proc_page_alloc(true);
+    perm = r->perm;
+  }
+  if (!page) {
+    return false;
+  }
+  if (vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+    kfree(page);
+    return false;
+  }
+  return true;
+}
+
+// cow_fault(pt, va)
+//    Resolve a write fault at `va` in page table `pt` if it hit a PTE_COW
+//    page: copy the page unless this is its last reference (merged pages
+//    are always copied), then map it writable. Returns false if `va` is
+//    not a copy-on-write page or no memory is free. No TLB flush is
+//    needed: the processor drops its entry for `va` when it raises the
+//    fault.
+static bool cow_fault(x86_64_pagetable *pt, uintptr_t va) {
+  vmiter_t it = vmiter_init(pt);
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+  if (it.level != 0 || !(*(it.pep) & PTE_P) || !(*(it.pep) & PTE_COW)) {
+    return false;
+  }
+  uintptr_t pa = *(it.pep) & PTE_PAMASK;
+  int perm = ((*(it.pep) & PAGEOFFMASK) & ~PTE_COW) | PTE_W;
+  if (pages[pa / PAGESIZE].refcount > 1 || pages[pa / PAGESIZE].merged) {
+    void *copy;
+    if ((void *)pa == zero_frame) {
+      copy = proc_page_alloc(true);
+    } else if ((copy = proc_page_alloc(false))) {
+      memcpy(copy, (void *)pa, PAGESIZE);
+    }
+    if (!copy) {
+      return false;
+    }
+    kfree((void *)pa);
+    pa = (uintptr_t)copy;
+  }
+  *(it.pep) = pa | perm;
+  return true;
+}
+
+bool proc_access(proc *p, uintptr_t va, size_t len, bool write) {
+  if (va < PROC_START_ADDR || va + len > VA_LOWEND || va + len < va) {
+    return false;
+  }
+  // faulting in later pages must not swap out earlier ones
+  swap_pin(p, va, len);
+  uint64_t err = write ? PFERR_WRITE : 0;
+  vmiter_t it = vmiter_init(p->pagetable);
+  for (uintptr_t pg = va & ~PAGEOFFMASK; pg < va + len; pg += PAGESIZE) {
+    vmiter_va_add(&it, pg - vmiter_va(&it));
+    if (!vmiter_present(&it)) {
+      if (!swap_in(p, pg, err) && !demand_fault(p, pg, err)) {
+        return false;
+      }
+      vmiter_va_add(&it, 0);
+    } else if (it.level != 0 || !(*(it.pep) & PTE_U)) {
+      return false;
+    } else if (write && !(*(it.pep) & PTE_W)) {
+      if (!cow_fault(p->pagetable, pg)) {
+        return false;
+      }
+      // no fault was raised, so the read-only entry may still be cached
+      invlpg((void *)pg);
+    }
+    if (write) {
+      // the kernel's writes bypass this entry; keep swap from trusting
+      // an older copy of the page
+      *(it.pep) |= PTE_D;
+    }
+  }
+  return true;
+}
+
+// Timer
+//    Each CPU's LAPIC timer is one-shot, in TSC-deadline mode where the
+//    CPU supports it and counting down otherwise. `run` arms it for the
+//    next tick boundary, so a running process is charged every tick as
+//    with a periodic timer. An idle CPU arms it for its first sleeper, or
+//    stops it, and halts until then or until a wakeup IPI. Since CPUs skip
+//    ticks, `ticks` follows the TSC instead of counting interrupts.
+
+// timer_update()
+//    Bring `ticks` up to date with the TSC. Returns true if this call
+//    advanced it.
+static bool timer_update() {
+  int now = (rdtsc() - tsc_boot) / tsc_per_tick;
+  int old = __atomic_load_n(&ticks, __ATOMIC_RELAXED);
+  while (old < now &&
+         !__atomic_compare_exchange_n(&ticks, &old, now, false,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+  return old < now;
+}
+
+// timer_tsc(tick)
+//    Return the TSC value at which tick `tick` begins.
+static uint64_t timer_tsc(size_t tick) {
+  return tsc_boot + tick * tsc_per_tick;
+}
+
+// timer_arm(deadline)
+//    Make this CPU's timer fire when the TSC reaches `deadline`, or never
+//    if `deadline` is 0.
+static void timer_arm(uint64_t deadline) {
+  cpustate *c = this_cpu();
+  if (deadline == c->timer_deadline) {
+    return;
+  }
+  c->timer_deadline = deadline;
+  if (tsc_deadline_supported) {
+    wrmsr(MSR_IA32_TSC_DEADLINE, deadline);
+    return;
+  }
+  uint32_t count = 0;
+  if (deadline) {
+    uint64_t now = rdtsc();
+    uint64_t d = deadline > now ? deadline - now : 0;
+    uint64_t n = d / tsc_per_tick * lapic_timer_count +
+                 d % tsc_per_tick * lapic_timer_count / tsc_per_tick;
+    // a capped count fires early; the idle loop re-arms
+    count = n > UINT32_MAX ? UINT32_MAX : n ? n : 1;
+  }
+  lapic_write(lapic_get(), APIC_REG_TIMER_INITIAL_COUNT, count);
+}
+
+// timer_arm_tick()
+//    Make sure this CPU's timer fires by the next tick boundary.
+static void timer_arm_tick() {
+  uint64_t next = timer_tsc((rdtsc() - tsc_boot) / tsc_per_tick + 1);
+  uint64_t armed = this_cpu()->timer_deadline;
+  if (!armed || armed > next) {
+    timer_arm(next);
+  }
+}
+
+// kernel_exception(regs)
+//    Exception handler (for interrupts, traps, and faults). An exception
+//    from user mode saves the registers in `current` and ends by running
+//    a process through `exception_return`, so it never returns; the timer
+//    interrupt preempts `current` in favor of the next runnable process.
+//    Interrupts taken in kernel mode (by the idle loop) return to the
+//    interrupted code. Only page faults and fatal exceptions take
+//    `kernel_lock`; timer interrupts touch just this CPU's state and run
+//    queues, apart from the benchmark hooks.
+
 void kernel_exception(regstate *regs) {
-  // TODO: save registers to 'current' process
-  // TODO: maybe some optional logging
+  bool user = (regs->reg_cs & 3) != 0;
+  if (user) {
+    current->regs = *regs;
+    regs = &current->regs;
+  }
 
   switch (regs->reg_intno) {
-  case INT_IRQ: {
-    // TODO: track ticks, handle lapic state
-    // TODO: schedule next process
+  case INT_IRQ + IRQ_TIMER:
+    lapic_ack(lapic_get());
+    this_cpu()->timer_deadline = 0;
+    if (timer_update()) {
+#if defined(SCHEDBENCH) || defined(SCHEDSCALE)
+      spinlock_acquire(&kernel_lock);
+#ifdef SCHEDBENCH
+      sched_benchmark_tick();
+#endif
+#ifdef SCHEDSCALE
+      sched_scale_tick();
+#endif
+      spinlock_release(&kernel_lock);
+#endif
+    }
+    if (sched_tick(user ? current : NULL) && user &&
+        current->state == P_RUNNABLE) {
+      sched_enqueue(current);
+      schedule();
+    }
     break;
-  }
-  case INT_PF: {
-    // TODO: implement page fault logic
+
+  case INT_IRQ + IRQ_WAKEUP:
+    // work was queued for this CPU; `schedule` picks it up
+    lapic_ack(lapic_get());
+    break;
+
+  case INT_IRQ + IRQ_ERROR:
+    lapic_error(lapic_get());
+    lapic_ack(lapic_get());
+    break;
+
+  case INT_IRQ + IRQ_SPURIOUS:
+    // spurious interrupts are not acknowledged
     break;
+
+  case INT_PF: {
+    uint64_t start = rdtsc();
+    uintptr_t addr = rdcr2();
+    uint64_t err = regs->reg_errcode;
+    pfstat *st = NULL;
+    if (current && (err & PFERR_USER)) {
+      spinlock_acquire(&kernel_lock);
+      if (!(err & PFERR_PRESENT) && swap_in(current, addr, err)) {
+        st = &pfstat_swap;
+      } else if (!(err & PFERR_PRESENT) &&
+                 demand_fault(current, addr, err)) {
+        st = &pfstat_demand;
+      } else if ((err & PFERR_WRITE) && (err & PFERR_PRESENT) &&
+                 cow_fault(current->pagetable, addr)) {
+        st = &pfstat_cow;
+      }
+      if (st) {
+        pfstat_add(st, start);
+      }
+      spinlock_release(&kernel_lock);
+    }
+    if (st) {
+      break;
+    }
+    // an unresolved fault is fatal
+    __attribute__((fallthrough));
   }
+
   default:
-    // TODO: unhandled exception, put an error here
+    if (!user) {
+      // no `kernel_lock`: this CPU may hold it already
+      log_printf("kernel exception %u at %p, error %lx\n", regs->reg_intno,
+                 (void *)regs->reg_rip, regs->reg_errcode);
+      for (;;) {
+        asm volatile("cli; hlt");
+      }
+    }
+    spinlock_acquire(&kernel_lock);
+    log_printf("proc %d: exception %u at %p, error %lx\n", current->pid,
+               regs->reg_intno, (void *)regs->reg_rip, regs->reg_errcode);
+    current->state = P_BROKEN;
+    spinlock_release(&kernel_lock);
+    break;
+  }
+
+  if (user) {
+    if (current->state == P_RUNNABLE) {
+      run(current);
+    }
+    schedule();
+  }
+}
+
+// run(p)
+//    Make `p` the current process and resume it. Does not return.
+void run(proc *p) {
+  current = p;
+  timer_arm_tick();
+  if ((rdcr3() & PTE_PAMASK) != (uintptr_t)p->pagetable) {
+    proc_load_pagetable(p);
+  }
+  exception_return(p);
+}
+
+// idle()
+//    Do background work while no process is runnable, with the kernel
+//    page table loaded so exited processes' page tables can be freed:
+//    free dead address spaces, keep the pre-zeroed page pool topped up,
+//    merge identical pages, swap out pages if memory is low, and log
+//    statistics. Then, unless work is queued, halt until the next sleeper
+//    is due or another CPU queues work here. While page tables or the
+//    zero pool still need work, only let pending interrupts in instead.
+static void idle() {
+  current = NULL;
+  if ((rdcr3() & PTE_PAMASK) != (uintptr_t)kernel_pagetable) {
+    wrcr3((uintptr_t)kernel_pagetable);
+    this_cpu()->pagetable = kernel_pagetable;
+  }
+  spinlock_acquire(&kernel_lock);
+  bool busy = pagetable_reap();
+  busy = zero_pool_refill() || busy;
+  merge_scan();
+  swap_balance();
+  pagefault_report();
+  merge_report();
+  swap_report();
+  sched_report();
+  spinlock_release(&kernel_lock);
+
+  size_t wake;
+  if (!sched_idle_enter(&wake)) {
     return;
   }
+  timer_arm(wake ? timer_tsc(wake) : 0);
+  if (busy) {
+    asm volatile("sti; nop; cli" : : : "memory");
+  } else {
+    // `sti` takes effect after `hlt` starts, so an interrupt that is
+    // already pending ends the halt instead of being missed
+    asm volatile("sti; hlt; cli" : : : "memory");
+  }
+  sched_idle_exit();
+}
 
-  // TODO: schedule here in case we fall through case statement
+void schedule() {
+  // leave `current`: other CPUs may now run it or edit its page table
+  if (current) {
+    proc *p = current;
+    current = NULL;
+    spinlock_release(&p->cpu_lock);
+  }
+  for (;;) {
+    proc *p = sched_pick();
+    if (p) {
+      // waits out a `proc_claim` by another CPU; then `p`'s page table
+      // and PCID state are stable until this CPU leaves it
+      spinlock_acquire(&p->cpu_lock);
+      // `p` may have run on another CPU since this one left it, even if
+      // its page table is still loaded here
+      proc_load_pagetable(p);
+      run(p);
+    }
+    idle();
+  }
 }
 
 // syscall(regs)
@@ -242,26 +972,132 @@ void kernel_exception(regstate *regs) {
 //    The return value, if any, is returned to the user process in `%rax`.
 //
 //    Note that hardware interrupts are disabled when the kernel is running.
+//    System calls run under `kernel_lock`, which `syscall_return` drops.
 
 int syscall_page_alloc(uintptr_t addr);
 int syscall_fork();
-int syscall_exit(pid_t pid);
+int syscall_exit();
 int syscall_kill(pid_t pid);
 int syscall_sleep(size_t time);
 
 uintptr_t syscall(regstate *regs) {
+  spinlock_acquire(&kernel_lock);
   // Copy the saved registers into the `current` process descriptor.
-  // TODO: handle multiple cores?
-  // current->regs = *regs;
-  // regs = &current->regs;
+  current->regs = *regs;
+  regs = &current->regs;
 
   // Actually handle the exception.
   switch (regs->reg_rax) {
-    // TODO: implement
+  case SYSCALL_FORK:
+    return syscall_fork();
+  case SYSCALL_PAGE_ALLOC:
+    return syscall_page_alloc(regs->reg_rdi);
+  case SYSCALL_SHM_CREATE:
+    return shm_create(current, regs->reg_rdi);
+  case SYSCALL_SHM_MAP:
+    return shm_map(current, regs->reg_rdi, regs->reg_rsi);
+  case SYSCALL_SHM_UNMAP:
+    return shm_unmap(current, regs->reg_rdi);
+  case SYSCALL_PIPE:
+    return pipe_create();
+  case SYSCALL_PIPE_READ:
+    return pipe_read(current, regs->reg_rdi, regs->reg_rsi, regs->reg_rdx);
+  case SYSCALL_PIPE_WRITE:
+    return pipe_write(current, regs->reg_rdi, regs->reg_rsi, regs->reg_rdx);
+  case SYSCALL_PIPE_CLOSE:
+    return pipe_close(regs->reg_rdi, regs->reg_rsi);
+  case SYSCALL_SLEEP:
+    return syscall_sleep(regs->reg_rdi);
+  case SYSCALL_EXIT:
+    return syscall_exit();
+    // TODO: implement the rest
   }
   return 0;
 }
 
+// syscall_return(rax)
+//    Return `rax` from a system call to `current`, or run another process
+//    if `current` blocked. Called by `syscall_entry`; does not return.
+void syscall_return(uintptr_t rax) {
+  current->regs.reg_rax = rax;
+  bool runnable = current->state == P_RUNNABLE;
+  spinlock_release(&kernel_lock);
+  if (runnable) {
+    run(current);
+  }
+  schedule();
+}
+
+// syscall_page_alloc(addr)
+//    Make the page at `addr` usable by `current`. The page is reserved
+//    rather than allocated: the first access maps a zero page.
+int syscall_page_alloc(uintptr_t addr) {
+  return proc_reserve(current, addr, addr + PAGESIZE, PTE_P | PTE_W | PTE_U);
+}
+
+// syscall_sleep(time)
+//    Block `current` for `time` milliseconds, rounded up to whole ticks.
+//    A sleep of 0 yields the CPU to other processes at its level.
+int syscall_sleep(size_t time) {
+  size_t nticks = (time * HZ + 999) / 1000;
+  timer_update();
+  // once queued, `current` may be resumed by another CPU at once
+  current->regs.reg_rax = 0;
+  if (nticks == 0) {
+    sched_enqueue(current);
+  } else {
+    sched_sleep(current, nticks);
+  }
+  spinlock_release(&kernel_lock);
+  schedule();
+}
+
+// syscall_exit()
+//    End `current` and free its slot. Its page table, which this CPU
+//    still has loaded, is freed later from the idle loop.
+int syscall_exit() {
+  proc *p = current;
+  shm_release(p);
+  pagetable_free_deferred(p->pagetable);
+  p->pagetable = NULL;
+  // a process that reuses the slot must not reuse `p`'s TLB entries
+  proc_tlb_invalidate(p);
+  p->state = P_FREE;
+  spinlock_release(&kernel_lock);
+  schedule();
+}
+
+// syscall_fork()
+//    Create a child of `current` that shares its memory copy-on-write.
+//    Returns the child's pid to the parent, 0 to the child, or -1 if no
+//    process slot or memory is free.
+int syscall_fork() {
+  pid_t pid = 1;
+  while (pid < NPROC && ptable[pid].state != P_FREE) {
+    ++pid;
+  }
+  if (pid == NPROC) {
+    return -1;
+  }
+  x86_64_pagetable *pt = pagetable_copy(current->pagetable, true);
+  if (!pt) {
+    return -1;
+  }
+  // the parent's pages are now read-only; drop its writable TLB entries
+  // (the kernel's global entries stay)
+  wrcr3(rdcr3());
+  proc *p = &ptable[pid];
+  p->pid = pid;
+  p->pagetable = pt;
+  p->regs = current->regs;
+  p->regs.reg_rax = 0;
+  memcpy(p->regions, current->regions, sizeof(p->regions));
+  shm_fork(p);
+  sched_init_proc(p);
+  sched_enqueue(p);
+  return pid;
+}
+
 // init_kernel_memory
 //    Set up early-stage segment registers and kernel page table.
 //
@@ -288,12 +1124,47 @@ static void set_sys_segment(uint64_t *segment, uintptr_t addr, size_t size,
   segment[1] = addr >> 32;
 }
 
-x86_64_pagetable kernel_pagetable[5];
-uint64_t kernel_gdt_segments[7];
-static x86_64_taskstate kernel_taskstate;
+x86_64_pagetable kernel_pagetable[4];
+uint64_t kernel_gdt_segments[7]; // template for each CPU's GDT
+
+// direct_map(start, end, perm, maxlevel)
+//    Identity-map the page-aligned physical range [start, end) in
+//    `kernel_pagetable` with permissions `perm`. Each step uses the
+//    largest page that is aligned and fits: 1 GiB (if `maxlevel == 2`),
+//    2 MiB, or 4 KiB, so small pages only appear at the range's edges.
+//    Returns 0, or -1 if a page-table page cannot be allocated.
+static int direct_map(uintptr_t start, uintptr_t end, uint64_t perm,
+                      int maxlevel) {
+  uintptr_t pa = start;
+  while (pa < end) {
+    int level = maxlevel;
+    while (level > 0 &&
+           ((pa & pageoffmask(level)) || end - pa <= pageoffmask(level))) {
+      --level;
+    }
+
+    x86_64_pagetable *pt = kernel_pagetable;
+    for (int l = 3; l > level; --l) {
+      x86_64_pageentry_t *pep = &pt->entry[pageindex(pa, l)];
+      if (!(*pep & PTE_P)) {
+        x86_64_pagetable *npt = kalloc_zeroed(PAGESIZE);
+        if (!npt) {
+          return -1;
+        }
+        *pep = (uintptr_t)npt | PTE_P | PTE_W | PTE_U;
+      }
+      pt = (x86_64_pagetable *)(*pep & PTE_PAMASK);
+    }
+    pt->entry[pageindex(pa, level)] = pa | perm | (level ? PTE_PS : 0);
+    pa += pageoffmask(level) + 1;
+  }
+  return 0;
+}
 
 void init_kernel_memory() {
   // stash_kernel_data(false);
+  init_physical_memory();
+  init_free_pages();
 
   // initialize segments
   kernel_gdt_segments[0] = 0;
@@ -303,16 +1174,15 @@ void init_kernel_memory() {
   set_app_segment(&kernel_gdt_segments[SEGSEL_APP_CODE >> 3],
                   X86SEG_X | X86SEG_L, 3);
   set_app_segment(&kernel_gdt_segments[SEGSEL_APP_DATA >> 3], X86SEG_W, 3);
-  set_sys_segment(&kernel_gdt_segments[SEGSEL_TASKSTATE >> 3],
-                  (uintptr_t)&kernel_taskstate, sizeof(kernel_taskstate),
-                  X86SEG_TSS, 0);
+  // each CPU adds its own task state segment (see `init_cpu_state`)
   x86_64_pseudodescriptor gdt;
   gdt.limit = (sizeof(uint64_t) * 3) - 1;
   gdt.base = (uint64_t)kernel_gdt_segments;
 
   asm volatile("lgdt %0" : : "m"(gdt.limit));
 
-  // initialize kernel page table
+  // initialize kernel page table: static tables cover the first GiB and,
+  // with 4 KiB pages, its first 2 MiB
   memset(kernel_pagetable, 0, sizeof(kernel_pagetable));
   kernel_pagetable[0].entry[0] =
       (x86_64_pageentry_t)&kernel_pagetable[1] | PTE_P | PTE_W | PTE_U;
@@ -320,29 +1190,41 @@ void init_kernel_memory() {
       (x86_64_pageentry_t)&kernel_pagetable[2] | PTE_P | PTE_W | PTE_U;
   kernel_pagetable[2].entry[0] =
       (x86_64_pageentry_t)&kernel_pagetable[3] | PTE_P | PTE_W | PTE_U;
-  kernel_pagetable[2].entry[1] =
-      (x86_64_pageentry_t)&kernel_pagetable[4] | PTE_P | PTE_W | PTE_U;
 
-  // the kernel can access [1GiB,4GiB) of physical memory,
-  // which includes important memory-mapped I/O devices
-  kernel_pagetable[1].entry[1] = (1UL << 30) | PTE_P | PTE_W | PTE_PS;
-  kernel_pagetable[1].entry[2] = (2UL << 30) | PTE_P | PTE_W | PTE_PS;
-  kernel_pagetable[1].entry[3] = (3UL << 30) | PTE_P | PTE_W | PTE_PS;
+  x86_64_cpuid_t ext = cpuid(0x80000000);
+  int maxlevel = 1;
+  if (ext.eax >= 0x80000001 && (cpuid(0x80000001).edx & (1U << 26))) {
+    maxlevel = 2; // 1 GiB pages supported
+  }
 
-  // user-accessible mappings for physical memory,
-  // except that (for debuggability) nullptr is totally inaccessible
-  for (vmiter_t it = vmiter_init(kernel_pagetable);
-       vmiter_va(&it) < MEMSIZE_PHYSICAL;
-       vmiter_va_add(&it, PAGESIZE)) {
-    if (vmiter_va(&it) != 0) {
-      vmiter_map(&it, vmiter_va(&it), PTE_P | PTE_W | PTE_U);
+  // kernel-only mappings for physical memory,
+  // except that (for debuggability) nullptr is totally inaccessible.
+  // Process page tables share these mappings, so they are global: they
+  // survive %cr3 loads, and traps need not switch page tables.
+  // All of [0,4GiB) is mapped, as it includes important memory-mapped
+  // I/O devices; above that, only RAM is.
+  direct_map(PAGESIZE, 4UL << 30, PTE_P | PTE_W | PTE_G, maxlevel);
+  for (int i = 0; i < nram_regions; ++i) {
+    if (ram_regions[i].end > (4UL << 30)) {
+      uintptr_t start = ram_regions[i].start > (4UL << 30)
+                            ? ram_regions[i].start
+                            : (4UL << 30);
+      direct_map(start, ram_regions[i].end, PTE_P | PTE_W | PTE_G,
+                 maxlevel);
     }
   }
 
+  wrcr4(rdcr4() | CR4_PGE);
+  init_pcid();
+
   wrcr3((uintptr_t)kernel_pagetable);
 
   // Now that boot-time structures (pagetable and global descriptor
   // table) have been replaced, we can reuse boot-time memory.
+  for (uintptr_t pa = BOOT_PAGETABLE_START; pa < BOOT_PAGETABLE_END;
+       pa += PAGESIZE) {
+    buddy_free(pa / PAGESIZE, 0);
+  }
 }
 
 // processor state for taking an interrupt
@@ -373,13 +1255,22 @@ void init_interrupts() {
   outb(IO_PIC2 + 1, 0xFF);
 }
 
-void init_cpu_state() {
-  memset(&kernel_taskstate, 0, sizeof(kernel_taskstate));
-  kernel_taskstate.ts_rsp[0] = KERNEL_STACK_TOP;
+void init_cpu_state(int index, uintptr_t stack_top) {
+  cpustate *c = &cpus[index];
+  c->self = c;
+  c->index = index;
+  c->kstack_top = stack_top;
+  c->pcid_next = 1;
+  c->pcid_generation = 1;
+  memset(&c->task, 0, sizeof(c->task));
+  c->task.ts_rsp[0] = stack_top;
+  memcpy(c->gdt_segments, kernel_gdt_segments, sizeof(c->gdt_segments));
+  set_sys_segment(&c->gdt_segments[SEGSEL_TASKSTATE >> 3],
+                  (uintptr_t)&c->task, sizeof(c->task), X86SEG_TSS, 0);
 
   x86_64_pseudodescriptor gdt;
-  gdt.limit = sizeof(kernel_gdt_segments) - 1;
-  gdt.base = (uint64_t)kernel_gdt_segments;
+  gdt.limit = sizeof(c->gdt_segments) - 1;
+  gdt.base = (uint64_t)c->gdt_segments;
 
   x86_64_pseudodescriptor idt;
   idt.limit = sizeof(interrupt_descriptors) - 1;
@@ -391,10 +1282,17 @@ void init_cpu_state() {
                : "m"(gdt.limit), "r"((uint16_t)SEGSEL_TASKSTATE), "m"(idt.limit)
                : "memory", "cc");
 
-  // initialize segments
+  // initialize segments; loading %gs clears its base, so set it after
   asm volatile("movw %%ax, %%fs; movw %%ax, %%gs"
                :
                : "a"((uint16_t)SEGSEL_KERN_DATA));
+  wrmsr(MSR_IA32_GS_BASE, (uintptr_t)c);
+  wrmsr(MSR_IA32_KERNEL_GS_BASE, 0);
+
+  // the boot CPU enabled PCIDs in `init_kernel_memory`
+  if (pcid_enabled) {
+    wrcr4(rdcr4() | CR4_PCIDE);
+  }
 
   // set up control registers
   uint32_t cr0 = rdcr0();
@@ -411,11 +1309,26 @@ void init_cpu_state() {
   // initialize local APIC (interrupt controller)
   lapicstate_t *lapic = lapic_get();
   lapic_enable(lapic, INT_IRQ + IRQ_SPURIOUS);
-
-  // timer is in periodic mode
+  c->lapic_id = lapic_read(lapic, APIC_REG_ID) >> 24;
+
+  // timer is one-shot (see `timer_arm`), calibrated against the PIT;
+  // ticks count from here
+  if (index == 0) {
+    uint64_t tsc;
+    uint32_t count = lapic_timer_calibrate(lapic, &tsc);
+    tsc_per_tick = tsc * 100 / HZ; // calibration takes 10 ms
+    lapic_timer_count = (uint64_t)count * 100 / HZ;
+    tsc_deadline_supported = (cpuid(1).ecx & (1U << 24)) != 0;
+    tsc_boot = rdtsc();
+  }
   lapic->reg[APIC_REG_TIMER_DIVIDE].v = TIMER_DIVIDE_1;
-  lapic->reg[APIC_REG_LVT_TIMER].v = TIMER_PERIODIC | (INT_IRQ + IRQ_TIMER);
-  lapic->reg[APIC_REG_TIMER_INITIAL_COUNT].v = 0;
+  lapic->reg[APIC_REG_LVT_TIMER].v =
+      (tsc_deadline_supported ? TIMER_TSC_DEADLINE : TIMER_ONESHOT) |
+      (INT_IRQ + IRQ_TIMER);
+  // the mode must be set before the first TSC-deadline write
+  asm volatile("mfence" : : : "memory");
+  c->timer_deadline = 0;
+  timer_arm_tick();
 
   // disable logical interrupt lines
   lapic->reg[APIC_REG_LVT_LINT0].v = LVT_MASKED;
@@ -465,10 +1378,468 @@ void print_hex(uint32_t value, uint8_t color) {
   vga_print(buffer, color);
 }
 
+// Fork benchmark (see kernel.h)
+#define FORKBENCH_MAXPAGES 4096
+
+// bench_pagetable(n)
+//    Return a process page table with `n` private zero pages mapped from
+//    PROC_START_ADDR, or `nullptr` if out of memory.
+static x86_64_pagetable *bench_pagetable(size_t n) {
+  x86_64_pagetable *pt = pagetable_new();
+  if (!pt) {
+    return NULL;
+  }
+  vmiter_t it = vmiter_init(pt);
+  vmiter_va_add(&it, PROC_START_ADDR);
+  for (size_t i = 0; i < n; ++i, vmiter_va_add(&it, PAGESIZE)) {
+    void *page = kalloc_zeroed(PAGESIZE);
+    if (!page || vmiter_map(&it, (uintptr_t)page, PTE_PWU) < 0) {
+      kfree(page);
+      pagetable_free(pt);
+      return NULL;
+    }
+  }
+  return pt;
+}
+
+void fork_benchmark() {
+  for (size_t n = 16; n <= FORKBENCH_MAXPAGES; n *= 4) {
+    x86_64_pagetable *pt = bench_pagetable(n);
+    if (!pt) {
+      log_printf("forkbench: out of memory\n");
+      return;
+    }
+
+    for (int cow = 0; cow <= 1; ++cow) {
+      size_t free_before = nfree_pages;
+      uint64_t start = rdtsc();
+      x86_64_pagetable *child = pagetable_copy(pt, cow);
+      uint64_t cycles = rdtsc() - start;
+      if (!child) {
+        log_printf("forkbench: out of memory\n");
+        pagetable_free(pt);
+        return;
+      }
+      log_printf("forkbench %s %lu pages %lu cycles %lu pages used\n",
+                 cow ? "cow" : "eager", n, cycles, free_before - nfree_pages);
+      if (cow) {
+        // cost of the child then writing every page
+        start = rdtsc();
+        for (size_t i = 0; i < n; ++i) {
+          cow_fault(child, PROC_START_ADDR + i * PAGESIZE);
+        }
+        log_printf("forkbench cow-write %lu pages %lu cycles\n", n,
+                   rdtsc() - start);
+      }
+      pagetable_free(child);
+    }
+    pagetable_free(pt);
+  }
+}
+
+// Context-switch benchmark (see kernel.h)
+#define SWITCHBENCH_REPS 1000
+#define SWITCHBENCH_MAXPAGES 1024
+
+void switch_benchmark() {
+  static proc bench[2];
+  bool pcid_supported = pcid_enabled;
+  for (size_t n = 16; n <= SWITCHBENCH_MAXPAGES; n *= 4) {
+    bench[0].pagetable = bench_pagetable(n);
+    bench[1].pagetable = bench_pagetable(n);
+    bool ok = bench[0].pagetable && bench[1].pagetable;
+    if (!ok) {
+      log_printf("switchbench: out of memory\n");
+      n = SWITCHBENCH_MAXPAGES;
+    }
+
+    for (int pcid = 0; ok && pcid <= pcid_supported; ++pcid) {
+      pcid_enabled = pcid;
+      bench[0].pcid_generation = bench[1].pcid_generation = 0;
+      uint64_t start = rdtsc();
+      for (int r = 0; r < SWITCHBENCH_REPS; ++r) {
+        for (int i = 0; i < 2; ++i) {
+          proc_load_pagetable(&bench[i]);
+          const volatile char *p = (const volatile char *)PROC_START_ADDR;
+          for (size_t pg = 0; pg < n; ++pg) {
+            (void)p[pg * PAGESIZE];
+          }
+        }
+      }
+      log_printf("switchbench pcid %d %lu pages %lu cycles/switch\n", pcid,
+                 n, (rdtsc() - start) / (2 * SWITCHBENCH_REPS));
+    }
+
+    pcid_enabled = pcid_supported;
+    wrcr3((uintptr_t)kernel_pagetable);
+    this_cpu()->pagetable = kernel_pagetable;
+    for (int i = 0; i < 2; ++i) {
+      if (bench[i].pagetable) {
+        pagetable_free(bench[i].pagetable);
+      }
+      bench[i].pagetable = NULL;
+    }
+  }
+}
+
+// Trap benchmark (see kernel.h)
+#define TRAPBENCH_REPS 10000
+#define TRAPBENCH_MAXPAGES 64 // [KERNEL_START_ADDR, KERNEL_STACK_TOP)
+
+// touch `n` 4 KiB kernel pages, like a system call's working set
+static void trapbench_touch(int n) {
+  const volatile char *p = (const volatile char *)KERNEL_START_ADDR;
+  for (int i = 0; i < n; ++i) {
+    (void)p[i * PAGESIZE];
+  }
+}
+
+void trap_benchmark() {
+  uintptr_t cr3 = rdcr3();
+  uint64_t cr4 = rdcr4();
+  for (int n = 4; n <= TRAPBENCH_MAXPAGES; n *= 4) {
+    uint64_t start = rdtsc();
+    for (int r = 0; r < TRAPBENCH_REPS; ++r) {
+      trapbench_touch(n);
+    }
+    log_printf("trapbench noreload %d pages %lu cycles\n", n,
+               (rdtsc() - start) / TRAPBENCH_REPS);
+
+    for (int pge = 0; pge <= 1; ++pge) {
+      wrcr4(pge ? cr4 | CR4_PGE : cr4 & ~CR4_PGE);
+      start = rdtsc();
+      for (int r = 0; r < TRAPBENCH_REPS; ++r) {
+        wrcr3(cr3);
+        trapbench_touch(n);
+      }
+      log_printf("trapbench reload pge %d %d pages %lu cycles\n", pge, n,
+                 (rdtsc() - start) / TRAPBENCH_REPS);
+    }
+  }
+  wrcr4(cr4);
+}
+
+// Benchmark processes
+//    The scheduler benchmarks run their processes in user mode. A process
+//    sees only its own pages from PROC_START_ADDR: a copy of the kernel's
+//    `.usertext` functions, a page it shares with the kernel and the
+//    benchmark's other processes, and a stack. Functions in `.usertext`
+//    must therefore reach nothing outside it but that shared page.
+
+#define BENCH_USERTEXT __attribute__((section(".usertext")))
+#define BENCH_TEXT_ADDR PROC_START_ADDR
+#define BENCH_DATA_ADDR (PROC_START_ADDR + PAGESIZE)
+#define BENCH_STACK_ADDR (PROC_START_ADDR + 2 * PAGESIZE)
+
+extern char _usertext_start[], _usertext_end[]; // see `link/kernel.ld`
+
+// bench_sleep(ms)
+//    The `sleep` system call, made from a benchmark process.
+__always_inline void bench_sleep(size_t ms) {
+  uintptr_t rax = SYSCALL_SLEEP;
+  asm volatile("syscall" : "+a"(rax) : "D"(ms) : "rcx", "r11", "memory");
+}
+
+// bench_exit()
+//    The `exit` system call, made from a benchmark process.
+__always_inline __attribute__((noreturn)) void bench_exit() {
+  asm volatile("syscall" : : "a"(SYSCALL_EXIT) : "rcx", "r11", "memory");
+  __builtin_unreachable();
+}
+
+// bench_map(pt, va, page, perm)
+//    Map `page` at `va` in `pt`, or drop the caller's reference to it and
+//    return false if `page` is `nullptr` or the mapping fails.
+static bool bench_map(x86_64_pagetable *pt, uintptr_t va, void *page,
+                      int perm) {
+  vmiter_t it = vmiter_init(pt);
+  vmiter_va_add(&it, va);
+  if (!page || vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+    kfree(page);
+    return false;
+  }
+  return true;
+}
+
+// bench_proc_start(p, fn, data, arg)
+//    Make `p` run `fn(data, arg)` and queue it. `fn` must be in
+//    `.usertext`; `data` is a page the kernel shares with the process,
+//    which `fn` receives at its user address.
+static bool bench_proc_start(proc *p, void *fn, void *data, uintptr_t arg) {
+  // assert(_usertext_end - _usertext_start <= PAGESIZE);
+  p->pagetable = pagetable_new();
+  if (!p->pagetable) {
+    return false;
+  }
+  void *text = kalloc(PAGESIZE);
+  if (text) {
+    memcpy(text, _usertext_start, _usertext_end - _usertext_start);
+  }
+  ++pages[(uintptr_t)data / PAGESIZE].refcount;
+  if (!bench_map(p->pagetable, BENCH_DATA_ADDR, data, PTE_PWU | PTE_SHARED) ||
+      !bench_map(p->pagetable, BENCH_TEXT_ADDR, text, PTE_P | PTE_U) ||
+      !bench_map(p->pagetable, BENCH_STACK_ADDR, kalloc(PAGESIZE),
+                 PTE_PWU)) {
+    pagetable_free(p->pagetable);
+    p->pagetable = NULL;
+    return false;
+  }
+  memset(&p->regs, 0, sizeof(p->regs));
+  p->pid = p - ptable;
+  p->regs.reg_rip = BENCH_TEXT_ADDR + ((char *)fn - _usertext_start);
+  p->regs.reg_rdi = BENCH_DATA_ADDR;
+  p->regs.reg_rsi = arg;
+  // as if called: %rsp + 8 is 16-byte aligned
+  p->regs.reg_rsp = BENCH_STACK_ADDR + PAGESIZE - 8;
+  p->regs.reg_cs = SEGSEL_APP_CODE | 3;
+  p->regs.reg_ss = SEGSEL_APP_DATA | 3;
+  p->regs.reg_rflags = EFLAGS_IF;
+  sched_init_proc(p);
+  sched_enqueue(p);
+  return true;
+}
+
+// Scheduler benchmark (see kernel.h)
+#define SCHEDBENCH_NPROC 4
+#define SCHEDBENCH_TICKS (5 * HZ)
+
+typedef struct schedbench_stat {
+  uint64_t runs;          // times resumed after being preempted
+  uint64_t switch_cycles; // total switch latency
+  uint64_t switch_max;
+  uint64_t wait_max;      // longest time spent preempted
+} schedbench_stat;
+
+// page shared by the kernel and the benchmark processes
+typedef struct schedbench_data {
+  uint64_t last; // latest TSC read by any process
+  uint64_t gap;  // jump between readings that means a preemption
+  int stop;
+  schedbench_stat stats[SCHEDBENCH_NPROC];
+} schedbench_data;
+
+static volatile schedbench_data *schedbench;
+static int schedbench_end; // `ticks` value that ends the run, 0 when over
+
+// schedbench_spin(d, i)
+//    Body of benchmark process `i`. It reads the TSC in a loop; a jump of
+//    more than `d->gap` cycles means it was preempted. The switch latency
+//    is the time since the previous process's last reading: timer
+//    interrupt, scheduling decision, page-table switch, and return to user
+//    mode. Exits once the run ends.
+__attribute__((noreturn)) BENCH_USERTEXT static void
+schedbench_spin(volatile schedbench_data *d, int i) {
+  volatile schedbench_stat *st = &d->stats[i];
+  uint64_t gap = d->gap;
+  uint64_t mine = rdtsc();
+  while (!d->stop) {
+    uint64_t t = rdtsc();
+    if (t - mine > gap) {
+      uint64_t latency = t - d->last;
+      ++st->runs;
+      st->switch_cycles += latency;
+      if (latency > st->switch_max) {
+        st->switch_max = latency;
+      }
+      if (t - mine > st->wait_max) {
+        st->wait_max = t - mine;
+      }
+    }
+    d->last = mine = t;
+  }
+  bench_exit();
+}
+
+void sched_benchmark() {
+  schedbench = kalloc_zeroed(PAGESIZE);
+  if (!schedbench) {
+    log_printf("schedbench: out of memory\n");
+    return;
+  }
+  schedbench->gap = tsc_per_tick / 2;
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+    if (!bench_proc_start(&ptable[i + 1], schedbench_spin, (void *)schedbench, i)) {
+      log_printf("schedbench: out of memory\n");
+      return;
+    }
+  }
+  schedbench_end = ticks + SCHEDBENCH_TICKS;
+  log_printf("schedbench nproc %d hz %d tick %lu cycles\n", SCHEDBENCH_NPROC,
+             HZ, tsc_per_tick);
+}
+
+void sched_benchmark_tick() {
+  if (!schedbench_end || ticks < schedbench_end) {
+    return;
+  }
+  schedbench_end = 0;
+  // processes may still be running on other CPUs, so they are told to
+  // stop rather than freed
+  schedbench->stop = 1;
+  uint64_t runs = 0, switch_cycles = 0, switch_max = 0, wait_max = 0;
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+    volatile schedbench_stat *st = &schedbench->stats[i];
+    log_printf("schedbench proc %d runs %lu switch %lu max %lu wait max "
+               "%lu cycles\n",
+               i + 1, st->runs, st->runs ? st->switch_cycles / st->runs : 0,
+               st->switch_max, st->wait_max);
+    runs += st->runs;
+    switch_cycles += st->switch_cycles;
+    switch_max = st->switch_max > switch_max ? st->switch_max : switch_max;
+    wait_max = st->wait_max > wait_max ? st->wait_max : wait_max;
+  }
+  log_printf("schedbench total runs %lu switch %lu max %lu wait max %lu "
+             "cycles\n",
+             runs, runs ? switch_cycles / runs : 0, switch_max, wait_max);
+}
+
+// Scheduler scaling benchmark (see kernel.h)
+#define SCHEDSCALE_NPROC (NPROC - 1)
+#define SCHEDSCALE_WORK 200000   // loop iterations per job
+#define SCHEDSCALE_WARMUP HZ     // ticks before counting starts
+#define SCHEDSCALE_TICKS (2 * HZ) // ticks counted
+
+// per-process job counters, one cache line each so CPUs do not share
+typedef struct __attribute__((aligned(64))) schedscale_count {
+  uint64_t jobs;
+} schedscale_count;
+
+// page shared by the kernel and the benchmark processes
+typedef struct schedscale_data {
+  schedscale_count counts[SCHEDSCALE_NPROC];
+  uint64_t work; // loop iterations per job
+  int stop;
+} schedscale_data;
+
+static volatile schedscale_data *schedscale;
+static int schedscale_start; // `ticks` value when counting starts
+static int schedscale_end;   // 0 until counting starts and when over
+static uint64_t schedscale_base;
+
+// schedscale_job(d, i)
+//    Body of scaling benchmark process `i`: a stream of short CPU-bound
+//    jobs, each `d->work` iterations followed by a yield. Exits once the
+//    run ends.
+__attribute__((noreturn)) BENCH_USERTEXT static void
+schedscale_job(volatile schedscale_data *d, int i) {
+  volatile schedscale_count *count = &d->counts[i];
+  uint64_t work = d->work;
+  while (!d->stop) {
+    for (volatile uint64_t n = 0; n < work; ++n) {
+    }
+    ++count->jobs;
+    bench_sleep(0);
+  }
+  bench_exit();
+}
+
+static uint64_t schedscale_total() {
+  uint64_t jobs = 0;
+  for (int i = 0; i < SCHEDSCALE_NPROC; ++i) {
+    jobs += schedscale->counts[i].jobs;
+  }
+  return jobs;
+}
+
+void sched_scale_benchmark() {
+  schedscale = kalloc_zeroed(PAGESIZE);
+  if (!schedscale) {
+    log_printf("schedscale: out of memory\n");
+    return;
+  }
+  schedscale->work = SCHEDSCALE_WORK;
+  for (int i = 0; i < SCHEDSCALE_NPROC; ++i) {
+    if (!bench_proc_start(&ptable[i + 1], schedscale_job, (void *)schedscale, i)) {
+      log_printf("schedscale: out of memory\n");
+      return;
+    }
+  }
+  schedscale_start = ticks + SCHEDSCALE_WARMUP;
+}
+
+void sched_scale_tick() {
+  if (!schedscale_start || ticks < schedscale_start) {
+    return;
+  }
+  if (!schedscale_end) {
+    schedscale_base = schedscale_total();
+    schedscale_start = ticks;
+    schedscale_end = ticks + SCHEDSCALE_TICKS;
+  } else if (ticks >= schedscale_end) {
+    uint64_t jobs = schedscale_total() - schedscale_base;
+    int elapsed = ticks - schedscale_start;
+    schedscale->stop = 1;
+    schedscale_start = 0;
+    log_printf("schedscale cpus %d procs %d jobs %lu rate %lu jobs/s\n", ncpu,
+               SCHEDSCALE_NPROC, jobs, jobs * HZ / elapsed);
+    log_printf("schedscale end\n");
+  }
+}
+
+// Boot timeline (see boottime.h)
+static boottime_t boottime;
+// name of the phase that ends at each timestamp
+static const char *const boottime_names[NBOOTTIME] = {
+    "", "stage1", "stage2", "memory", "interrupts", "cpu_state", "vga"};
+
+// boottime_init()
+//    Copy the boot loader's timestamps out of low memory, which the
+//    kernel allocator will reuse.
+static void boottime_init() {
+  uint64_t now = rdtsc();
+  const boottime_t *loader = (const boottime_t *)BOOTTIME_ADDR;
+  if (loader->magic == BOOTTIME_MAGIC) {
+    boottime = *loader;
+  }
+  boottime.magic = BOOTTIME_MAGIC;
+  boottime.tsc[BOOTTIME_KERNEL] = now;
+}
+
+static void boottime_mark(int phase) { boottime.tsc[phase] = rdtsc(); }
+
+// boottime_report()
+//    Log the length of each boot phase in TSC cycles as `bootprof` lines,
+//    which `make boot-profile` collects. Phases whose start was not
+//    recorded (e.g. when booted without our loader) are skipped.
+static void boottime_report() {
+  log_printf("bootprof begin\n");
+  uint64_t first = 0;
+  for (int i = 1; i < NBOOTTIME; ++i) {
+    if (boottime.tsc[i - 1] && boottime.tsc[i]) {
+      log_printf("bootprof phase %s %lu\n", boottime_names[i],
+                 boottime.tsc[i] - boottime.tsc[i - 1]);
+    }
+    if (!first) {
+      first = boottime.tsc[i - 1];
+    }
+  }
+  log_printf("bootprof total %lu\n", boottime.tsc[NBOOTTIME - 1] - first);
+  log_printf("bootprof end\n");
+}
+
 int kernel_main() {
+  boottime_init();
+  mem_init();
   init_kernel_memory();
-  // init_interrupts();
-  // init_cpu_state();
+  merge_init();
+  swap_init();
+  boottime_mark(BOOTTIME_MEMORY);
+  init_interrupts();
+  boottime_mark(BOOTTIME_INTERRUPTS);
+  init_cpu_state(0, KERNEL_STACK_TOP);
+  boottime_mark(BOOTTIME_CPU_STATE);
+#ifdef MEMBENCH
+  mem_benchmark();
+#endif
+#ifdef FORKBENCH
+  fork_benchmark();
+#endif
+#ifdef TRAPBENCH
+  trap_benchmark();
+#endif
+#ifdef SWITCHBENCH
+  switch_benchmark();
+#endif
   // Clear the VGA buffer with black background and light grey text
   clear_vga_buffer(VGA_BUFFER, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
 
@@ -503,8 +1874,19 @@ int kernel_main() {
   char num_cores_str[4];
   itoa(num_cores, num_cores_str, 10);
   vga_print(num_cores_str, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+  boottime_mark(BOOTTIME_VGA);
+  boottime_report();
 
-  // Infinite loop
-  for (;;) {
-  }
+  spinlock_acquire(&kernel_lock);
+  smp_init();
+
+#ifdef SCHEDBENCH
+  sched_benchmark();
+#endif
+#ifdef SCHEDSCALE
+  sched_scale_benchmark();
+#endif
+
+  spinlock_release(&kernel_lock);
+  schedule();
 }
@@ -3,6 +3,7 @@
 
 #include "x86-64.h"
 #include "types.h"
+#include "lib.h"
 
 
 // kernel page table (used for virtual memory)
@@ -16,6 +17,20 @@ extern x86_64_pagetable kernel_pagetable[];
 #define P_BROKEN    3                   // faulted process
 #define P_SLEPT     4                   // sleeping process
 
+// Demand-paged virtual memory region (see `proc_reserve`)
+typedef struct vmregion {
+    uintptr_t start;                    // page-aligned; empty if start == end
+    uintptr_t end;
+    int perm;                           // PTE_* permissions of its pages
+    int shm;                            // shared-memory segment, or 0
+} vmregion;
+#define PROC_NREGIONS 8
+
+// Spinlock (see `spinlock_acquire`)
+typedef struct spinlock {
+    volatile int locked;
+} spinlock;
+
 // Process descriptor type
 typedef struct proc {
     x86_64_pagetable* pagetable;        // process's page table
@@ -25,26 +40,184 @@ typedef struct proc {
     // The first 4 members of `proc` must not change, but you can add more.
     size_t sleep_ts;
     size_t sleep_time;
+    vmregion regions[PROC_NREGIONS];    // e.g. heap and stack growth zones
+    uint16_t pcid;                      // TLB tag (see `proc_load_pagetable`)
+    uint64_t pcid_generation;           // 0 if `pcid` is unassigned
+    int pcid_cpu;                       // CPU whose PCID space `pcid` is in
+    int priority;                       // run-queue level (see sched.c)
+    int quantum;                        // ticks left at that level
+    pid_t next;                         // run-queue, sleep or pipe link
+    int cpu;                            // CPU whose run queue it joins
+    spinlock cpu_lock;                  // see `proc_claim`
+    uint64_t enqueue_tsc;               // when last queued
 } proc;
 // Process table
 #define NPROC 16                // maximum number of processes
 extern proc ptable[NPROC];
 
+#define HZ 100                  // timer interrupt frequency (interrupts/sec)
+extern int ticks;               // timer ticks since boot, following the TSC
+extern uint64_t tsc_per_tick;   // TSC cycles per timer interrupt
+
+// Per-CPU state
+//    The kernel points each CPU's %gs base at its `cpustate`; user mode
+//    runs with its own %gs base, and the entry and exit paths in
+//    exception.S switch with `swapgs`. The first three members are used
+//    by exception.S and must not move.
+#define MAXCPU                  8
+#define CPUSTATE_KSTACK_TOP     8
+#define CPUSTATE_SYSCALL_RSP    16
+typedef struct cpustate {
+    struct cpustate* self;              // %gs:0
+    uintptr_t kstack_top;               // this CPU's kernel stack
+    uintptr_t syscall_rsp;              // user %rsp at `syscall`
+    int index;                          // 0 is the boot CPU
+    int lapic_id;
+    proc* current_proc;                 // running process, or `nullptr`
+    x86_64_pagetable* pagetable;        // loaded in %cr3 (see vmiter.c)
+    uint16_t pcid_next;                 // PCID allocator (see kernel.c)
+    uint64_t pcid_generation;
+    uint64_t timer_deadline;            // armed TSC deadline, or 0
+    x86_64_taskstate task;
+    uint64_t gdt_segments[7];
+} cpustate;
+extern cpustate cpus[MAXCPU];
+extern int ncpu;                        // CPUs started (see `smp_init`)
+
+// this_cpu()
+//    Return the calling CPU's `cpustate`. Kernel code never moves to
+//    another CPU, so the result may be cached.
+static inline cpustate* this_cpu() {
+    cpustate* c;
+    asm("movq %%gs:0, %0" : "=r"(c));
+    return c;
+}
+
+// the process running on this CPU, or `nullptr` when idle
+#define current (this_cpu()->current_proc)
+
+// init_cpu_state(index, stack_top)
+//    Set up CPU `index` (the calling CPU) with its own GDT, task state
+//    segment, and kernel stack ending at `stack_top`: load the descriptor
+//    tables, point %gs at `cpus[index]`, and program the system call
+//    MSRs and the local APIC. The boot CPU calibrates the LAPIC timer;
+//    the others reuse its count.
+void init_cpu_state(int index, uintptr_t stack_top);
+
+// proc_claim(p)
+//    Keep `p` off every other CPU while the caller edits its page table.
+//    Returns false if `p` is running on another CPU, whose TLB and
+//    hardware A/D updates the edit could race with. A CPU holds
+//    `p->cpu_lock` from picking `p` in `schedule` until it leaves `p`, so
+//    a claimed process cannot be picked until `proc_unclaim`. `current`
+//    is always claimable.
+bool proc_claim(proc* p);
+
+// proc_unclaim(p)
+//    Undo a successful `proc_claim(p)`.
+void proc_unclaim(proc* p);
+
+// Spinlocks
+static inline void spinlock_acquire(spinlock* l) {
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+            pause();
+        }
+    }
+}
+
+static inline bool spinlock_try_acquire(spinlock* l) {
+    return !__atomic_load_n(&l->locked, __ATOMIC_RELAXED) &&
+           !__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE);
+}
+
+static inline void spinlock_release(spinlock* l) {
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+}
+
+// Multiprocessor support (smp.c)
+//    `kernel_lock` is the big kernel lock. It covers kernel data other
+//    than the per-CPU state and the run queues (which have their own
+//    locks): system calls, page faults, and the idle loop's background
+//    work hold it. Timer interrupts and scheduling do not, so CPUs
+//    preempt and switch processes in parallel.
+extern spinlock kernel_lock;
+
+// AP_TRAMPOLINE_ADDR
+//    Page below 1 MiB where application processors start, in real mode.
+#define AP_TRAMPOLINE_ADDR      0x7000
+
+// smp_init()
+//    Start the application processors. Each sets itself up with
+//    `init_cpu_state`, then enters `schedule`. Call after the boot CPU's
+//    `init_cpu_state`.
+void smp_init();
+
+// smp_wake(cpu)
+//    Send CPU `cpu` a wakeup IPI, ending its `hlt` in the idle loop.
+void smp_wake(int cpu);
+
+// Physical page metadata
+//    Information about physical page with address `pa` is stored in
+//    `pages[pa / PAGESIZE]`. `refcount` is 0 for free pages; the rest
+//    belongs to the page allocator (see `kalloc`).
+typedef struct pageinfo {
+    uint8_t refcount;
+    uint8_t order;      // log2 of block size in pages (first page of a block)
+    bool free : 1;      // first page of a block on a free list
+    bool slab : 1;      // first page of a `kmalloc` slab
+    bool merged : 1;    // canonical copy of merged pages (see merge.c)
+    uint32_t swapslot;  // swap slot holding a copy of the page, or 0
+    uint32_t next;      // free-list links: page numbers, 0 ends the list
+    uint32_t prev;
+} pageinfo;
+
 // Hardware interrupt numbers
 #define INT_IRQ                 32U
 #define IRQ_TIMER               0
 #define IRQ_KEYBOARD            1
+#define IRQ_WAKEUP              2       // IPI to a halted CPU
 #define IRQ_ERROR               19
 #define IRQ_SPURIOUS            31
 
 // kernel values hard coded
 #define KERNEL_START_ADDR       0x40000
-#define KERNEL_STACK_TOP        0x80000
+#define KERNEL_STACK_TOP        0x80000 // boot CPU's; see `smp_init`
 //
-// Physical memory size
+// Physical memory size, detected at boot from the BIOS E820 map.
+// MEMSIZE_PHYSICAL is the fallback when no map is available; the kernel
+// direct map (one L3 table) covers at most MEMSIZE_MAX.
 #define MEMSIZE_PHYSICAL        0x200000
-// Number of physical pages
-#define NPAGES                  (MEMSIZE_PHYSICAL / PAGESIZE)
+#define MEMSIZE_MAX             (1UL << 39)
+extern uintptr_t memsize_physical;
+// Number of physical pages and their metadata
+extern size_t npages;
+extern pageinfo* pages;
+
+// Process address space
+//    L4 entry 0 ([0, MEMSIZE_MAX)) is the kernel direct map; process page
+//    tables share it by pointing their entry 0 at the kernel's L3 table.
+//    Process memory lives in [PROC_START_ADDR, VA_LOWEND).
+#define PROC_START_ADDR         MEMSIZE_MAX
+
+// Software page-table entry bits
+#define PTE_COW                 PTE_OS1 // read-only copy-on-write page
+#define PTE_SHARED              PTE_OS2 // shared-memory page, never COW
+#define PTE_SWAP                PTE_OS3 // non-present entry for a page in
+                                        // swap; address bits hold the slot
+
+// System call numbers (`%rax` at `syscall`)
+#define SYSCALL_FORK            1
+#define SYSCALL_PAGE_ALLOC      2
+#define SYSCALL_SHM_CREATE      3
+#define SYSCALL_SHM_MAP         4
+#define SYSCALL_SHM_UNMAP       5
+#define SYSCALL_PIPE            6
+#define SYSCALL_PIPE_READ       7
+#define SYSCALL_PIPE_WRITE      8
+#define SYSCALL_PIPE_CLOSE      9
+#define SYSCALL_SLEEP           10
+#define SYSCALL_EXIT            11
 
 // Segment selectors
 #define SEGSEL_BOOT_CODE        0x8             // boot code segment
@@ -57,30 +230,358 @@ extern proc ptable[NPROC];
 // exception_return
 //    Return from an exception to user mode: load the page table
 //    and registers and start the process back up. Defined in k-exception.S.
-void exception_return(proc* p);
+__attribute__((noreturn)) void exception_return(proc* p);
+
+// run(p)
+//    Make `p` the current process, load its page table, and resume it.
+//    Call without `kernel_lock`. Does not return.
+__attribute__((noreturn)) void run(proc* p);
+
+// schedule()
+//    Run the highest-priority queued process (see `sched_pick`), idling
+//    until there is one. Call without `kernel_lock`. Does not return.
+__attribute__((noreturn)) void schedule();
+
+// Run queues (sched.c)
+//    Each CPU has its own run queues, one per priority level; level 0 is
+//    the highest. Processes that use up their quantum sink a level, and
+//    processes that block or sleep rise one when woken. The running
+//    process is not queued. A process is queued on the CPU it last ran on
+//    (`proc::cpu`); idle CPUs steal work, and CPUs periodically rebalance.
+//    The run queues have their own locks and need no `kernel_lock`.
+#define SCHED_NLEVELS           4
+
+// sched_init_proc(p)
+//    Start new process `p` at the top level with a full quantum, on this
+//    CPU.
+void sched_init_proc(proc* p);
+
+// sched_enqueue(p)
+//    Mark `p` runnable and queue it at its level on its CPU.
+void sched_enqueue(proc* p);
+
+// sched_wake(p)
+//    Like `sched_enqueue`, for a process that blocked or slept: it first
+//    rises one level.
+void sched_wake(proc* p);
+
+// sched_pick()
+//    Dequeue and return the highest-priority process queued on this CPU,
+//    or else steal one from the busiest other CPU. Returns `nullptr` if
+//    no process is queued anywhere.
+proc* sched_pick();
+
+// sched_tick(p)
+//    Account a timer tick on this CPU: wake its sleepers that are due,
+//    rebalance now and then, and charge the tick to running process `p`
+//    (if not `nullptr`). Returns true if `p` should be preempted: its
+//    quantum is used up (it is demoted), or a higher-priority process is
+//    waiting on this CPU.
+bool sched_tick(proc* p);
+
+// sched_sleep(p, nticks)
+//    Put `p`, running on this CPU, to sleep for `nticks` ticks.
+void sched_sleep(proc* p, size_t nticks);
+
+// sched_idle_enter(wake)
+//    Mark this CPU idle, so queueing work for it wakes it with
+//    `smp_wake`. Returns false (and leaves it unmarked) if any CPU has
+//    work queued. Otherwise sets `*wake` to the tick when this CPU's
+//    first sleeper is due, or 0 if none is asleep.
+bool sched_idle_enter(size_t* wake);
+
+// sched_idle_exit()
+//    Mark this CPU busy again.
+void sched_idle_exit();
+
+// sched_report()
+//    Log per-level wait times, and the number of processes moved between
+//    CPUs, as `sched` lines when a count has doubled since its last
+//    report.
+void sched_report();
 
 // kalloc(sz)
 //    Kernel memory allocator. Allocates `sz` contiguous bytes and
 //    returns a pointer to the allocated memory, or `nullptr` on failure.
 //
-//    The returned memory is initialized to 0xCC, which corresponds to
-//    the x86 instruction `int3` (this may help you debug). You'll
-//    probably want to reset it to something more useful.
-//
-//    Currently, `kalloc` is a page-based allocator: if `sz > PAGESIZE`
-//    the allocation fails; if `sz < PAGESIZE` it allocates a whole page
-//    anyway.
+//    The returned memory is not initialized. In kernels built with
+//    `POISON=1` it is filled with 0xCC, which corresponds to the x86
+//    instruction `int3` (this may help you debug).
 //
-//    The handout code returns the next allocatable free page it can find.
-//    It never reuses pages or supports freeing memory (you'll change that).
+//    `kalloc` is a page-based buddy allocator: `sz` is rounded up to a
+//    power-of-two number of pages (a whole page if `sz < PAGESIZE`), and
+//    the result is physically contiguous and aligned to its size.
 void *kalloc(size_t sz);
 
+// kalloc_zeroed(sz)
+//    Like `kalloc`, but the returned memory is filled with zeroes. Single
+//    pages usually come from a pool zeroed ahead of time.
+void *kalloc_zeroed(size_t sz);
+
+// zero_pool_refill()
+//    Zero one more page for `kalloc_zeroed`'s pool. Call when idle.
+//    Returns false if the pool is full or memory is exhausted.
+bool zero_pool_refill();
+
 // kfree(kptr)
 //    Free `kptr`, which must have been previously returned by `kalloc`.
 //    If `kptr == nullptr` does nothing.
 void kfree(void *kptr);
 
-void* memset(void *v, int c, size_t n);
+// kalloc_nfree()
+//    Return the number of free pages.
+size_t kalloc_nfree();
+
+// kmalloc(sz)
+//    Small-object allocator. Returns `sz` bytes (16-byte aligned) from a
+//    per-size-class slab cache, or `nullptr` on failure. Requests larger
+//    than KMALLOC_MAX go to `kalloc`. Memory is not initialized.
+#define KMALLOC_MAX             2048
+void *kmalloc(size_t sz);
+
+// kmfree(ptr)
+//    Free `ptr`, which must have been returned by `kmalloc`.
+//    If `ptr == nullptr` does nothing.
+void kmfree(void *ptr);
+
+// pagetable_new()
+//    Return a new, empty process page table that shares the kernel's
+//    direct map, or `nullptr` if out of memory.
+x86_64_pagetable* pagetable_new();
+
+// pagetable_copy(pt, cow)
+//    Return a copy of process page table `pt`, or `nullptr` if out of
+//    memory. If `cow` is false every page is copied. Otherwise pages are
+//    shared: writable pages become read-only PTE_COW pages in both tables
+//    and are copied on the first write fault (see `kernel_exception`).
+x86_64_pagetable* pagetable_copy(x86_64_pagetable* pt, bool cow);
+
+// pagetable_free(pt)
+//    Free process page table `pt` and everything it maps in
+//    [PROC_START_ADDR, VA_LOWEND). Each mapped page loses one reference,
+//    so pages shared with other address spaces survive. `pt` must not be
+//    loaded on any CPU.
+void pagetable_free(x86_64_pagetable* pt);
+
+// pagetable_free_deferred(pt)
+//    Queue `pt` for `pagetable_free` from the idle loop, so exiting
+//    processes do not pay for their teardown. `pt` may still be loaded.
+void pagetable_free_deferred(x86_64_pagetable* pt);
+
+// pagetable_reap()
+//    Free one queued page table that no CPU has loaded any more. Returns
+//    false if the queue is empty.
+bool pagetable_reap();
+
+// proc_reserve(p, start, end, perm)
+//    Let process `p` use the page-aligned range [start, end) with
+//    permissions `perm` without mapping it now. Each page is allocated,
+//    zero-filled, by the page-fault handler on first touch, so a large
+//    reservation costs only the pages actually used. Returns 0 (also if
+//    the range is already reserved with `perm`), or -1 if the range is
+//    invalid, overlaps another region, or `p` has no free region.
+int proc_reserve(proc* p, uintptr_t start, uintptr_t end, int perm);
+
+// proc_page_alloc(zeroed)
+//    Allocate a page for process memory, zero-filled if `zeroed`. If
+//    memory is exhausted, swap out process pages and try again. Returns
+//    `nullptr` if that fails too.
+void* proc_page_alloc(bool zeroed);
+
+// proc_load_pagetable(p)
+//    Load `p`'s page table into %cr3. With PCIDs, entries cached for
+//    other address spaces survive and `p`'s own entries are reused.
+void proc_load_pagetable(proc* p);
+
+// proc_tlb_invalidate(p)
+//    Discard any TLB entries cached for `p`. Call after changing `p`'s
+//    page table while `p` is not running.
+void proc_tlb_invalidate(proc* p);
+
+// proc_access(p, va, len, write)
+//    Prepare [va, va + len) in process `p` for the kernel to read (or,
+//    if `write`, write) directly: the range must be user memory, and
+//    demand-paged and copy-on-write pages in it are materialized now.
+//    `p` must be running on this CPU. Returns false if any page is not
+//    accessible.
+bool proc_access(proc* p, uintptr_t va, size_t len, bool write);
+
+// Shared memory (shm.c)
+//    A segment is a set of zeroed pages that any number of processes can
+//    map, writable, at page-aligned addresses of their choice. Mappings
+//    are recorded as `vmregion`s and survive `fork`. A segment lives until
+//    its last mapping is removed and its creator has unmapped it once or
+//    exited; segments are numbered from 1.
+#define NSHM                    32
+#define SHM_MAXPAGES            1024
+
+// shm_create(p, size)
+//    Create a segment of `size` bytes (rounded up to whole pages), owned
+//    by process `p`. Returns its id, or -1 if `size` is 0 or too large,
+//    or no segment slot or memory is free.
+int shm_create(proc* p, size_t size);
+
+// shm_map(p, id, addr)
+//    Map segment `id` into process `p` at `addr`. Returns 0, or -1 if
+//    `id` or `addr` is invalid, the range is in use, or memory is short.
+int shm_map(proc* p, int id, uintptr_t addr);
+
+// shm_unmap(p, addr)
+//    Remove the segment mapping starting at `addr` from process `p`.
+//    `p` must be running on this CPU. Returns 0, or -1 if there is none
+//    or it cannot be unmapped.
+int shm_unmap(proc* p, uintptr_t addr);
+
+// shm_fork(p)
+//    Count the segment mappings `p` inherited from its parent.
+void shm_fork(proc* p);
+
+// shm_release(p)
+//    Drop `p`'s segment mappings, and its creator references, when `p`
+//    exits. The mapped pages themselves are released by `pagetable_free`.
+void shm_release(proc* p);
+
+// Same-page merging (merge.c)
+//    `zero_frame` is a single all-zero page that is never freed. Reads of
+//    untouched demand-paged memory map it copy-on-write, and `merge_scan`
+//    remaps zero-filled process pages to it. `merge_scan` also replaces
+//    duplicate read-only process pages with one shared copy-on-write
+//    copy. Pages with `merged` set are never made writable in place.
+extern void* zero_frame;
+
+// merge_init()
+//    Allocate `zero_frame`.
+void merge_init();
+
+// merge_scan()
+//    Examine a bounded batch of process pages for merging. Call when idle.
+void merge_scan();
+
+// merge_report()
+//    Log merge statistics as a `merge` line when the number of pages
+//    saved has doubled since the last report.
+void merge_report();
+
+// Swap (swap.c)
+//    When memory runs low, private process pages are written to the swap
+//    area of the boot disk (see bootimg.h) and their page-table entries
+//    become PTE_SWAP entries. Victims are chosen by a clock over the
+//    process page tables using PTE_A. Page faults on PTE_SWAP entries
+//    read the pages back.
+
+// swap_init()
+//    Prepare the disk for swapping.
+void swap_init();
+
+// swap_reclaim(n)
+//    Swap out about `n` pages. Returns the number of pages freed.
+int swap_reclaim(int n);
+
+// swap_balance()
+//    Swap out a batch of pages if free memory is low. Call when idle.
+void swap_balance();
+
+// swap_in(p, va, err)
+//    Resolve a fault with error code `err` at `va` in process `p` if it
+//    hit a PTE_SWAP entry by reading the page back. Returns false if the
+//    entry is not PTE_SWAP, the access is not allowed, or memory is short.
+bool swap_in(proc* p, uintptr_t va, uint64_t err);
+
+// swap_dup(pe)
+//    Count a copy of PTE_SWAP entry `pe` (for `fork`). Returns 0, or -1
+//    if the slot has too many references.
+int swap_dup(x86_64_pageentry_t pe);
+
+// swap_free(pe)
+//    Drop PTE_SWAP entry `pe`'s reference to its slot.
+void swap_free(x86_64_pageentry_t pe);
+
+// swap_forget(pn)
+//    Release the slot cached by physical page `pn`; `kfree` calls this
+//    when the page is freed.
+void swap_forget(uint32_t pn);
+
+// swap_pin(p, va, len)
+//    Keep [va, va + len) in process `p` resident until the next call,
+//    while the kernel accesses it directly (see `proc_access`).
+void swap_pin(proc* p, uintptr_t va, size_t len);
+
+// swap_report()
+//    Log swap statistics as a `swap` line when the number of pages
+//    swapped out has doubled since the last report.
+void swap_report();
+
+// Pipes (pipe.c)
+//    A pipe is a PIPE_SIZE-byte kernel ring buffer with a read end and a
+//    write end, numbered from 1. A reader of an empty pipe or a writer to
+//    a full one blocks (P_BLOCKED) and retries its system call once woken.
+#define NPIPE                   16
+#define PIPE_SIZE               0x10000
+
+// pipe_create()
+//    Returns a new pipe's id, or -1 if no pipe slot or memory is free.
+int pipe_create();
+
+// pipe_read(p, id, buf, n)
+//    Copy up to `n` bytes from pipe `id` to `buf` in process `p`. Returns
+//    the number of bytes read, 0 at end of file (empty with the write end
+//    closed), or -1 on error. Blocks `p` if the pipe is empty.
+long pipe_read(proc* p, int id, uintptr_t buf, size_t n);
+
+// pipe_write(p, id, buf, n)
+//    Copy up to `n` bytes from `buf` in process `p` to pipe `id`. Returns
+//    the number of bytes written, or -1 on error or if the read end is
+//    closed. Blocks `p` if the pipe is full.
+long pipe_write(proc* p, int id, uintptr_t buf, size_t n);
+
+// pipe_close(id, end)
+//    Close the read end (`end == 0`) or write end (`end == 1`) of pipe
+//    `id`, waking processes blocked on the other end. The pipe is freed
+//    once both ends are closed. Returns 0 or -1.
+int pipe_close(int id, int end);
+
+// pagefault_report()
+//    Log the number of handled page faults and their average cost in TSC
+//    cycles, by kind, as `pfstat` lines. Logs only when a count has
+//    doubled since the last report, so it is cheap to call when idle.
+void pagefault_report();
+
+// trap_benchmark()
+//    Measure what trap entry saved by not reloading %cr3: the cost of a
+//    %cr3 load plus refilling the TLB for a small kernel working set,
+//    with and without global pages (CR4_PGE), against touching the
+//    working set alone. Logs `trapbench` lines; build with `TRAPBENCH=1`
+//    to run it at boot.
+void trap_benchmark();
+
+// switch_benchmark()
+//    Time switching between two address spaces that each touch a working
+//    set of several sizes, with and without PCIDs, and log the results
+//    as `switchbench` lines. Build with `SWITCHBENCH=1` to run it at boot.
+void switch_benchmark();
+
+// fork_benchmark()
+//    Time `pagetable_copy` with eager copying and with copy-on-write for
+//    address spaces of several sizes, and log the results as `forkbench`
+//    lines. Build with `FORKBENCH=1` to run it at boot.
+void fork_benchmark();
+
+// sched_benchmark()
+//    Start CPU-bound processes that time their own preemptions, and from
+//    the timer (`sched_benchmark_tick`) log the switch latency and the
+//    longest wait to run as `schedbench` lines after a few seconds. Build
+//    with `SCHEDBENCH=1` to run it at boot.
+void sched_benchmark();
+void sched_benchmark_tick();
+
+// sched_scale_benchmark()
+//    Start NPROC - 1 processes that each run a stream of short CPU-bound
+//    jobs, yielding after each, and from the timer (`sched_scale_tick`)
+//    log the jobs completed per second across all CPUs as a `schedscale`
+//    line. Build with `SCHEDSCALE=1` to run it at boot; `make bench-sched`
+//    runs it with 1 to 8 CPUs.
+void sched_scale_benchmark();
+void sched_scale_tick();
 
 
 #endif // SIGNALOS_KERNEL_H
@@ -22,3 +22,34 @@ void lapic_ack(lapicstate_t* lapic) {
 lapicstate_t* lapic_get() {
     return (lapicstate_t*)lapic_pa;
 }
+
+// PIT channel 2, used as a reference clock for calibration
+#define PIT_FREQ 1193182    // input clock, Hz
+#define PIT_CH2 0x42
+#define PIT_CMD 0x43
+#define PIT_PORTB 0x61      // bit 0: channel 2 gate, bit 5: channel 2 output
+#define PIT_CAL_MS 10
+
+uint32_t lapic_timer_calibrate(lapicstate_t *lapic, uint64_t *tsc) {
+  uint16_t count = PIT_FREQ * PIT_CAL_MS / 1000;
+  // hold the gate low (and the speaker off) while loading the count
+  uint8_t portb = inb(PIT_PORTB) & ~0x03;
+  outb(PIT_PORTB, portb);
+  outb(PIT_CMD, 0xB0); // channel 2, low then high byte, mode 0
+  outb(PIT_CH2, count & 0xFF);
+  outb(PIT_CH2, count >> 8);
+
+  lapic_write(lapic, APIC_REG_LVT_TIMER, LVT_MASKED);
+  lapic_write(lapic, APIC_REG_TIMER_DIVIDE, TIMER_DIVIDE_1);
+  lapic_write(lapic, APIC_REG_TIMER_INITIAL_COUNT, UINT32_MAX);
+  uint64_t start = rdtsc();
+  outb(PIT_PORTB, portb | 0x01); // start counting
+  while (!(inb(PIT_PORTB) & 0x20)) {
+  }
+  uint32_t elapsed =
+      UINT32_MAX - lapic_read(lapic, APIC_REG_TIMER_CURRENT_COUNT);
+  *tsc = rdtsc() - start;
+  lapic_write(lapic, APIC_REG_TIMER_INITIAL_COUNT, 0);
+  outb(PIT_PORTB, portb);
+  return elapsed;
+}
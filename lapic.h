@@ -42,7 +42,12 @@ enum ipi_delivery {
 };
 
 // Timer settings
-enum timer_settings { TIMER_DIVIDE_1 = 0x0B, TIMER_PERIODIC = 0x20000 };
+enum timer_settings {
+  TIMER_DIVIDE_1 = 0x0B,
+  TIMER_ONESHOT = 0,
+  TIMER_PERIODIC = 0x20000,
+  TIMER_TSC_DEADLINE = 0x40000
+};
 
 // LVT settings
 enum lvt_settings { LVT_MASKED = 0x10000 };
@@ -68,6 +73,12 @@ uint32_t lapic_error(lapicstate_t* lapic);
 
 void lapic_ack(lapicstate_t* lapic);
 
+// lapic_timer_calibrate(lapic, tsc)
+//      Time a 10 ms interval on the PIT. Returns the number of
+//      LAPIC timer counts at divide-by-1 in the interval, and sets `*tsc`
+//      to the number of TSC cycles. Leaves the timer stopped and masked.
+uint32_t lapic_timer_calibrate(lapicstate_t* lapic, uint64_t* tsc);
+
 // lapic_get
 //      Get the CPUs APIC device
 lapicstate_t* lapic_get();
@@ -0,0 +1,184 @@
+#include "kernel.h"
+#include "log.h"
+
+// Memory primitives (see lib.h)
+//    Every variant works on any x86-64 CPU; `mem_init` only changes which
+//    one the public functions use. With ERMS, `rep stosb`/`rep movsb`
+//    handle any size and alignment at least as well as the quadword forms.
+//    Without FSRM, though, `rep movsb` has a high startup cost, so short
+//    copies stay on `rep movsq`.
+
+#define MEM_MOVSB_MIN 128 // smallest copy sent to `rep movsb` without FSRM
+
+static bool mem_erms;
+static bool mem_fsrm;
+
+void mem_init() {
+  if (cpuid(0).eax >= 7) {
+    x86_64_cpuid_t leaf7 = cpuid_subleaf(7, 0);
+    mem_erms = (leaf7.ebx >> 9) & 1;
+    mem_fsrm = (leaf7.edx >> 4) & 1;
+  }
+}
+
+static void memset_bytes(void *v, int c, size_t n) {
+  for (char *p = (char *)v; n > 0; ++p, --n) {
+    *p = c;
+  }
+}
+
+static void memset_stosq(void *v, int c, size_t n) {
+  uint64_t pattern = (uint8_t)c * 0x0101010101010101UL;
+  size_t nq = n / 8, nb = n % 8;
+  asm volatile("rep stosq" : "+D"(v), "+c"(nq) : "a"(pattern) : "memory");
+  asm volatile("rep stosb" : "+D"(v), "+c"(nb) : "a"(pattern) : "memory");
+}
+
+static void memset_stosb(void *v, int c, size_t n) {
+  asm volatile("rep stosb" : "+D"(v), "+c"(n) : "a"(c) : "memory");
+}
+
+static void memcpy_bytes(void *dst, const void *src, size_t n) {
+  char *d = (char *)dst;
+  const char *s = (const char *)src;
+  for (; n > 0; --n) {
+    *d++ = *s++;
+  }
+}
+
+static void memcpy_movsq(void *dst, const void *src, size_t n) {
+  size_t nq = n / 8, nb = n % 8;
+  asm volatile("rep movsq" : "+D"(dst), "+S"(src), "+c"(nq) : : "memory");
+  asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(nb) : : "memory");
+}
+
+static void memcpy_movsb(void *dst, const void *src, size_t n) {
+  asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(n) : : "memory");
+}
+
+void *memset(void *v, int c, size_t n) {
+  if (mem_erms) {
+    memset_stosb(v, c, n);
+  } else {
+    memset_stosq(v, c, n);
+  }
+  return v;
+}
+
+void *memcpy(void *dst, const void *src, size_t n) {
+  if (mem_fsrm || (mem_erms && n >= MEM_MOVSB_MIN)) {
+    memcpy_movsb(dst, src, n);
+  } else {
+    memcpy_movsq(dst, src, n);
+  }
+  return dst;
+}
+
+// memmove(dst, src, n)
+//    A forward copy is safe unless `dst` lies inside `[src, src + n)`.
+//    Otherwise copy backward with the direction flag set: quadwords from
+//    the end, then the leftover bytes at the start.
+void *memmove(void *dst, const void *src, size_t n) {
+  if ((uintptr_t)dst - (uintptr_t)src >= n) {
+    return memcpy(dst, src, n);
+  }
+  size_t nq = n / 8, nb = n % 8;
+  char *d = (char *)dst + n - 8;
+  const char *s = (const char *)src + n - 8;
+  asm volatile("std; rep movsq"
+               : "+D"(d), "+S"(s), "+c"(nq)
+               :
+               : "memory");
+  d += 7;
+  s += 7;
+  asm volatile("rep movsb; cld"
+               : "+D"(d), "+S"(s), "+c"(nb)
+               :
+               : "memory");
+  return dst;
+}
+
+int memcmp(const void *a, const void *b, size_t n) {
+  const uint64_t *qa = (const uint64_t *)a, *qb = (const uint64_t *)b;
+  for (; n >= 8 && *qa == *qb; n -= 8) {
+    ++qa, ++qb;
+  }
+  const uint8_t *ba = (const uint8_t *)qa, *bb = (const uint8_t *)qb;
+  for (; n > 0; --n, ++ba, ++bb) {
+    if (*ba != *bb) {
+      return *ba - *bb;
+    }
+  }
+  return 0;
+}
+
+void memzero_nt(void *v, size_t n) {
+  uint64_t *p = (uint64_t *)v;
+  uint64_t *end = p + n / 8;
+  for (; p < end; ++p) {
+    asm volatile("movnti %1, %0" : "=m"(*p) : "r"(0UL));
+  }
+  // order the weakly-ordered stores before anything that publishes `v`
+  asm volatile("sfence" : : : "memory");
+}
+
+static void memset_nt(void *v, int c, size_t n) { memzero_nt(v, n); }
+
+// Microbenchmark
+typedef struct membench_variant {
+  const char *name;
+  void (*set)(void *, int, size_t);
+  void (*copy)(void *, const void *, size_t);
+} membench_variant;
+
+static const membench_variant membench_variants[] = {
+    {"bytes", memset_bytes, memcpy_bytes},
+    {"stosq/movsq", memset_stosq, memcpy_movsq},
+    {"stosb/movsb", memset_stosb, memcpy_movsb},
+    {"movnti", memset_nt, NULL},
+};
+
+#define MEMBENCH_MAXSIZE (1UL << 20)
+#define MEMBENCH_BYTES (8UL << 20) // bytes moved per variant and size
+
+// membench_time(v, copy, dst, src, n)
+//    Return the average TSC cycles of one call of variant `v` on `n` bytes.
+static uint64_t membench_time(const membench_variant *v, bool copy, void *dst,
+                              void *src, size_t n) {
+  size_t reps = MEMBENCH_BYTES / n;
+  // warm up caches and TLB
+  copy ? v->copy(dst, src, n) : v->set(dst, 0, n);
+  uint64_t start = rdtsc();
+  for (size_t i = 0; i < reps; ++i) {
+    copy ? v->copy(dst, src, n) : v->set(dst, 0, n);
+  }
+  return (rdtsc() - start) / reps;
+}
+
+void mem_benchmark() {
+  void *dst = kalloc(MEMBENCH_MAXSIZE);
+  void *src = kalloc(MEMBENCH_MAXSIZE);
+  if (!dst || !src) {
+    log_printf("membench: out of memory\n");
+    kfree(dst);
+    kfree(src);
+    return;
+  }
+  memset(src, 0x5A, MEMBENCH_MAXSIZE);
+
+  log_printf("membench erms %d fsrm %d\n", mem_erms, mem_fsrm);
+  int nvariants = sizeof(membench_variants) / sizeof(membench_variants[0]);
+  for (size_t n = 64; n <= MEMBENCH_MAXSIZE; n *= 4) {
+    for (int i = 0; i < nvariants; ++i) {
+      const membench_variant *v = &membench_variants[i];
+      log_printf("membench memset %s %lu %lu\n", v->name, n,
+                 membench_time(v, false, dst, src, n));
+      if (v->copy) {
+        log_printf("membench memcpy %s %lu %lu\n", v->name, n,
+                   membench_time(v, true, dst, src, n));
+      }
+    }
+  }
+  kfree(dst);
+  kfree(src);
+}
@@ -0,0 +1,35 @@
+#ifndef SIGNALOS_LIB_H
+#define SIGNALOS_LIB_H
+#include "types.h"
+
+// lib.h
+//
+//   Kernel memory primitives. The kernel is built without SSE, so these
+//   use x86 string instructions; `mem_init` picks the variant that is
+//   fastest on the boot CPU.
+
+void* memset(void* v, int c, size_t n);
+void* memcpy(void* dst, const void* src, size_t n);
+void* memmove(void* dst, const void* src, size_t n);
+int memcmp(const void* a, const void* b, size_t n);
+
+// memzero_nt(v, n)
+//    Zero `n` bytes at `v` with non-temporal stores, which bypass the
+//    cache. For clearing pages that will not be touched soon (e.g. the
+//    pre-zeroed page pool). `v` must be 8-byte aligned and `n` a multiple
+//    of 8.
+void memzero_nt(void* v, size_t n);
+
+// mem_init()
+//    Detect ERMS (fast `rep movsb`/`rep stosb`) and FSRM (fast short
+//    `rep movsb`) with `cpuid`. Until this runs, the primitives use
+//    `rep stosq`/`rep movsq`, which are correct on any x86-64 CPU.
+void mem_init();
+
+// mem_benchmark()
+//    Time each memset and memcpy variant across sizes from 64 bytes to
+//    1 MiB and log the cycle counts as `membench` lines. Build with
+//    `MEMBENCH=1` to run it at boot.
+void mem_benchmark();
+
+#endif // SIGNALOS_LIB_H
@@ -0,0 +1,101 @@
+#include "log.h"
+#include "x86-64.h"
+
+// Parallel port registers
+#define IO_PARALLEL1_DATA 0x378
+#define IO_PARALLEL1_STATUS 0x379
+#define IO_PARALLEL_STATUS_BUSY 0x80
+#define IO_PARALLEL1_CONTROL 0x37A
+#define IO_PARALLEL_CONTROL_SELECT 0x08
+#define IO_PARALLEL_CONTROL_INIT 0x04
+#define IO_PARALLEL_CONTROL_STROBE 0x01
+
+static void log_putc(unsigned char c) {
+  static bool initialized;
+  if (!initialized) {
+    outb(IO_PARALLEL1_CONTROL, 0);
+    initialized = true;
+  }
+
+  // wait (briefly) for the printer to become ready
+  for (int i = 0;
+       i < 12800 && (inb(IO_PARALLEL1_STATUS) & IO_PARALLEL_STATUS_BUSY) == 0;
+       ++i) {
+    pause();
+  }
+  outb(IO_PARALLEL1_DATA, c);
+  outb(IO_PARALLEL1_CONTROL, IO_PARALLEL_CONTROL_SELECT |
+                                 IO_PARALLEL_CONTROL_INIT |
+                                 IO_PARALLEL_CONTROL_STROBE);
+  outb(IO_PARALLEL1_CONTROL,
+       IO_PARALLEL_CONTROL_SELECT | IO_PARALLEL_CONTROL_INIT);
+}
+
+static void log_puts(const char *s) {
+  for (; *s; ++s) {
+    log_putc(*s);
+  }
+}
+
+static void log_putu(uint64_t value, int base) {
+  char buffer[21];
+  char *p = &buffer[sizeof(buffer) - 1];
+  *p = '\0';
+  do {
+    *--p = "0123456789abcdef"[value % base];
+    value /= base;
+  } while (value);
+  log_puts(p);
+}
+
+void log_printf(const char *format, ...) {
+  va_list val;
+  va_start(val, format);
+  for (; *format; ++format) {
+    if (*format != '%') {
+      log_putc(*format);
+      continue;
+    }
+
+    ++format;
+    bool is_long = *format == 'l';
+    if (is_long) {
+      ++format;
+    }
+    switch (*format) {
+    case 's':
+      log_puts(va_arg(val, const char *));
+      break;
+    case 'c':
+      log_putc(va_arg(val, int));
+      break;
+    case 'd': {
+      int64_t v = is_long ? va_arg(val, int64_t) : va_arg(val, int);
+      if (v < 0) {
+        log_putc('-');
+        v = -v;
+      }
+      log_putu(v, 10);
+      break;
+    }
+    case 'u':
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 10);
+      break;
+    case 'x':
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 16);
+      break;
+    case 'p':
+      log_puts("0x");
+      log_putu((uintptr_t)va_arg(val, void *), 16);
+      break;
+    case '%':
+      log_putc('%');
+      break;
+    default:
+      // unknown conversion (or end of string): stop here
+      va_end(val);
+      return;
+    }
+  }
+  va_end(val);
+}
@@ -0,0 +1,16 @@
+#ifndef SIGNALOS_LOG_H
+#define SIGNALOS_LOG_H
+#include "types.h"
+
+// log.h
+//
+//   Kernel log on the first parallel port. QEMU routes it to `log.txt`
+//   (see `LOG` in GNUmakefile).
+
+// log_printf(format, ...)
+//    Print a formatted message to the log. Supports `%s`, `%c`, `%d`,
+//    `%u`, `%x`, `%p` and `%%`; `l` before `d`, `u` or `x` prints a
+//    64-bit value.
+void log_printf(const char* format, ...);
+
+#endif // SIGNALOS_LOG_H
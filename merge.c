@@ -0,0 +1,158 @@
+#include "kernel.h"
+#include "log.h"
+#include "vmiter.h"
+
+// Same-page merging (see kernel.h)
+//    `merge_scan` walks the process page tables a batch at a time. A
+//    private page (not PTE_SHARED) that is all zeroes is remapped to
+//    `zero_frame`. Otherwise, if it is read-only, it is hashed and looked
+//    up in `merge_table`: a page with equal contents there becomes its
+//    canonical copy and the duplicate is freed; failing that, the page
+//    becomes the canonical copy for its hash. Canonical pages are marked
+//    `merged` so that `cow_fault` copies them instead of making them
+//    writable, which keeps them read-only wherever they are mapped.
+//    Remapped pages become PTE_COW if they were writable before.
+//
+//    Table entries are hints: an entry is trusted only while its page is
+//    still `merged`, and contents are compared in full before merging.
+//    The scan runs with no process on this CPU and claims each process
+//    it examines (`proc_claim`), skipping those running elsewhere, so
+//    pages cannot change under it and no CPU holds stale TLB entries.
+
+#define MERGE_TABLE_SIZE 1024
+#define MERGE_BATCH 64 // pages examined per `merge_scan` call
+
+typedef struct merge_entry {
+  uint64_t hash;
+  uint32_t pn; // canonical page, or 0
+} merge_entry;
+
+static merge_entry merge_table[MERGE_TABLE_SIZE];
+
+void *zero_frame;
+
+// scan position
+static pid_t merge_pid = 1;
+static uintptr_t merge_va = PROC_START_ADDR;
+
+// statistics
+static struct {
+  uint64_t scanned; // pages examined
+  uint64_t zero;    // pages remapped to `zero_frame`
+  uint64_t dup;     // duplicate pages remapped to a canonical copy
+  uint64_t reported; // pages saved at the last `merge_report`
+} merge_stats;
+
+void merge_init() {
+  zero_frame = kalloc_zeroed(PAGESIZE);
+  pages[(uintptr_t)zero_frame / PAGESIZE].merged = true;
+}
+
+// merge_hash(page)
+//    FNV-1a over the page's 64-bit words.
+static uint64_t merge_hash(const uint64_t *page) {
+  uint64_t h = 0xCBF29CE484222325UL;
+  for (size_t i = 0; i < PAGESIZE / sizeof(uint64_t); ++i) {
+    h = (h ^ page[i]) * 0x100000001B3UL;
+  }
+  return h;
+}
+
+static bool merge_is_zero(const uint64_t *page) {
+  for (size_t i = 0; i < PAGESIZE / sizeof(uint64_t); ++i) {
+    if (page[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// merge_remap(p, pep, pa)
+//    Point `p`'s leaf entry `pep` at canonical page `pa`, dropping the old
+//    page's reference.
+static void merge_remap(proc *p, x86_64_pageentry_t *pep, uintptr_t pa) {
+  x86_64_pageentry_t pe = *pep;
+  int perm = pe & PAGEOFFMASK;
+  if (perm & PTE_W) {
+    perm = (perm & ~PTE_W) | PTE_COW;
+  }
+  *pep = pa | perm;
+  if ((void *)pa != zero_frame) {
+    ++pages[pa / PAGESIZE].refcount;
+  }
+  kfree((void *)(pe & PTE_PAMASK));
+  proc_tlb_invalidate(p);
+}
+
+// merge_page(p, pep)
+//    Try to merge the page mapped by `p`'s leaf entry `pep`.
+static void merge_page(proc *p, x86_64_pageentry_t *pep) {
+  uintptr_t pa = *pep & PTE_PAMASK;
+  uint32_t pn = pa / PAGESIZE;
+  const uint64_t *data = (const uint64_t *)pa;
+  ++merge_stats.scanned;
+  if (!(*pep & PTE_U) || (*pep & PTE_SHARED) || pages[pn].merged) {
+    return;
+  }
+
+  if (merge_is_zero(data)) {
+    merge_remap(p, pep, (uintptr_t)zero_frame);
+    ++merge_stats.zero;
+    return;
+  }
+  if (*pep & PTE_W) {
+    return;
+  }
+
+  uint64_t hash = merge_hash(data);
+  merge_entry *e = &merge_table[hash % MERGE_TABLE_SIZE];
+  uint32_t cpn = e->pn;
+  if (cpn && e->hash == hash && pages[cpn].merged && pages[cpn].refcount &&
+      pages[cpn].refcount < UINT8_MAX &&
+      memcmp((void *)((uintptr_t)cpn * PAGESIZE), data, PAGESIZE) == 0) {
+    merge_remap(p, pep, (uintptr_t)cpn * PAGESIZE);
+    ++merge_stats.dup;
+  } else if (!cpn || !pages[cpn].merged || !pages[cpn].refcount) {
+    e->hash = hash;
+    e->pn = pn;
+    pages[pn].merged = true;
+  }
+}
+
+void merge_scan() {
+  int budget = MERGE_BATCH;
+  for (int nproc = 0; nproc < NPROC && budget > 0; ++nproc) {
+    proc *p = &ptable[merge_pid];
+    // a process running on another CPU could keep writing through a
+    // stale TLB entry to a page merged away
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+      vmiter_t it = vmiter_init(p->pagetable);
+      for (vmiter_va_add(&it, merge_va); vmiter_va(&it) < VA_LOWEND;
+           vmiter_next(&it)) {
+        if (vmiter_present(&it) && it.level == 0) {
+          if (budget == 0) {
+            // resume here next time
+            merge_va = vmiter_va(&it);
+            proc_unclaim(p);
+            return;
+          }
+          merge_page(p, it.pep);
+          --budget;
+        }
+      }
+      proc_unclaim(p);
+    }
+    merge_pid = merge_pid + 1 < NPROC ? merge_pid + 1 : 1;
+    merge_va = PROC_START_ADDR;
+  }
+}
+
+void merge_report() {
+  uint64_t saved = merge_stats.zero + merge_stats.dup;
+  if (saved && saved >= 2 * merge_stats.reported) {
+    log_printf("merge %lu scanned %lu zero %lu dup %lu KiB saved\n",
+               merge_stats.scanned, merge_stats.zero, merge_stats.dup,
+               saved * (PAGESIZE / 1024));
+    merge_stats.reported = saved;
+  }
+}
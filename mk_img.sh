@@ -1,12 +1,6 @@
 #!/bin/bash
 
-# Create the image file with the bootloader
-dd if=obj/bootsector of=signalos.img bs=512 count=1
-
-# add magic boot bytes
-echo -n -e '\x55\xAA' | dd conv=notrunc of=signalos.img bs=1 seek=510
-
-
-# Append the kernel ELF to the image file
-dd if=obj/kernel of=signalos.img bs=512 seek=1
-
+# Boot sector (with the 0x55AA signature), then the second-stage loader,
+# then the LZ4-compressed kernel image, which mkbootdisk places at
+# KERNEL_START_SECTOR (bootimg.h)
+obj/mkbootdisk obj/bootsector obj/boot2 -z obj/kernel > signalos.img
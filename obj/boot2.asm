@@ -0,0 +1,208 @@
+
+obj/boot2.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000008000 <boot2>:
+// defined in boot.c, resident in the boot sector
+void boot_readsects(uintptr_t dst, uint32_t src_sect, uint32_t nsect);
+
+// boot2
+// 	Load the kernel and jump to it.
+__section(".text.entry") __attribute__((noreturn)) void boot2() {
+    8000:	41 54                	push   %r12
+    8002:	55                   	push   %rbp
+    8003:	53                   	push   %rbx
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) x), "d" (x >> 32));
+}
+
+__always_inline uint64_t rdtsc() {
+    uint64_t low, high;
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+    8004:	0f 31                	rdtsc
+    return low | (high << 32);
+    8006:	48 c1 e2 20          	shl    $0x20,%rdx
+  BOOTTIME->tsc[BOOTTIME_STAGE2] = rdtsc();
+  BOOTTIME->magic = BOOTTIME_MAGIC;
+
+  boot_readsects((uintptr_t)BOOTIMGHDR, KERNEL_START_SECTOR,
+    800a:	be 11 00 00 00       	mov    $0x11,%esi
+    800f:	bf 00 30 00 00       	mov    $0x3000,%edi
+  BOOTTIME->magic = BOOTTIME_MAGIC;
+    8014:	c7 04 25 00 40 00 00 	movl   $0x454d4954,0x4000
+    801b:	54 49 4d 45 
+    801f:	48 09 c2             	or     %rax,%rdx
+    8022:	48 89 14 25 10 40 00 	mov    %rdx,0x4010
+    8029:	00 
+  boot_readsects((uintptr_t)BOOTIMGHDR, KERNEL_START_SECTOR,
+    802a:	ba 08 00 00 00       	mov    $0x8,%edx
+    802f:	e8 cb fc ff ff       	call   7cff <boot_readsects>
+                 BOOTIMG_HDRSIZE / SECTORSIZE);
+  while (BOOTIMGHDR->magic != BOOTIMG_MAGIC) {
+    8034:	8b 04 25 00 30 00 00 	mov    0x3000,%eax
+    803b:	3d 53 4f 4c 5a       	cmp    $0x5a4c4f53,%eax
+    8040:	75 f9                	jne    803b <boot2+0x3b>
+  }
+
+  struct bootimg_extent *ext = BOOTIMGHDR->extents;
+  struct bootimg_extent *eext = ext + BOOTIMGHDR->nextents;
+    8042:	8b 2c 25 04 30 00 00 	mov    0x3004,%ebp
+  struct bootimg_extent *ext = BOOTIMGHDR->extents;
+    8049:	bb 10 30 00 00       	mov    $0x3010,%ebx
+  struct bootimg_extent *eext = ext + BOOTIMGHDR->nextents;
+    804e:	48 6b ed 18          	imul   $0x18,%rbp,%rbp
+    8052:	48 81 c5 10 30 00 00 	add    $0x3010,%rbp
+  for (; ext < eext; ++ext) {
+    8059:	48 39 eb             	cmp    %rbp,%rbx
+    805c:	0f 83 1a 01 00 00    	jae    817c <boot2+0x17c>
+//	expand it to its load address `ext->va`.
+static void boot2_loadextent(struct bootimg_extent *ext) {
+  uint8_t *dst = (uint8_t *)ext->va;
+  const uint8_t *src = (const uint8_t *)BOOT2_STAGING;
+
+  if (ext->type == BOOTIMG_ZERO) {
+    8062:	8b 43 0c             	mov    0xc(%rbx),%eax
+  uint8_t *dst = (uint8_t *)ext->va;
+    8065:	4c 8b 23             	mov    (%rbx),%r12
+  if (ext->type == BOOTIMG_ZERO) {
+    8068:	85 c0                	test   %eax,%eax
+    806a:	75 25                	jne    8091 <boot2+0x91>
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    806c:	3b 43 14             	cmp    0x14(%rbx),%eax
+    806f:	73 1a                	jae    808b <boot2+0x8b>
+      dst[i] = 0;
+    8071:	89 c2                	mov    %eax,%edx
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    8073:	ff c0                	inc    %eax
+      dst[i] = 0;
+    8075:	41 c6 04 14 00       	movb   $0x0,(%r12,%rdx,1)
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    807a:	eb f0                	jmp    806c <boot2+0x6c>
+    807c:	48 01 c1             	add    %rax,%rcx
+    size_t len = boot2_lz4_length(&src, token >> 4);
+    for (; len > 0; --len) {
+      *dst++ = *src++;
+    }
+    // the last sequence has no match part
+    if (src >= end) {
+    807f:	49 01 c4             	add    %rax,%r12
+    8082:	48 39 f9             	cmp    %rdi,%rcx
+    8085:	0f 82 86 00 00 00    	jb     8111 <boot2+0x111>
+  for (; ext < eext; ++ext) {
+    808b:	48 83 c3 18          	add    $0x18,%rbx
+    808f:	eb c8                	jmp    8059 <boot2+0x59>
+                 (ext->csize + SECTORSIZE - 1) / SECTORSIZE);
+    8091:	8b 43 10             	mov    0x10(%rbx),%eax
+  boot_readsects(BOOT2_STAGING, KERNEL_START_SECTOR + ext->sect,
+    8094:	bf 00 00 01 00       	mov    $0x10000,%edi
+                 (ext->csize + SECTORSIZE - 1) / SECTORSIZE);
+    8099:	8d 90 ff 01 00 00    	lea    0x1ff(%rax),%edx
+  boot_readsects(BOOT2_STAGING, KERNEL_START_SECTOR + ext->sect,
+    809f:	8b 43 08             	mov    0x8(%rbx),%eax
+    80a2:	c1 ea 09             	shr    $0x9,%edx
+    80a5:	8d 70 11             	lea    0x11(%rax),%esi
+    80a8:	e8 52 fc ff ff       	call   7cff <boot_readsects>
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    80ad:	31 c0                	xor    %eax,%eax
+  if (ext->type == BOOTIMG_LZ4) {
+    80af:	83 7b 0c 02          	cmpl   $0x2,0xc(%rbx)
+    80b3:	0f 85 aa 00 00 00    	jne    8163 <boot2+0x163>
+    boot2_lz4(dst, src, ext->csize);
+    80b9:	8b 7b 10             	mov    0x10(%rbx),%edi
+  while (src < end) {
+    80bc:	be 00 00 01 00       	mov    $0x10000,%esi
+  const uint8_t *end = src + csize;
+    80c1:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  while (src < end) {
+    80c8:	48 39 fe             	cmp    %rdi,%rsi
+    80cb:	73 be                	jae    808b <boot2+0x8b>
+    unsigned token = *src++;
+    80cd:	0f b6 06             	movzbl (%rsi),%eax
+    80d0:	48 8d 4e 01          	lea    0x1(%rsi),%rcx
+    80d4:	89 c2                	mov    %eax,%edx
+    size_t len = boot2_lz4_length(&src, token >> 4);
+    80d6:	c1 e8 04             	shr    $0x4,%eax
+  if (len == 15) {
+    80d9:	83 f8 0f             	cmp    $0xf,%eax
+    80dc:	74 04                	je     80e2 <boot2+0xe2>
+    80de:	31 f6                	xor    %esi,%esi
+    80e0:	eb 19                	jmp    80fb <boot2+0xfb>
+    80e2:	b8 0f 00 00 00       	mov    $0xf,%eax
+      b = *(*src)++;
+    80e7:	44 0f b6 01          	movzbl (%rcx),%r8d
+    80eb:	48 ff c1             	inc    %rcx
+    80ee:	4c 89 c6             	mov    %r8,%rsi
+      len += b;
+    80f1:	4c 01 c0             	add    %r8,%rax
+    } while (b == 255);
+    80f4:	40 fe c6             	inc    %sil
+    80f7:	74 ee                	je     80e7 <boot2+0xe7>
+    80f9:	eb e3                	jmp    80de <boot2+0xde>
+    for (; len > 0; --len) {
+    80fb:	48 39 f0             	cmp    %rsi,%rax
+    80fe:	0f 84 78 ff ff ff    	je     807c <boot2+0x7c>
+      *dst++ = *src++;
+    8104:	44 8a 04 31          	mov    (%rcx,%rsi,1),%r8b
+    8108:	45 88 04 34          	mov    %r8b,(%r12,%rsi,1)
+    for (; len > 0; --len) {
+    810c:	48 ff c6             	inc    %rsi
+    810f:	eb ea                	jmp    80fb <boot2+0xfb>
+      break;
+    }
+
+    // match
+    const uint8_t *match = dst - (src[0] | (src[1] << 8));
+    8111:	0f b7 01             	movzwl (%rcx),%eax
+    8114:	4d 89 e0             	mov    %r12,%r8
+    src += 2;
+    8117:	48 8d 71 02          	lea    0x2(%rcx),%rsi
+    811b:	89 d1                	mov    %edx,%ecx
+    811d:	83 e1 0f             	and    $0xf,%ecx
+    const uint8_t *match = dst - (src[0] | (src[1] << 8));
+    8120:	49 29 c0             	sub    %rax,%r8
+    len = boot2_lz4_length(&src, token & 15) + 4;
+    8123:	48 89 d0             	mov    %rdx,%rax
+    8126:	83 e0 0f             	and    $0xf,%eax
+  if (len == 15) {
+    8129:	80 f9 0f             	cmp    $0xf,%cl
+    812c:	75 15                	jne    8143 <boot2+0x143>
+    812e:	b8 0f 00 00 00       	mov    $0xf,%eax
+      b = *(*src)++;
+    8133:	0f b6 0e             	movzbl (%rsi),%ecx
+    8136:	48 ff c6             	inc    %rsi
+    8139:	48 89 ca             	mov    %rcx,%rdx
+      len += b;
+    813c:	48 01 c8             	add    %rcx,%rax
+    } while (b == 255);
+    813f:	fe c2                	inc    %dl
+    8141:	74 f0                	je     8133 <boot2+0x133>
+    len = boot2_lz4_length(&src, token & 15) + 4;
+    8143:	48 83 c0 04          	add    $0x4,%rax
+    for (; len > 0; --len) {
+    8147:	31 d2                	xor    %edx,%edx
+    8149:	48 39 c2             	cmp    %rax,%rdx
+    814c:	74 0d                	je     815b <boot2+0x15b>
+      *dst++ = *match++;
+    814e:	41 8a 0c 10          	mov    (%r8,%rdx,1),%cl
+    8152:	41 88 0c 14          	mov    %cl,(%r12,%rdx,1)
+    for (; len > 0; --len) {
+    8156:	48 ff c2             	inc    %rdx
+    8159:	eb ee                	jmp    8149 <boot2+0x149>
+    815b:	49 01 d4             	add    %rdx,%r12
+    815e:	e9 65 ff ff ff       	jmp    80c8 <boot2+0xc8>
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    8163:	3b 43 14             	cmp    0x14(%rbx),%eax
+    8166:	0f 83 1f ff ff ff    	jae    808b <boot2+0x8b>
+      dst[i] = src[i];
+    816c:	89 c2                	mov    %eax,%edx
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    816e:	ff c0                	inc    %eax
+      dst[i] = src[i];
+    8170:	8a 8a 00 00 01 00    	mov    0x10000(%rdx),%cl
+    8176:	41 88 0c 14          	mov    %cl,(%r12,%rdx,1)
+    for (uint32_t i = 0; i < ext->usize; ++i) {
+    817a:	eb e7                	jmp    8163 <boot2+0x163>
+  kernel_entry();
+    817c:	31 c0                	xor    %eax,%eax
+    817e:	ff 14 25 08 30 00 00 	call   *0x3008
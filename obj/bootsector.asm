@@ -0,0 +1,299 @@
+
+obj/bootsector.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000007c00 <boot_start>:
+#include "e820.h"
+
+.globl boot_start                               # Entry point
+boot_start:
+        .code16                         # This runs in real mode
+        cli                             # Disable interrupts
+    7c00:	fa                   	cli
+        cld                             # String operations increment
+    7c01:	fc                   	cld
+
+        # All segments are initially 0.
+        # Set up the stack pointer, growing downward from 0x7c00.
+        movw    $boot_start, %sp
+    7c02:	bc 00 7c 0f 31       	mov    $0x310f7c00,%esp
+
+        # Record the first boot timestamp, boottime::tsc[BOOTTIME_START].
+        rdtsc
+        movl    %eax, BOOTTIME_ADDR + 8
+    7c07:	66                   	data16
+    7c08:	a3                   	.byte 0xa3
+    7c09:	08 40 66             	or     %al,0x66(%rax)
+        movl    %edx, BOOTTIME_ADDR + 12
+    7c0c:	89 16                	mov    %edx,(%rsi)
+    7c0e:	0c 40                	or     $0x40,%al
+
+0000000000007c10 <notify_bios64>:
+
+notify_bios64:
+        # Notify the BIOS (the machine's firmware) to optimize itself
+        # for x86-64 code. https://wiki.osdev.org/X86-64
+        movw    $0xEC00, %ax
+    7c10:	b8 00 ec ba 02       	mov    $0x2baec00,%eax
+        movw    $2, %dx
+    7c15:	00 cd                	add    %cl,%ch
+        int     $0x15
+    7c17:	15                   	.byte 0x15
+
+0000000000007c18 <detect_memory>:
+
+detect_memory:
+        # Ask the BIOS for the physical memory map, one entry per call.
+        # The entry count goes at E820_ADDR, the entries follow it.
+        movw    $(E820_ADDR + 8), %di
+    7c18:	bf 08 50 66 31       	mov    $0x31665008,%edi
+        xorl    %ebx, %ebx              # continuation value, 0 = start
+    7c1d:	db 66 31             	(bad)  0x31(%rsi)
+        xorl    %esi, %esi              # entry count
+    7c20:	f6 66 b8             	mulb   -0x48(%rsi)
+1:      movl    $0xE820, %eax
+    7c23:	20 e8                	and    %ch,%al
+    7c25:	00 00                	add    %al,(%rax)
+        movl    $E820_ENTRYSIZE, %ecx
+    7c27:	66 b9 18 00          	mov    $0x18,%cx
+    7c2b:	00 00                	add    %al,(%rax)
+        movl    $E820_SMAP, %edx
+    7c2d:	66 ba 50 41          	mov    $0x4150,%dx
+    7c31:	4d 53                	rex.WRB push %r11
+        movl    $1, 20(%di)             # default ACPI attributes: valid
+    7c33:	66 c7 45 14 01 00    	movw   $0x1,0x14(%rbp)
+    7c39:	00 00                	add    %al,(%rax)
+        int     $0x15
+    7c3b:	cd 15                	int    $0x15
+        jc      2f                      # error, or end of the list
+    7c3d:	72 16                	jb     7c55 <detect_memory+0x3d>
+        cmpl    $E820_SMAP, %eax
+    7c3f:	66 3d 50 41          	cmp    $0x4150,%ax
+    7c43:	4d 53                	rex.WRB push %r11
+        jne     2f
+    7c45:	75 0e                	jne    7c55 <detect_memory+0x3d>
+        incw    %si
+    7c47:	46 83 c7 18          	rex.RX add $0x18,%edi
+        addw    $E820_ENTRYSIZE, %di
+        cmpw    $E820_MAXENTRIES, %si
+    7c4b:	83 fe 40             	cmp    $0x40,%esi
+        je      2f
+    7c4e:	74 05                	je     7c55 <detect_memory+0x3d>
+        testl   %ebx, %ebx              # 0 after the last entry
+    7c50:	66 85 db             	test   %bx,%bx
+        jnz     1b
+    7c53:	75 cc                	jne    7c21 <detect_memory+0x9>
+2:      movl    %esi, E820_ADDR
+    7c55:	66 89 36             	mov    %si,(%rsi)
+    7c58:	00                   	.byte 0x0
+    7c59:	50                   	push   %rax
+
+0000000000007c5a <init_boot_pagetable>:
+
+init_boot_pagetable:
+        # clear memory for boot page table
+        .set BOOT_PAGETABLE,0x1000
+        movl    $BOOT_PAGETABLE, %edi
+    7c5a:	66 bf 00 10          	mov    $0x1000,%di
+    7c5e:	00 00                	add    %al,(%rax)
+        xorl    %eax, %eax
+    7c60:	66 31 c0             	xor    %ax,%ax
+        movl    $(0x2000 / 4), %ecx
+    7c63:	66 b9 00 08          	mov    $0x800,%cx
+    7c67:	00 00                	add    %al,(%rax)
+        rep stosl
+    7c69:	66 f3 ab             	rep stos %ax,%es:(%rdi)
+        # set up boot page table
+        # 0x1000: L1 page table; entry 0 points to:
+        # 0x2000: L2 page table; entry 0 maps 1st 1GB of physmem
+        # This is a minimal page table that maps the first 1GB of
+        # physical memory using identity mappings.
+        movl    $BOOT_PAGETABLE, %edi
+    7c6c:	66 bf 00 10          	mov    $0x1000,%di
+    7c70:	00 00                	add    %al,(%rax)
+        leal    0x1000 + PTE_P + PTE_W(%edi), %ecx
+    7c72:	67 66 8d 8f 03 10 00 	lea    0x1003(%edi),%cx
+    7c79:	00 
+        movl    %ecx, (%edi)
+    7c7a:	67 66 89 0f          	mov    %cx,(%edi)
+        movl    $(PTE_P + PTE_W + PTE_PS), -3(%ecx)
+    7c7e:	67 66 c7 41 fd 83 00 	movw   $0x83,-0x3(%ecx)
+	...
+
+0000000000007c87 <real_to_prot>:
+#   The `gdt` and `gdtdesc` tables below define these segments.
+#   This code loads them into the processor.
+#   We need this setup to ensure the transition to protected mode is smooth.
+
+real_to_prot:
+        movl    %cr4, %eax              # enable physical address extensions
+    7c87:	0f 20 e0             	mov    %cr4,%rax
+        orl     $(CR4_PSE | CR4_PAE), %eax
+    7c8a:	66 83 c8 30          	or     $0x30,%ax
+        movl    %eax, %cr4
+    7c8e:	0f 22 e0             	mov    %rax,%cr4
+        movl    %edi, %cr3
+    7c91:	0f 22 df             	mov    %rdi,%cr3
+
+        movl    $MSR_IA32_EFER, %ecx    # turn on 64-bit mode
+    7c94:	66 b9 80 00          	mov    $0x80,%cx
+    7c98:	00 c0                	add    %al,%al
+        rdmsr
+    7c9a:	0f 32                	rdmsr
+        orl     $(IA32_EFER_LME | IA32_EFER_SCE | IA32_EFER_NXE), %eax
+    7c9c:	66 0d 01 09          	or     $0x901,%ax
+    7ca0:	00 00                	add    %al,(%rax)
+        wrmsr
+    7ca2:	0f 30                	wrmsr
+
+        movl    %cr0, %eax              # turn on protected mode
+    7ca4:	0f 20 c0             	mov    %cr0,%rax
+        orl     $(CR0_PE | CR0_WP | CR0_PG), %eax
+    7ca7:	66 0d 01 00          	or     $0x1,%ax
+    7cab:	01 80 0f 22 c0 0f    	add    %eax,0xfc0220f(%rax)
+        movl    %eax, %cr0
+
+        lgdt    gdtdesc + 6             # load GDT
+    7cb1:	01 16                	add    %edx,(%rsi)
+    7cb3:	d6                   	(bad)
+    7cb4:	7c ea                	jl     7ca0 <real_to_prot+0x19>
+
+        # CPU magic: jump to relocation, flush prefetch queue, and
+        # reload %cs.  Has the effect of just jmp to the next
+        # instruction, but simultaneously loads CS with
+        # $SEGSEL_BOOT_CODE.
+        ljmp    $SEGSEL_BOOT_CODE, $boot
+    7cb6:	72 7d                	jb     7d35 <boot_readsects+0x36>
+    7cb8:	08 00                	or     %al,(%rax)
+    7cba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000007cc0 <gdt>:
+	...
+    7ccc:	00                   	.byte 0x0
+    7ccd:	9a                   	(bad)
+    7cce:	20 00                	and    %al,(%rax)
+
+0000000000007cd0 <gdtdesc>:
+    7cd0:	00 00                	add    %al,(%rax)
+    7cd2:	00 00                	add    %al,(%rax)
+    7cd4:	00 00                	add    %al,(%rax)
+    7cd6:	0f 00 c0             	sldt   %eax
+    7cd9:	7c 00                	jl     7cdb <gdtdesc+0xb>
+    7cdb:	00 00                	add    %al,(%rax)
+    7cdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000007ce0 <boot_waitdisk>:
+#define EFLAGS_VIP              0x00100000      // Virtual Interrupt Pending
+#define EFLAGS_ID               0x00200000      // ID flag
+
+__always_inline uint8_t inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+    7ce0:	ba f6 03 00 00       	mov    $0x3f6,%edx
+    7ce5:	ec                   	in     (%dx),%al
+    7ce6:	ec                   	in     (%dx),%al
+    7ce7:	ec                   	in     (%dx),%al
+    7ce8:	ec                   	in     (%dx),%al
+  for (int i = 0; i < 4; ++i) {
+    (void)inb(0x3F6);
+  }
+  // Wait until the ATA status register says ready (0x40 is on) and not busy
+  // (0x80 is off), with DRQ as requested
+  while ((inb(0x1F7) & (0xC0 | drq)) != (0x40 | drq)) {
+    7ce9:	89 f9                	mov    %edi,%ecx
+    7ceb:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cf0:	83 cf 40             	or     $0x40,%edi
+    7cf3:	83 c9 c0             	or     $0xffffffc0,%ecx
+    7cf6:	ec                   	in     (%dx),%al
+    7cf7:	21 c8                	and    %ecx,%eax
+    7cf9:	40 38 f8             	cmp    %dil,%al
+    7cfc:	75 f8                	jne    7cf6 <boot_waitdisk+0x16>
+    // do nothing
+  }
+}
+    7cfe:	c3                   	ret
+
+0000000000007cff <boot_readsects>:
+// boot_readsects(dst, src_sect, nsect)
+//	Read `nsect` (1 to 256) disk sectors starting at sector number
+//	`src_sect` into address `dst` with a single ATA command.
+//	Stage 2 links against this copy, so it must keep its plain ABI.
+__attribute__((noipa)) void boot_readsects(uintptr_t dst, uint32_t src_sect,
+                                           uint32_t nsect) {
+    7cff:	41 89 d0             	mov    %edx,%r8d
+    7d02:	49 89 f9             	mov    %rdi,%r9
+  // programmed I/O for "read sectors"
+  boot_waitdisk(0);
+    7d05:	31 ff                	xor    %edi,%edi
+    7d07:	e8 d4 ff ff ff       	call   7ce0 <boot_waitdisk>
+ *
+ * @param port The I/O port to write to. This is a 16-bit value.
+ * @param data The 8-bit value to write to the I/O port.
+ */
+__always_inline void outb(uint16_t port, uint8_t data) {
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+    7d0c:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7d11:	44 89 c0             	mov    %r8d,%eax
+    7d14:	ee                   	out    %al,(%dx)
+    7d15:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7d1a:	89 f0                	mov    %esi,%eax
+    7d1c:	ee                   	out    %al,(%dx)
+  outb(0x1F2, nsect); // send `count` as an ATA argument; 256 is sent as 0
+  outb(0x1F3, src_sect);
+  outb(0x1F4, src_sect >> 8);
+    7d1d:	89 f0                	mov    %esi,%eax
+    7d1f:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7d24:	c1 e8 08             	shr    $0x8,%eax
+    7d27:	ee                   	out    %al,(%dx)
+  outb(0x1F5, src_sect >> 16);
+    7d28:	89 f0                	mov    %esi,%eax
+    7d2a:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7d2f:	c1 e8 10             	shr    $0x10,%eax
+    7d32:	ee                   	out    %al,(%dx)
+  outb(0x1F6, (src_sect >> 24) | 0xE0);
+    7d33:	c1 ee 18             	shr    $0x18,%esi
+    7d36:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7d3b:	89 f0                	mov    %esi,%eax
+    7d3d:	83 c8 e0             	or     $0xffffffe0,%eax
+    7d40:	ee                   	out    %al,(%dx)
+    7d41:	b0 20                	mov    $0x20,%al
+    7d43:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7d48:	ee                   	out    %al,(%dx)
+    asm volatile("cld; rep; insl"
+    7d49:	be f0 01 00 00       	mov    $0x1f0,%esi
+  outb(0x1F7, 0x20); // send the command: 0x20 = read sectors
+
+  // move the data into memory; the disk raises DRQ once per sector
+  do {
+    boot_waitdisk(0x08);
+    7d4e:	bf 08 00 00 00       	mov    $0x8,%edi
+    7d53:	e8 88 ff ff ff       	call   7ce0 <boot_waitdisk>
+    7d58:	4c 89 cf             	mov    %r9,%rdi
+    7d5b:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d60:	89 f2                	mov    %esi,%edx
+    7d62:	fc                   	cld
+    7d63:	f3 6d                	rep insl (%dx),%es:(%rdi)
+    insl(0x1F0, (void *)dst, SECTORSIZE / 4); // read 128 words from the disk
+    dst += SECTORSIZE;
+    7d65:	49 81 c1 00 02 00 00 	add    $0x200,%r9
+  } while (--nsect);
+    7d6c:	41 ff c8             	dec    %r8d
+    7d6f:	75 dd                	jne    7d4e <boot_readsects+0x4f>
+}
+    7d71:	c3                   	ret
+
+0000000000007d72 <boot>:
+__attribute__((noreturn)) void boot() {
+    7d72:	50                   	push   %rax
+  boot_readsects(BOOT2_ADDR, BOOT2_START_SECTOR, BOOT2_SECTORS);
+    7d73:	ba 10 00 00 00       	mov    $0x10,%edx
+    7d78:	be 01 00 00 00       	mov    $0x1,%esi
+    7d7d:	bf 00 80 00 00       	mov    $0x8000,%edi
+    7d82:	e8 78 ff ff ff       	call   7cff <boot_readsects>
+  boot2_entry();
+    7d87:	31 c0                	xor    %eax,%eax
+    7d89:	ba 00 80 00 00       	mov    $0x8000,%edx
+    7d8e:	ff d2                	call   *%rdx
@@ -0,0 +1,11673 @@
+
+obj/kernel.full:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000040000 <kernel_entry>:
+//    The code initializes `%rsp` to the top of the kernel stack,
+//    then jumps to `kernel_start`.
+.globl kernel_entry
+kernel_entry:
+        // initialize stack pointer and base pointer
+        movq $KERNEL_STACK_TOP, %rsp
+   40000:	48 c7 c4 00 00 08 00 	mov    $0x80000,%rsp
+        movq %rsp, %rbp
+   40007:	48 89 e5             	mov    %rsp,%rbp
+        // clear `%rflags`
+        pushq $0
+   4000a:	6a 00                	push   $0x0
+        popfq
+   4000c:	9d                   	popf
+        // check for multiboot command line; if found pass it along
+        cmpl $0x2BADB002, %eax
+   4000d:	3d 02 b0 ad 2b       	cmp    $0x2badb002,%eax
+        jne 1f
+   40012:	75 0d                	jne    40021 <kernel_entry+0x21>
+        testl $4, (%rbx)
+   40014:	f7 03 04 00 00 00    	testl  $0x4,(%rbx)
+        je 1f
+   4001a:	74 05                	je     40021 <kernel_entry+0x21>
+        movl 16(%rbx), %edi
+   4001c:	8b 7b 10             	mov    0x10(%rbx),%edi
+        jmp 2f
+   4001f:	eb 07                	jmp    40028 <kernel_entry+0x28>
+1:      movq $0, %rdi
+   40021:	48 c7 c7 00 00 00 00 	mov    $0x0,%rdi
+2:      jmp kernel_main
+   40028:	e9 78 2c 00 00       	jmp    42ca5 <kernel_main>
+
+000000000004002d <ap_trampoline>:
+#define AP_ADDR(x) (AP_TRAMPOLINE_ADDR + ((x) - ap_trampoline))
+
+        .globl ap_trampoline, ap_trampoline_end
+        .code16
+ap_trampoline:
+        cli
+   4002d:	fa                   	cli
+        cld
+   4002e:	fc                   	cld
+        xorw %ax, %ax
+   4002f:	31 c0                	xor    %eax,%eax
+        movw %ax, %ds
+   40031:	8e d8                	mov    %eax,%ds
+
+        movl %cr4, %eax
+   40033:	0f 20 e0             	mov    %cr4,%rax
+        orl $(CR4_PAE | CR4_PGE), %eax
+   40036:	66 0d a0 00          	or     $0xa0,%ax
+   4003a:	00 00                	add    %al,(%rax)
+        movl %eax, %cr4
+   4003c:	0f 22 e0             	mov    %rax,%cr4
+        movl $kernel_pagetable, %eax
+   4003f:	66 b8 00 b0          	mov    $0xb000,%ax
+   40043:	04 00                	add    $0x0,%al
+        movl %eax, %cr3
+   40045:	0f 22 d8             	mov    %rax,%cr3
+        movl $MSR_IA32_EFER, %ecx
+   40048:	66 b9 80 00          	mov    $0x80,%cx
+   4004c:	00 c0                	add    %al,%al
+        rdmsr
+   4004e:	0f 32                	rdmsr
+        orl $(IA32_EFER_LME | IA32_EFER_SCE | IA32_EFER_NXE), %eax
+   40050:	66 0d 01 09          	or     $0x901,%ax
+   40054:	00 00                	add    %al,(%rax)
+        wrmsr
+   40056:	0f 30                	wrmsr
+        // INIT leaves caching disabled
+        movl %cr0, %eax
+   40058:	0f 20 c0             	mov    %cr0,%rax
+        andl $~(CR0_CD | CR0_NW), %eax
+   4005b:	66 25 ff ff          	and    $0xffff,%ax
+   4005f:	ff 9f 66 0d 01 00    	lcall  *0x10d66(%rdi)
+        orl $(CR0_PE | CR0_WP | CR0_PG), %eax
+   40065:	01 80 0f 22 c0 66    	add    %eax,0x66c0220f(%rax)
+        movl %eax, %cr0
+
+        lgdtl AP_ADDR(ap_gdtdesc)
+   4006b:	0f 01 16             	lgdt   (%rsi)
+   4006e:	9b                   	fwait
+   4006f:	70 66                	jo     400d7 <exception_entry_1>
+        ljmpl $SEGSEL_KERN_CODE, $AP_ADDR(ap_start64)
+   40071:	ea                   	(bad)
+   40072:	4b 70 00             	rex.WXB jo 40075 <ap_trampoline+0x48>
+   40075:	00 08                	add    %cl,(%rax)
+	...
+
+0000000000040078 <ap_start64>:
+
+        .code64
+ap_start64:
+        movw $SEGSEL_KERN_DATA, %ax
+   40078:	66 b8 10 00          	mov    $0x10,%ax
+        movw %ax, %ds
+   4007c:	8e d8                	mov    %eax,%ds
+        movw %ax, %es
+   4007e:	8e c0                	mov    %eax,%es
+        movw %ax, %ss
+   40080:	8e d0                	mov    %eax,%ss
+        movl $1, %edi
+   40082:	bf 01 00 00 00       	mov    $0x1,%edi
+        lock xaddl %edi, ap_next
+   40087:	f0 0f c1 3c 25 80 80 	lock xadd %edi,0x48080
+   4008e:	04 00 
+        cmpl $MAXCPU, %edi
+   40090:	83 ff 08             	cmp    $0x8,%edi
+        jae 1f
+   40093:	73 14                	jae    400a9 <ap_start64+0x31>
+        movq ap_stack_top(,%rdi,8), %rsp
+   40095:	48 8b 24 fd 00 88 05 	mov    0x58800(,%rdi,8),%rsp
+   4009c:	00 
+        movabsq $ap_entry, %rax
+   4009d:	48 b8 09 6c 04 00 00 	movabs $0x46c09,%rax
+   400a4:	00 00 00 
+        call *%rax
+   400a7:	ff d0                	call   *%rax
+1:      cli
+   400a9:	fa                   	cli
+        hlt
+   400aa:	f4                   	hlt
+        jmp 1b
+   400ab:	eb fc                	jmp    400a9 <ap_start64+0x31>
+   400ad:	0f 1f 00             	nopl   (%rax)
+
+00000000000400b0 <ap_gdt>:
+	...
+   400b8:	ff                   	(bad)
+   400b9:	ff 00                	incl   (%rax)
+   400bb:	00 00                	add    %al,(%rax)
+   400bd:	9a                   	(bad)
+   400be:	af                   	scas   %es:(%rdi),%eax
+   400bf:	00 ff                	add    %bh,%bh
+   400c1:	ff 00                	incl   (%rax)
+   400c3:	00 00                	add    %al,(%rax)
+   400c5:	92                   	xchg   %eax,%edx
+   400c6:	cf                   	iret
+	...
+
+00000000000400c8 <ap_gdtdesc>:
+   400c8:	17                   	(bad)
+   400c9:	00                   	.byte 0x0
+   400ca:	83 70 00 00          	xorl   $0x0,0x0(%rax)
+
+00000000000400ce <ap_trampoline_end>:
+.endm
+
+// now create all 256 exception handlers and table
+.set exception_number, 0
+.rept 256
+exception_handler %exception_number
+   400ce:	6a 00                	push   $0x0
+   400d0:	6a 00                	push   $0x0
+   400d2:	e9 3c 0a 00 00       	jmp    40b13 <exception_entry>
+
+00000000000400d7 <exception_entry_1>:
+   400d7:	6a 00                	push   $0x0
+   400d9:	6a 01                	push   $0x1
+   400db:	e9 33 0a 00 00       	jmp    40b13 <exception_entry>
+
+00000000000400e0 <exception_entry_2>:
+   400e0:	6a 00                	push   $0x0
+   400e2:	6a 02                	push   $0x2
+   400e4:	e9 2a 0a 00 00       	jmp    40b13 <exception_entry>
+
+00000000000400e9 <exception_entry_3>:
+   400e9:	6a 00                	push   $0x0
+   400eb:	6a 03                	push   $0x3
+   400ed:	e9 21 0a 00 00       	jmp    40b13 <exception_entry>
+
+00000000000400f2 <exception_entry_4>:
+   400f2:	6a 00                	push   $0x0
+   400f4:	6a 04                	push   $0x4
+   400f6:	e9 18 0a 00 00       	jmp    40b13 <exception_entry>
+
+00000000000400fb <exception_entry_5>:
+   400fb:	6a 00                	push   $0x0
+   400fd:	6a 05                	push   $0x5
+   400ff:	e9 0f 0a 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040104 <exception_entry_6>:
+   40104:	6a 00                	push   $0x0
+   40106:	6a 06                	push   $0x6
+   40108:	e9 06 0a 00 00       	jmp    40b13 <exception_entry>
+
+000000000004010d <exception_entry_7>:
+   4010d:	6a 00                	push   $0x0
+   4010f:	6a 07                	push   $0x7
+   40111:	e9 fd 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040116 <exception_entry_8>:
+   40116:	6a 08                	push   $0x8
+   40118:	e9 f6 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004011d <exception_entry_9>:
+   4011d:	6a 00                	push   $0x0
+   4011f:	6a 09                	push   $0x9
+   40121:	e9 ed 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040126 <exception_entry_10>:
+   40126:	6a 0a                	push   $0xa
+   40128:	e9 e6 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004012d <exception_entry_11>:
+   4012d:	6a 0b                	push   $0xb
+   4012f:	e9 df 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040134 <exception_entry_12>:
+   40134:	6a 0c                	push   $0xc
+   40136:	e9 d8 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004013b <exception_entry_13>:
+   4013b:	6a 0d                	push   $0xd
+   4013d:	e9 d1 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040142 <exception_entry_14>:
+   40142:	6a 0e                	push   $0xe
+   40144:	e9 ca 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040149 <exception_entry_15>:
+   40149:	6a 00                	push   $0x0
+   4014b:	6a 0f                	push   $0xf
+   4014d:	e9 c1 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040152 <exception_entry_16>:
+   40152:	6a 00                	push   $0x0
+   40154:	6a 10                	push   $0x10
+   40156:	e9 b8 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004015b <exception_entry_17>:
+   4015b:	6a 11                	push   $0x11
+   4015d:	e9 b1 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040162 <exception_entry_18>:
+   40162:	6a 00                	push   $0x0
+   40164:	6a 12                	push   $0x12
+   40166:	e9 a8 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004016b <exception_entry_19>:
+   4016b:	6a 00                	push   $0x0
+   4016d:	6a 13                	push   $0x13
+   4016f:	e9 9f 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040174 <exception_entry_20>:
+   40174:	6a 00                	push   $0x0
+   40176:	6a 14                	push   $0x14
+   40178:	e9 96 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004017d <exception_entry_21>:
+   4017d:	6a 00                	push   $0x0
+   4017f:	6a 15                	push   $0x15
+   40181:	e9 8d 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040186 <exception_entry_22>:
+   40186:	6a 00                	push   $0x0
+   40188:	6a 16                	push   $0x16
+   4018a:	e9 84 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004018f <exception_entry_23>:
+   4018f:	6a 00                	push   $0x0
+   40191:	6a 17                	push   $0x17
+   40193:	e9 7b 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040198 <exception_entry_24>:
+   40198:	6a 00                	push   $0x0
+   4019a:	6a 18                	push   $0x18
+   4019c:	e9 72 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401a1 <exception_entry_25>:
+   401a1:	6a 00                	push   $0x0
+   401a3:	6a 19                	push   $0x19
+   401a5:	e9 69 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401aa <exception_entry_26>:
+   401aa:	6a 00                	push   $0x0
+   401ac:	6a 1a                	push   $0x1a
+   401ae:	e9 60 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401b3 <exception_entry_27>:
+   401b3:	6a 00                	push   $0x0
+   401b5:	6a 1b                	push   $0x1b
+   401b7:	e9 57 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401bc <exception_entry_28>:
+   401bc:	6a 00                	push   $0x0
+   401be:	6a 1c                	push   $0x1c
+   401c0:	e9 4e 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401c5 <exception_entry_29>:
+   401c5:	6a 00                	push   $0x0
+   401c7:	6a 1d                	push   $0x1d
+   401c9:	e9 45 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401ce <exception_entry_30>:
+   401ce:	6a 00                	push   $0x0
+   401d0:	6a 1e                	push   $0x1e
+   401d2:	e9 3c 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401d7 <exception_entry_31>:
+   401d7:	6a 00                	push   $0x0
+   401d9:	6a 1f                	push   $0x1f
+   401db:	e9 33 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401e0 <exception_entry_32>:
+   401e0:	6a 00                	push   $0x0
+   401e2:	6a 20                	push   $0x20
+   401e4:	e9 2a 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401e9 <exception_entry_33>:
+   401e9:	6a 00                	push   $0x0
+   401eb:	6a 21                	push   $0x21
+   401ed:	e9 21 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401f2 <exception_entry_34>:
+   401f2:	6a 00                	push   $0x0
+   401f4:	6a 22                	push   $0x22
+   401f6:	e9 18 09 00 00       	jmp    40b13 <exception_entry>
+
+00000000000401fb <exception_entry_35>:
+   401fb:	6a 00                	push   $0x0
+   401fd:	6a 23                	push   $0x23
+   401ff:	e9 0f 09 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040204 <exception_entry_36>:
+   40204:	6a 00                	push   $0x0
+   40206:	6a 24                	push   $0x24
+   40208:	e9 06 09 00 00       	jmp    40b13 <exception_entry>
+
+000000000004020d <exception_entry_37>:
+   4020d:	6a 00                	push   $0x0
+   4020f:	6a 25                	push   $0x25
+   40211:	e9 fd 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040216 <exception_entry_38>:
+   40216:	6a 00                	push   $0x0
+   40218:	6a 26                	push   $0x26
+   4021a:	e9 f4 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004021f <exception_entry_39>:
+   4021f:	6a 00                	push   $0x0
+   40221:	6a 27                	push   $0x27
+   40223:	e9 eb 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040228 <exception_entry_40>:
+   40228:	6a 00                	push   $0x0
+   4022a:	6a 28                	push   $0x28
+   4022c:	e9 e2 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040231 <exception_entry_41>:
+   40231:	6a 00                	push   $0x0
+   40233:	6a 29                	push   $0x29
+   40235:	e9 d9 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004023a <exception_entry_42>:
+   4023a:	6a 00                	push   $0x0
+   4023c:	6a 2a                	push   $0x2a
+   4023e:	e9 d0 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040243 <exception_entry_43>:
+   40243:	6a 00                	push   $0x0
+   40245:	6a 2b                	push   $0x2b
+   40247:	e9 c7 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004024c <exception_entry_44>:
+   4024c:	6a 00                	push   $0x0
+   4024e:	6a 2c                	push   $0x2c
+   40250:	e9 be 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040255 <exception_entry_45>:
+   40255:	6a 00                	push   $0x0
+   40257:	6a 2d                	push   $0x2d
+   40259:	e9 b5 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004025e <exception_entry_46>:
+   4025e:	6a 00                	push   $0x0
+   40260:	6a 2e                	push   $0x2e
+   40262:	e9 ac 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040267 <exception_entry_47>:
+   40267:	6a 00                	push   $0x0
+   40269:	6a 2f                	push   $0x2f
+   4026b:	e9 a3 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040270 <exception_entry_48>:
+   40270:	6a 00                	push   $0x0
+   40272:	6a 30                	push   $0x30
+   40274:	e9 9a 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040279 <exception_entry_49>:
+   40279:	6a 00                	push   $0x0
+   4027b:	6a 31                	push   $0x31
+   4027d:	e9 91 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040282 <exception_entry_50>:
+   40282:	6a 00                	push   $0x0
+   40284:	6a 32                	push   $0x32
+   40286:	e9 88 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004028b <exception_entry_51>:
+   4028b:	6a 00                	push   $0x0
+   4028d:	6a 33                	push   $0x33
+   4028f:	e9 7f 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040294 <exception_entry_52>:
+   40294:	6a 00                	push   $0x0
+   40296:	6a 34                	push   $0x34
+   40298:	e9 76 08 00 00       	jmp    40b13 <exception_entry>
+
+000000000004029d <exception_entry_53>:
+   4029d:	6a 00                	push   $0x0
+   4029f:	6a 35                	push   $0x35
+   402a1:	e9 6d 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402a6 <exception_entry_54>:
+   402a6:	6a 00                	push   $0x0
+   402a8:	6a 36                	push   $0x36
+   402aa:	e9 64 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402af <exception_entry_55>:
+   402af:	6a 00                	push   $0x0
+   402b1:	6a 37                	push   $0x37
+   402b3:	e9 5b 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402b8 <exception_entry_56>:
+   402b8:	6a 00                	push   $0x0
+   402ba:	6a 38                	push   $0x38
+   402bc:	e9 52 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402c1 <exception_entry_57>:
+   402c1:	6a 00                	push   $0x0
+   402c3:	6a 39                	push   $0x39
+   402c5:	e9 49 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402ca <exception_entry_58>:
+   402ca:	6a 00                	push   $0x0
+   402cc:	6a 3a                	push   $0x3a
+   402ce:	e9 40 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402d3 <exception_entry_59>:
+   402d3:	6a 00                	push   $0x0
+   402d5:	6a 3b                	push   $0x3b
+   402d7:	e9 37 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402dc <exception_entry_60>:
+   402dc:	6a 00                	push   $0x0
+   402de:	6a 3c                	push   $0x3c
+   402e0:	e9 2e 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402e5 <exception_entry_61>:
+   402e5:	6a 00                	push   $0x0
+   402e7:	6a 3d                	push   $0x3d
+   402e9:	e9 25 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402ee <exception_entry_62>:
+   402ee:	6a 00                	push   $0x0
+   402f0:	6a 3e                	push   $0x3e
+   402f2:	e9 1c 08 00 00       	jmp    40b13 <exception_entry>
+
+00000000000402f7 <exception_entry_63>:
+   402f7:	6a 00                	push   $0x0
+   402f9:	6a 3f                	push   $0x3f
+   402fb:	e9 13 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040300 <exception_entry_64>:
+   40300:	6a 00                	push   $0x0
+   40302:	6a 40                	push   $0x40
+   40304:	e9 0a 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040309 <exception_entry_65>:
+   40309:	6a 00                	push   $0x0
+   4030b:	6a 41                	push   $0x41
+   4030d:	e9 01 08 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040312 <exception_entry_66>:
+   40312:	6a 00                	push   $0x0
+   40314:	6a 42                	push   $0x42
+   40316:	e9 f8 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004031b <exception_entry_67>:
+   4031b:	6a 00                	push   $0x0
+   4031d:	6a 43                	push   $0x43
+   4031f:	e9 ef 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040324 <exception_entry_68>:
+   40324:	6a 00                	push   $0x0
+   40326:	6a 44                	push   $0x44
+   40328:	e9 e6 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004032d <exception_entry_69>:
+   4032d:	6a 00                	push   $0x0
+   4032f:	6a 45                	push   $0x45
+   40331:	e9 dd 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040336 <exception_entry_70>:
+   40336:	6a 00                	push   $0x0
+   40338:	6a 46                	push   $0x46
+   4033a:	e9 d4 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004033f <exception_entry_71>:
+   4033f:	6a 00                	push   $0x0
+   40341:	6a 47                	push   $0x47
+   40343:	e9 cb 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040348 <exception_entry_72>:
+   40348:	6a 00                	push   $0x0
+   4034a:	6a 48                	push   $0x48
+   4034c:	e9 c2 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040351 <exception_entry_73>:
+   40351:	6a 00                	push   $0x0
+   40353:	6a 49                	push   $0x49
+   40355:	e9 b9 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004035a <exception_entry_74>:
+   4035a:	6a 00                	push   $0x0
+   4035c:	6a 4a                	push   $0x4a
+   4035e:	e9 b0 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040363 <exception_entry_75>:
+   40363:	6a 00                	push   $0x0
+   40365:	6a 4b                	push   $0x4b
+   40367:	e9 a7 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004036c <exception_entry_76>:
+   4036c:	6a 00                	push   $0x0
+   4036e:	6a 4c                	push   $0x4c
+   40370:	e9 9e 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040375 <exception_entry_77>:
+   40375:	6a 00                	push   $0x0
+   40377:	6a 4d                	push   $0x4d
+   40379:	e9 95 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004037e <exception_entry_78>:
+   4037e:	6a 00                	push   $0x0
+   40380:	6a 4e                	push   $0x4e
+   40382:	e9 8c 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040387 <exception_entry_79>:
+   40387:	6a 00                	push   $0x0
+   40389:	6a 4f                	push   $0x4f
+   4038b:	e9 83 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040390 <exception_entry_80>:
+   40390:	6a 00                	push   $0x0
+   40392:	6a 50                	push   $0x50
+   40394:	e9 7a 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040399 <exception_entry_81>:
+   40399:	6a 00                	push   $0x0
+   4039b:	6a 51                	push   $0x51
+   4039d:	e9 71 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403a2 <exception_entry_82>:
+   403a2:	6a 00                	push   $0x0
+   403a4:	6a 52                	push   $0x52
+   403a6:	e9 68 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403ab <exception_entry_83>:
+   403ab:	6a 00                	push   $0x0
+   403ad:	6a 53                	push   $0x53
+   403af:	e9 5f 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403b4 <exception_entry_84>:
+   403b4:	6a 00                	push   $0x0
+   403b6:	6a 54                	push   $0x54
+   403b8:	e9 56 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403bd <exception_entry_85>:
+   403bd:	6a 00                	push   $0x0
+   403bf:	6a 55                	push   $0x55
+   403c1:	e9 4d 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403c6 <exception_entry_86>:
+   403c6:	6a 00                	push   $0x0
+   403c8:	6a 56                	push   $0x56
+   403ca:	e9 44 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403cf <exception_entry_87>:
+   403cf:	6a 00                	push   $0x0
+   403d1:	6a 57                	push   $0x57
+   403d3:	e9 3b 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403d8 <exception_entry_88>:
+   403d8:	6a 00                	push   $0x0
+   403da:	6a 58                	push   $0x58
+   403dc:	e9 32 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403e1 <exception_entry_89>:
+   403e1:	6a 00                	push   $0x0
+   403e3:	6a 59                	push   $0x59
+   403e5:	e9 29 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403ea <exception_entry_90>:
+   403ea:	6a 00                	push   $0x0
+   403ec:	6a 5a                	push   $0x5a
+   403ee:	e9 20 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403f3 <exception_entry_91>:
+   403f3:	6a 00                	push   $0x0
+   403f5:	6a 5b                	push   $0x5b
+   403f7:	e9 17 07 00 00       	jmp    40b13 <exception_entry>
+
+00000000000403fc <exception_entry_92>:
+   403fc:	6a 00                	push   $0x0
+   403fe:	6a 5c                	push   $0x5c
+   40400:	e9 0e 07 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040405 <exception_entry_93>:
+   40405:	6a 00                	push   $0x0
+   40407:	6a 5d                	push   $0x5d
+   40409:	e9 05 07 00 00       	jmp    40b13 <exception_entry>
+
+000000000004040e <exception_entry_94>:
+   4040e:	6a 00                	push   $0x0
+   40410:	6a 5e                	push   $0x5e
+   40412:	e9 fc 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040417 <exception_entry_95>:
+   40417:	6a 00                	push   $0x0
+   40419:	6a 5f                	push   $0x5f
+   4041b:	e9 f3 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040420 <exception_entry_96>:
+   40420:	6a 00                	push   $0x0
+   40422:	6a 60                	push   $0x60
+   40424:	e9 ea 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040429 <exception_entry_97>:
+   40429:	6a 00                	push   $0x0
+   4042b:	6a 61                	push   $0x61
+   4042d:	e9 e1 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040432 <exception_entry_98>:
+   40432:	6a 00                	push   $0x0
+   40434:	6a 62                	push   $0x62
+   40436:	e9 d8 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004043b <exception_entry_99>:
+   4043b:	6a 00                	push   $0x0
+   4043d:	6a 63                	push   $0x63
+   4043f:	e9 cf 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040444 <exception_entry_100>:
+   40444:	6a 00                	push   $0x0
+   40446:	6a 64                	push   $0x64
+   40448:	e9 c6 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004044d <exception_entry_101>:
+   4044d:	6a 00                	push   $0x0
+   4044f:	6a 65                	push   $0x65
+   40451:	e9 bd 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040456 <exception_entry_102>:
+   40456:	6a 00                	push   $0x0
+   40458:	6a 66                	push   $0x66
+   4045a:	e9 b4 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004045f <exception_entry_103>:
+   4045f:	6a 00                	push   $0x0
+   40461:	6a 67                	push   $0x67
+   40463:	e9 ab 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040468 <exception_entry_104>:
+   40468:	6a 00                	push   $0x0
+   4046a:	6a 68                	push   $0x68
+   4046c:	e9 a2 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040471 <exception_entry_105>:
+   40471:	6a 00                	push   $0x0
+   40473:	6a 69                	push   $0x69
+   40475:	e9 99 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004047a <exception_entry_106>:
+   4047a:	6a 00                	push   $0x0
+   4047c:	6a 6a                	push   $0x6a
+   4047e:	e9 90 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040483 <exception_entry_107>:
+   40483:	6a 00                	push   $0x0
+   40485:	6a 6b                	push   $0x6b
+   40487:	e9 87 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004048c <exception_entry_108>:
+   4048c:	6a 00                	push   $0x0
+   4048e:	6a 6c                	push   $0x6c
+   40490:	e9 7e 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040495 <exception_entry_109>:
+   40495:	6a 00                	push   $0x0
+   40497:	6a 6d                	push   $0x6d
+   40499:	e9 75 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004049e <exception_entry_110>:
+   4049e:	6a 00                	push   $0x0
+   404a0:	6a 6e                	push   $0x6e
+   404a2:	e9 6c 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404a7 <exception_entry_111>:
+   404a7:	6a 00                	push   $0x0
+   404a9:	6a 6f                	push   $0x6f
+   404ab:	e9 63 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404b0 <exception_entry_112>:
+   404b0:	6a 00                	push   $0x0
+   404b2:	6a 70                	push   $0x70
+   404b4:	e9 5a 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404b9 <exception_entry_113>:
+   404b9:	6a 00                	push   $0x0
+   404bb:	6a 71                	push   $0x71
+   404bd:	e9 51 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404c2 <exception_entry_114>:
+   404c2:	6a 00                	push   $0x0
+   404c4:	6a 72                	push   $0x72
+   404c6:	e9 48 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404cb <exception_entry_115>:
+   404cb:	6a 00                	push   $0x0
+   404cd:	6a 73                	push   $0x73
+   404cf:	e9 3f 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404d4 <exception_entry_116>:
+   404d4:	6a 00                	push   $0x0
+   404d6:	6a 74                	push   $0x74
+   404d8:	e9 36 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404dd <exception_entry_117>:
+   404dd:	6a 00                	push   $0x0
+   404df:	6a 75                	push   $0x75
+   404e1:	e9 2d 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404e6 <exception_entry_118>:
+   404e6:	6a 00                	push   $0x0
+   404e8:	6a 76                	push   $0x76
+   404ea:	e9 24 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404ef <exception_entry_119>:
+   404ef:	6a 00                	push   $0x0
+   404f1:	6a 77                	push   $0x77
+   404f3:	e9 1b 06 00 00       	jmp    40b13 <exception_entry>
+
+00000000000404f8 <exception_entry_120>:
+   404f8:	6a 00                	push   $0x0
+   404fa:	6a 78                	push   $0x78
+   404fc:	e9 12 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040501 <exception_entry_121>:
+   40501:	6a 00                	push   $0x0
+   40503:	6a 79                	push   $0x79
+   40505:	e9 09 06 00 00       	jmp    40b13 <exception_entry>
+
+000000000004050a <exception_entry_122>:
+   4050a:	6a 00                	push   $0x0
+   4050c:	6a 7a                	push   $0x7a
+   4050e:	e9 00 06 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040513 <exception_entry_123>:
+   40513:	6a 00                	push   $0x0
+   40515:	6a 7b                	push   $0x7b
+   40517:	e9 f7 05 00 00       	jmp    40b13 <exception_entry>
+
+000000000004051c <exception_entry_124>:
+   4051c:	6a 00                	push   $0x0
+   4051e:	6a 7c                	push   $0x7c
+   40520:	e9 ee 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040525 <exception_entry_125>:
+   40525:	6a 00                	push   $0x0
+   40527:	6a 7d                	push   $0x7d
+   40529:	e9 e5 05 00 00       	jmp    40b13 <exception_entry>
+
+000000000004052e <exception_entry_126>:
+   4052e:	6a 00                	push   $0x0
+   40530:	6a 7e                	push   $0x7e
+   40532:	e9 dc 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040537 <exception_entry_127>:
+   40537:	6a 00                	push   $0x0
+   40539:	6a 7f                	push   $0x7f
+   4053b:	e9 d3 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040540 <exception_entry_128>:
+   40540:	6a 00                	push   $0x0
+   40542:	68 80 00 00 00       	push   $0x80
+   40547:	e9 c7 05 00 00       	jmp    40b13 <exception_entry>
+
+000000000004054c <exception_entry_129>:
+   4054c:	6a 00                	push   $0x0
+   4054e:	68 81 00 00 00       	push   $0x81
+   40553:	e9 bb 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040558 <exception_entry_130>:
+   40558:	6a 00                	push   $0x0
+   4055a:	68 82 00 00 00       	push   $0x82
+   4055f:	e9 af 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040564 <exception_entry_131>:
+   40564:	6a 00                	push   $0x0
+   40566:	68 83 00 00 00       	push   $0x83
+   4056b:	e9 a3 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040570 <exception_entry_132>:
+   40570:	6a 00                	push   $0x0
+   40572:	68 84 00 00 00       	push   $0x84
+   40577:	e9 97 05 00 00       	jmp    40b13 <exception_entry>
+
+000000000004057c <exception_entry_133>:
+   4057c:	6a 00                	push   $0x0
+   4057e:	68 85 00 00 00       	push   $0x85
+   40583:	e9 8b 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040588 <exception_entry_134>:
+   40588:	6a 00                	push   $0x0
+   4058a:	68 86 00 00 00       	push   $0x86
+   4058f:	e9 7f 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040594 <exception_entry_135>:
+   40594:	6a 00                	push   $0x0
+   40596:	68 87 00 00 00       	push   $0x87
+   4059b:	e9 73 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405a0 <exception_entry_136>:
+   405a0:	6a 00                	push   $0x0
+   405a2:	68 88 00 00 00       	push   $0x88
+   405a7:	e9 67 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405ac <exception_entry_137>:
+   405ac:	6a 00                	push   $0x0
+   405ae:	68 89 00 00 00       	push   $0x89
+   405b3:	e9 5b 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405b8 <exception_entry_138>:
+   405b8:	6a 00                	push   $0x0
+   405ba:	68 8a 00 00 00       	push   $0x8a
+   405bf:	e9 4f 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405c4 <exception_entry_139>:
+   405c4:	6a 00                	push   $0x0
+   405c6:	68 8b 00 00 00       	push   $0x8b
+   405cb:	e9 43 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405d0 <exception_entry_140>:
+   405d0:	6a 00                	push   $0x0
+   405d2:	68 8c 00 00 00       	push   $0x8c
+   405d7:	e9 37 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405dc <exception_entry_141>:
+   405dc:	6a 00                	push   $0x0
+   405de:	68 8d 00 00 00       	push   $0x8d
+   405e3:	e9 2b 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405e8 <exception_entry_142>:
+   405e8:	6a 00                	push   $0x0
+   405ea:	68 8e 00 00 00       	push   $0x8e
+   405ef:	e9 1f 05 00 00       	jmp    40b13 <exception_entry>
+
+00000000000405f4 <exception_entry_143>:
+   405f4:	6a 00                	push   $0x0
+   405f6:	68 8f 00 00 00       	push   $0x8f
+   405fb:	e9 13 05 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040600 <exception_entry_144>:
+   40600:	6a 00                	push   $0x0
+   40602:	68 90 00 00 00       	push   $0x90
+   40607:	e9 07 05 00 00       	jmp    40b13 <exception_entry>
+
+000000000004060c <exception_entry_145>:
+   4060c:	6a 00                	push   $0x0
+   4060e:	68 91 00 00 00       	push   $0x91
+   40613:	e9 fb 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040618 <exception_entry_146>:
+   40618:	6a 00                	push   $0x0
+   4061a:	68 92 00 00 00       	push   $0x92
+   4061f:	e9 ef 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040624 <exception_entry_147>:
+   40624:	6a 00                	push   $0x0
+   40626:	68 93 00 00 00       	push   $0x93
+   4062b:	e9 e3 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040630 <exception_entry_148>:
+   40630:	6a 00                	push   $0x0
+   40632:	68 94 00 00 00       	push   $0x94
+   40637:	e9 d7 04 00 00       	jmp    40b13 <exception_entry>
+
+000000000004063c <exception_entry_149>:
+   4063c:	6a 00                	push   $0x0
+   4063e:	68 95 00 00 00       	push   $0x95
+   40643:	e9 cb 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040648 <exception_entry_150>:
+   40648:	6a 00                	push   $0x0
+   4064a:	68 96 00 00 00       	push   $0x96
+   4064f:	e9 bf 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040654 <exception_entry_151>:
+   40654:	6a 00                	push   $0x0
+   40656:	68 97 00 00 00       	push   $0x97
+   4065b:	e9 b3 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040660 <exception_entry_152>:
+   40660:	6a 00                	push   $0x0
+   40662:	68 98 00 00 00       	push   $0x98
+   40667:	e9 a7 04 00 00       	jmp    40b13 <exception_entry>
+
+000000000004066c <exception_entry_153>:
+   4066c:	6a 00                	push   $0x0
+   4066e:	68 99 00 00 00       	push   $0x99
+   40673:	e9 9b 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040678 <exception_entry_154>:
+   40678:	6a 00                	push   $0x0
+   4067a:	68 9a 00 00 00       	push   $0x9a
+   4067f:	e9 8f 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040684 <exception_entry_155>:
+   40684:	6a 00                	push   $0x0
+   40686:	68 9b 00 00 00       	push   $0x9b
+   4068b:	e9 83 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040690 <exception_entry_156>:
+   40690:	6a 00                	push   $0x0
+   40692:	68 9c 00 00 00       	push   $0x9c
+   40697:	e9 77 04 00 00       	jmp    40b13 <exception_entry>
+
+000000000004069c <exception_entry_157>:
+   4069c:	6a 00                	push   $0x0
+   4069e:	68 9d 00 00 00       	push   $0x9d
+   406a3:	e9 6b 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406a8 <exception_entry_158>:
+   406a8:	6a 00                	push   $0x0
+   406aa:	68 9e 00 00 00       	push   $0x9e
+   406af:	e9 5f 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406b4 <exception_entry_159>:
+   406b4:	6a 00                	push   $0x0
+   406b6:	68 9f 00 00 00       	push   $0x9f
+   406bb:	e9 53 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406c0 <exception_entry_160>:
+   406c0:	6a 00                	push   $0x0
+   406c2:	68 a0 00 00 00       	push   $0xa0
+   406c7:	e9 47 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406cc <exception_entry_161>:
+   406cc:	6a 00                	push   $0x0
+   406ce:	68 a1 00 00 00       	push   $0xa1
+   406d3:	e9 3b 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406d8 <exception_entry_162>:
+   406d8:	6a 00                	push   $0x0
+   406da:	68 a2 00 00 00       	push   $0xa2
+   406df:	e9 2f 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406e4 <exception_entry_163>:
+   406e4:	6a 00                	push   $0x0
+   406e6:	68 a3 00 00 00       	push   $0xa3
+   406eb:	e9 23 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406f0 <exception_entry_164>:
+   406f0:	6a 00                	push   $0x0
+   406f2:	68 a4 00 00 00       	push   $0xa4
+   406f7:	e9 17 04 00 00       	jmp    40b13 <exception_entry>
+
+00000000000406fc <exception_entry_165>:
+   406fc:	6a 00                	push   $0x0
+   406fe:	68 a5 00 00 00       	push   $0xa5
+   40703:	e9 0b 04 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040708 <exception_entry_166>:
+   40708:	6a 00                	push   $0x0
+   4070a:	68 a6 00 00 00       	push   $0xa6
+   4070f:	e9 ff 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040714 <exception_entry_167>:
+   40714:	6a 00                	push   $0x0
+   40716:	68 a7 00 00 00       	push   $0xa7
+   4071b:	e9 f3 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040720 <exception_entry_168>:
+   40720:	6a 00                	push   $0x0
+   40722:	68 a8 00 00 00       	push   $0xa8
+   40727:	e9 e7 03 00 00       	jmp    40b13 <exception_entry>
+
+000000000004072c <exception_entry_169>:
+   4072c:	6a 00                	push   $0x0
+   4072e:	68 a9 00 00 00       	push   $0xa9
+   40733:	e9 db 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040738 <exception_entry_170>:
+   40738:	6a 00                	push   $0x0
+   4073a:	68 aa 00 00 00       	push   $0xaa
+   4073f:	e9 cf 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040744 <exception_entry_171>:
+   40744:	6a 00                	push   $0x0
+   40746:	68 ab 00 00 00       	push   $0xab
+   4074b:	e9 c3 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040750 <exception_entry_172>:
+   40750:	6a 00                	push   $0x0
+   40752:	68 ac 00 00 00       	push   $0xac
+   40757:	e9 b7 03 00 00       	jmp    40b13 <exception_entry>
+
+000000000004075c <exception_entry_173>:
+   4075c:	6a 00                	push   $0x0
+   4075e:	68 ad 00 00 00       	push   $0xad
+   40763:	e9 ab 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040768 <exception_entry_174>:
+   40768:	6a 00                	push   $0x0
+   4076a:	68 ae 00 00 00       	push   $0xae
+   4076f:	e9 9f 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040774 <exception_entry_175>:
+   40774:	6a 00                	push   $0x0
+   40776:	68 af 00 00 00       	push   $0xaf
+   4077b:	e9 93 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040780 <exception_entry_176>:
+   40780:	6a 00                	push   $0x0
+   40782:	68 b0 00 00 00       	push   $0xb0
+   40787:	e9 87 03 00 00       	jmp    40b13 <exception_entry>
+
+000000000004078c <exception_entry_177>:
+   4078c:	6a 00                	push   $0x0
+   4078e:	68 b1 00 00 00       	push   $0xb1
+   40793:	e9 7b 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040798 <exception_entry_178>:
+   40798:	6a 00                	push   $0x0
+   4079a:	68 b2 00 00 00       	push   $0xb2
+   4079f:	e9 6f 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407a4 <exception_entry_179>:
+   407a4:	6a 00                	push   $0x0
+   407a6:	68 b3 00 00 00       	push   $0xb3
+   407ab:	e9 63 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407b0 <exception_entry_180>:
+   407b0:	6a 00                	push   $0x0
+   407b2:	68 b4 00 00 00       	push   $0xb4
+   407b7:	e9 57 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407bc <exception_entry_181>:
+   407bc:	6a 00                	push   $0x0
+   407be:	68 b5 00 00 00       	push   $0xb5
+   407c3:	e9 4b 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407c8 <exception_entry_182>:
+   407c8:	6a 00                	push   $0x0
+   407ca:	68 b6 00 00 00       	push   $0xb6
+   407cf:	e9 3f 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407d4 <exception_entry_183>:
+   407d4:	6a 00                	push   $0x0
+   407d6:	68 b7 00 00 00       	push   $0xb7
+   407db:	e9 33 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407e0 <exception_entry_184>:
+   407e0:	6a 00                	push   $0x0
+   407e2:	68 b8 00 00 00       	push   $0xb8
+   407e7:	e9 27 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407ec <exception_entry_185>:
+   407ec:	6a 00                	push   $0x0
+   407ee:	68 b9 00 00 00       	push   $0xb9
+   407f3:	e9 1b 03 00 00       	jmp    40b13 <exception_entry>
+
+00000000000407f8 <exception_entry_186>:
+   407f8:	6a 00                	push   $0x0
+   407fa:	68 ba 00 00 00       	push   $0xba
+   407ff:	e9 0f 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040804 <exception_entry_187>:
+   40804:	6a 00                	push   $0x0
+   40806:	68 bb 00 00 00       	push   $0xbb
+   4080b:	e9 03 03 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040810 <exception_entry_188>:
+   40810:	6a 00                	push   $0x0
+   40812:	68 bc 00 00 00       	push   $0xbc
+   40817:	e9 f7 02 00 00       	jmp    40b13 <exception_entry>
+
+000000000004081c <exception_entry_189>:
+   4081c:	6a 00                	push   $0x0
+   4081e:	68 bd 00 00 00       	push   $0xbd
+   40823:	e9 eb 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040828 <exception_entry_190>:
+   40828:	6a 00                	push   $0x0
+   4082a:	68 be 00 00 00       	push   $0xbe
+   4082f:	e9 df 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040834 <exception_entry_191>:
+   40834:	6a 00                	push   $0x0
+   40836:	68 bf 00 00 00       	push   $0xbf
+   4083b:	e9 d3 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040840 <exception_entry_192>:
+   40840:	6a 00                	push   $0x0
+   40842:	68 c0 00 00 00       	push   $0xc0
+   40847:	e9 c7 02 00 00       	jmp    40b13 <exception_entry>
+
+000000000004084c <exception_entry_193>:
+   4084c:	6a 00                	push   $0x0
+   4084e:	68 c1 00 00 00       	push   $0xc1
+   40853:	e9 bb 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040858 <exception_entry_194>:
+   40858:	6a 00                	push   $0x0
+   4085a:	68 c2 00 00 00       	push   $0xc2
+   4085f:	e9 af 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040864 <exception_entry_195>:
+   40864:	6a 00                	push   $0x0
+   40866:	68 c3 00 00 00       	push   $0xc3
+   4086b:	e9 a3 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040870 <exception_entry_196>:
+   40870:	6a 00                	push   $0x0
+   40872:	68 c4 00 00 00       	push   $0xc4
+   40877:	e9 97 02 00 00       	jmp    40b13 <exception_entry>
+
+000000000004087c <exception_entry_197>:
+   4087c:	6a 00                	push   $0x0
+   4087e:	68 c5 00 00 00       	push   $0xc5
+   40883:	e9 8b 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040888 <exception_entry_198>:
+   40888:	6a 00                	push   $0x0
+   4088a:	68 c6 00 00 00       	push   $0xc6
+   4088f:	e9 7f 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040894 <exception_entry_199>:
+   40894:	6a 00                	push   $0x0
+   40896:	68 c7 00 00 00       	push   $0xc7
+   4089b:	e9 73 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408a0 <exception_entry_200>:
+   408a0:	6a 00                	push   $0x0
+   408a2:	68 c8 00 00 00       	push   $0xc8
+   408a7:	e9 67 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408ac <exception_entry_201>:
+   408ac:	6a 00                	push   $0x0
+   408ae:	68 c9 00 00 00       	push   $0xc9
+   408b3:	e9 5b 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408b8 <exception_entry_202>:
+   408b8:	6a 00                	push   $0x0
+   408ba:	68 ca 00 00 00       	push   $0xca
+   408bf:	e9 4f 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408c4 <exception_entry_203>:
+   408c4:	6a 00                	push   $0x0
+   408c6:	68 cb 00 00 00       	push   $0xcb
+   408cb:	e9 43 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408d0 <exception_entry_204>:
+   408d0:	6a 00                	push   $0x0
+   408d2:	68 cc 00 00 00       	push   $0xcc
+   408d7:	e9 37 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408dc <exception_entry_205>:
+   408dc:	6a 00                	push   $0x0
+   408de:	68 cd 00 00 00       	push   $0xcd
+   408e3:	e9 2b 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408e8 <exception_entry_206>:
+   408e8:	6a 00                	push   $0x0
+   408ea:	68 ce 00 00 00       	push   $0xce
+   408ef:	e9 1f 02 00 00       	jmp    40b13 <exception_entry>
+
+00000000000408f4 <exception_entry_207>:
+   408f4:	6a 00                	push   $0x0
+   408f6:	68 cf 00 00 00       	push   $0xcf
+   408fb:	e9 13 02 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040900 <exception_entry_208>:
+   40900:	6a 00                	push   $0x0
+   40902:	68 d0 00 00 00       	push   $0xd0
+   40907:	e9 07 02 00 00       	jmp    40b13 <exception_entry>
+
+000000000004090c <exception_entry_209>:
+   4090c:	6a 00                	push   $0x0
+   4090e:	68 d1 00 00 00       	push   $0xd1
+   40913:	e9 fb 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040918 <exception_entry_210>:
+   40918:	6a 00                	push   $0x0
+   4091a:	68 d2 00 00 00       	push   $0xd2
+   4091f:	e9 ef 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040924 <exception_entry_211>:
+   40924:	6a 00                	push   $0x0
+   40926:	68 d3 00 00 00       	push   $0xd3
+   4092b:	e9 e3 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040930 <exception_entry_212>:
+   40930:	6a 00                	push   $0x0
+   40932:	68 d4 00 00 00       	push   $0xd4
+   40937:	e9 d7 01 00 00       	jmp    40b13 <exception_entry>
+
+000000000004093c <exception_entry_213>:
+   4093c:	6a 00                	push   $0x0
+   4093e:	68 d5 00 00 00       	push   $0xd5
+   40943:	e9 cb 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040948 <exception_entry_214>:
+   40948:	6a 00                	push   $0x0
+   4094a:	68 d6 00 00 00       	push   $0xd6
+   4094f:	e9 bf 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040954 <exception_entry_215>:
+   40954:	6a 00                	push   $0x0
+   40956:	68 d7 00 00 00       	push   $0xd7
+   4095b:	e9 b3 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040960 <exception_entry_216>:
+   40960:	6a 00                	push   $0x0
+   40962:	68 d8 00 00 00       	push   $0xd8
+   40967:	e9 a7 01 00 00       	jmp    40b13 <exception_entry>
+
+000000000004096c <exception_entry_217>:
+   4096c:	6a 00                	push   $0x0
+   4096e:	68 d9 00 00 00       	push   $0xd9
+   40973:	e9 9b 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040978 <exception_entry_218>:
+   40978:	6a 00                	push   $0x0
+   4097a:	68 da 00 00 00       	push   $0xda
+   4097f:	e9 8f 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040984 <exception_entry_219>:
+   40984:	6a 00                	push   $0x0
+   40986:	68 db 00 00 00       	push   $0xdb
+   4098b:	e9 83 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040990 <exception_entry_220>:
+   40990:	6a 00                	push   $0x0
+   40992:	68 dc 00 00 00       	push   $0xdc
+   40997:	e9 77 01 00 00       	jmp    40b13 <exception_entry>
+
+000000000004099c <exception_entry_221>:
+   4099c:	6a 00                	push   $0x0
+   4099e:	68 dd 00 00 00       	push   $0xdd
+   409a3:	e9 6b 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409a8 <exception_entry_222>:
+   409a8:	6a 00                	push   $0x0
+   409aa:	68 de 00 00 00       	push   $0xde
+   409af:	e9 5f 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409b4 <exception_entry_223>:
+   409b4:	6a 00                	push   $0x0
+   409b6:	68 df 00 00 00       	push   $0xdf
+   409bb:	e9 53 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409c0 <exception_entry_224>:
+   409c0:	6a 00                	push   $0x0
+   409c2:	68 e0 00 00 00       	push   $0xe0
+   409c7:	e9 47 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409cc <exception_entry_225>:
+   409cc:	6a 00                	push   $0x0
+   409ce:	68 e1 00 00 00       	push   $0xe1
+   409d3:	e9 3b 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409d8 <exception_entry_226>:
+   409d8:	6a 00                	push   $0x0
+   409da:	68 e2 00 00 00       	push   $0xe2
+   409df:	e9 2f 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409e4 <exception_entry_227>:
+   409e4:	6a 00                	push   $0x0
+   409e6:	68 e3 00 00 00       	push   $0xe3
+   409eb:	e9 23 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409f0 <exception_entry_228>:
+   409f0:	6a 00                	push   $0x0
+   409f2:	68 e4 00 00 00       	push   $0xe4
+   409f7:	e9 17 01 00 00       	jmp    40b13 <exception_entry>
+
+00000000000409fc <exception_entry_229>:
+   409fc:	6a 00                	push   $0x0
+   409fe:	68 e5 00 00 00       	push   $0xe5
+   40a03:	e9 0b 01 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a08 <exception_entry_230>:
+   40a08:	6a 00                	push   $0x0
+   40a0a:	68 e6 00 00 00       	push   $0xe6
+   40a0f:	e9 ff 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a14 <exception_entry_231>:
+   40a14:	6a 00                	push   $0x0
+   40a16:	68 e7 00 00 00       	push   $0xe7
+   40a1b:	e9 f3 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a20 <exception_entry_232>:
+   40a20:	6a 00                	push   $0x0
+   40a22:	68 e8 00 00 00       	push   $0xe8
+   40a27:	e9 e7 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a2c <exception_entry_233>:
+   40a2c:	6a 00                	push   $0x0
+   40a2e:	68 e9 00 00 00       	push   $0xe9
+   40a33:	e9 db 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a38 <exception_entry_234>:
+   40a38:	6a 00                	push   $0x0
+   40a3a:	68 ea 00 00 00       	push   $0xea
+   40a3f:	e9 cf 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a44 <exception_entry_235>:
+   40a44:	6a 00                	push   $0x0
+   40a46:	68 eb 00 00 00       	push   $0xeb
+   40a4b:	e9 c3 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a50 <exception_entry_236>:
+   40a50:	6a 00                	push   $0x0
+   40a52:	68 ec 00 00 00       	push   $0xec
+   40a57:	e9 b7 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a5c <exception_entry_237>:
+   40a5c:	6a 00                	push   $0x0
+   40a5e:	68 ed 00 00 00       	push   $0xed
+   40a63:	e9 ab 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a68 <exception_entry_238>:
+   40a68:	6a 00                	push   $0x0
+   40a6a:	68 ee 00 00 00       	push   $0xee
+   40a6f:	e9 9f 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a74 <exception_entry_239>:
+   40a74:	6a 00                	push   $0x0
+   40a76:	68 ef 00 00 00       	push   $0xef
+   40a7b:	e9 93 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a80 <exception_entry_240>:
+   40a80:	6a 00                	push   $0x0
+   40a82:	68 f0 00 00 00       	push   $0xf0
+   40a87:	e9 87 00 00 00       	jmp    40b13 <exception_entry>
+
+0000000000040a8c <exception_entry_241>:
+   40a8c:	6a 00                	push   $0x0
+   40a8e:	68 f1 00 00 00       	push   $0xf1
+   40a93:	eb 7e                	jmp    40b13 <exception_entry>
+
+0000000000040a95 <exception_entry_242>:
+   40a95:	6a 00                	push   $0x0
+   40a97:	68 f2 00 00 00       	push   $0xf2
+   40a9c:	eb 75                	jmp    40b13 <exception_entry>
+
+0000000000040a9e <exception_entry_243>:
+   40a9e:	6a 00                	push   $0x0
+   40aa0:	68 f3 00 00 00       	push   $0xf3
+   40aa5:	eb 6c                	jmp    40b13 <exception_entry>
+
+0000000000040aa7 <exception_entry_244>:
+   40aa7:	6a 00                	push   $0x0
+   40aa9:	68 f4 00 00 00       	push   $0xf4
+   40aae:	eb 63                	jmp    40b13 <exception_entry>
+
+0000000000040ab0 <exception_entry_245>:
+   40ab0:	6a 00                	push   $0x0
+   40ab2:	68 f5 00 00 00       	push   $0xf5
+   40ab7:	eb 5a                	jmp    40b13 <exception_entry>
+
+0000000000040ab9 <exception_entry_246>:
+   40ab9:	6a 00                	push   $0x0
+   40abb:	68 f6 00 00 00       	push   $0xf6
+   40ac0:	eb 51                	jmp    40b13 <exception_entry>
+
+0000000000040ac2 <exception_entry_247>:
+   40ac2:	6a 00                	push   $0x0
+   40ac4:	68 f7 00 00 00       	push   $0xf7
+   40ac9:	eb 48                	jmp    40b13 <exception_entry>
+
+0000000000040acb <exception_entry_248>:
+   40acb:	6a 00                	push   $0x0
+   40acd:	68 f8 00 00 00       	push   $0xf8
+   40ad2:	eb 3f                	jmp    40b13 <exception_entry>
+
+0000000000040ad4 <exception_entry_249>:
+   40ad4:	6a 00                	push   $0x0
+   40ad6:	68 f9 00 00 00       	push   $0xf9
+   40adb:	eb 36                	jmp    40b13 <exception_entry>
+
+0000000000040add <exception_entry_250>:
+   40add:	6a 00                	push   $0x0
+   40adf:	68 fa 00 00 00       	push   $0xfa
+   40ae4:	eb 2d                	jmp    40b13 <exception_entry>
+
+0000000000040ae6 <exception_entry_251>:
+   40ae6:	6a 00                	push   $0x0
+   40ae8:	68 fb 00 00 00       	push   $0xfb
+   40aed:	eb 24                	jmp    40b13 <exception_entry>
+
+0000000000040aef <exception_entry_252>:
+   40aef:	6a 00                	push   $0x0
+   40af1:	68 fc 00 00 00       	push   $0xfc
+   40af6:	eb 1b                	jmp    40b13 <exception_entry>
+
+0000000000040af8 <exception_entry_253>:
+   40af8:	6a 00                	push   $0x0
+   40afa:	68 fd 00 00 00       	push   $0xfd
+   40aff:	eb 12                	jmp    40b13 <exception_entry>
+
+0000000000040b01 <exception_entry_254>:
+   40b01:	6a 00                	push   $0x0
+   40b03:	68 fe 00 00 00       	push   $0xfe
+   40b08:	eb 09                	jmp    40b13 <exception_entry>
+
+0000000000040b0a <exception_entry_255>:
+   40b0a:	6a 00                	push   $0x0
+   40b0c:	68 ff 00 00 00       	push   $0xff
+   40b11:	eb 00                	jmp    40b13 <exception_entry>
+
+0000000000040b13 <exception_entry>:
+//    Most exception handlers jump here.
+.globl exception_entry
+exception_entry:
+        // C code assumes DF is clear, but user mode may have set it;
+        // `iretq` restores the interrupted code's flags
+        cld
+   40b13:	fc                   	cld
+        // from user mode, switch to the kernel's %gs base (see `cpustate`)
+        testb $3, 24(%rsp)
+   40b14:	f6 44 24 18 03       	testb  $0x3,0x18(%rsp)
+        jz 1f
+   40b19:	74 03                	je     40b1e <exception_entry+0xb>
+        swapgs
+   40b1b:	0f 01 f8             	swapgs
+1:      push %gs
+   40b1e:	0f a8                	push   %gs
+        push %fs
+   40b20:	0f a0                	push   %fs
+        pushq %r15
+   40b22:	41 57                	push   %r15
+        pushq %r14
+   40b24:	41 56                	push   %r14
+        pushq %r13
+   40b26:	41 55                	push   %r13
+        pushq %r12
+   40b28:	41 54                	push   %r12
+        pushq %r11
+   40b2a:	41 53                	push   %r11
+        pushq %r10
+   40b2c:	41 52                	push   %r10
+        pushq %r9
+   40b2e:	41 51                	push   %r9
+        pushq %r8
+   40b30:	41 50                	push   %r8
+        pushq %rdi
+   40b32:	57                   	push   %rdi
+        pushq %rsi
+   40b33:	56                   	push   %rsi
+        pushq %rbp
+   40b34:	55                   	push   %rbp
+        pushq %rbx
+   40b35:	53                   	push   %rbx
+        pushq %rdx
+   40b36:	52                   	push   %rdx
+        pushq %rcx
+   40b37:	51                   	push   %rcx
+        pushq %rax
+   40b38:	50                   	push   %rax
+        movq %rsp, %rdi
+   40b39:	48 89 e7             	mov    %rsp,%rdi
+
+        // stay on the current page table: every process page table maps
+        // the kernel with global pages, so no %cr3 load (and TLB flush)
+        // is needed
+        call kernel_exception
+   40b3c:	e8 97 1d 00 00       	call   428d8 <kernel_exception>
+        // `kernel_exception` returns only from interrupts taken in kernel
+        // mode; resume the interrupted kernel code
+        jmp exception_restore
+   40b41:	eb 04                	jmp    40b47 <exception_restore>
+
+0000000000040b43 <exception_return>:
+// exception_return(p)
+//    Resume process `p` from `p->regs`, which sits at offset 16 of `proc`.
+//    The caller has loaded `p`'s page table.
+        .globl exception_return
+exception_return:
+        leaq 16(%rdi), %rsp
+   40b43:	48 8d 67 10          	lea    0x10(%rdi),%rsp
+
+0000000000040b47 <exception_restore>:
+
+// exception_restore
+//    Restore the `regstate` at `%rsp` and return from the exception.
+exception_restore:
+        popq %rax
+   40b47:	58                   	pop    %rax
+        popq %rcx
+   40b48:	59                   	pop    %rcx
+        popq %rdx
+   40b49:	5a                   	pop    %rdx
+        popq %rbx
+   40b4a:	5b                   	pop    %rbx
+        popq %rbp
+   40b4b:	5d                   	pop    %rbp
+        popq %rsi
+   40b4c:	5e                   	pop    %rsi
+        popq %rdi
+   40b4d:	5f                   	pop    %rdi
+        popq %r8
+   40b4e:	41 58                	pop    %r8
+        popq %r9
+   40b50:	41 59                	pop    %r9
+        popq %r10
+   40b52:	41 5a                	pop    %r10
+        popq %r11
+   40b54:	41 5b                	pop    %r11
+        popq %r12
+   40b56:	41 5c                	pop    %r12
+        popq %r13
+   40b58:	41 5d                	pop    %r13
+        popq %r14
+   40b5a:	41 5e                	pop    %r14
+        popq %r15
+   40b5c:	41 5f                	pop    %r15
+        // skip %fs, %gs, reg_intno/reg_swapgs, and reg_errcode
+        addq $32, %rsp
+   40b5e:	48 83 c4 20          	add    $0x20,%rsp
+        // to user mode, switch back to the user's %gs base
+        testb $3, 8(%rsp)
+   40b62:	f6 44 24 08 03       	testb  $0x3,0x8(%rsp)
+        jz 1f
+   40b67:	74 03                	je     40b6c <exception_restore+0x25>
+        swapgs
+   40b69:	0f 01 f8             	swapgs
+1:      iretq
+   40b6c:	48 cf                	iretq
+
+0000000000040b6e <syscall_entry>:
+// syscall_entry
+//    Kernel entry point for the `syscall` instruction
+
+        .globl syscall_entry
+syscall_entry:
+        swapgs                              // %gs: this CPU's `cpustate`
+   40b6e:	0f 01 f8             	swapgs
+        movq %rsp, %gs:CPUSTATE_SYSCALL_RSP // save entry %rsp
+   40b71:	65 48 89 24 25 10 00 	mov    %rsp,%gs:0x10
+   40b78:	00 00 
+        movq %gs:CPUSTATE_KSTACK_TOP, %rsp  // change to kernel stack
+   40b7a:	65 48 8b 24 25 08 00 	mov    %gs:0x8,%rsp
+   40b81:	00 00 
+
+        // structure used by `iret`:
+        pushq $(SEGSEL_APP_DATA + 3)   // %ss
+   40b83:	6a 23                	push   $0x23
+        pushq %gs:CPUSTATE_SYSCALL_RSP // %rsp
+   40b85:	65 ff 34 25 10 00 00 	push   %gs:0x10
+   40b8c:	00 
+        pushq %r11                     // %rflags
+   40b8d:	41 53                	push   %r11
+        pushq $(SEGSEL_APP_CODE + 3)   // %cs
+   40b8f:	6a 1b                	push   $0x1b
+        pushq %rcx                     // %rip
+   40b91:	51                   	push   %rcx
+
+        // other registers:
+        subq $8, %rsp                  // error code unused
+   40b92:	48 83 ec 08          	sub    $0x8,%rsp
+        pushq $-1                      // reg_intno
+   40b96:	6a ff                	push   $0xffffffffffffffff
+        push %gs
+   40b98:	0f a8                	push   %gs
+        push %fs
+   40b9a:	0f a0                	push   %fs
+        pushq %r15 // callee saved
+   40b9c:	41 57                	push   %r15
+        pushq %r14 // callee saved
+   40b9e:	41 56                	push   %r14
+        pushq %r13 // callee saved
+   40ba0:	41 55                	push   %r13
+        pushq %r12 // callee saved
+   40ba2:	41 54                	push   %r12
+        subq $8, %rsp                  // %r11 clobbered by `syscall`
+   40ba4:	48 83 ec 08          	sub    $0x8,%rsp
+        pushq %r10
+   40ba8:	41 52                	push   %r10
+        pushq %r9
+   40baa:	41 51                	push   %r9
+        pushq %r8
+   40bac:	41 50                	push   %r8
+        pushq %rdi
+   40bae:	57                   	push   %rdi
+        pushq %rsi
+   40baf:	56                   	push   %rsi
+        pushq %rbp // callee saved
+   40bb0:	55                   	push   %rbp
+        pushq %rbx // callee saved
+   40bb1:	53                   	push   %rbx
+        pushq %rdx
+   40bb2:	52                   	push   %rdx
+        subq $8, %rsp                  // %rcx clobbered by `syscall`
+   40bb3:	48 83 ec 08          	sub    $0x8,%rsp
+        pushq %rax
+   40bb7:	50                   	push   %rax
+
+        // stay on the process page table (see `exception_entry`)
+
+        // call syscall()
+        movq %rsp, %rdi
+   40bb8:	48 89 e7             	mov    %rsp,%rdi
+        call syscall
+   40bbb:	e8 99 16 00 00       	call   42259 <syscall>
+
+        // return to `current` with the result in %rax, or run another
+        // process if it blocked; `syscall_return` does not return
+        movq %rax, %rdi
+   40bc0:	48 89 c7             	mov    %rax,%rdi
+        call syscall_return
+   40bc3:	e8 4d 14 00 00       	call   42015 <syscall_return>
+
+0000000000040bc8 <free_area_push>:
+// `init_kernel_memory` loads `kernel_pagetable`.
+#define BOOT_PAGETABLE_START 0x1000
+#define BOOT_PAGETABLE_END 0x3000
+
+static void free_area_push(uint32_t pn, int order) {
+  pageinfo *pi = &pages[pn];
+   40bc8:	89 f8                	mov    %edi,%eax
+   40bca:	48 c1 e0 04          	shl    $0x4,%rax
+   40bce:	48 03 05 2b e4 00 00 	add    0xe42b(%rip),%rax        # 4f000 <pages>
+  pi->free = true;
+   40bd5:	80 48 02 01          	orb    $0x1,0x2(%rax)
+  pi->order = order;
+   40bd9:	40 88 70 01          	mov    %sil,0x1(%rax)
+  pi->prev = 0;
+   40bdd:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  pi->next = free_area[order];
+   40be4:	48 63 d6             	movslq %esi,%rdx
+   40be7:	8b 14 95 a0 12 05 00 	mov    0x512a0(,%rdx,4),%edx
+   40bee:	89 50 08             	mov    %edx,0x8(%rax)
+  if (pi->next) {
+   40bf1:	85 d2                	test   %edx,%edx
+   40bf3:	74 10                	je     40c05 <free_area_push+0x3d>
+    pages[pi->next].prev = pn;
+   40bf5:	89 d2                	mov    %edx,%edx
+   40bf7:	48 c1 e2 04          	shl    $0x4,%rdx
+   40bfb:	48 03 15 fe e3 00 00 	add    0xe3fe(%rip),%rdx        # 4f000 <pages>
+   40c02:	89 7a 0c             	mov    %edi,0xc(%rdx)
+  }
+  free_area[order] = pn;
+   40c05:	48 63 f6             	movslq %esi,%rsi
+   40c08:	89 3c b5 a0 12 05 00 	mov    %edi,0x512a0(,%rsi,4)
+}
+   40c0f:	c3                   	ret
+
+0000000000040c10 <free_area_remove>:
+
+static void free_area_remove(uint32_t pn) {
+  pageinfo *pi = &pages[pn];
+   40c10:	48 8b 15 e9 e3 00 00 	mov    0xe3e9(%rip),%rdx        # 4f000 <pages>
+   40c17:	89 ff                	mov    %edi,%edi
+   40c19:	48 c1 e7 04          	shl    $0x4,%rdi
+   40c1d:	48 01 d7             	add    %rdx,%rdi
+  if (pi->prev) {
+   40c20:	8b 47 0c             	mov    0xc(%rdi),%eax
+   40c23:	85 c0                	test   %eax,%eax
+   40c25:	74 26                	je     40c4d <free_area_remove+0x3d>
+    pages[pi->prev].next = pi->next;
+   40c27:	8b 4f 08             	mov    0x8(%rdi),%ecx
+   40c2a:	89 c0                	mov    %eax,%eax
+   40c2c:	48 c1 e0 04          	shl    $0x4,%rax
+   40c30:	89 4c 02 08          	mov    %ecx,0x8(%rdx,%rax,1)
+  } else {
+    free_area[pi->order] = pi->next;
+  }
+  if (pi->next) {
+   40c34:	8b 47 08             	mov    0x8(%rdi),%eax
+   40c37:	85 c0                	test   %eax,%eax
+   40c39:	74 0d                	je     40c48 <free_area_remove+0x38>
+    pages[pi->next].prev = pi->prev;
+   40c3b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+   40c3e:	89 c0                	mov    %eax,%eax
+   40c40:	48 c1 e0 04          	shl    $0x4,%rax
+   40c44:	89 4c 02 0c          	mov    %ecx,0xc(%rdx,%rax,1)
+  }
+  pi->free = false;
+   40c48:	80 67 02 fe          	andb   $0xfe,0x2(%rdi)
+}
+   40c4c:	c3                   	ret
+    free_area[pi->order] = pi->next;
+   40c4d:	0f b6 47 01          	movzbl 0x1(%rdi),%eax
+   40c51:	8b 4f 08             	mov    0x8(%rdi),%ecx
+   40c54:	89 0c 85 a0 12 05 00 	mov    %ecx,0x512a0(,%rax,4)
+   40c5b:	eb d7                	jmp    40c34 <free_area_remove+0x24>
+
+0000000000040c5d <buddy_free>:
+
+// buddy_free(pn, order)
+//    Return the order-`order` block starting at page `pn` to the free
+//    lists, coalescing it with free buddies.
+static void buddy_free(uint32_t pn, int order) {
+   40c5d:	55                   	push   %rbp
+   40c5e:	48 89 e5             	mov    %rsp,%rbp
+   40c61:	41 56                	push   %r14
+   40c63:	41 55                	push   %r13
+   40c65:	41 54                	push   %r12
+   40c67:	53                   	push   %rbx
+   40c68:	41 89 fd             	mov    %edi,%r13d
+   40c6b:	89 f3                	mov    %esi,%ebx
+  nfree_pages += 1UL << order;
+   40c6d:	b8 01 00 00 00       	mov    $0x1,%eax
+   40c72:	89 f1                	mov    %esi,%ecx
+   40c74:	48 d3 e0             	shl    %cl,%rax
+   40c77:	48 01 05 02 06 01 00 	add    %rax,0x10602(%rip)        # 51280 <nfree_pages>
+  while (order < PAGE_MAXORDER) {
+   40c7e:	83 fe 08             	cmp    $0x8,%esi
+   40c81:	7f 4b                	jg     40cce <buddy_free+0x71>
+    uint32_t buddy = pn ^ (1U << order);
+   40c83:	41 be 01 00 00 00    	mov    $0x1,%r14d
+   40c89:	45 89 f4             	mov    %r14d,%r12d
+   40c8c:	89 d9                	mov    %ebx,%ecx
+   40c8e:	41 d3 e4             	shl    %cl,%r12d
+   40c91:	44 89 e7             	mov    %r12d,%edi
+   40c94:	44 31 ef             	xor    %r13d,%edi
+    if (buddy >= npages || !pages[buddy].free || pages[buddy].order != order) {
+   40c97:	89 f8                	mov    %edi,%eax
+   40c99:	48 3b 05 68 e3 00 00 	cmp    0xe368(%rip),%rax        # 4f008 <npages>
+   40ca0:	73 2c                	jae    40cce <buddy_free+0x71>
+   40ca2:	48 c1 e0 04          	shl    $0x4,%rax
+   40ca6:	48 03 05 53 e3 00 00 	add    0xe353(%rip),%rax        # 4f000 <pages>
+   40cad:	f6 40 02 01          	testb  $0x1,0x2(%rax)
+   40cb1:	74 1b                	je     40cce <buddy_free+0x71>
+   40cb3:	0f b6 40 01          	movzbl 0x1(%rax),%eax
+   40cb7:	39 d8                	cmp    %ebx,%eax
+   40cb9:	75 13                	jne    40cce <buddy_free+0x71>
+      break;
+    }
+    free_area_remove(buddy);
+   40cbb:	e8 50 ff ff ff       	call   40c10 <free_area_remove>
+    pn &= ~(1U << order);
+   40cc0:	41 f7 d4             	not    %r12d
+   40cc3:	45 21 e5             	and    %r12d,%r13d
+    ++order;
+   40cc6:	83 c3 01             	add    $0x1,%ebx
+  while (order < PAGE_MAXORDER) {
+   40cc9:	83 fb 09             	cmp    $0x9,%ebx
+   40ccc:	75 bb                	jne    40c89 <buddy_free+0x2c>
+  }
+  free_area_push(pn, order);
+   40cce:	89 de                	mov    %ebx,%esi
+   40cd0:	44 89 ef             	mov    %r13d,%edi
+   40cd3:	e8 f0 fe ff ff       	call   40bc8 <free_area_push>
+}
+   40cd8:	5b                   	pop    %rbx
+   40cd9:	41 5c                	pop    %r12
+   40cdb:	41 5d                	pop    %r13
+   40cdd:	41 5e                	pop    %r14
+   40cdf:	5d                   	pop    %rbp
+   40ce0:	c3                   	ret
+
+0000000000040ce1 <buddy_alloc>:
+
+// buddy_alloc(order)
+//    Allocate an order-`order` block, splitting a larger block if
+//    needed. Returns its first page number, or 0 if none is free.
+static uint32_t buddy_alloc(int order) {
+   40ce1:	55                   	push   %rbp
+   40ce2:	48 89 e5             	mov    %rsp,%rbp
+   40ce5:	41 56                	push   %r14
+   40ce7:	41 55                	push   %r13
+   40ce9:	41 54                	push   %r12
+   40ceb:	53                   	push   %rbx
+   40cec:	41 89 fc             	mov    %edi,%r12d
+  int k = order;
+  while (k < PAGE_NORDERS && !free_area[k]) {
+   40cef:	83 ff 09             	cmp    $0x9,%edi
+   40cf2:	0f 8f 91 00 00 00    	jg     40d89 <buddy_alloc+0xa8>
+   40cf8:	48 63 c7             	movslq %edi,%rax
+   40cfb:	89 c2                	mov    %eax,%edx
+   40cfd:	83 3c 85 a0 12 05 00 	cmpl   $0x0,0x512a0(,%rax,4)
+   40d04:	00 
+   40d05:	75 0e                	jne    40d15 <buddy_alloc+0x34>
+   40d07:	48 83 c0 01          	add    $0x1,%rax
+   40d0b:	83 f8 09             	cmp    $0x9,%eax
+   40d0e:	7e eb                	jle    40cfb <buddy_alloc+0x1a>
+    ++k;
+   40d10:	8d 5a 01             	lea    0x1(%rdx),%ebx
+   40d13:	eb 02                	jmp    40d17 <buddy_alloc+0x36>
+   40d15:	89 c3                	mov    %eax,%ebx
+  }
+  if (k == PAGE_NORDERS) {
+    return 0;
+   40d17:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  if (k == PAGE_NORDERS) {
+   40d1d:	83 fb 0a             	cmp    $0xa,%ebx
+   40d20:	74 5b                	je     40d7d <buddy_alloc+0x9c>
+  }
+
+  uint32_t pn = free_area[k];
+   40d22:	48 63 c3             	movslq %ebx,%rax
+   40d25:	44 8b 2c 85 a0 12 05 	mov    0x512a0(,%rax,4),%r13d
+   40d2c:	00 
+  free_area_remove(pn);
+   40d2d:	44 89 ef             	mov    %r13d,%edi
+   40d30:	e8 db fe ff ff       	call   40c10 <free_area_remove>
+  // give back the upper half at each level
+  while (k > order) {
+   40d35:	41 39 dc             	cmp    %ebx,%r12d
+   40d38:	7d 1f                	jge    40d59 <buddy_alloc+0x78>
+    --k;
+    free_area_push(pn + (1U << k), k);
+   40d3a:	41 be 01 00 00 00    	mov    $0x1,%r14d
+    --k;
+   40d40:	83 eb 01             	sub    $0x1,%ebx
+    free_area_push(pn + (1U << k), k);
+   40d43:	44 89 f7             	mov    %r14d,%edi
+   40d46:	89 d9                	mov    %ebx,%ecx
+   40d48:	d3 e7                	shl    %cl,%edi
+   40d4a:	44 01 ef             	add    %r13d,%edi
+   40d4d:	89 de                	mov    %ebx,%esi
+   40d4f:	e8 74 fe ff ff       	call   40bc8 <free_area_push>
+  while (k > order) {
+   40d54:	41 39 dc             	cmp    %ebx,%r12d
+   40d57:	75 e7                	jne    40d40 <buddy_alloc+0x5f>
+  }
+  pages[pn].order = order;
+   40d59:	44 89 e8             	mov    %r13d,%eax
+   40d5c:	48 c1 e0 04          	shl    $0x4,%rax
+   40d60:	48 03 05 99 e2 00 00 	add    0xe299(%rip),%rax        # 4f000 <pages>
+   40d67:	44 88 60 01          	mov    %r12b,0x1(%rax)
+  nfree_pages -= 1UL << order;
+   40d6b:	b8 01 00 00 00       	mov    $0x1,%eax
+   40d70:	44 89 e1             	mov    %r12d,%ecx
+   40d73:	48 d3 e0             	shl    %cl,%rax
+   40d76:	48 29 05 03 05 01 00 	sub    %rax,0x10503(%rip)        # 51280 <nfree_pages>
+  return pn;
+}
+   40d7d:	44 89 e8             	mov    %r13d,%eax
+   40d80:	5b                   	pop    %rbx
+   40d81:	41 5c                	pop    %r12
+   40d83:	41 5d                	pop    %r13
+   40d85:	41 5e                	pop    %r14
+   40d87:	5d                   	pop    %rbp
+   40d88:	c3                   	ret
+    return 0;
+   40d89:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  if (k == PAGE_NORDERS) {
+   40d8f:	83 ff 0a             	cmp    $0xa,%edi
+   40d92:	74 e9                	je     40d7d <buddy_alloc+0x9c>
+  uint32_t pn = free_area[k];
+   40d94:	49 63 c4             	movslq %r12d,%rax
+   40d97:	44 8b 2c 85 a0 12 05 	mov    0x512a0(,%rax,4),%r13d
+   40d9e:	00 
+  free_area_remove(pn);
+   40d9f:	44 89 ef             	mov    %r13d,%edi
+   40da2:	e8 69 fe ff ff       	call   40c10 <free_area_remove>
+  while (k > order) {
+   40da7:	eb b0                	jmp    40d59 <buddy_alloc+0x78>
+
+0000000000040da9 <kalloc_claim>:
+  zero_pool[zero_pool_count++] = pn;
+  return true;
+}
+
+static void *kalloc_claim(uint32_t pn, int order) {
+  for (uint32_t i = 0; i < (1U << order); ++i) {
+   40da9:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+   40daf:	89 f1                	mov    %esi,%ecx
+   40db1:	41 d3 e0             	shl    %cl,%r8d
+   40db4:	41 01 f8             	add    %edi,%r8d
+   40db7:	89 f9                	mov    %edi,%ecx
+    pages[pn + i].refcount = 1;
+   40db9:	89 ca                	mov    %ecx,%edx
+   40dbb:	48 c1 e2 04          	shl    $0x4,%rdx
+   40dbf:	48 8b 35 3a e2 00 00 	mov    0xe23a(%rip),%rsi        # 4f000 <pages>
+   40dc6:	c6 04 16 01          	movb   $0x1,(%rsi,%rdx,1)
+    pages[pn + i].merged = false;
+   40dca:	48 8b 35 2f e2 00 00 	mov    0xe22f(%rip),%rsi        # 4f000 <pages>
+   40dd1:	80 64 16 02 fb       	andb   $0xfb,0x2(%rsi,%rdx,1)
+  for (uint32_t i = 0; i < (1U << order); ++i) {
+   40dd6:	83 c1 01             	add    $0x1,%ecx
+   40dd9:	41 39 c8             	cmp    %ecx,%r8d
+   40ddc:	75 db                	jne    40db9 <kalloc_claim+0x10>
+  }
+  return (void *)((uintptr_t)pn * PAGESIZE);
+   40dde:	89 f8                	mov    %edi,%eax
+   40de0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+   40de4:	c3                   	ret
+
+0000000000040de5 <timer_update>:
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) x), "d" (x >> 32));
+}
+
+__always_inline uint64_t rdtsc() {
+    uint64_t low, high;
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   40de5:	0f 31                	rdtsc
+    return low | (high << 32);
+   40de7:	48 c1 e2 20          	shl    $0x20,%rdx
+   40deb:	48 09 c2             	or     %rax,%rdx
+
+// timer_update()
+//    Bring `ticks` up to date with the TSC. Returns true if this call
+//    advanced it.
+static bool timer_update() {
+  int now = (rdtsc() - tsc_boot) / tsc_per_tick;
+   40dee:	48 89 d0             	mov    %rdx,%rax
+   40df1:	48 2b 05 f0 08 01 00 	sub    0x108f0(%rip),%rax        # 516e8 <tsc_boot>
+   40df8:	ba 00 00 00 00       	mov    $0x0,%edx
+   40dfd:	48 f7 35 14 e2 00 00 	divq   0xe214(%rip)        # 4f018 <tsc_per_tick>
+   40e04:	48 89 c1             	mov    %rax,%rcx
+   40e07:	48 89 c6             	mov    %rax,%rsi
+   40e0a:	89 c2                	mov    %eax,%edx
+  int old = __atomic_load_n(&ticks, __ATOMIC_RELAXED);
+   40e0c:	8b 05 0e e2 00 00    	mov    0xe20e(%rip),%eax        # 4f020 <ticks>
+  while (old < now &&
+   40e12:	39 c2                	cmp    %eax,%edx
+   40e14:	7e 0a                	jle    40e20 <timer_update+0x3b>
+         !__atomic_compare_exchange_n(&ticks, &old, now, false,
+   40e16:	f0 0f b1 35 02 e2 00 	lock cmpxchg %esi,0xe202(%rip)        # 4f020 <ticks>
+   40e1d:	00 
+  while (old < now &&
+   40e1e:	75 f2                	jne    40e12 <timer_update+0x2d>
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+  return old < now;
+   40e20:	39 c1                	cmp    %eax,%ecx
+   40e22:	0f 9f c0             	setg   %al
+}
+   40e25:	c3                   	ret
+
+0000000000040e26 <spinlock_acquire>:
+//    Undo a successful `proc_claim(p)`.
+void proc_unclaim(proc* p);
+
+// Spinlocks
+static inline void spinlock_acquire(spinlock* l) {
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   40e26:	ba 01 00 00 00       	mov    $0x1,%edx
+   40e2b:	eb 08                	jmp    40e35 <spinlock_acquire+0xf>
+}
+
+__always_inline void pause() {
+    asm volatile("pause" : : : "memory");
+   40e2d:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   40e2f:	8b 07                	mov    (%rdi),%eax
+   40e31:	85 c0                	test   %eax,%eax
+   40e33:	75 f8                	jne    40e2d <spinlock_acquire+0x7>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   40e35:	89 d0                	mov    %edx,%eax
+   40e37:	87 07                	xchg   %eax,(%rdi)
+   40e39:	85 c0                	test   %eax,%eax
+   40e3b:	75 f2                	jne    40e2f <spinlock_acquire+0x9>
+            pause();
+        }
+    }
+}
+   40e3d:	c3                   	ret
+
+0000000000040e3e <timer_arm>:
+    asm("movq %%gs:0, %0" : "=r"(c));
+   40e3e:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   40e45:	00 00 
+// timer_arm(deadline)
+//    Make this CPU's timer fire when the TSC reaches `deadline`, or never
+//    if `deadline` is 0.
+static void timer_arm(uint64_t deadline) {
+  cpustate *c = this_cpu();
+  if (deadline == c->timer_deadline) {
+   40e47:	48 39 78 40          	cmp    %rdi,0x40(%rax)
+   40e4b:	0f 84 b6 00 00 00    	je     40f07 <timer_arm+0xc9>
+    return;
+  }
+  c->timer_deadline = deadline;
+   40e51:	48 89 78 40          	mov    %rdi,0x40(%rax)
+  if (tsc_deadline_supported) {
+   40e55:	80 3d 84 08 01 00 00 	cmpb   $0x0,0x10884(%rip)        # 516e0 <tsc_deadline_supported>
+   40e5c:	0f 85 87 00 00 00    	jne    40ee9 <timer_arm+0xab>
+static void timer_arm(uint64_t deadline) {
+   40e62:	55                   	push   %rbp
+   40e63:	48 89 e5             	mov    %rsp,%rbp
+   40e66:	53                   	push   %rbx
+   40e67:	48 83 ec 08          	sub    $0x8,%rsp
+    wrmsr(MSR_IA32_TSC_DEADLINE, deadline);
+    return;
+  }
+  uint32_t count = 0;
+   40e6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (deadline) {
+   40e70:	48 85 ff             	test   %rdi,%rdi
+   40e73:	74 55                	je     40eca <timer_arm+0x8c>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   40e75:	0f 31                	rdtsc
+    return low | (high << 32);
+   40e77:	48 c1 e2 20          	shl    $0x20,%rdx
+   40e7b:	48 09 d0             	or     %rdx,%rax
+    uint64_t now = rdtsc();
+    uint64_t d = deadline > now ? deadline - now : 0;
+    uint64_t n = d / tsc_per_tick * lapic_timer_count +
+                 d % tsc_per_tick * lapic_timer_count / tsc_per_tick;
+    // a capped count fires early; the idle loop re-arms
+    count = n > UINT32_MAX ? UINT32_MAX : n ? n : 1;
+   40e7e:	bb 01 00 00 00       	mov    $0x1,%ebx
+    uint64_t d = deadline > now ? deadline - now : 0;
+   40e83:	48 39 f8             	cmp    %rdi,%rax
+   40e86:	73 42                	jae    40eca <timer_arm+0x8c>
+   40e88:	48 29 c7             	sub    %rax,%rdi
+    uint64_t n = d / tsc_per_tick * lapic_timer_count +
+   40e8b:	48 8b 0d 86 e1 00 00 	mov    0xe186(%rip),%rcx        # 4f018 <tsc_per_tick>
+   40e92:	8b 35 58 08 01 00    	mov    0x10858(%rip),%esi        # 516f0 <lapic_timer_count>
+                 d % tsc_per_tick * lapic_timer_count / tsc_per_tick;
+   40e98:	48 89 f8             	mov    %rdi,%rax
+   40e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+   40ea0:	48 f7 f1             	div    %rcx
+   40ea3:	48 89 c7             	mov    %rax,%rdi
+   40ea6:	48 89 d0             	mov    %rdx,%rax
+   40ea9:	48 0f af c6          	imul   %rsi,%rax
+   40ead:	ba 00 00 00 00       	mov    $0x0,%edx
+   40eb2:	48 f7 f1             	div    %rcx
+    uint64_t n = d / tsc_per_tick * lapic_timer_count +
+   40eb5:	48 0f af fe          	imul   %rsi,%rdi
+   40eb9:	48 01 f8             	add    %rdi,%rax
+    count = n > UINT32_MAX ? UINT32_MAX : n ? n : 1;
+   40ebc:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   40ec1:	48 89 c6             	mov    %rax,%rsi
+   40ec4:	48 c1 ee 20          	shr    $0x20,%rsi
+   40ec8:	74 30                	je     40efa <timer_arm+0xbc>
+  }
+  lapic_write(lapic_get(), APIC_REG_TIMER_INITIAL_COUNT, count);
+   40eca:	b8 00 00 00 00       	mov    $0x0,%eax
+   40ecf:	e8 e2 25 00 00       	call   434b6 <lapic_get>
+   40ed4:	48 89 c7             	mov    %rax,%rdi
+   40ed7:	89 da                	mov    %ebx,%edx
+   40ed9:	be 38 00 00 00       	mov    $0x38,%esi
+   40ede:	e8 aa 25 00 00       	call   4348d <lapic_write>
+}
+   40ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   40ee7:	c9                   	leave
+   40ee8:	c3                   	ret
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) x), "d" (x >> 32));
+   40ee9:	48 89 fa             	mov    %rdi,%rdx
+   40eec:	48 c1 ea 20          	shr    $0x20,%rdx
+   40ef0:	b9 e0 06 00 00       	mov    $0x6e0,%ecx
+   40ef5:	89 f8                	mov    %edi,%eax
+   40ef7:	0f 30                	wrmsr
+    return;
+   40ef9:	c3                   	ret
+    count = n > UINT32_MAX ? UINT32_MAX : n ? n : 1;
+   40efa:	48 85 c0             	test   %rax,%rax
+   40efd:	bb 01 00 00 00       	mov    $0x1,%ebx
+   40f02:	0f 45 d8             	cmovne %eax,%ebx
+   40f05:	eb c3                	jmp    40eca <timer_arm+0x8c>
+   40f07:	c3                   	ret
+
+0000000000040f08 <timer_arm_tick>:
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   40f08:	0f 31                	rdtsc
+
+// timer_arm_tick()
+//    Make sure this CPU's timer fires by the next tick boundary.
+static void timer_arm_tick() {
+  uint64_t next = timer_tsc((rdtsc() - tsc_boot) / tsc_per_tick + 1);
+   40f0a:	48 8b 35 d7 07 01 00 	mov    0x107d7(%rip),%rsi        # 516e8 <tsc_boot>
+   40f11:	48 8b 0d 00 e1 00 00 	mov    0xe100(%rip),%rcx        # 4f018 <tsc_per_tick>
+    return low | (high << 32);
+   40f18:	48 c1 e2 20          	shl    $0x20,%rdx
+   40f1c:	48 09 c2             	or     %rax,%rdx
+   40f1f:	48 89 d0             	mov    %rdx,%rax
+   40f22:	48 29 f0             	sub    %rsi,%rax
+   40f25:	ba 00 00 00 00       	mov    $0x0,%edx
+   40f2a:	48 f7 f1             	div    %rcx
+   40f2d:	48 83 c0 01          	add    $0x1,%rax
+  return tsc_boot + tick * tsc_per_tick;
+   40f31:	48 0f af c1          	imul   %rcx,%rax
+   40f35:	48 8d 3c 30          	lea    (%rax,%rsi,1),%rdi
+   40f39:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   40f40:	00 00 
+  uint64_t armed = this_cpu()->timer_deadline;
+  if (!armed || armed > next) {
+   40f42:	48 8b 40 40          	mov    0x40(%rax),%rax
+   40f46:	48 83 e8 01          	sub    $0x1,%rax
+   40f4a:	48 39 f8             	cmp    %rdi,%rax
+   40f4d:	73 01                	jae    40f50 <timer_arm_tick+0x48>
+   40f4f:	c3                   	ret
+static void timer_arm_tick() {
+   40f50:	55                   	push   %rbp
+   40f51:	48 89 e5             	mov    %rsp,%rbp
+    timer_arm(next);
+   40f54:	e8 e5 fe ff ff       	call   40e3e <timer_arm>
+  }
+}
+   40f59:	5d                   	pop    %rbp
+   40f5a:	c3                   	ret
+
+0000000000040f5b <reserved_physical_address>:
+  return pa < PAGESIZE || (pa >= IOPHYSMEM && pa < EXTPHYSMEM);
+   40f5b:	48 8d 87 00 00 f6 ff 	lea    -0xa0000(%rdi),%rax
+   40f62:	48 3d ff ff 05 00    	cmp    $0x5ffff,%rax
+   40f68:	0f 96 c0             	setbe  %al
+   40f6b:	48 81 ff ff 0f 00 00 	cmp    $0xfff,%rdi
+   40f72:	0f 96 c2             	setbe  %dl
+   40f75:	09 d0                	or     %edx,%eax
+}
+   40f77:	c3                   	ret
+
+0000000000040f78 <round_up>:
+  int offset = ptr % incr;
+   40f78:	48 89 f8             	mov    %rdi,%rax
+   40f7b:	ba 00 00 00 00       	mov    $0x0,%edx
+   40f80:	48 f7 f6             	div    %rsi
+  if (offset) {
+   40f83:	85 d2                	test   %edx,%edx
+   40f85:	75 04                	jne    40f8b <round_up+0x13>
+}
+   40f87:	48 89 f8             	mov    %rdi,%rax
+   40f8a:	c3                   	ret
+    return ptr - offset + incr;
+   40f8b:	48 01 f7             	add    %rsi,%rdi
+   40f8e:	48 63 d2             	movslq %edx,%rdx
+   40f91:	48 29 d7             	sub    %rdx,%rdi
+   40f94:	eb f1                	jmp    40f87 <round_up+0xf>
+
+0000000000040f96 <allocatable_physical_address>:
+bool allocatable_physical_address(uintptr_t pa) {
+   40f96:	55                   	push   %rbp
+   40f97:	48 89 e5             	mov    %rsp,%rbp
+   40f9a:	41 54                	push   %r12
+   40f9c:	53                   	push   %rbx
+   40f9d:	48 89 fb             	mov    %rdi,%rbx
+  return !reserved_physical_address(pa) &&
+   40fa0:	e8 b6 ff ff ff       	call   40f5b <reserved_physical_address>
+   40fa5:	41 89 c4             	mov    %eax,%r12d
+         pa < memsize_physical && ram_physical_address(pa);
+   40fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+   40fad:	45 84 e4             	test   %r12b,%r12b
+   40fb0:	75 50                	jne    41002 <allocatable_physical_address+0x6c>
+  return !reserved_physical_address(pa) &&
+   40fb2:	48 81 fb ff ff 03 00 	cmp    $0x3ffff,%rbx
+   40fb9:	76 32                	jbe    40fed <allocatable_physical_address+0x57>
+          pa >= round_up((uintptr_t)_kernel_end, PAGESIZE)) &&
+   40fbb:	be 00 10 00 00       	mov    $0x1000,%esi
+   40fc0:	bf a4 8f 05 00       	mov    $0x58fa4,%edi
+   40fc5:	e8 ae ff ff ff       	call   40f78 <round_up>
+   40fca:	48 89 c2             	mov    %rax,%rdx
+         pa < memsize_physical && ram_physical_address(pa);
+   40fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+         (pa < KERNEL_START_ADDR ||
+   40fd2:	48 39 d3             	cmp    %rdx,%rbx
+   40fd5:	72 2b                	jb     41002 <allocatable_physical_address+0x6c>
+         (pa < KERNEL_STACK_TOP - PAGESIZE || pa >= KERNEL_STACK_TOP) &&
+   40fd7:	48 8d 83 00 10 f8 ff 	lea    -0x7f000(%rbx),%rax
+          pa >= round_up((uintptr_t)_kernel_end, PAGESIZE)) &&
+   40fde:	48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+   40fe4:	77 24                	ja     4100a <allocatable_physical_address+0x74>
+         pa < memsize_physical && ram_physical_address(pa);
+   40fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+   40feb:	eb 15                	jmp    41002 <allocatable_physical_address+0x6c>
+         (pa < AP_TRAMPOLINE_ADDR || pa >= AP_TRAMPOLINE_ADDR + PAGESIZE) &&
+   40fed:	48 8d 93 00 90 ff ff 	lea    -0x7000(%rbx),%rdx
+         pa < memsize_physical && ram_physical_address(pa);
+   40ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+         (pa < KERNEL_STACK_TOP - PAGESIZE || pa >= KERNEL_STACK_TOP) &&
+   40ff9:	48 81 fa ff 0f 00 00 	cmp    $0xfff,%rdx
+   41000:	77 08                	ja     4100a <allocatable_physical_address+0x74>
+         pa < memsize_physical && ram_physical_address(pa);
+   41002:	83 e0 01             	and    $0x1,%eax
+}
+   41005:	5b                   	pop    %rbx
+   41006:	41 5c                	pop    %r12
+   41008:	5d                   	pop    %rbp
+   41009:	c3                   	ret
+  uintptr_t pages_pa = (uintptr_t)pages;
+   4100a:	48 8b 05 ef df 00 00 	mov    0xdfef(%rip),%rax        # 4f000 <pages>
+         (pa < AP_TRAMPOLINE_ADDR || pa >= AP_TRAMPOLINE_ADDR + PAGESIZE) &&
+   41011:	48 39 c3             	cmp    %rax,%rbx
+   41014:	72 25                	jb     4103b <allocatable_physical_address+0xa5>
+          pa >= round_up(pages_pa + npages * sizeof(pageinfo), PAGESIZE)) &&
+   41016:	48 8b 3d eb df 00 00 	mov    0xdfeb(%rip),%rdi        # 4f008 <npages>
+   4101d:	48 c1 e7 04          	shl    $0x4,%rdi
+   41021:	48 01 c7             	add    %rax,%rdi
+   41024:	be 00 10 00 00       	mov    $0x1000,%esi
+   41029:	e8 4a ff ff ff       	call   40f78 <round_up>
+   4102e:	48 89 c2             	mov    %rax,%rdx
+         pa < memsize_physical && ram_physical_address(pa);
+   41031:	b8 00 00 00 00       	mov    $0x0,%eax
+         (pa < pages_pa ||
+   41036:	48 39 d3             	cmp    %rdx,%rbx
+   41039:	72 c7                	jb     41002 <allocatable_physical_address+0x6c>
+         pa < memsize_physical && ram_physical_address(pa);
+   4103b:	b8 00 00 00 00       	mov    $0x0,%eax
+          pa >= round_up(pages_pa + npages * sizeof(pageinfo), PAGESIZE)) &&
+   41040:	48 3b 1d c9 df 00 00 	cmp    0xdfc9(%rip),%rbx        # 4f010 <memsize_physical>
+   41047:	73 b9                	jae    41002 <allocatable_physical_address+0x6c>
+  for (int i = 0; i < nram_regions; ++i) {
+   41049:	8b 15 79 02 01 00    	mov    0x10279(%rip),%edx        # 512c8 <nram_regions>
+   4104f:	85 d2                	test   %edx,%edx
+   41051:	7e 2f                	jle    41082 <allocatable_physical_address+0xec>
+   41053:	48 63 d2             	movslq %edx,%rdx
+   41056:	48 c1 e2 04          	shl    $0x4,%rdx
+   4105a:	b8 00 00 00 00       	mov    $0x0,%eax
+   4105f:	eb 09                	jmp    4106a <allocatable_physical_address+0xd4>
+   41061:	48 83 c0 10          	add    $0x10,%rax
+   41065:	48 39 d0             	cmp    %rdx,%rax
+   41068:	74 18                	je     41082 <allocatable_physical_address+0xec>
+    if (pa >= ram_regions[i].start && pa < ram_regions[i].end) {
+   4106a:	48 3b 98 e0 12 05 00 	cmp    0x512e0(%rax),%rbx
+   41071:	72 ee                	jb     41061 <allocatable_physical_address+0xcb>
+   41073:	48 3b 98 e8 12 05 00 	cmp    0x512e8(%rax),%rbx
+   4107a:	73 e5                	jae    41061 <allocatable_physical_address+0xcb>
+      return true;
+   4107c:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+         pa < memsize_physical && ram_physical_address(pa);
+   41082:	41 0f b6 c4          	movzbl %r12b,%eax
+   41086:	e9 77 ff ff ff       	jmp    41002 <allocatable_physical_address+0x6c>
+
+000000000004108b <zero_pool_refill>:
+    return false;
+   4108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (zero_pool_count == ZERO_POOL_MAX) {
+   41090:	83 3d d5 00 01 00 40 	cmpl   $0x40,0x100d5(%rip)        # 5116c <zero_pool_count>
+   41097:	74 53                	je     410ec <zero_pool_refill+0x61>
+bool zero_pool_refill() {
+   41099:	55                   	push   %rbp
+   4109a:	48 89 e5             	mov    %rsp,%rbp
+   4109d:	53                   	push   %rbx
+   4109e:	48 83 ec 08          	sub    $0x8,%rsp
+  uint32_t pn = buddy_alloc(0);
+   410a2:	bf 00 00 00 00       	mov    $0x0,%edi
+   410a7:	e8 35 fc ff ff       	call   40ce1 <buddy_alloc>
+   410ac:	89 c3                	mov    %eax,%ebx
+    return false;
+   410ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (!pn) {
+   410b3:	85 db                	test   %ebx,%ebx
+   410b5:	75 06                	jne    410bd <zero_pool_refill+0x32>
+}
+   410b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   410bb:	c9                   	leave
+   410bc:	c3                   	ret
+  memzero_nt((void *)((uintptr_t)pn * PAGESIZE), PAGESIZE);
+   410bd:	89 df                	mov    %ebx,%edi
+   410bf:	48 c1 e7 0c          	shl    $0xc,%rdi
+   410c3:	be 00 10 00 00       	mov    $0x1000,%esi
+   410c8:	e8 b0 35 00 00       	call   4467d <memzero_nt>
+  zero_pool[zero_pool_count++] = pn;
+   410cd:	8b 05 99 00 01 00    	mov    0x10099(%rip),%eax        # 5116c <zero_pool_count>
+   410d3:	8d 50 01             	lea    0x1(%rax),%edx
+   410d6:	89 15 90 00 01 00    	mov    %edx,0x10090(%rip)        # 5116c <zero_pool_count>
+   410dc:	48 98                	cltq
+   410de:	89 1c 85 80 11 05 00 	mov    %ebx,0x51180(,%rax,4)
+  return true;
+   410e5:	b8 01 00 00 00       	mov    $0x1,%eax
+   410ea:	eb cb                	jmp    410b7 <zero_pool_refill+0x2c>
+}
+   410ec:	c3                   	ret
+
+00000000000410ed <kalloc>:
+void *kalloc(size_t sz) {
+   410ed:	55                   	push   %rbp
+   410ee:	48 89 e5             	mov    %rsp,%rbp
+   410f1:	53                   	push   %rbx
+   410f2:	48 83 ec 08          	sub    $0x8,%rsp
+  int order = 0;
+   410f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while ((PAGESIZE << order) < sz) {
+   410fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+   41100:	48 89 d0             	mov    %rdx,%rax
+   41103:	89 d9                	mov    %ebx,%ecx
+   41105:	48 d3 e0             	shl    %cl,%rax
+   41108:	48 39 f8             	cmp    %rdi,%rax
+   4110b:	73 13                	jae    41120 <kalloc+0x33>
+    if (++order > PAGE_MAXORDER) {
+   4110d:	83 c3 01             	add    $0x1,%ebx
+   41110:	83 fb 0a             	cmp    $0xa,%ebx
+   41113:	75 eb                	jne    41100 <kalloc+0x13>
+      return NULL;
+   41115:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   4111a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   4111e:	c9                   	leave
+   4111f:	c3                   	ret
+  uint32_t pn = buddy_alloc(order);
+   41120:	89 df                	mov    %ebx,%edi
+   41122:	e8 ba fb ff ff       	call   40ce1 <buddy_alloc>
+   41127:	89 c7                	mov    %eax,%edi
+  if (!pn && order == 0 && zero_pool_count > 0) {
+   41129:	89 d8                	mov    %ebx,%eax
+   4112b:	09 f8                	or     %edi,%eax
+   4112d:	75 22                	jne    41151 <kalloc+0x64>
+   4112f:	8b 15 37 00 01 00    	mov    0x10037(%rip),%edx        # 5116c <zero_pool_count>
+    return NULL;
+   41135:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (!pn && order == 0 && zero_pool_count > 0) {
+   4113a:	85 d2                	test   %edx,%edx
+   4113c:	7e dc                	jle    4111a <kalloc+0x2d>
+    pn = zero_pool[--zero_pool_count];
+   4113e:	83 ea 01             	sub    $0x1,%edx
+   41141:	89 15 25 00 01 00    	mov    %edx,0x10025(%rip)        # 5116c <zero_pool_count>
+   41147:	48 63 d2             	movslq %edx,%rdx
+   4114a:	8b 3c 95 80 11 05 00 	mov    0x51180(,%rdx,4),%edi
+  if (!pn) {
+   41151:	85 ff                	test   %edi,%edi
+   41153:	74 09                	je     4115e <kalloc+0x71>
+  void *ptr = kalloc_claim(pn, order);
+   41155:	89 de                	mov    %ebx,%esi
+   41157:	e8 4d fc ff ff       	call   40da9 <kalloc_claim>
+  return ptr;
+   4115c:	eb bc                	jmp    4111a <kalloc+0x2d>
+    return NULL;
+   4115e:	b8 00 00 00 00       	mov    $0x0,%eax
+   41163:	eb b5                	jmp    4111a <kalloc+0x2d>
+
+0000000000041165 <kalloc_zeroed>:
+void *kalloc_zeroed(size_t sz) {
+   41165:	55                   	push   %rbp
+   41166:	48 89 e5             	mov    %rsp,%rbp
+   41169:	41 54                	push   %r12
+   4116b:	53                   	push   %rbx
+   4116c:	48 89 fb             	mov    %rdi,%rbx
+  if (sz <= PAGESIZE && zero_pool_count > 0) {
+   4116f:	48 81 ff 00 10 00 00 	cmp    $0x1000,%rdi
+   41176:	77 0a                	ja     41182 <kalloc_zeroed+0x1d>
+   41178:	8b 05 ee ff 00 00    	mov    0xffee(%rip),%eax        # 5116c <zero_pool_count>
+   4117e:	85 c0                	test   %eax,%eax
+   41180:	7f 34                	jg     411b6 <kalloc_zeroed+0x51>
+  void *ptr = kalloc(sz);
+   41182:	48 89 df             	mov    %rbx,%rdi
+   41185:	e8 63 ff ff ff       	call   410ed <kalloc>
+   4118a:	49 89 c4             	mov    %rax,%r12
+  if (ptr) {
+   4118d:	48 85 c0             	test   %rax,%rax
+   41190:	74 1c                	je     411ae <kalloc_zeroed+0x49>
+    memset(ptr, 0, sz <= PAGESIZE ? PAGESIZE : sz);
+   41192:	b8 00 10 00 00       	mov    $0x1000,%eax
+   41197:	48 39 c3             	cmp    %rax,%rbx
+   4119a:	48 0f 43 c3          	cmovae %rbx,%rax
+   4119e:	48 89 c2             	mov    %rax,%rdx
+   411a1:	be 00 00 00 00       	mov    $0x0,%esi
+   411a6:	4c 89 e7             	mov    %r12,%rdi
+   411a9:	e8 d1 33 00 00       	call   4457f <memset>
+}
+   411ae:	4c 89 e0             	mov    %r12,%rax
+   411b1:	5b                   	pop    %rbx
+   411b2:	41 5c                	pop    %r12
+   411b4:	5d                   	pop    %rbp
+   411b5:	c3                   	ret
+    return kalloc_claim(zero_pool[--zero_pool_count], 0);
+   411b6:	83 e8 01             	sub    $0x1,%eax
+   411b9:	89 05 ad ff 00 00    	mov    %eax,0xffad(%rip)        # 5116c <zero_pool_count>
+   411bf:	48 98                	cltq
+   411c1:	8b 3c 85 80 11 05 00 	mov    0x51180(,%rax,4),%edi
+   411c8:	be 00 00 00 00       	mov    $0x0,%esi
+   411cd:	e8 d7 fb ff ff       	call   40da9 <kalloc_claim>
+   411d2:	49 89 c4             	mov    %rax,%r12
+   411d5:	eb d7                	jmp    411ae <kalloc_zeroed+0x49>
+
+00000000000411d7 <direct_map>:
+//    `kernel_pagetable` with permissions `perm`. Each step uses the
+//    largest page that is aligned and fits: 1 GiB (if `maxlevel == 2`),
+//    2 MiB, or 4 KiB, so small pages only appear at the range's edges.
+//    Returns 0, or -1 if a page-table page cannot be allocated.
+static int direct_map(uintptr_t start, uintptr_t end, uint64_t perm,
+                      int maxlevel) {
+   411d7:	55                   	push   %rbp
+   411d8:	48 89 e5             	mov    %rsp,%rbp
+   411db:	41 57                	push   %r15
+   411dd:	41 56                	push   %r14
+   411df:	41 55                	push   %r13
+   411e1:	41 54                	push   %r12
+   411e3:	53                   	push   %rbx
+   411e4:	48 83 ec 28          	sub    $0x28,%rsp
+   411e8:	48 89 f3             	mov    %rsi,%rbx
+   411eb:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  uintptr_t pa = start;
+  while (pa < end) {
+   411ef:	48 39 f7             	cmp    %rsi,%rdi
+   411f2:	0f 83 28 01 00 00    	jae    41320 <direct_map+0x149>
+   411f8:	49 89 fe             	mov    %rdi,%r14
+   411fb:	89 ce                	mov    %ecx,%esi
+   411fd:	8d 44 c9 0c          	lea    0xc(%rcx,%rcx,8),%eax
+   41201:	89 45 bc             	mov    %eax,-0x44(%rbp)
+   41204:	48 89 da             	mov    %rbx,%rdx
+   41207:	e9 f3 00 00 00       	jmp    412ff <direct_map+0x128>
+    int level = maxlevel;
+    while (level > 0 &&
+   4120c:	83 e9 09             	sub    $0x9,%ecx
+   4120f:	41 83 ec 01          	sub    $0x1,%r12d
+   41213:	74 2d                	je     41242 <direct_map+0x6b>
+           ((pa & pageoffmask(level)) || end - pa <= pageoffmask(level))) {
+   41215:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   4121c:	48 d3 e0             	shl    %cl,%rax
+   4121f:	48 f7 d0             	not    %rax
+    while (level > 0 &&
+   41222:	4c 85 f0             	test   %r14,%rax
+   41225:	75 e5                	jne    4120c <direct_map+0x35>
+    return (1UL << (PAGEOFFBITS + level * PAGEINDEXBITS)) - 1;
+   41227:	b8 01 00 00 00       	mov    $0x1,%eax
+   4122c:	48 d3 e0             	shl    %cl,%rax
+   4122f:	48 83 e8 01          	sub    $0x1,%rax
+           ((pa & pageoffmask(level)) || end - pa <= pageoffmask(level))) {
+   41233:	48 39 f8             	cmp    %rdi,%rax
+   41236:	73 d4                	jae    4120c <direct_map+0x35>
+      --level;
+    }
+
+    x86_64_pagetable *pt = kernel_pagetable;
+    for (int l = 3; l > level; --l) {
+   41238:	41 83 fc 02          	cmp    $0x2,%r12d
+   4123c:	0f 8f d6 00 00 00    	jg     41318 <direct_map+0x141>
+   41242:	43 8d 5c e4 0c       	lea    0xc(%r12,%r12,8),%ebx
+    int level = maxlevel;
+   41247:	41 bd 27 00 00 00    	mov    $0x27,%r13d
+   4124d:	41 bf 00 b0 04 00    	mov    $0x4b000,%r15d
+   41253:	44 89 65 cc          	mov    %r12d,-0x34(%rbp)
+   41257:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+   4125b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+   4125e:	eb 1d                	jmp    4127d <direct_map+0xa6>
+        if (!npt) {
+          return -1;
+        }
+        *pep = (uintptr_t)npt | PTE_P | PTE_W | PTE_U;
+      }
+      pt = (x86_64_pagetable *)(*pep & PTE_PAMASK);
+   41260:	4d 63 e4             	movslq %r12d,%r12
+   41263:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   4126a:	ff 0f 00 
+   4126d:	4b 23 04 e7          	and    (%r15,%r12,8),%rax
+   41271:	49 89 c7             	mov    %rax,%r15
+    for (int l = 3; l > level; --l) {
+   41274:	41 83 ed 09          	sub    $0x9,%r13d
+   41278:	44 39 eb             	cmp    %r13d,%ebx
+   4127b:	74 3b                	je     412b8 <direct_map+0xe1>
+    return (int) (addr >> (PAGEOFFBITS + level * PAGEINDEXBITS)) & 0x1FF;
+   4127d:	4c 89 f0             	mov    %r14,%rax
+   41280:	44 89 e9             	mov    %r13d,%ecx
+   41283:	48 d3 e8             	shr    %cl,%rax
+   41286:	41 89 c4             	mov    %eax,%r12d
+   41289:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+      if (!(*pep & PTE_P)) {
+   41290:	25 ff 01 00 00       	and    $0x1ff,%eax
+   41295:	41 f6 04 c7 01       	testb  $0x1,(%r15,%rax,8)
+   4129a:	75 c4                	jne    41260 <direct_map+0x89>
+        x86_64_pagetable *npt = kalloc_zeroed(PAGESIZE);
+   4129c:	bf 00 10 00 00       	mov    $0x1000,%edi
+   412a1:	e8 bf fe ff ff       	call   41165 <kalloc_zeroed>
+        if (!npt) {
+   412a6:	48 85 c0             	test   %rax,%rax
+   412a9:	74 7c                	je     41327 <direct_map+0x150>
+        *pep = (uintptr_t)npt | PTE_P | PTE_W | PTE_U;
+   412ab:	49 63 d4             	movslq %r12d,%rdx
+   412ae:	48 83 c8 07          	or     $0x7,%rax
+   412b2:	49 89 04 d7          	mov    %rax,(%r15,%rdx,8)
+   412b6:	eb a8                	jmp    41260 <direct_map+0x89>
+   412b8:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+   412bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+   412c0:	8b 75 c8             	mov    -0x38(%rbp),%esi
+   412c3:	43 8d 4c e4 0c       	lea    0xc(%r12,%r12,8),%ecx
+   412c8:	4c 89 f7             	mov    %r14,%rdi
+   412cb:	48 d3 ef             	shr    %cl,%rdi
+    }
+    pt->entry[pageindex(pa, level)] = pa | perm | (level ? PTE_PS : 0);
+   412ce:	81 e7 ff 01 00 00    	and    $0x1ff,%edi
+   412d4:	45 85 e4             	test   %r12d,%r12d
+   412d7:	0f 95 c0             	setne  %al
+   412da:	0f b6 c0             	movzbl %al,%eax
+   412dd:	48 c1 e0 07          	shl    $0x7,%rax
+   412e1:	4c 8b 45 b0          	mov    -0x50(%rbp),%r8
+   412e5:	4d 09 f0             	or     %r14,%r8
+   412e8:	4c 09 c0             	or     %r8,%rax
+   412eb:	49 89 04 ff          	mov    %rax,(%r15,%rdi,8)
+    return (1UL << (PAGEOFFBITS + level * PAGEINDEXBITS)) - 1;
+   412ef:	b8 01 00 00 00       	mov    $0x1,%eax
+   412f4:	48 d3 e0             	shl    %cl,%rax
+    pa += pageoffmask(level) + 1;
+   412f7:	49 01 c6             	add    %rax,%r14
+  while (pa < end) {
+   412fa:	49 39 d6             	cmp    %rdx,%r14
+   412fd:	73 3c                	jae    4133b <direct_map+0x164>
+    while (level > 0 &&
+   412ff:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+    int level = maxlevel;
+   41302:	41 89 f4             	mov    %esi,%r12d
+           ((pa & pageoffmask(level)) || end - pa <= pageoffmask(level))) {
+   41305:	48 89 d7             	mov    %rdx,%rdi
+   41308:	4c 29 f7             	sub    %r14,%rdi
+    while (level > 0 &&
+   4130b:	85 f6                	test   %esi,%esi
+   4130d:	0f 8f 02 ff ff ff    	jg     41215 <direct_map+0x3e>
+   41313:	e9 20 ff ff ff       	jmp    41238 <direct_map+0x61>
+    for (int l = 3; l > level; --l) {
+   41318:	41 bf 00 b0 04 00    	mov    $0x4b000,%r15d
+   4131e:	eb a3                	jmp    412c3 <direct_map+0xec>
+  }
+  return 0;
+   41320:	b8 00 00 00 00       	mov    $0x0,%eax
+   41325:	eb 05                	jmp    4132c <direct_map+0x155>
+          return -1;
+   41327:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+   4132c:	48 83 c4 28          	add    $0x28,%rsp
+   41330:	5b                   	pop    %rbx
+   41331:	41 5c                	pop    %r12
+   41333:	41 5d                	pop    %r13
+   41335:	41 5e                	pop    %r14
+   41337:	41 5f                	pop    %r15
+   41339:	5d                   	pop    %rbp
+   4133a:	c3                   	ret
+  return 0;
+   4133b:	b8 00 00 00 00       	mov    $0x0,%eax
+   41340:	eb ea                	jmp    4132c <direct_map+0x155>
+
+0000000000041342 <kfree>:
+  if (!kptr || kptr == zero_frame) {
+   41342:	48 85 ff             	test   %rdi,%rdi
+   41345:	0f 84 a2 00 00 00    	je     413ed <kfree+0xab>
+   4134b:	48 39 3d 6e 0a 01 00 	cmp    %rdi,0x10a6e(%rip)        # 51dc0 <zero_frame>
+   41352:	0f 84 95 00 00 00    	je     413ed <kfree+0xab>
+void kfree(void *kptr) {
+   41358:	55                   	push   %rbp
+   41359:	48 89 e5             	mov    %rsp,%rbp
+   4135c:	41 55                	push   %r13
+   4135e:	41 54                	push   %r12
+   41360:	53                   	push   %rbx
+   41361:	48 83 ec 08          	sub    $0x8,%rsp
+  uint32_t pn = (uintptr_t)kptr / PAGESIZE;
+   41365:	48 c1 ef 0c          	shr    $0xc,%rdi
+   41369:	49 89 fc             	mov    %rdi,%r12
+  if (--pages[pn].refcount == 0) {
+   4136c:	41 89 fd             	mov    %edi,%r13d
+   4136f:	49 c1 e5 04          	shl    $0x4,%r13
+   41373:	4c 89 ea             	mov    %r13,%rdx
+   41376:	48 03 15 83 dc 00 00 	add    0xdc83(%rip),%rdx        # 4f000 <pages>
+   4137d:	0f b6 02             	movzbl (%rdx),%eax
+   41380:	83 e8 01             	sub    $0x1,%eax
+   41383:	88 02                	mov    %al,(%rdx)
+   41385:	84 c0                	test   %al,%al
+   41387:	75 52                	jne    413db <kfree+0x99>
+  uint32_t pn = (uintptr_t)kptr / PAGESIZE;
+   41389:	89 fb                	mov    %edi,%ebx
+    if (pages[pn].swapslot) {
+   4138b:	48 8b 05 6e dc 00 00 	mov    0xdc6e(%rip),%rax        # 4f000 <pages>
+   41392:	42 83 7c 28 04 00    	cmpl   $0x0,0x4(%rax,%r13,1)
+   41398:	75 4c                	jne    413e6 <kfree+0xa4>
+    int order = pages[pn].order;
+   4139a:	48 8b 05 5f dc 00 00 	mov    0xdc5f(%rip),%rax        # 4f000 <pages>
+   413a1:	42 0f b6 74 28 01    	movzbl 0x1(%rax,%r13,1),%esi
+    for (uint32_t i = 1; i < (1U << order); ++i) {
+   413a7:	bf 01 00 00 00       	mov    $0x1,%edi
+   413ac:	89 f1                	mov    %esi,%ecx
+   413ae:	d3 e7                	shl    %cl,%edi
+   413b0:	83 ff 01             	cmp    $0x1,%edi
+   413b3:	76 1f                	jbe    413d4 <kfree+0x92>
+   413b5:	41 8d 54 24 01       	lea    0x1(%r12),%edx
+   413ba:	44 01 e7             	add    %r12d,%edi
+      pages[pn + i].refcount = 0;
+   413bd:	89 d0                	mov    %edx,%eax
+   413bf:	48 c1 e0 04          	shl    $0x4,%rax
+   413c3:	48 03 05 36 dc 00 00 	add    0xdc36(%rip),%rax        # 4f000 <pages>
+   413ca:	c6 00 00             	movb   $0x0,(%rax)
+    for (uint32_t i = 1; i < (1U << order); ++i) {
+   413cd:	83 c2 01             	add    $0x1,%edx
+   413d0:	39 fa                	cmp    %edi,%edx
+   413d2:	75 e9                	jne    413bd <kfree+0x7b>
+    buddy_free(pn, order);
+   413d4:	89 df                	mov    %ebx,%edi
+   413d6:	e8 82 f8 ff ff       	call   40c5d <buddy_free>
+}
+   413db:	48 83 c4 08          	add    $0x8,%rsp
+   413df:	5b                   	pop    %rbx
+   413e0:	41 5c                	pop    %r12
+   413e2:	41 5d                	pop    %r13
+   413e4:	5d                   	pop    %rbp
+   413e5:	c3                   	ret
+      swap_forget(pn);
+   413e6:	e8 2e 4b 00 00       	call   45f19 <swap_forget>
+   413eb:	eb ad                	jmp    4139a <kfree+0x58>
+   413ed:	c3                   	ret
+
+00000000000413ee <bench_map>:
+
+// bench_map(pt, va, page, perm)
+//    Map `page` at `va` in `pt`, or drop the caller's reference to it and
+//    return false if `page` is `nullptr` or the mapping fails.
+static bool bench_map(x86_64_pagetable *pt, uintptr_t va, void *page,
+                      int perm) {
+   413ee:	55                   	push   %rbp
+   413ef:	48 89 e5             	mov    %rsp,%rbp
+   413f2:	41 55                	push   %r13
+   413f4:	41 54                	push   %r12
+   413f6:	53                   	push   %rbx
+   413f7:	48 83 ec 28          	sub    $0x28,%rsp
+   413fb:	49 89 f4             	mov    %rsi,%r12
+   413fe:	48 89 d3             	mov    %rdx,%rbx
+   41401:	41 89 cd             	mov    %ecx,%r13d
+  vmiter_t it = vmiter_init(pt);
+   41404:	48 89 fe             	mov    %rdi,%rsi
+   41407:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   4140b:	e8 71 23 00 00       	call   43781 <vmiter_init>
+  vmiter_va_add(&it, va);
+   41410:	4c 89 e6             	mov    %r12,%rsi
+   41413:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41417:	e8 df 25 00 00       	call   439fb <vmiter_va_add>
+  if (!page || vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+   4141c:	48 85 db             	test   %rbx,%rbx
+   4141f:	74 25                	je     41446 <bench_map+0x58>
+   41421:	44 89 ea             	mov    %r13d,%edx
+   41424:	48 89 de             	mov    %rbx,%rsi
+   41427:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   4142b:	e8 b1 23 00 00       	call   437e1 <vmiter_map>
+   41430:	89 c2                	mov    %eax,%edx
+    kfree(page);
+    return false;
+  }
+  return true;
+   41432:	b8 01 00 00 00       	mov    $0x1,%eax
+  if (!page || vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+   41437:	85 d2                	test   %edx,%edx
+   41439:	78 0b                	js     41446 <bench_map+0x58>
+}
+   4143b:	48 83 c4 28          	add    $0x28,%rsp
+   4143f:	5b                   	pop    %rbx
+   41440:	41 5c                	pop    %r12
+   41442:	41 5d                	pop    %r13
+   41444:	5d                   	pop    %rbp
+   41445:	c3                   	ret
+    kfree(page);
+   41446:	48 89 df             	mov    %rbx,%rdi
+   41449:	e8 f4 fe ff ff       	call   41342 <kfree>
+    return false;
+   4144e:	b8 00 00 00 00       	mov    $0x0,%eax
+   41453:	eb e6                	jmp    4143b <bench_map+0x4d>
+
+0000000000041455 <bench_proc_start>:
+
+// bench_proc_start(p, fn, data, arg)
+//    Make `p` run `fn(data, arg)` and queue it. `fn` must be in
+//    `.usertext`; `data` is a page the kernel shares with the process,
+//    which `fn` receives at its user address.
+static bool bench_proc_start(proc *p, void *fn, void *data, uintptr_t arg) {
+   41455:	55                   	push   %rbp
+   41456:	48 89 e5             	mov    %rsp,%rbp
+   41459:	41 57                	push   %r15
+   4145b:	41 56                	push   %r14
+   4145d:	41 55                	push   %r13
+   4145f:	41 54                	push   %r12
+   41461:	53                   	push   %rbx
+   41462:	48 83 ec 08          	sub    $0x8,%rsp
+   41466:	48 89 fb             	mov    %rdi,%rbx
+   41469:	49 89 f6             	mov    %rsi,%r14
+   4146c:	49 89 d4             	mov    %rdx,%r12
+   4146f:	49 89 cf             	mov    %rcx,%r15
+  // assert(_usertext_end - _usertext_start <= PAGESIZE);
+  p->pagetable = pagetable_new();
+   41472:	b8 00 00 00 00       	mov    $0x0,%eax
+   41477:	e8 53 26 00 00       	call   43acf <pagetable_new>
+   4147c:	48 89 03             	mov    %rax,(%rbx)
+  if (!p->pagetable) {
+    return false;
+   4147f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  if (!p->pagetable) {
+   41485:	48 85 c0             	test   %rax,%rax
+   41488:	0f 84 91 00 00 00    	je     4151f <bench_proc_start+0xca>
+  }
+  void *text = kalloc(PAGESIZE);
+   4148e:	bf 00 10 00 00       	mov    $0x1000,%edi
+   41493:	e8 55 fc ff ff       	call   410ed <kalloc>
+   41498:	49 89 c5             	mov    %rax,%r13
+  if (text) {
+   4149b:	48 85 c0             	test   %rax,%rax
+   4149e:	74 19                	je     414b9 <bench_proc_start+0x64>
+    memcpy(text, _usertext_start, _usertext_end - _usertext_start);
+   414a0:	ba 31 6d 04 00       	mov    $0x46d31,%edx
+   414a5:	48 81 ea 2f 6c 04 00 	sub    $0x46c2f,%rdx
+   414ac:	be 2f 6c 04 00       	mov    $0x46c2f,%esi
+   414b1:	48 89 c7             	mov    %rax,%rdi
+   414b4:	e8 f2 30 00 00       	call   445ab <memcpy>
+  }
+  ++pages[(uintptr_t)data / PAGESIZE].refcount;
+   414b9:	4c 89 e0             	mov    %r12,%rax
+   414bc:	48 c1 e8 0c          	shr    $0xc,%rax
+   414c0:	48 c1 e0 04          	shl    $0x4,%rax
+   414c4:	48 03 05 35 db 00 00 	add    0xdb35(%rip),%rax        # 4f000 <pages>
+   414cb:	80 00 01             	addb   $0x1,(%rax)
+  if (!bench_map(p->pagetable, BENCH_DATA_ADDR, data, PTE_PWU | PTE_SHARED) ||
+   414ce:	48 8b 3b             	mov    (%rbx),%rdi
+   414d1:	b9 07 04 00 00       	mov    $0x407,%ecx
+   414d6:	4c 89 e2             	mov    %r12,%rdx
+   414d9:	48 be 00 10 00 00 80 	movabs $0x8000001000,%rsi
+   414e0:	00 00 00 
+   414e3:	e8 06 ff ff ff       	call   413ee <bench_map>
+   414e8:	84 c0                	test   %al,%al
+   414ea:	74 1e                	je     4150a <bench_proc_start+0xb5>
+      !bench_map(p->pagetable, BENCH_TEXT_ADDR, text, PTE_P | PTE_U) ||
+   414ec:	48 8b 3b             	mov    (%rbx),%rdi
+   414ef:	b9 05 00 00 00       	mov    $0x5,%ecx
+   414f4:	4c 89 ea             	mov    %r13,%rdx
+   414f7:	48 be 00 00 00 00 80 	movabs $0x8000000000,%rsi
+   414fe:	00 00 00 
+   41501:	e8 e8 fe ff ff       	call   413ee <bench_map>
+  if (!bench_map(p->pagetable, BENCH_DATA_ADDR, data, PTE_PWU | PTE_SHARED) ||
+   41506:	84 c0                	test   %al,%al
+   41508:	75 27                	jne    41531 <bench_proc_start+0xdc>
+      !bench_map(p->pagetable, BENCH_STACK_ADDR, kalloc(PAGESIZE),
+                 PTE_PWU)) {
+    pagetable_free(p->pagetable);
+   4150a:	48 8b 3b             	mov    (%rbx),%rdi
+   4150d:	e8 dc 25 00 00       	call   43aee <pagetable_free>
+    p->pagetable = NULL;
+   41512:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+    return false;
+   41519:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  p->regs.reg_ss = SEGSEL_APP_DATA | 3;
+  p->regs.reg_rflags = EFLAGS_IF;
+  sched_init_proc(p);
+  sched_enqueue(p);
+  return true;
+}
+   4151f:	44 89 e8             	mov    %r13d,%eax
+   41522:	48 83 c4 08          	add    $0x8,%rsp
+   41526:	5b                   	pop    %rbx
+   41527:	41 5c                	pop    %r12
+   41529:	41 5d                	pop    %r13
+   4152b:	41 5e                	pop    %r14
+   4152d:	41 5f                	pop    %r15
+   4152f:	5d                   	pop    %rbp
+   41530:	c3                   	ret
+      !bench_map(p->pagetable, BENCH_STACK_ADDR, kalloc(PAGESIZE),
+   41531:	bf 00 10 00 00       	mov    $0x1000,%edi
+   41536:	e8 b2 fb ff ff       	call   410ed <kalloc>
+   4153b:	48 89 c2             	mov    %rax,%rdx
+   4153e:	48 8b 3b             	mov    (%rbx),%rdi
+   41541:	b9 07 00 00 00       	mov    $0x7,%ecx
+   41546:	48 be 00 20 00 00 80 	movabs $0x8000002000,%rsi
+   4154d:	00 00 00 
+   41550:	e8 99 fe ff ff       	call   413ee <bench_map>
+   41555:	41 89 c5             	mov    %eax,%r13d
+      !bench_map(p->pagetable, BENCH_TEXT_ADDR, text, PTE_P | PTE_U) ||
+   41558:	84 c0                	test   %al,%al
+   4155a:	74 ae                	je     4150a <bench_proc_start+0xb5>
+  memset(&p->regs, 0, sizeof(p->regs));
+   4155c:	48 8d 7b 10          	lea    0x10(%rbx),%rdi
+   41560:	ba c0 00 00 00       	mov    $0xc0,%edx
+   41565:	be 00 00 00 00       	mov    $0x0,%esi
+   4156a:	e8 10 30 00 00       	call   4457f <memset>
+  p->pid = p - ptable;
+   4156f:	48 89 d8             	mov    %rbx,%rax
+   41572:	48 2d 40 f0 04 00    	sub    $0x4f040,%rax
+   41578:	48 c1 f8 04          	sar    $0x4,%rax
+   4157c:	48 ba 35 c2 72 4f 23 	movabs $0x34f72c234f72c235,%rdx
+   41583:	2c f7 34 
+   41586:	48 0f af c2          	imul   %rdx,%rax
+   4158a:	89 43 08             	mov    %eax,0x8(%rbx)
+  p->regs.reg_rip = BENCH_TEXT_ADDR + ((char *)fn - _usertext_start);
+   4158d:	48 b8 2f 6c 04 00 80 	movabs $0xffffff8000046c2f,%rax
+   41594:	ff ff ff 
+   41597:	49 29 c6             	sub    %rax,%r14
+   4159a:	4c 89 b3 a8 00 00 00 	mov    %r14,0xa8(%rbx)
+  p->regs.reg_rdi = BENCH_DATA_ADDR;
+   415a1:	48 b8 00 10 00 00 80 	movabs $0x8000001000,%rax
+   415a8:	00 00 00 
+   415ab:	48 89 43 40          	mov    %rax,0x40(%rbx)
+  p->regs.reg_rsi = arg;
+   415af:	4c 89 7b 38          	mov    %r15,0x38(%rbx)
+  p->regs.reg_rsp = BENCH_STACK_ADDR + PAGESIZE - 8;
+   415b3:	48 8d 80 f8 1f 00 00 	lea    0x1ff8(%rax),%rax
+   415ba:	48 89 83 c0 00 00 00 	mov    %rax,0xc0(%rbx)
+  p->regs.reg_cs = SEGSEL_APP_CODE | 3;
+   415c1:	48 c7 83 b0 00 00 00 	movq   $0x1b,0xb0(%rbx)
+   415c8:	1b 00 00 00 
+  p->regs.reg_ss = SEGSEL_APP_DATA | 3;
+   415cc:	48 c7 83 c8 00 00 00 	movq   $0x23,0xc8(%rbx)
+   415d3:	23 00 00 00 
+  p->regs.reg_rflags = EFLAGS_IF;
+   415d7:	48 c7 83 b8 00 00 00 	movq   $0x200,0xb8(%rbx)
+   415de:	00 02 00 00 
+  sched_init_proc(p);
+   415e2:	48 89 df             	mov    %rbx,%rdi
+   415e5:	e8 92 4d 00 00       	call   4637c <sched_init_proc>
+  sched_enqueue(p);
+   415ea:	48 89 df             	mov    %rbx,%rdi
+   415ed:	e8 5a 4b 00 00       	call   4614c <sched_enqueue>
+  return true;
+   415f2:	e9 28 ff ff ff       	jmp    4151f <bench_proc_start+0xca>
+
+00000000000415f7 <kalloc_nfree>:
+size_t kalloc_nfree() { return nfree_pages + zero_pool_count; }
+   415f7:	48 63 05 6e fb 00 00 	movslq 0xfb6e(%rip),%rax        # 5116c <zero_pool_count>
+   415fe:	48 03 05 7b fc 00 00 	add    0xfc7b(%rip),%rax        # 51280 <nfree_pages>
+   41605:	c3                   	ret
+
+0000000000041606 <clear_vga_buffer>:
+  return (uint16_t)uc | (uint16_t)color << 8;
+   41606:	89 f1                	mov    %esi,%ecx
+   41608:	c1 e1 08             	shl    $0x8,%ecx
+   4160b:	83 c9 20             	or     $0x20,%ecx
+   4160e:	48 8d 97 a0 00 00 00 	lea    0xa0(%rdi),%rdx
+   41615:	48 8d b7 40 10 00 00 	lea    0x1040(%rdi),%rsi
+    for (int x = 0; x < VGA_WIDTH; x++) {
+   4161c:	48 8d 82 60 ff ff ff 	lea    -0xa0(%rdx),%rax
+      buffer[index] = vga_entry(' ', color);
+   41623:	66 89 08             	mov    %cx,(%rax)
+    for (int x = 0; x < VGA_WIDTH; x++) {
+   41626:	48 83 c0 02          	add    $0x2,%rax
+   4162a:	48 39 d0             	cmp    %rdx,%rax
+   4162d:	75 f4                	jne    41623 <clear_vga_buffer+0x1d>
+  for (int y = 0; y < VGA_HEIGHT; y++) {
+   4162f:	48 81 c2 a0 00 00 00 	add    $0xa0,%rdx
+   41636:	48 39 f2             	cmp    %rsi,%rdx
+   41639:	75 e1                	jne    4161c <clear_vga_buffer+0x16>
+}
+   4163b:	c3                   	ret
+
+000000000004163c <vga_print>:
+  for (size_t i = 0; str[i] != '\0'; i++) {
+   4163c:	80 3f 00             	cmpb   $0x0,(%rdi)
+   4163f:	0f 84 f3 00 00 00    	je     41738 <vga_print+0xfc>
+void vga_print(const char *str, uint8_t color) {
+   41645:	55                   	push   %rbp
+   41646:	48 89 e5             	mov    %rsp,%rbp
+   41649:	41 56                	push   %r14
+   4164b:	41 55                	push   %r13
+   4164d:	41 54                	push   %r12
+   4164f:	53                   	push   %rbx
+   41650:	49 89 fc             	mov    %rdi,%r12
+        VGA_BUFFER[index + x] = vga_entry(' ', color);
+   41653:	40 0f b6 de          	movzbl %sil,%ebx
+  return (uint16_t)uc | (uint16_t)color << 8;
+   41657:	c1 e3 08             	shl    $0x8,%ebx
+   4165a:	41 89 dd             	mov    %ebx,%r13d
+   4165d:	83 cb 20             	or     $0x20,%ebx
+      int offset = VGA_WIDTH - (index % VGA_WIDTH);
+   41660:	49 be cd cc cc cc cc 	movabs $0xcccccccccccccccd,%r14
+   41667:	cc cc cc 
+   4166a:	e9 84 00 00 00       	jmp    416f3 <vga_print+0xb7>
+      memmove(VGA_BUFFER, VGA_BUFFER + VGA_WIDTH,
+   4166f:	ba 00 0f 00 00       	mov    $0xf00,%edx
+   41674:	be a0 80 0b 00       	mov    $0xb80a0,%esi
+   41679:	bf 00 80 0b 00       	mov    $0xb8000,%edi
+   4167e:	e8 62 2f 00 00       	call   445e5 <memmove>
+      index = VGA_WIDTH * (VGA_HEIGHT - 1);
+   41683:	48 c7 05 52 fa 00 00 	movq   $0x780,0xfa52(%rip)        # 510e0 <index.1>
+   4168a:	80 07 00 00 
+   4168e:	b8 00 8f 0b 00       	mov    $0xb8f00,%eax
+        VGA_BUFFER[index + x] = vga_entry(' ', color);
+   41693:	66 89 18             	mov    %bx,(%rax)
+      for (int x = 0; x < VGA_WIDTH; ++x) {
+   41696:	48 83 c0 02          	add    $0x2,%rax
+   4169a:	48 3d a0 8f 0b 00    	cmp    $0xb8fa0,%rax
+   416a0:	75 f1                	jne    41693 <vga_print+0x57>
+   416a2:	eb 60                	jmp    41704 <vga_print+0xc8>
+      int offset = VGA_WIDTH - (index % VGA_WIDTH);
+   416a4:	48 8b 0d 35 fa 00 00 	mov    0xfa35(%rip),%rcx        # 510e0 <index.1>
+   416ab:	48 89 c8             	mov    %rcx,%rax
+   416ae:	49 f7 e6             	mul    %r14
+   416b1:	48 c1 ea 06          	shr    $0x6,%rdx
+   416b5:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+   416b9:	48 c1 e0 04          	shl    $0x4,%rax
+   416bd:	29 c8                	sub    %ecx,%eax
+   416bf:	8d 70 50             	lea    0x50(%rax),%esi
+      for (int j = 0; j < offset; ++j) {
+   416c2:	48 8d 94 09 00 80 0b 	lea    0xb8000(%rcx,%rcx,1),%rdx
+   416c9:	00 
+   416ca:	b8 00 00 00 00       	mov    $0x0,%eax
+        VGA_BUFFER[index++] = vga_entry(' ', color);
+   416cf:	48 83 c1 01          	add    $0x1,%rcx
+   416d3:	66 89 1a             	mov    %bx,(%rdx)
+      for (int j = 0; j < offset; ++j) {
+   416d6:	83 c0 01             	add    $0x1,%eax
+   416d9:	48 83 c2 02          	add    $0x2,%rdx
+   416dd:	39 c6                	cmp    %eax,%esi
+   416df:	7f ee                	jg     416cf <vga_print+0x93>
+   416e1:	48 89 0d f8 f9 00 00 	mov    %rcx,0xf9f8(%rip)        # 510e0 <index.1>
+  for (size_t i = 0; str[i] != '\0'; i++) {
+   416e8:	49 83 c4 01          	add    $0x1,%r12
+   416ec:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+   416f1:	74 3c                	je     4172f <vga_print+0xf3>
+    if (index >= VGA_WIDTH * VGA_HEIGHT) {
+   416f3:	48 81 3d e2 f9 00 00 	cmpq   $0x7cf,0xf9e2(%rip)        # 510e0 <index.1>
+   416fa:	cf 07 00 00 
+   416fe:	0f 87 6b ff ff ff    	ja     4166f <vga_print+0x33>
+    char c = str[i];
+   41704:	41 0f b6 04 24       	movzbl (%r12),%eax
+    if (c == '\n') {
+   41709:	3c 0a                	cmp    $0xa,%al
+   4170b:	74 97                	je     416a4 <vga_print+0x68>
+      VGA_BUFFER[index++] = vga_entry(str[i], color);
+   4170d:	48 8b 15 cc f9 00 00 	mov    0xf9cc(%rip),%rdx        # 510e0 <index.1>
+   41714:	48 8d 4a 01          	lea    0x1(%rdx),%rcx
+   41718:	48 89 0d c1 f9 00 00 	mov    %rcx,0xf9c1(%rip)        # 510e0 <index.1>
+  return (uint16_t)uc | (uint16_t)color << 8;
+   4171f:	0f b6 c0             	movzbl %al,%eax
+   41722:	44 09 e8             	or     %r13d,%eax
+   41725:	66 89 84 12 00 80 0b 	mov    %ax,0xb8000(%rdx,%rdx,1)
+   4172c:	00 
+   4172d:	eb b9                	jmp    416e8 <vga_print+0xac>
+}
+   4172f:	5b                   	pop    %rbx
+   41730:	41 5c                	pop    %r12
+   41732:	41 5d                	pop    %r13
+   41734:	41 5e                	pop    %r14
+   41736:	5d                   	pop    %rbp
+   41737:	c3                   	ret
+   41738:	c3                   	ret
+
+0000000000041739 <proc_load_pagetable>:
+void proc_load_pagetable(proc *p) {
+   41739:	55                   	push   %rbp
+   4173a:	48 89 e5             	mov    %rsp,%rbp
+   4173d:	48 83 ec 10          	sub    $0x10,%rsp
+   41741:	48 89 f8             	mov    %rdi,%rax
+  uintptr_t cr3 = (uintptr_t)p->pagetable;
+   41744:	48 8b 17             	mov    (%rdi),%rdx
+  if (pcid_enabled) {
+   41747:	80 3d 1b fa 00 00 00 	cmpb   $0x0,0xfa1b(%rip)        # 51169 <pcid_enabled>
+   4174e:	74 53                	je     417a3 <proc_load_pagetable+0x6a>
+   41750:	65 48 8b 0c 25 00 00 	mov    %gs:0x0,%rcx
+   41757:	00 00 
+    if (p->pcid_generation != c->pcid_generation ||
+   41759:	48 8b 71 38          	mov    0x38(%rcx),%rsi
+   4175d:	48 39 b7 a8 01 00 00 	cmp    %rsi,0x1a8(%rdi)
+   41764:	74 52                	je     417b8 <proc_load_pagetable+0x7f>
+      if (c->pcid_next == PCID_COUNT) {
+   41766:	66 81 79 30 00 10    	cmpw   $0x1000,0x30(%rcx)
+   4176c:	74 57                	je     417c5 <proc_load_pagetable+0x8c>
+      p->pcid = c->pcid_next++;
+   4176e:	0f b7 71 30          	movzwl 0x30(%rcx),%esi
+   41772:	8d 7e 01             	lea    0x1(%rsi),%edi
+   41775:	66 89 79 30          	mov    %di,0x30(%rcx)
+   41779:	66 89 b0 a0 01 00 00 	mov    %si,0x1a0(%rax)
+      p->pcid_generation = c->pcid_generation;
+   41780:	48 8b 71 38          	mov    0x38(%rcx),%rsi
+   41784:	48 89 b0 a8 01 00 00 	mov    %rsi,0x1a8(%rax)
+      p->pcid_cpu = c->index;
+   4178b:	8b 49 18             	mov    0x18(%rcx),%ecx
+   4178e:	89 88 b0 01 00 00    	mov    %ecx,0x1b0(%rax)
+    cr3 |= p->pcid | CR3_NOFLUSH;
+   41794:	0f b7 88 a0 01 00 00 	movzwl 0x1a0(%rax),%ecx
+   4179b:	48 09 ca             	or     %rcx,%rdx
+   4179e:	48 0f ba ea 3f       	bts    $0x3f,%rdx
+    asm volatile("movq %0, %%cr3" : : "r" (x) : "memory");
+   417a3:	0f 22 da             	mov    %rdx,%cr3
+   417a6:	65 48 8b 14 25 00 00 	mov    %gs:0x0,%rdx
+   417ad:	00 00 
+  this_cpu()->pagetable = p->pagetable;
+   417af:	48 8b 00             	mov    (%rax),%rax
+   417b2:	48 89 42 28          	mov    %rax,0x28(%rdx)
+}
+   417b6:	c9                   	leave
+   417b7:	c3                   	ret
+    if (p->pcid_generation != c->pcid_generation ||
+   417b8:	8b 79 18             	mov    0x18(%rcx),%edi
+   417bb:	39 b8 b0 01 00 00    	cmp    %edi,0x1b0(%rax)
+   417c1:	75 a3                	jne    41766 <proc_load_pagetable+0x2d>
+   417c3:	eb cf                	jmp    41794 <proc_load_pagetable+0x5b>
+        ++c->pcid_generation;
+   417c5:	48 83 c6 01          	add    $0x1,%rsi
+   417c9:	48 89 71 38          	mov    %rsi,0x38(%rcx)
+        c->pcid_next = 1;
+   417cd:	66 c7 41 30 01 00    	movw   $0x1,0x30(%rcx)
+  if (invpcid_supported) {
+   417d3:	80 3d 8e f9 00 00 00 	cmpb   $0x0,0xf98e(%rip)        # 51168 <invpcid_supported>
+   417da:	74 20                	je     417fc <proc_load_pagetable+0xc3>
+    } desc = {0, 0};
+   417dc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+   417e3:	00 
+   417e4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+   417eb:	00 
+    asm volatile("invpcid %0, %1" : : "m"(desc), "r"(3UL) : "memory");
+   417ec:	be 03 00 00 00       	mov    $0x3,%esi
+   417f1:	66 0f 38 82 75 f0    	invpcid -0x10(%rbp),%rsi
+   417f7:	e9 72 ff ff ff       	jmp    4176e <proc_load_pagetable+0x35>
+    asm volatile("movq %%cr4, %0" : "=r" (x));
+   417fc:	0f 20 e6             	mov    %cr4,%rsi
+    wrcr4(cr4 & ~CR4_PGE);
+   417ff:	48 89 f7             	mov    %rsi,%rdi
+   41802:	40 80 e7 7f          	and    $0x7f,%dil
+    asm volatile("movq %0, %%cr4" : : "r" (x));
+   41806:	0f 22 e7             	mov    %rdi,%cr4
+   41809:	0f 22 e6             	mov    %rsi,%cr4
+}
+   4180c:	e9 5d ff ff ff       	jmp    4176e <proc_load_pagetable+0x35>
+
+0000000000041811 <proc_tlb_invalidate>:
+  p->pcid_generation = 0;
+   41811:	48 c7 87 a8 01 00 00 	movq   $0x0,0x1a8(%rdi)
+   41818:	00 00 00 00 
+}
+   4181c:	c3                   	ret
+
+000000000004181d <proc_claim>:
+   4181d:	65 48 8b 14 25 00 00 	mov    %gs:0x0,%rdx
+   41824:	00 00 
+  return p == current || spinlock_try_acquire(&p->cpu_lock);
+   41826:	b8 01 00 00 00       	mov    $0x1,%eax
+   4182b:	48 39 7a 20          	cmp    %rdi,0x20(%rdx)
+   4182f:	74 16                	je     41847 <proc_claim+0x2a>
+
+static inline bool spinlock_try_acquire(spinlock* l) {
+    return !__atomic_load_n(&l->locked, __ATOMIC_RELAXED) &&
+   41831:	48 8d 8f c4 01 00 00 	lea    0x1c4(%rdi),%rcx
+   41838:	8b 97 c4 01 00 00    	mov    0x1c4(%rdi),%edx
+   4183e:	b8 00 00 00 00       	mov    $0x0,%eax
+   41843:	85 d2                	test   %edx,%edx
+   41845:	74 04                	je     4184b <proc_claim+0x2e>
+   41847:	83 e0 01             	and    $0x1,%eax
+}
+   4184a:	c3                   	ret
+           !__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE);
+   4184b:	b8 01 00 00 00       	mov    $0x1,%eax
+   41850:	87 01                	xchg   %eax,(%rcx)
+    return !__atomic_load_n(&l->locked, __ATOMIC_RELAXED) &&
+   41852:	85 c0                	test   %eax,%eax
+   41854:	0f 94 c0             	sete   %al
+   41857:	0f b6 c0             	movzbl %al,%eax
+   4185a:	eb eb                	jmp    41847 <proc_claim+0x2a>
+
+000000000004185c <proc_unclaim>:
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4185c:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   41863:	00 00 
+  if (p != current) {
+   41865:	48 39 78 20          	cmp    %rdi,0x20(%rax)
+   41869:	74 0a                	je     41875 <proc_unclaim+0x19>
+}
+
+static inline void spinlock_release(spinlock* l) {
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   4186b:	c7 87 c4 01 00 00 00 	movl   $0x0,0x1c4(%rdi)
+   41872:	00 00 00 
+}
+   41875:	c3                   	ret
+
+0000000000041876 <pagefault_report>:
+void pagefault_report() {
+   41876:	55                   	push   %rbp
+   41877:	48 89 e5             	mov    %rsp,%rbp
+   4187a:	41 55                	push   %r13
+   4187c:	41 54                	push   %r12
+   4187e:	53                   	push   %rbx
+   4187f:	48 83 ec 28          	sub    $0x28,%rsp
+  pfstat *stats[] = {&pfstat_demand, &pfstat_cow, &pfstat_swap};
+   41883:	48 c7 45 c8 40 80 04 	movq   $0x48040,-0x38(%rbp)
+   4188a:	00 
+   4188b:	48 c7 45 d0 20 80 04 	movq   $0x48020,-0x30(%rbp)
+   41892:	00 
+   41893:	48 c7 45 d8 00 80 04 	movq   $0x48000,-0x28(%rbp)
+   4189a:	00 
+  for (int i = 0; i < 3; ++i) {
+   4189b:	48 8d 5d c8          	lea    -0x38(%rbp),%rbx
+   4189f:	4c 8d 6d e0          	lea    -0x20(%rbp),%r13
+   418a3:	eb 09                	jmp    418ae <pagefault_report+0x38>
+   418a5:	48 83 c3 08          	add    $0x8,%rbx
+   418a9:	4c 39 eb             	cmp    %r13,%rbx
+   418ac:	74 4c                	je     418fa <pagefault_report+0x84>
+    pfstat *st = stats[i];
+   418ae:	4c 8b 23             	mov    (%rbx),%r12
+    if (st->count && st->count >= 2 * st->reported) {
+   418b1:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+   418b6:	48 85 ff             	test   %rdi,%rdi
+   418b9:	74 ea                	je     418a5 <pagefault_report+0x2f>
+   418bb:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+   418c0:	48 01 c0             	add    %rax,%rax
+   418c3:	48 39 c7             	cmp    %rax,%rdi
+   418c6:	72 dd                	jb     418a5 <pagefault_report+0x2f>
+      log_printf("pfstat %s %lu faults %lu cycles/fault\n", st->name,
+   418c8:	49 8b 44 24 10       	mov    0x10(%r12),%rax
+   418cd:	ba 00 00 00 00       	mov    $0x0,%edx
+   418d2:	48 f7 f7             	div    %rdi
+   418d5:	49 8b 34 24          	mov    (%r12),%rsi
+   418d9:	48 89 c1             	mov    %rax,%rcx
+   418dc:	48 89 fa             	mov    %rdi,%rdx
+   418df:	bf 00 72 04 00       	mov    $0x47200,%edi
+   418e4:	b8 00 00 00 00       	mov    $0x0,%eax
+   418e9:	e8 7e 26 00 00       	call   43f6c <log_printf>
+      st->reported = st->count;
+   418ee:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+   418f3:	49 89 44 24 18       	mov    %rax,0x18(%r12)
+   418f8:	eb ab                	jmp    418a5 <pagefault_report+0x2f>
+}
+   418fa:	48 83 c4 28          	add    $0x28,%rsp
+   418fe:	5b                   	pop    %rbx
+   418ff:	41 5c                	pop    %r12
+   41901:	41 5d                	pop    %r13
+   41903:	5d                   	pop    %rbp
+   41904:	c3                   	ret
+
+0000000000041905 <proc_reserve>:
+  if (((start | end) & PAGEOFFMASK) || start < PROC_START_ADDR ||
+   41905:	48 89 f0             	mov    %rsi,%rax
+   41908:	48 09 d0             	or     %rdx,%rax
+   4190b:	a9 ff 0f 00 00       	test   $0xfff,%eax
+   41910:	0f 85 47 01 00 00    	jne    41a5d <proc_reserve+0x158>
+   41916:	49 89 f9             	mov    %rdi,%r9
+   41919:	49 89 f2             	mov    %rsi,%r10
+   4191c:	48 89 d7             	mov    %rdx,%rdi
+   4191f:	48 89 f0             	mov    %rsi,%rax
+   41922:	48 c1 e8 27          	shr    $0x27,%rax
+   41926:	0f 94 c0             	sete   %al
+      end > VA_LOWEND || start >= end) {
+   41929:	48 ba 00 00 00 00 00 	movabs $0x800000000000,%rdx
+   41930:	80 00 00 
+   41933:	48 39 fa             	cmp    %rdi,%rdx
+   41936:	0f 92 c2             	setb   %dl
+   41939:	08 d0                	or     %dl,%al
+   4193b:	0f 85 23 01 00 00    	jne    41a64 <proc_reserve+0x15f>
+   41941:	48 39 fe             	cmp    %rdi,%rsi
+   41944:	0f 83 1a 01 00 00    	jae    41a64 <proc_reserve+0x15f>
+int proc_reserve(proc *p, uintptr_t start, uintptr_t end, int perm) {
+   4194a:	55                   	push   %rbp
+   4194b:	48 89 e5             	mov    %rsp,%rbp
+   4194e:	41 54                	push   %r12
+   41950:	53                   	push   %rbx
+  perm |= PTE_P | PTE_U;
+   41951:	89 cb                	mov    %ecx,%ebx
+   41953:	83 cb 05             	or     $0x5,%ebx
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   41956:	49 8d 81 e0 00 00 00 	lea    0xe0(%r9),%rax
+  perm |= PTE_P | PTE_U;
+   4195d:	48 89 c2             	mov    %rax,%rdx
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   41960:	be 00 00 00 00       	mov    $0x0,%esi
+   41965:	eb 0c                	jmp    41973 <proc_reserve+0x6e>
+   41967:	83 c6 01             	add    $0x1,%esi
+   4196a:	48 83 c2 18          	add    $0x18,%rdx
+   4196e:	83 fe 08             	cmp    $0x8,%esi
+   41971:	74 59                	je     419cc <proc_reserve+0xc7>
+    if (r->start < end && start < r->end) {
+   41973:	4c 8b 02             	mov    (%rdx),%r8
+   41976:	49 39 f8             	cmp    %rdi,%r8
+   41979:	73 ec                	jae    41967 <proc_reserve+0x62>
+   4197b:	4c 8b 5a 08          	mov    0x8(%rdx),%r11
+   4197f:	4d 39 da             	cmp    %r11,%r10
+   41982:	73 e3                	jae    41967 <proc_reserve+0x62>
+      bool covered = !r->shm && r->perm == perm && r->start <= start &&
+   41984:	48 63 c6             	movslq %esi,%rax
+   41987:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+      return covered ? 0 : -1;
+   4198b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+      bool covered = !r->shm && r->perm == perm && r->start <= start &&
+   41990:	41 83 bc c1 f4 00 00 	cmpl   $0x0,0xf4(%r9,%rax,8)
+   41997:	00 00 
+   41999:	0f 85 b7 00 00 00    	jne    41a56 <proc_reserve+0x151>
+   4199f:	4d 39 c2             	cmp    %r8,%r10
+   419a2:	0f 93 c0             	setae  %al
+   419a5:	49 39 fb             	cmp    %rdi,%r11
+   419a8:	0f 93 c2             	setae  %dl
+   419ab:	21 d0                	and    %edx,%eax
+   419ad:	48 63 f6             	movslq %esi,%rsi
+   419b0:	48 8d 14 76          	lea    (%rsi,%rsi,2),%rdx
+   419b4:	41 39 9c d1 f0 00 00 	cmp    %ebx,0xf0(%r9,%rdx,8)
+   419bb:	00 
+   419bc:	0f 94 c1             	sete   %cl
+   419bf:	0f b6 c9             	movzbl %cl,%ecx
+   419c2:	21 c1                	and    %eax,%ecx
+   419c4:	83 e9 01             	sub    $0x1,%ecx
+   419c7:	e9 8a 00 00 00       	jmp    41a56 <proc_reserve+0x151>
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   419cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  vmregion *slot = NULL;
+   419d1:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+   419d7:	eb 13                	jmp    419ec <proc_reserve+0xe7>
+      slot = slot ? slot : r;
+   419d9:	4d 85 db             	test   %r11,%r11
+   419dc:	4c 0f 44 d8          	cmove  %rax,%r11
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   419e0:	83 c2 01             	add    $0x1,%edx
+   419e3:	48 83 c0 18          	add    $0x18,%rax
+   419e7:	83 fa 08             	cmp    $0x8,%edx
+   419ea:	74 4d                	je     41a39 <proc_reserve+0x134>
+    if (r->start == r->end) {
+   419ec:	48 8b 30             	mov    (%rax),%rsi
+   419ef:	4c 8b 40 08          	mov    0x8(%rax),%r8
+   419f3:	4c 39 c6             	cmp    %r8,%rsi
+   419f6:	74 e1                	je     419d9 <proc_reserve+0xd4>
+    } else if (!r->shm && r->perm == perm &&
+   419f8:	8b 48 14             	mov    0x14(%rax),%ecx
+   419fb:	85 c9                	test   %ecx,%ecx
+   419fd:	75 e1                	jne    419e0 <proc_reserve+0xdb>
+   419ff:	39 58 10             	cmp    %ebx,0x10(%rax)
+   41a02:	75 dc                	jne    419e0 <proc_reserve+0xdb>
+               (r->end == start || r->start == end)) {
+   41a04:	48 39 fe             	cmp    %rdi,%rsi
+   41a07:	74 05                	je     41a0e <proc_reserve+0x109>
+   41a09:	4d 39 d0             	cmp    %r10,%r8
+   41a0c:	75 d2                	jne    419e0 <proc_reserve+0xdb>
+      r->start = r->start < start ? r->start : start;
+   41a0e:	48 63 d2             	movslq %edx,%rdx
+   41a11:	48 8d 04 12          	lea    (%rdx,%rdx,1),%rax
+   41a15:	4c 8d 1c 10          	lea    (%rax,%rdx,1),%r11
+   41a19:	4c 39 d6             	cmp    %r10,%rsi
+   41a1c:	49 0f 47 f2          	cmova  %r10,%rsi
+   41a20:	4b 89 b4 d9 e0 00 00 	mov    %rsi,0xe0(%r9,%r11,8)
+   41a27:	00 
+      r->end = r->end > end ? r->end : end;
+   41a28:	49 39 f8             	cmp    %rdi,%r8
+   41a2b:	4c 0f 42 c7          	cmovb  %rdi,%r8
+   41a2f:	4f 89 84 d9 e8 00 00 	mov    %r8,0xe8(%r9,%r11,8)
+   41a36:	00 
+      return 0;
+   41a37:	eb 1d                	jmp    41a56 <proc_reserve+0x151>
+  if (!slot) {
+   41a39:	4d 85 db             	test   %r11,%r11
+   41a3c:	74 2e                	je     41a6c <proc_reserve+0x167>
+  slot->start = start;
+   41a3e:	4d 89 13             	mov    %r10,(%r11)
+  slot->end = end;
+   41a41:	49 89 7b 08          	mov    %rdi,0x8(%r11)
+  slot->perm = perm;
+   41a45:	41 89 5b 10          	mov    %ebx,0x10(%r11)
+  slot->shm = 0;
+   41a49:	41 c7 43 14 00 00 00 	movl   $0x0,0x14(%r11)
+   41a50:	00 
+  return 0;
+   41a51:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+   41a56:	89 c8                	mov    %ecx,%eax
+   41a58:	5b                   	pop    %rbx
+   41a59:	41 5c                	pop    %r12
+   41a5b:	5d                   	pop    %rbp
+   41a5c:	c3                   	ret
+    return -1;
+   41a5d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+   41a62:	eb 05                	jmp    41a69 <proc_reserve+0x164>
+   41a64:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+}
+   41a69:	89 c8                	mov    %ecx,%eax
+   41a6b:	c3                   	ret
+    return -1;
+   41a6c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+   41a71:	eb e3                	jmp    41a56 <proc_reserve+0x151>
+
+0000000000041a73 <proc_page_alloc>:
+void *proc_page_alloc(bool zeroed) {
+   41a73:	55                   	push   %rbp
+   41a74:	48 89 e5             	mov    %rsp,%rbp
+   41a77:	41 55                	push   %r13
+   41a79:	41 54                	push   %r12
+   41a7b:	53                   	push   %rbx
+   41a7c:	48 83 ec 08          	sub    $0x8,%rsp
+   41a80:	41 89 fd             	mov    %edi,%r13d
+   41a83:	41 bc 02 00 00 00    	mov    $0x2,%r12d
+   41a89:	eb 26                	jmp    41ab1 <proc_page_alloc+0x3e>
+    void *page = zeroed ? kalloc_zeroed(PAGESIZE) : kalloc(PAGESIZE);
+   41a8b:	bf 00 10 00 00       	mov    $0x1000,%edi
+   41a90:	e8 58 f6 ff ff       	call   410ed <kalloc>
+   41a95:	48 89 c3             	mov    %rax,%rbx
+    if (page || swap_reclaim(1) == 0) {
+   41a98:	48 85 db             	test   %rbx,%rbx
+   41a9b:	75 28                	jne    41ac5 <proc_page_alloc+0x52>
+   41a9d:	bf 01 00 00 00       	mov    $0x1,%edi
+   41aa2:	e8 8b 42 00 00       	call   45d32 <swap_reclaim>
+   41aa7:	85 c0                	test   %eax,%eax
+   41aa9:	74 1a                	je     41ac5 <proc_page_alloc+0x52>
+  for (int attempt = 0; attempt < 2; ++attempt) {
+   41aab:	41 83 ec 01          	sub    $0x1,%r12d
+   41aaf:	74 14                	je     41ac5 <proc_page_alloc+0x52>
+    void *page = zeroed ? kalloc_zeroed(PAGESIZE) : kalloc(PAGESIZE);
+   41ab1:	45 84 ed             	test   %r13b,%r13b
+   41ab4:	74 d5                	je     41a8b <proc_page_alloc+0x18>
+   41ab6:	bf 00 10 00 00       	mov    $0x1000,%edi
+   41abb:	e8 a5 f6 ff ff       	call   41165 <kalloc_zeroed>
+   41ac0:	48 89 c3             	mov    %rax,%rbx
+   41ac3:	eb d3                	jmp    41a98 <proc_page_alloc+0x25>
+}
+   41ac5:	48 89 d8             	mov    %rbx,%rax
+   41ac8:	48 83 c4 08          	add    $0x8,%rsp
+   41acc:	5b                   	pop    %rbx
+   41acd:	41 5c                	pop    %r12
+   41acf:	41 5d                	pop    %r13
+   41ad1:	5d                   	pop    %rbp
+   41ad2:	c3                   	ret
+
+0000000000041ad3 <demand_fault>:
+static bool demand_fault(proc *p, uintptr_t va, uint64_t err) {
+   41ad3:	55                   	push   %rbp
+   41ad4:	48 89 e5             	mov    %rsp,%rbp
+   41ad7:	41 55                	push   %r13
+   41ad9:	41 54                	push   %r12
+   41adb:	53                   	push   %rbx
+   41adc:	48 83 ec 28          	sub    $0x28,%rsp
+   41ae0:	48 89 f3             	mov    %rsi,%rbx
+  for (int i = 0; i < PROC_NREGIONS && !r; ++i) {
+   41ae3:	48 8d 8f e0 00 00 00 	lea    0xe0(%rdi),%rcx
+   41aea:	b8 00 00 00 00       	mov    $0x0,%eax
+   41aef:	eb 10                	jmp    41b01 <demand_fault+0x2e>
+   41af1:	83 c0 01             	add    $0x1,%eax
+   41af4:	48 83 c1 18          	add    $0x18,%rcx
+   41af8:	83 f8 08             	cmp    $0x8,%eax
+   41afb:	0f 84 cd 00 00 00    	je     41bce <demand_fault+0xfb>
+    if (va >= p->regions[i].start && va < p->regions[i].end) {
+   41b01:	48 3b 19             	cmp    (%rcx),%rbx
+   41b04:	72 eb                	jb     41af1 <demand_fault+0x1e>
+   41b06:	48 3b 59 08          	cmp    0x8(%rcx),%rbx
+   41b0a:	73 e5                	jae    41af1 <demand_fault+0x1e>
+      r = &p->regions[i];
+   41b0c:	48 98                	cltq
+   41b0e:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   41b12:	4c 8d a4 c7 e0 00 00 	lea    0xe0(%rdi,%rax,8),%r12
+   41b19:	00 
+  if (!r || r->shm || ((err & PFERR_WRITE) && !(r->perm & PTE_W))) {
+   41b1a:	4d 85 e4             	test   %r12,%r12
+   41b1d:	0f 84 c6 00 00 00    	je     41be9 <demand_fault+0x116>
+    return false;
+   41b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (!r || r->shm || ((err & PFERR_WRITE) && !(r->perm & PTE_W))) {
+   41b28:	41 83 7c 24 14 00    	cmpl   $0x0,0x14(%r12)
+   41b2e:	0f 85 ba 00 00 00    	jne    41bee <demand_fault+0x11b>
+   41b34:	83 e2 02             	and    $0x2,%edx
+   41b37:	49 89 d5             	mov    %rdx,%r13
+   41b3a:	74 0c                	je     41b48 <demand_fault+0x75>
+   41b3c:	41 f6 44 24 10 02    	testb  $0x2,0x10(%r12)
+   41b42:	0f 84 a6 00 00 00    	je     41bee <demand_fault+0x11b>
+  vmiter_t it = vmiter_init(p->pagetable);
+   41b48:	48 8b 37             	mov    (%rdi),%rsi
+   41b4b:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41b4f:	e8 2d 1c 00 00       	call   43781 <vmiter_init>
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+   41b54:	48 89 de             	mov    %rbx,%rsi
+   41b57:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+   41b5e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41b62:	e8 94 1e 00 00       	call   439fb <vmiter_va_add>
+  if (it.level == 0 && (*(it.pep) & PTE_SWAP)) {
+   41b67:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+   41b6b:	75 11                	jne    41b7e <demand_fault+0xab>
+   41b6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   41b71:	48 8b 10             	mov    (%rax),%rdx
+    return false;
+   41b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (it.level == 0 && (*(it.pep) & PTE_SWAP)) {
+   41b79:	f6 c6 08             	test   $0x8,%dh
+   41b7c:	75 70                	jne    41bee <demand_fault+0x11b>
+  void *page = zero_frame;
+   41b7e:	48 8b 1d 3b 02 01 00 	mov    0x1023b(%rip),%rbx        # 51dc0 <zero_frame>
+  int perm = r->perm & ~PTE_W;
+   41b85:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+   41b8a:	89 c2                	mov    %eax,%edx
+   41b8c:	83 e2 fd             	and    $0xfffffffd,%edx
+    perm |= PTE_COW;
+   41b8f:	89 d1                	mov    %edx,%ecx
+   41b91:	80 cd 02             	or     $0x2,%ch
+   41b94:	a8 02                	test   $0x2,%al
+   41b96:	0f 45 d1             	cmovne %ecx,%edx
+  if (err & PFERR_WRITE) {
+   41b99:	4d 85 ed             	test   %r13,%r13
+   41b9c:	75 37                	jne    41bd5 <demand_fault+0x102>
+    return false;
+   41b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (!page) {
+   41ba3:	48 85 db             	test   %rbx,%rbx
+   41ba6:	74 46                	je     41bee <demand_fault+0x11b>
+  if (vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+   41ba8:	48 89 de             	mov    %rbx,%rsi
+   41bab:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41baf:	e8 2d 1c 00 00       	call   437e1 <vmiter_map>
+   41bb4:	89 c2                	mov    %eax,%edx
+  return true;
+   41bb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  if (vmiter_map(&it, (uintptr_t)page, perm) < 0) {
+   41bbb:	85 d2                	test   %edx,%edx
+   41bbd:	79 2f                	jns    41bee <demand_fault+0x11b>
+    kfree(page);
+   41bbf:	48 89 df             	mov    %rbx,%rdi
+   41bc2:	e8 7b f7 ff ff       	call   41342 <kfree>
+    return false;
+   41bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+   41bcc:	eb 20                	jmp    41bee <demand_fault+0x11b>
+    return false;
+   41bce:	b8 00 00 00 00       	mov    $0x0,%eax
+   41bd3:	eb 19                	jmp    41bee <demand_fault+0x11b>
+    page = proc_page_alloc(true);
+   41bd5:	bf 01 00 00 00       	mov    $0x1,%edi
+   41bda:	e8 94 fe ff ff       	call   41a73 <proc_page_alloc>
+   41bdf:	48 89 c3             	mov    %rax,%rbx
+    perm = r->perm;
+   41be2:	41 8b 54 24 10       	mov    0x10(%r12),%edx
+   41be7:	eb b5                	jmp    41b9e <demand_fault+0xcb>
+    return false;
+   41be9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   41bee:	48 83 c4 28          	add    $0x28,%rsp
+   41bf2:	5b                   	pop    %rbx
+   41bf3:	41 5c                	pop    %r12
+   41bf5:	41 5d                	pop    %r13
+   41bf7:	5d                   	pop    %rbp
+   41bf8:	c3                   	ret
+
+0000000000041bf9 <cow_fault>:
+static bool cow_fault(x86_64_pagetable *pt, uintptr_t va) {
+   41bf9:	55                   	push   %rbp
+   41bfa:	48 89 e5             	mov    %rsp,%rbp
+   41bfd:	41 55                	push   %r13
+   41bff:	41 54                	push   %r12
+   41c01:	53                   	push   %rbx
+   41c02:	48 83 ec 28          	sub    $0x28,%rsp
+   41c06:	48 89 f3             	mov    %rsi,%rbx
+  vmiter_t it = vmiter_init(pt);
+   41c09:	48 89 fe             	mov    %rdi,%rsi
+   41c0c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41c10:	e8 6c 1b 00 00       	call   43781 <vmiter_init>
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+   41c15:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+   41c1c:	48 89 de             	mov    %rbx,%rsi
+   41c1f:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   41c23:	e8 d3 1d 00 00       	call   439fb <vmiter_va_add>
+    return false;
+   41c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (it.level != 0 || !(*(it.pep) & PTE_P) || !(*(it.pep) & PTE_COW)) {
+   41c2d:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+   41c31:	0f 85 96 00 00 00    	jne    41ccd <cow_fault+0xd4>
+   41c37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   41c3b:	4c 8b 20             	mov    (%rax),%r12
+   41c3e:	4c 89 e2             	mov    %r12,%rdx
+   41c41:	81 e2 01 02 00 00    	and    $0x201,%edx
+    return false;
+   41c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (it.level != 0 || !(*(it.pep) & PTE_P) || !(*(it.pep) & PTE_COW)) {
+   41c4c:	48 81 fa 01 02 00 00 	cmp    $0x201,%rdx
+   41c53:	75 78                	jne    41ccd <cow_fault+0xd4>
+  uintptr_t pa = *(it.pep) & PTE_PAMASK;
+   41c55:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   41c5c:	ff 0f 00 
+   41c5f:	4c 21 e0             	and    %r12,%rax
+  if (pages[pa / PAGESIZE].refcount > 1 || pages[pa / PAGESIZE].merged) {
+   41c62:	48 89 c2             	mov    %rax,%rdx
+   41c65:	48 c1 ea 08          	shr    $0x8,%rdx
+   41c69:	48 03 15 90 d3 00 00 	add    0xd390(%rip),%rdx        # 4f000 <pages>
+   41c70:	80 3a 01             	cmpb   $0x1,(%rdx)
+   41c73:	76 63                	jbe    41cd8 <cow_fault+0xdf>
+    if ((void *)pa == zero_frame) {
+   41c75:	49 89 c5             	mov    %rax,%r13
+   41c78:	48 3b 05 41 01 01 00 	cmp    0x10141(%rip),%rax        # 51dc0 <zero_frame>
+   41c7f:	74 5f                	je     41ce0 <cow_fault+0xe7>
+    } else if ((copy = proc_page_alloc(false))) {
+   41c81:	bf 00 00 00 00       	mov    $0x0,%edi
+   41c86:	e8 e8 fd ff ff       	call   41a73 <proc_page_alloc>
+   41c8b:	48 89 c3             	mov    %rax,%rbx
+      return false;
+   41c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+    } else if ((copy = proc_page_alloc(false))) {
+   41c93:	48 85 db             	test   %rbx,%rbx
+   41c96:	74 35                	je     41ccd <cow_fault+0xd4>
+      memcpy(copy, (void *)pa, PAGESIZE);
+   41c98:	ba 00 10 00 00       	mov    $0x1000,%edx
+   41c9d:	4c 89 ee             	mov    %r13,%rsi
+   41ca0:	48 89 df             	mov    %rbx,%rdi
+   41ca3:	e8 03 29 00 00       	call   445ab <memcpy>
+    kfree((void *)pa);
+   41ca8:	4c 89 ef             	mov    %r13,%rdi
+   41cab:	e8 92 f6 ff ff       	call   41342 <kfree>
+    pa = (uintptr_t)copy;
+   41cb0:	48 89 d8             	mov    %rbx,%rax
+  int perm = ((*(it.pep) & PAGEOFFMASK) & ~PTE_COW) | PTE_W;
+   41cb3:	41 81 e4 fd 0d 00 00 	and    $0xdfd,%r12d
+  *(it.pep) = pa | perm;
+   41cba:	41 83 cc 02          	or     $0x2,%r12d
+   41cbe:	49 09 c4             	or     %rax,%r12
+   41cc1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   41cc5:	4c 89 20             	mov    %r12,(%rax)
+  return true;
+   41cc8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+   41ccd:	48 83 c4 28          	add    $0x28,%rsp
+   41cd1:	5b                   	pop    %rbx
+   41cd2:	41 5c                	pop    %r12
+   41cd4:	41 5d                	pop    %r13
+   41cd6:	5d                   	pop    %rbp
+   41cd7:	c3                   	ret
+  if (pages[pa / PAGESIZE].refcount > 1 || pages[pa / PAGESIZE].merged) {
+   41cd8:	f6 42 02 04          	testb  $0x4,0x2(%rdx)
+   41cdc:	74 d5                	je     41cb3 <cow_fault+0xba>
+   41cde:	eb 95                	jmp    41c75 <cow_fault+0x7c>
+      copy = proc_page_alloc(true);
+   41ce0:	bf 01 00 00 00       	mov    $0x1,%edi
+   41ce5:	e8 89 fd ff ff       	call   41a73 <proc_page_alloc>
+   41cea:	48 89 c3             	mov    %rax,%rbx
+      return false;
+   41ced:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (!copy) {
+   41cf2:	48 85 db             	test   %rbx,%rbx
+   41cf5:	74 d6                	je     41ccd <cow_fault+0xd4>
+   41cf7:	eb af                	jmp    41ca8 <cow_fault+0xaf>
+
+0000000000041cf9 <proc_access>:
+bool proc_access(proc *p, uintptr_t va, size_t len, bool write) {
+   41cf9:	55                   	push   %rbp
+   41cfa:	48 89 e5             	mov    %rsp,%rbp
+   41cfd:	41 57                	push   %r15
+   41cff:	41 56                	push   %r14
+   41d01:	41 55                	push   %r13
+   41d03:	41 54                	push   %r12
+   41d05:	53                   	push   %rbx
+   41d06:	48 83 ec 38          	sub    $0x38,%rsp
+   41d0a:	89 4d a8             	mov    %ecx,-0x58(%rbp)
+    return false;
+   41d0d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  if (va < PROC_START_ADDR || va + len > VA_LOWEND || va + len < va) {
+   41d13:	48 89 f0             	mov    %rsi,%rax
+   41d16:	48 c1 e8 27          	shr    $0x27,%rax
+   41d1a:	74 2e                	je     41d4a <proc_access+0x51>
+   41d1c:	49 89 fc             	mov    %rdi,%r12
+   41d1f:	48 89 f3             	mov    %rsi,%rbx
+   41d22:	41 89 cf             	mov    %ecx,%r15d
+   41d25:	49 89 f6             	mov    %rsi,%r14
+   41d28:	49 01 d6             	add    %rdx,%r14
+   41d2b:	41 0f 92 c5          	setb   %r13b
+   41d2f:	48 b8 00 00 00 00 00 	movabs $0x800000000000,%rax
+   41d36:	80 00 00 
+   41d39:	4c 39 f0             	cmp    %r14,%rax
+   41d3c:	0f 92 c0             	setb   %al
+   41d3f:	41 08 c5             	or     %al,%r13b
+   41d42:	74 18                	je     41d5c <proc_access+0x63>
+    return false;
+   41d44:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+}
+   41d4a:	44 89 e8             	mov    %r13d,%eax
+   41d4d:	48 83 c4 38          	add    $0x38,%rsp
+   41d51:	5b                   	pop    %rbx
+   41d52:	41 5c                	pop    %r12
+   41d54:	41 5d                	pop    %r13
+   41d56:	41 5e                	pop    %r14
+   41d58:	41 5f                	pop    %r15
+   41d5a:	5d                   	pop    %rbp
+   41d5b:	c3                   	ret
+  swap_pin(p, va, len);
+   41d5c:	e8 d7 41 00 00       	call   45f38 <swap_pin>
+  uint64_t err = write ? PFERR_WRITE : 0;
+   41d61:	0f b6 45 a8          	movzbl -0x58(%rbp),%eax
+   41d65:	48 01 c0             	add    %rax,%rax
+   41d68:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  vmiter_t it = vmiter_init(p->pagetable);
+   41d6c:	49 8b 34 24          	mov    (%r12),%rsi
+   41d70:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   41d74:	e8 08 1a 00 00       	call   43781 <vmiter_init>
+  for (uintptr_t pg = va & ~PAGEOFFMASK; pg < va + len; pg += PAGESIZE) {
+   41d79:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+   41d80:	4c 39 f3             	cmp    %r14,%rbx
+   41d83:	72 59                	jb     41dde <proc_access+0xe5>
+  return true;
+   41d85:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+   41d8b:	eb bd                	jmp    41d4a <proc_access+0x51>
+      if (!swap_in(p, pg, err) && !demand_fault(p, pg, err)) {
+   41d8d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+   41d91:	48 89 de             	mov    %rbx,%rsi
+   41d94:	4c 89 e7             	mov    %r12,%rdi
+   41d97:	e8 0e 40 00 00       	call   45daa <swap_in>
+   41d9c:	84 c0                	test   %al,%al
+   41d9e:	75 17                	jne    41db7 <proc_access+0xbe>
+   41da0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+   41da4:	48 89 de             	mov    %rbx,%rsi
+   41da7:	4c 89 e7             	mov    %r12,%rdi
+   41daa:	e8 24 fd ff ff       	call   41ad3 <demand_fault>
+   41daf:	84 c0                	test   %al,%al
+   41db1:	0f 84 8e 00 00 00    	je     41e45 <proc_access+0x14c>
+      vmiter_va_add(&it, 0);
+   41db7:	be 00 00 00 00       	mov    $0x0,%esi
+   41dbc:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   41dc0:	e8 36 1c 00 00       	call   439fb <vmiter_va_add>
+    if (write) {
+   41dc5:	45 84 ff             	test   %r15b,%r15b
+   41dc8:	74 08                	je     41dd2 <proc_access+0xd9>
+      *(it.pep) |= PTE_D;
+   41dca:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+   41dce:	48 83 08 40          	orq    $0x40,(%rax)
+  for (uintptr_t pg = va & ~PAGEOFFMASK; pg < va + len; pg += PAGESIZE) {
+   41dd2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+   41dd9:	4c 39 f3             	cmp    %r14,%rbx
+   41ddc:	73 5c                	jae    41e3a <proc_access+0x141>
+    vmiter_va_add(&it, pg - vmiter_va(&it));
+   41dde:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   41de2:	e8 dc 18 00 00       	call   436c3 <vmiter_va>
+   41de7:	48 89 de             	mov    %rbx,%rsi
+   41dea:	48 29 c6             	sub    %rax,%rsi
+   41ded:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   41df1:	e8 05 1c 00 00       	call   439fb <vmiter_va_add>
+    if (!vmiter_present(&it)) {
+   41df6:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   41dfa:	e8 c9 18 00 00       	call   436c8 <vmiter_present>
+   41dff:	84 c0                	test   %al,%al
+   41e01:	74 8a                	je     41d8d <proc_access+0x94>
+    } else if (it.level != 0 || !(*(it.pep) & PTE_U)) {
+   41e03:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+   41e07:	0f 85 3d ff ff ff    	jne    41d4a <proc_access+0x51>
+   41e0d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+   41e11:	48 8b 00             	mov    (%rax),%rax
+   41e14:	a8 04                	test   $0x4,%al
+   41e16:	0f 84 2e ff ff ff    	je     41d4a <proc_access+0x51>
+    } else if (write && !(*(it.pep) & PTE_W)) {
+   41e1c:	45 84 ff             	test   %r15b,%r15b
+   41e1f:	74 b1                	je     41dd2 <proc_access+0xd9>
+   41e21:	a8 02                	test   $0x2,%al
+   41e23:	75 a5                	jne    41dca <proc_access+0xd1>
+      if (!cow_fault(p->pagetable, pg)) {
+   41e25:	49 8b 3c 24          	mov    (%r12),%rdi
+   41e29:	48 89 de             	mov    %rbx,%rsi
+   41e2c:	e8 c8 fd ff ff       	call   41bf9 <cow_fault>
+   41e31:	84 c0                	test   %al,%al
+   41e33:	74 18                	je     41e4d <proc_access+0x154>
+    asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+   41e35:	0f 01 3b             	invlpg (%rbx)
+}
+   41e38:	eb 90                	jmp    41dca <proc_access+0xd1>
+  return true;
+   41e3a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+   41e40:	e9 05 ff ff ff       	jmp    41d4a <proc_access+0x51>
+        return false;
+   41e45:	41 89 c5             	mov    %eax,%r13d
+   41e48:	e9 fd fe ff ff       	jmp    41d4a <proc_access+0x51>
+        return false;
+   41e4d:	41 89 c5             	mov    %eax,%r13d
+   41e50:	e9 f5 fe ff ff       	jmp    41d4a <proc_access+0x51>
+
+0000000000041e55 <run>:
+void run(proc *p) {
+   41e55:	55                   	push   %rbp
+   41e56:	48 89 e5             	mov    %rsp,%rbp
+   41e59:	53                   	push   %rbx
+   41e5a:	48 83 ec 08          	sub    $0x8,%rsp
+   41e5e:	48 89 fb             	mov    %rdi,%rbx
+    asm("movq %%gs:0, %0" : "=r"(c));
+   41e61:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   41e68:	00 00 
+  current = p;
+   41e6a:	48 89 78 20          	mov    %rdi,0x20(%rax)
+  timer_arm_tick();
+   41e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+   41e73:	e8 90 f0 ff ff       	call   40f08 <timer_arm_tick>
+    asm volatile("movq %%cr3, %0" : "=r" (x));
+   41e78:	0f 20 d8             	mov    %cr3,%rax
+  if ((rdcr3() & PTE_PAMASK) != (uintptr_t)p->pagetable) {
+   41e7b:	48 ba 00 f0 ff ff ff 	movabs $0xffffffffff000,%rdx
+   41e82:	ff 0f 00 
+   41e85:	48 21 d0             	and    %rdx,%rax
+   41e88:	48 39 03             	cmp    %rax,(%rbx)
+   41e8b:	75 08                	jne    41e95 <run+0x40>
+  exception_return(p);
+   41e8d:	48 89 df             	mov    %rbx,%rdi
+   41e90:	e8 ae ec ff ff       	call   40b43 <exception_return>
+    proc_load_pagetable(p);
+   41e95:	48 89 df             	mov    %rbx,%rdi
+   41e98:	e8 9c f8 ff ff       	call   41739 <proc_load_pagetable>
+   41e9d:	eb ee                	jmp    41e8d <run+0x38>
+
+0000000000041e9f <schedule>:
+void schedule() {
+   41e9f:	55                   	push   %rbp
+   41ea0:	48 89 e5             	mov    %rsp,%rbp
+   41ea3:	41 55                	push   %r13
+   41ea5:	41 54                	push   %r12
+   41ea7:	53                   	push   %rbx
+   41ea8:	48 83 ec 18          	sub    $0x18,%rsp
+   41eac:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   41eb3:	00 00 
+  if (current) {
+   41eb5:	48 83 78 20 00       	cmpq   $0x0,0x20(%rax)
+   41eba:	74 1f                	je     41edb <schedule+0x3c>
+   41ebc:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   41ec3:	00 00 
+    proc *p = current;
+   41ec5:	48 8b 50 20          	mov    0x20(%rax),%rdx
+    current = NULL;
+   41ec9:	48 c7 40 20 00 00 00 	movq   $0x0,0x20(%rax)
+   41ed0:	00 
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   41ed1:	c7 82 c4 01 00 00 00 	movl   $0x0,0x1c4(%rdx)
+   41ed8:	00 00 00 
+  if ((rdcr3() & PTE_PAMASK) != (uintptr_t)kernel_pagetable) {
+   41edb:	49 bc 00 f0 ff ff ff 	movabs $0xffffffffff000,%r12
+   41ee2:	ff 0f 00 
+   41ee5:	e9 d3 00 00 00       	jmp    41fbd <schedule+0x11e>
+      spinlock_acquire(&p->cpu_lock);
+   41eea:	48 8d b8 c4 01 00 00 	lea    0x1c4(%rax),%rdi
+   41ef1:	e8 30 ef ff ff       	call   40e26 <spinlock_acquire>
+      proc_load_pagetable(p);
+   41ef6:	48 89 df             	mov    %rbx,%rdi
+   41ef9:	e8 3b f8 ff ff       	call   41739 <proc_load_pagetable>
+      run(p);
+   41efe:	48 89 df             	mov    %rbx,%rdi
+   41f01:	e8 4f ff ff ff       	call   41e55 <run>
+    asm volatile("pause" : : : "memory");
+   41f06:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   41f08:	8b 05 32 69 01 00    	mov    0x16932(%rip),%eax        # 58840 <kernel_lock>
+   41f0e:	85 c0                	test   %eax,%eax
+   41f10:	75 f4                	jne    41f06 <schedule+0x67>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   41f12:	89 d0                	mov    %edx,%eax
+   41f14:	87 05 26 69 01 00    	xchg   %eax,0x16926(%rip)        # 58840 <kernel_lock>
+   41f1a:	85 c0                	test   %eax,%eax
+   41f1c:	75 ea                	jne    41f08 <schedule+0x69>
+  bool busy = pagetable_reap();
+   41f1e:	e8 fe 1e 00 00       	call   43e21 <pagetable_reap>
+   41f23:	89 c3                	mov    %eax,%ebx
+  busy = zero_pool_refill() || busy;
+   41f25:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f2a:	e8 5c f1 ff ff       	call   4108b <zero_pool_refill>
+   41f2f:	41 89 c5             	mov    %eax,%r13d
+  merge_scan();
+   41f32:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f37:	e8 bd 32 00 00       	call   451f9 <merge_scan>
+  swap_balance();
+   41f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f41:	e8 1b 3e 00 00       	call   45d61 <swap_balance>
+  pagefault_report();
+   41f46:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f4b:	e8 26 f9 ff ff       	call   41876 <pagefault_report>
+  merge_report();
+   41f50:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f55:	e8 94 35 00 00       	call   454ee <merge_report>
+  swap_report();
+   41f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f5f:	e8 f6 3f 00 00       	call   45f5a <swap_report>
+  sched_report();
+   41f64:	b8 00 00 00 00       	mov    $0x0,%eax
+   41f69:	e8 da 49 00 00       	call   46948 <sched_report>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   41f6e:	c7 05 c8 68 01 00 00 	movl   $0x0,0x168c8(%rip)        # 58840 <kernel_lock>
+   41f75:	00 00 00 
+  if (!sched_idle_enter(&wake)) {
+   41f78:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+   41f7c:	e8 42 48 00 00       	call   467c3 <sched_idle_enter>
+   41f81:	84 c0                	test   %al,%al
+   41f83:	74 38                	je     41fbd <schedule+0x11e>
+  timer_arm(wake ? timer_tsc(wake) : 0);
+   41f85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+   41f89:	48 85 ff             	test   %rdi,%rdi
+   41f8c:	74 0f                	je     41f9d <schedule+0xfe>
+  return tsc_boot + tick * tsc_per_tick;
+   41f8e:	48 0f af 3d 82 d0 00 	imul   0xd082(%rip),%rdi        # 4f018 <tsc_per_tick>
+   41f95:	00 
+   41f96:	48 03 3d 4b f7 00 00 	add    0xf74b(%rip),%rdi        # 516e8 <tsc_boot>
+  timer_arm(wake ? timer_tsc(wake) : 0);
+   41f9d:	e8 9c ee ff ff       	call   40e3e <timer_arm>
+  if (busy) {
+   41fa2:	84 db                	test   %bl,%bl
+   41fa4:	75 0a                	jne    41fb0 <schedule+0x111>
+   41fa6:	45 84 ed             	test   %r13b,%r13b
+   41fa9:	75 05                	jne    41fb0 <schedule+0x111>
+    asm volatile("sti; hlt; cli" : : : "memory");
+   41fab:	fb                   	sti
+   41fac:	f4                   	hlt
+   41fad:	fa                   	cli
+   41fae:	eb 03                	jmp    41fb3 <schedule+0x114>
+    asm volatile("sti; nop; cli" : : : "memory");
+   41fb0:	fb                   	sti
+   41fb1:	90                   	nop
+   41fb2:	fa                   	cli
+  sched_idle_exit();
+   41fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+   41fb8:	e8 eb 47 00 00       	call   467a8 <sched_idle_exit>
+    proc *p = sched_pick();
+   41fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+   41fc2:	e8 a7 42 00 00       	call   4626e <sched_pick>
+   41fc7:	48 89 c3             	mov    %rax,%rbx
+    if (p) {
+   41fca:	48 85 c0             	test   %rax,%rax
+   41fcd:	0f 85 17 ff ff ff    	jne    41eea <schedule+0x4b>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   41fd3:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   41fda:	00 00 
+  current = NULL;
+   41fdc:	48 c7 40 20 00 00 00 	movq   $0x0,0x20(%rax)
+   41fe3:	00 
+    asm volatile("movq %%cr3, %0" : "=r" (x));
+   41fe4:	0f 20 d8             	mov    %cr3,%rax
+  if ((rdcr3() & PTE_PAMASK) != (uintptr_t)kernel_pagetable) {
+   41fe7:	4c 21 e0             	and    %r12,%rax
+   41fea:	48 3d 00 b0 04 00    	cmp    $0x4b000,%rax
+   41ff0:	74 19                	je     4200b <schedule+0x16c>
+    asm volatile("movq %0, %%cr3" : : "r" (x) : "memory");
+   41ff2:	b8 00 b0 04 00       	mov    $0x4b000,%eax
+   41ff7:	0f 22 d8             	mov    %rax,%cr3
+   41ffa:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42001:	00 00 
+    this_cpu()->pagetable = kernel_pagetable;
+   42003:	48 c7 40 28 00 b0 04 	movq   $0x4b000,0x28(%rax)
+   4200a:	00 
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   4200b:	ba 01 00 00 00       	mov    $0x1,%edx
+   42010:	e9 fd fe ff ff       	jmp    41f12 <schedule+0x73>
+
+0000000000042015 <syscall_return>:
+void syscall_return(uintptr_t rax) {
+   42015:	55                   	push   %rbp
+   42016:	48 89 e5             	mov    %rsp,%rbp
+    asm("movq %%gs:0, %0" : "=r"(c));
+   42019:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42020:	00 00 
+  current->regs.reg_rax = rax;
+   42022:	48 8b 50 20          	mov    0x20(%rax),%rdx
+   42026:	48 89 7a 10          	mov    %rdi,0x10(%rdx)
+  bool runnable = current->state == P_RUNNABLE;
+   4202a:	48 8b 40 20          	mov    0x20(%rax),%rax
+   4202e:	8b 40 0c             	mov    0xc(%rax),%eax
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   42031:	c7 05 05 68 01 00 00 	movl   $0x0,0x16805(%rip)        # 58840 <kernel_lock>
+   42038:	00 00 00 
+  if (runnable) {
+   4203b:	83 f8 01             	cmp    $0x1,%eax
+   4203e:	74 0a                	je     4204a <syscall_return+0x35>
+  schedule();
+   42040:	b8 00 00 00 00       	mov    $0x0,%eax
+   42045:	e8 55 fe ff ff       	call   41e9f <schedule>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4204a:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42051:	00 00 
+    run(current);
+   42053:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42057:	e8 f9 fd ff ff       	call   41e55 <run>
+
+000000000004205c <syscall_page_alloc>:
+int syscall_page_alloc(uintptr_t addr) {
+   4205c:	55                   	push   %rbp
+   4205d:	48 89 e5             	mov    %rsp,%rbp
+   42060:	48 89 fe             	mov    %rdi,%rsi
+   42063:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   4206a:	00 00 
+  return proc_reserve(current, addr, addr + PAGESIZE, PTE_P | PTE_W | PTE_U);
+   4206c:	48 8d 97 00 10 00 00 	lea    0x1000(%rdi),%rdx
+   42073:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42077:	b9 07 00 00 00       	mov    $0x7,%ecx
+   4207c:	e8 84 f8 ff ff       	call   41905 <proc_reserve>
+}
+   42081:	5d                   	pop    %rbp
+   42082:	c3                   	ret
+
+0000000000042083 <syscall_sleep>:
+int syscall_sleep(size_t time) {
+   42083:	55                   	push   %rbp
+   42084:	48 89 e5             	mov    %rsp,%rbp
+   42087:	53                   	push   %rbx
+   42088:	48 83 ec 08          	sub    $0x8,%rsp
+  size_t nticks = (time * HZ + 999) / 1000;
+   4208c:	48 8d 04 bf          	lea    (%rdi,%rdi,4),%rax
+   42090:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+   42094:	48 8d 1c 85 e7 03 00 	lea    0x3e7(,%rax,4),%rbx
+   4209b:	00 
+  timer_update();
+   4209c:	b8 00 00 00 00       	mov    $0x0,%eax
+   420a1:	e8 3f ed ff ff       	call   40de5 <timer_update>
+   420a6:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   420ad:	00 00 
+  current->regs.reg_rax = 0;
+   420af:	48 8b 40 20          	mov    0x20(%rax),%rax
+   420b3:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+   420ba:	00 
+  if (nticks == 0) {
+   420bb:	48 81 fb e7 03 00 00 	cmp    $0x3e7,%rbx
+   420c2:	77 26                	ja     420ea <syscall_sleep+0x67>
+   420c4:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   420cb:	00 00 
+    sched_enqueue(current);
+   420cd:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   420d1:	e8 76 40 00 00       	call   4614c <sched_enqueue>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   420d6:	c7 05 60 67 01 00 00 	movl   $0x0,0x16760(%rip)        # 58840 <kernel_lock>
+   420dd:	00 00 00 
+  schedule();
+   420e0:	b8 00 00 00 00       	mov    $0x0,%eax
+   420e5:	e8 b5 fd ff ff       	call   41e9f <schedule>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   420ea:	65 48 8b 3c 25 00 00 	mov    %gs:0x0,%rdi
+   420f1:	00 00 
+  size_t nticks = (time * HZ + 999) / 1000;
+   420f3:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+   420f8:	48 89 d8             	mov    %rbx,%rax
+   420fb:	ba 00 00 00 00       	mov    $0x0,%edx
+   42100:	48 f7 f1             	div    %rcx
+   42103:	48 89 c6             	mov    %rax,%rsi
+    sched_sleep(current, nticks);
+   42106:	48 8b 7f 20          	mov    0x20(%rdi),%rdi
+   4210a:	e8 74 47 00 00       	call   46883 <sched_sleep>
+   4210f:	eb c5                	jmp    420d6 <syscall_sleep+0x53>
+
+0000000000042111 <syscall_exit>:
+int syscall_exit() {
+   42111:	55                   	push   %rbp
+   42112:	48 89 e5             	mov    %rsp,%rbp
+   42115:	53                   	push   %rbx
+   42116:	48 83 ec 08          	sub    $0x8,%rsp
+   4211a:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42121:	00 00 
+  proc *p = current;
+   42123:	48 8b 58 20          	mov    0x20(%rax),%rbx
+  shm_release(p);
+   42127:	48 89 df             	mov    %rbx,%rdi
+   4212a:	e8 cf 2b 00 00       	call   44cfe <shm_release>
+  pagetable_free_deferred(p->pagetable);
+   4212f:	48 8b 3b             	mov    (%rbx),%rdi
+   42132:	e8 d4 1c 00 00       	call   43e0b <pagetable_free_deferred>
+  p->pagetable = NULL;
+   42137:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  p->pcid_generation = 0;
+   4213e:	48 c7 83 a8 01 00 00 	movq   $0x0,0x1a8(%rbx)
+   42145:	00 00 00 00 
+  p->state = P_FREE;
+   42149:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%rbx)
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   42150:	c7 05 e6 66 01 00 00 	movl   $0x0,0x166e6(%rip)        # 58840 <kernel_lock>
+   42157:	00 00 00 
+  schedule();
+   4215a:	b8 00 00 00 00       	mov    $0x0,%eax
+   4215f:	e8 3b fd ff ff       	call   41e9f <schedule>
+
+0000000000042164 <syscall_fork>:
+int syscall_fork() {
+   42164:	55                   	push   %rbp
+   42165:	48 89 e5             	mov    %rsp,%rbp
+   42168:	41 54                	push   %r12
+   4216a:	53                   	push   %rbx
+  while (pid < NPROC && ptable[pid].state != P_FREE) {
+   4216b:	b8 1c f2 04 00       	mov    $0x4f21c,%eax
+  pid_t pid = 1;
+   42170:	bb 01 00 00 00       	mov    $0x1,%ebx
+  while (pid < NPROC && ptable[pid].state != P_FREE) {
+   42175:	83 38 00             	cmpl   $0x0,(%rax)
+   42178:	74 18                	je     42192 <syscall_fork+0x2e>
+    ++pid;
+   4217a:	83 c3 01             	add    $0x1,%ebx
+  while (pid < NPROC && ptable[pid].state != P_FREE) {
+   4217d:	48 05 d0 01 00 00    	add    $0x1d0,%rax
+   42183:	83 fb 10             	cmp    $0x10,%ebx
+   42186:	75 ed                	jne    42175 <syscall_fork+0x11>
+    return -1;
+   42188:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   4218d:	e9 b2 00 00 00       	jmp    42244 <syscall_fork+0xe0>
+  if (pid == NPROC) {
+   42192:	83 fb 10             	cmp    $0x10,%ebx
+   42195:	0f 84 b0 00 00 00    	je     4224b <syscall_fork+0xe7>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4219b:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   421a2:	00 00 
+  x86_64_pagetable *pt = pagetable_copy(current->pagetable, true);
+   421a4:	48 8b 40 20          	mov    0x20(%rax),%rax
+   421a8:	48 8b 38             	mov    (%rax),%rdi
+   421ab:	be 01 00 00 00       	mov    $0x1,%esi
+   421b0:	e8 ef 19 00 00       	call   43ba4 <pagetable_copy>
+  if (!pt) {
+   421b5:	48 85 c0             	test   %rax,%rax
+   421b8:	0f 84 94 00 00 00    	je     42252 <syscall_fork+0xee>
+    asm volatile("movq %%cr3, %0" : "=r" (x));
+   421be:	0f 20 da             	mov    %cr3,%rdx
+    asm volatile("movq %0, %%cr3" : : "r" (x) : "memory");
+   421c1:	0f 22 da             	mov    %rdx,%cr3
+  proc *p = &ptable[pid];
+   421c4:	48 63 d3             	movslq %ebx,%rdx
+   421c7:	48 69 d2 d0 01 00 00 	imul   $0x1d0,%rdx,%rdx
+   421ce:	4c 8d a2 40 f0 04 00 	lea    0x4f040(%rdx),%r12
+  p->pid = pid;
+   421d5:	89 9a 48 f0 04 00    	mov    %ebx,0x4f048(%rdx)
+  p->pagetable = pt;
+   421db:	48 89 82 40 f0 04 00 	mov    %rax,0x4f040(%rdx)
+   421e2:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   421e9:	00 00 
+  p->regs = current->regs;
+   421eb:	4c 8d 82 50 f0 04 00 	lea    0x4f050(%rdx),%r8
+   421f2:	48 8b 48 20          	mov    0x20(%rax),%rcx
+   421f6:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+   421fa:	b9 18 00 00 00       	mov    $0x18,%ecx
+   421ff:	4c 89 c7             	mov    %r8,%rdi
+   42202:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  p->regs.reg_rax = 0;
+   42205:	48 c7 82 50 f0 04 00 	movq   $0x0,0x4f050(%rdx)
+   4220c:	00 00 00 00 
+  memcpy(p->regions, current->regions, sizeof(p->regions));
+   42210:	48 8b 70 20          	mov    0x20(%rax),%rsi
+   42214:	48 81 c6 e0 00 00 00 	add    $0xe0,%rsi
+   4221b:	48 8d ba 20 f1 04 00 	lea    0x4f120(%rdx),%rdi
+   42222:	ba c0 00 00 00       	mov    $0xc0,%edx
+   42227:	e8 7f 23 00 00       	call   445ab <memcpy>
+  shm_fork(p);
+   4222c:	4c 89 e7             	mov    %r12,%rdi
+   4222f:	e8 8d 2a 00 00       	call   44cc1 <shm_fork>
+  sched_init_proc(p);
+   42234:	4c 89 e7             	mov    %r12,%rdi
+   42237:	e8 40 41 00 00       	call   4637c <sched_init_proc>
+  sched_enqueue(p);
+   4223c:	4c 89 e7             	mov    %r12,%rdi
+   4223f:	e8 08 3f 00 00       	call   4614c <sched_enqueue>
+}
+   42244:	89 d8                	mov    %ebx,%eax
+   42246:	5b                   	pop    %rbx
+   42247:	41 5c                	pop    %r12
+   42249:	5d                   	pop    %rbp
+   4224a:	c3                   	ret
+    return -1;
+   4224b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   42250:	eb f2                	jmp    42244 <syscall_fork+0xe0>
+    return -1;
+   42252:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   42257:	eb eb                	jmp    42244 <syscall_fork+0xe0>
+
+0000000000042259 <syscall>:
+uintptr_t syscall(regstate *regs) {
+   42259:	48 89 fe             	mov    %rdi,%rsi
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   4225c:	ba 01 00 00 00       	mov    $0x1,%edx
+   42261:	eb 0c                	jmp    4226f <syscall+0x16>
+    asm volatile("pause" : : : "memory");
+   42263:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   42265:	8b 05 d5 65 01 00    	mov    0x165d5(%rip),%eax        # 58840 <kernel_lock>
+   4226b:	85 c0                	test   %eax,%eax
+   4226d:	75 f4                	jne    42263 <syscall+0xa>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   4226f:	89 d0                	mov    %edx,%eax
+   42271:	87 05 c9 65 01 00    	xchg   %eax,0x165c9(%rip)        # 58840 <kernel_lock>
+   42277:	85 c0                	test   %eax,%eax
+   42279:	75 ea                	jne    42265 <syscall+0xc>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4227b:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42282:	00 00 
+  current->regs = *regs;
+   42284:	48 8b 48 20          	mov    0x20(%rax),%rcx
+   42288:	48 8d 79 10          	lea    0x10(%rcx),%rdi
+   4228c:	b9 18 00 00 00       	mov    $0x18,%ecx
+   42291:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  regs = &current->regs;
+   42294:	48 8b 40 20          	mov    0x20(%rax),%rax
+  switch (regs->reg_rax) {
+   42298:	48 83 78 10 0b       	cmpq   $0xb,0x10(%rax)
+   4229d:	0f 87 fc 00 00 00    	ja     4239f <syscall+0x146>
+uintptr_t syscall(regstate *regs) {
+   422a3:	55                   	push   %rbp
+   422a4:	48 89 e5             	mov    %rsp,%rbp
+  switch (regs->reg_rax) {
+   422a7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+   422ab:	ff 24 d5 00 70 04 00 	jmp    *0x47000(,%rdx,8)
+    return syscall_fork();
+   422b2:	b8 00 00 00 00       	mov    $0x0,%eax
+   422b7:	e8 a8 fe ff ff       	call   42164 <syscall_fork>
+   422bc:	48 98                	cltq
+}
+   422be:	5d                   	pop    %rbp
+   422bf:	c3                   	ret
+    return syscall_page_alloc(regs->reg_rdi);
+   422c0:	48 8b 78 40          	mov    0x40(%rax),%rdi
+   422c4:	e8 93 fd ff ff       	call   4205c <syscall_page_alloc>
+   422c9:	48 98                	cltq
+   422cb:	eb f1                	jmp    422be <syscall+0x65>
+   422cd:	65 48 8b 14 25 00 00 	mov    %gs:0x0,%rdx
+   422d4:	00 00 
+    return shm_create(current, regs->reg_rdi);
+   422d6:	48 8b 70 40          	mov    0x40(%rax),%rsi
+   422da:	48 8b 7a 20          	mov    0x20(%rdx),%rdi
+   422de:	e8 1a 24 00 00       	call   446fd <shm_create>
+   422e3:	48 98                	cltq
+   422e5:	eb d7                	jmp    422be <syscall+0x65>
+   422e7:	65 48 8b 0c 25 00 00 	mov    %gs:0x0,%rcx
+   422ee:	00 00 
+    return shm_map(current, regs->reg_rdi, regs->reg_rsi);
+   422f0:	48 8b 50 38          	mov    0x38(%rax),%rdx
+   422f4:	48 8b 79 20          	mov    0x20(%rcx),%rdi
+   422f8:	8b 70 40             	mov    0x40(%rax),%esi
+   422fb:	e8 2b 25 00 00       	call   4482b <shm_map>
+   42300:	48 98                	cltq
+   42302:	eb ba                	jmp    422be <syscall+0x65>
+   42304:	65 48 8b 14 25 00 00 	mov    %gs:0x0,%rdx
+   4230b:	00 00 
+    return shm_unmap(current, regs->reg_rdi);
+   4230d:	48 8b 70 40          	mov    0x40(%rax),%rsi
+   42311:	48 8b 7a 20          	mov    0x20(%rdx),%rdi
+   42315:	e8 27 28 00 00       	call   44b41 <shm_unmap>
+   4231a:	48 98                	cltq
+   4231c:	eb a0                	jmp    422be <syscall+0x65>
+    return pipe_create();
+   4231e:	b8 00 00 00 00       	mov    $0x0,%eax
+   42323:	e8 df 2a 00 00       	call   44e07 <pipe_create>
+   42328:	48 98                	cltq
+   4232a:	eb 92                	jmp    422be <syscall+0x65>
+   4232c:	65 48 8b 34 25 00 00 	mov    %gs:0x0,%rsi
+   42333:	00 00 
+    return pipe_read(current, regs->reg_rdi, regs->reg_rsi, regs->reg_rdx);
+   42335:	48 8b 48 20          	mov    0x20(%rax),%rcx
+   42339:	48 8b 50 38          	mov    0x38(%rax),%rdx
+   4233d:	48 8b 7e 20          	mov    0x20(%rsi),%rdi
+   42341:	8b 70 40             	mov    0x40(%rax),%esi
+   42344:	e8 70 2b 00 00       	call   44eb9 <pipe_read>
+   42349:	e9 70 ff ff ff       	jmp    422be <syscall+0x65>
+   4234e:	65 48 8b 34 25 00 00 	mov    %gs:0x0,%rsi
+   42355:	00 00 
+    return pipe_write(current, regs->reg_rdi, regs->reg_rsi, regs->reg_rdx);
+   42357:	48 8b 48 20          	mov    0x20(%rax),%rcx
+   4235b:	48 8b 50 38          	mov    0x38(%rax),%rdx
+   4235f:	48 8b 7e 20          	mov    0x20(%rsi),%rdi
+   42363:	8b 70 40             	mov    0x40(%rax),%esi
+   42366:	e8 67 2c 00 00       	call   44fd2 <pipe_write>
+   4236b:	e9 4e ff ff ff       	jmp    422be <syscall+0x65>
+    return pipe_close(regs->reg_rdi, regs->reg_rsi);
+   42370:	8b 70 38             	mov    0x38(%rax),%esi
+   42373:	8b 78 40             	mov    0x40(%rax),%edi
+   42376:	e8 6f 2d 00 00       	call   450ea <pipe_close>
+   4237b:	48 98                	cltq
+   4237d:	e9 3c ff ff ff       	jmp    422be <syscall+0x65>
+    return syscall_sleep(regs->reg_rdi);
+   42382:	48 8b 78 40          	mov    0x40(%rax),%rdi
+   42386:	e8 f8 fc ff ff       	call   42083 <syscall_sleep>
+    return syscall_exit();
+   4238b:	b8 00 00 00 00       	mov    $0x0,%eax
+   42390:	e8 7c fd ff ff       	call   42111 <syscall_exit>
+  switch (regs->reg_rax) {
+   42395:	b8 00 00 00 00       	mov    $0x0,%eax
+   4239a:	e9 1f ff ff ff       	jmp    422be <syscall+0x65>
+   4239f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   423a4:	c3                   	ret
+
+00000000000423a5 <init_cpu_state>:
+void init_cpu_state(int index, uintptr_t stack_top) {
+   423a5:	55                   	push   %rbp
+   423a6:	48 89 e5             	mov    %rsp,%rbp
+   423a9:	41 57                	push   %r15
+   423ab:	41 56                	push   %r14
+   423ad:	41 55                	push   %r13
+   423af:	41 54                	push   %r12
+   423b1:	53                   	push   %rbx
+   423b2:	48 83 ec 38          	sub    $0x38,%rsp
+   423b6:	41 89 fd             	mov    %edi,%r13d
+   423b9:	49 89 f7             	mov    %rsi,%r15
+  cpustate *c = &cpus[index];
+   423bc:	48 63 df             	movslq %edi,%rbx
+   423bf:	48 69 db e8 00 00 00 	imul   $0xe8,%rbx,%rbx
+   423c6:	4c 8d a3 60 88 05 00 	lea    0x58860(%rbx),%r12
+  c->self = c;
+   423cd:	4d 89 24 24          	mov    %r12,(%r12)
+  c->index = index;
+   423d1:	41 89 7c 24 18       	mov    %edi,0x18(%r12)
+  c->kstack_top = stack_top;
+   423d6:	49 89 74 24 08       	mov    %rsi,0x8(%r12)
+  c->pcid_next = 1;
+   423db:	66 41 c7 44 24 30 01 	movw   $0x1,0x30(%r12)
+   423e2:	00 
+  c->pcid_generation = 1;
+   423e3:	49 c7 44 24 38 01 00 	movq   $0x1,0x38(%r12)
+   423ea:	00 00 
+  memset(&c->task, 0, sizeof(c->task));
+   423ec:	4c 8d b3 a8 88 05 00 	lea    0x588a8(%rbx),%r14
+   423f3:	ba 68 00 00 00       	mov    $0x68,%edx
+   423f8:	be 00 00 00 00       	mov    $0x0,%esi
+   423fd:	4c 89 f7             	mov    %r14,%rdi
+   42400:	e8 7a 21 00 00       	call   4457f <memset>
+  c->task.ts_rsp[0] = stack_top;
+   42405:	4d 89 7c 24 4c       	mov    %r15,0x4c(%r12)
+  memcpy(c->gdt_segments, kernel_gdt_segments, sizeof(c->gdt_segments));
+   4240a:	4c 8d bb 10 89 05 00 	lea    0x58910(%rbx),%r15
+   42411:	ba 38 00 00 00       	mov    $0x38,%edx
+   42416:	be 00 a0 04 00       	mov    $0x4a000,%esi
+   4241b:	4c 89 ff             	mov    %r15,%rdi
+   4241e:	e8 88 21 00 00       	call   445ab <memcpy>
+  segment[0] = ((addr & 0x0000000000FFFFFFUL) << 16) |
+   42423:	4c 89 f0             	mov    %r14,%rax
+   42426:	48 c1 e0 10          	shl    $0x10,%rax
+   4242a:	48 ba 00 00 ff ff ff 	movabs $0xffffff0000,%rdx
+   42431:	00 00 00 
+   42434:	48 21 d0             	and    %rdx,%rax
+               ((addr & 0x00000000FF000000UL) << 32) |
+   42437:	4c 89 f2             	mov    %r14,%rdx
+   4243a:	48 c1 e2 20          	shl    $0x20,%rdx
+   4243e:	48 b9 00 00 00 00 00 	movabs $0xff00000000000000,%rcx
+   42445:	00 00 ff 
+   42448:	48 21 ca             	and    %rcx,%rdx
+  segment[0] = ((addr & 0x0000000000FFFFFFUL) << 16) |
+   4244b:	48 09 d0             	or     %rdx,%rax
+               type | ((uint64_t)dpl << 45) | X86SEG_P; // segment present
+   4244e:	48 ba 67 00 00 00 00 	movabs $0x890000000067,%rdx
+   42455:	89 00 00 
+   42458:	48 09 d0             	or     %rdx,%rax
+   4245b:	49 89 84 24 d8 00 00 	mov    %rax,0xd8(%r12)
+   42462:	00 
+  segment[1] = addr >> 32;
+   42463:	49 c1 ee 20          	shr    $0x20,%r14
+   42467:	4c 89 b3 40 89 05 00 	mov    %r14,0x58940(%rbx)
+  gdt.limit = sizeof(c->gdt_segments) - 1;
+   4246e:	66 c7 45 c6 37 00    	movw   $0x37,-0x3a(%rbp)
+  gdt.base = (uint64_t)c->gdt_segments;
+   42474:	4c 89 7d c8          	mov    %r15,-0x38(%rbp)
+  idt.limit = sizeof(interrupt_descriptors) - 1;
+   42478:	66 c7 45 b6 ff 0f    	movw   $0xfff,-0x4a(%rbp)
+  idt.base = (uint64_t)interrupt_descriptors;
+   4247e:	48 c7 45 b8 88 80 04 	movq   $0x48088,-0x48(%rbp)
+   42485:	00 
+  asm volatile("lgdt %0; ltr %1; lidt %2"
+   42486:	b8 28 00 00 00       	mov    $0x28,%eax
+   4248b:	0f 01 55 c6          	lgdt   -0x3a(%rbp)
+   4248f:	0f 00 d8             	ltr    %ax
+   42492:	0f 01 5d b6          	lidt   -0x4a(%rbp)
+  asm volatile("movw %%ax, %%fs; movw %%ax, %%gs"
+   42496:	b8 10 00 00 00       	mov    $0x10,%eax
+   4249b:	8e e0                	mov    %eax,%fs
+   4249d:	8e e8                	mov    %eax,%gs
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) x), "d" (x >> 32));
+   4249f:	4c 89 e2             	mov    %r12,%rdx
+   424a2:	48 c1 ea 20          	shr    $0x20,%rdx
+   424a6:	b9 01 01 00 c0       	mov    $0xc0000101,%ecx
+   424ab:	44 89 e0             	mov    %r12d,%eax
+   424ae:	0f 30                	wrmsr
+   424b0:	b9 02 01 00 c0       	mov    $0xc0000102,%ecx
+   424b5:	b8 00 00 00 00       	mov    $0x0,%eax
+   424ba:	ba 00 00 00 00       	mov    $0x0,%edx
+   424bf:	0f 30                	wrmsr
+  if (pcid_enabled) {
+   424c1:	80 3d a1 ec 00 00 00 	cmpb   $0x0,0xeca1(%rip)        # 51169 <pcid_enabled>
+   424c8:	74 0c                	je     424d6 <init_cpu_state+0x131>
+    asm volatile("movq %%cr4, %0" : "=r" (x));
+   424ca:	0f 20 e0             	mov    %cr4,%rax
+    wrcr4(rdcr4() | CR4_PCIDE);
+   424cd:	48 0d 00 00 02 00    	or     $0x20000,%rax
+    asm volatile("movq %0, %%cr4" : : "r" (x));
+   424d3:	0f 22 e0             	mov    %rax,%cr4
+    asm volatile("movq %%cr0, %0" : "=r" (x));
+   424d6:	0f 20 c0             	mov    %cr0,%rax
+  wrcr0(cr0);
+   424d9:	0d 23 00 05 80       	or     $0x80050023,%eax
+    asm volatile("movq %0, %%cr0" : : "r" (x));
+   424de:	0f 22 c0             	mov    %rax,%cr0
+    asm volatile("wrmsr" : : "c" (msr), "a" ((uint32_t) x), "d" (x >> 32));
+   424e1:	b9 81 00 00 c0       	mov    $0xc0000081,%ecx
+   424e6:	b8 00 00 00 00       	mov    $0x0,%eax
+   424eb:	ba 08 00 18 00       	mov    $0x180008,%edx
+   424f0:	0f 30                	wrmsr
+  wrmsr(MSR_IA32_LSTAR, (uint64_t)syscall_entry);
+   424f2:	b8 6e 0b 04 00       	mov    $0x40b6e,%eax
+   424f7:	48 89 c2             	mov    %rax,%rdx
+   424fa:	48 c1 ea 20          	shr    $0x20,%rdx
+   424fe:	b9 82 00 00 c0       	mov    $0xc0000082,%ecx
+   42503:	0f 30                	wrmsr
+   42505:	b9 84 00 00 c0       	mov    $0xc0000084,%ecx
+   4250a:	b8 00 77 04 00       	mov    $0x47700,%eax
+   4250f:	ba 00 00 00 00       	mov    $0x0,%edx
+   42514:	0f 30                	wrmsr
+  lapicstate_t *lapic = lapic_get();
+   42516:	b8 00 00 00 00       	mov    $0x0,%eax
+   4251b:	e8 96 0f 00 00       	call   434b6 <lapic_get>
+   42520:	49 89 c4             	mov    %rax,%r12
+  lapic_enable(lapic, INT_IRQ + IRQ_SPURIOUS);
+   42523:	be 3f 00 00 00       	mov    $0x3f,%esi
+   42528:	48 89 c7             	mov    %rax,%rdi
+   4252b:	e8 39 0f 00 00       	call   43469 <lapic_enable>
+  c->lapic_id = lapic_read(lapic, APIC_REG_ID) >> 24;
+   42530:	be 02 00 00 00       	mov    $0x2,%esi
+   42535:	4c 89 e7             	mov    %r12,%rdi
+   42538:	e8 43 0f 00 00       	call   43480 <lapic_read>
+   4253d:	49 63 d5             	movslq %r13d,%rdx
+   42540:	48 69 d2 e8 00 00 00 	imul   $0xe8,%rdx,%rdx
+   42547:	c1 e8 18             	shr    $0x18,%eax
+   4254a:	89 82 7c 88 05 00    	mov    %eax,0x5887c(%rdx)
+  if (index == 0) {
+   42550:	45 85 ed             	test   %r13d,%r13d
+   42553:	0f 84 8c 00 00 00    	je     425e5 <init_cpu_state+0x240>
+  lapic->reg[APIC_REG_TIMER_DIVIDE].v = TIMER_DIVIDE_1;
+   42559:	41 c7 84 24 e0 03 00 	movl   $0xb,0x3e0(%r12)
+   42560:	00 0b 00 00 00 
+      (tsc_deadline_supported ? TIMER_TSC_DEADLINE : TIMER_ONESHOT) |
+   42565:	80 3d 74 f1 00 00 01 	cmpb   $0x1,0xf174(%rip)        # 516e0 <tsc_deadline_supported>
+   4256c:	19 c0                	sbb    %eax,%eax
+   4256e:	25 00 00 fc ff       	and    $0xfffc0000,%eax
+   42573:	05 20 00 04 00       	add    $0x40020,%eax
+  lapic->reg[APIC_REG_LVT_TIMER].v =
+   42578:	41 89 84 24 20 03 00 	mov    %eax,0x320(%r12)
+   4257f:	00 
+  asm volatile("mfence" : : : "memory");
+   42580:	0f ae f0             	mfence
+  c->timer_deadline = 0;
+   42583:	4d 63 ed             	movslq %r13d,%r13
+   42586:	4d 69 ed e8 00 00 00 	imul   $0xe8,%r13,%r13
+   4258d:	49 c7 85 a0 88 05 00 	movq   $0x0,0x588a0(%r13)
+   42594:	00 00 00 00 
+  timer_arm_tick();
+   42598:	b8 00 00 00 00       	mov    $0x0,%eax
+   4259d:	e8 66 e9 ff ff       	call   40f08 <timer_arm_tick>
+  lapic->reg[APIC_REG_LVT_LINT0].v = LVT_MASKED;
+   425a2:	41 c7 84 24 50 03 00 	movl   $0x10000,0x350(%r12)
+   425a9:	00 00 00 01 00 
+  lapic->reg[APIC_REG_LVT_LINT1].v = LVT_MASKED;
+   425ae:	41 c7 84 24 60 03 00 	movl   $0x10000,0x360(%r12)
+   425b5:	00 00 00 01 00 
+  lapic->reg[APIC_REG_LVT_ERROR].v = INT_IRQ + IRQ_ERROR;
+   425ba:	41 c7 84 24 70 03 00 	movl   $0x33,0x370(%r12)
+   425c1:	00 33 00 00 00 
+  lapic_error(lapic);
+   425c6:	4c 89 e7             	mov    %r12,%rdi
+   425c9:	e8 cc 0e 00 00       	call   4349a <lapic_error>
+  lapic_ack(lapic);
+   425ce:	4c 89 e7             	mov    %r12,%rdi
+   425d1:	e8 d5 0e 00 00       	call   434ab <lapic_ack>
+}
+   425d6:	48 83 c4 38          	add    $0x38,%rsp
+   425da:	5b                   	pop    %rbx
+   425db:	41 5c                	pop    %r12
+   425dd:	41 5d                	pop    %r13
+   425df:	41 5e                	pop    %r14
+   425e1:	41 5f                	pop    %r15
+   425e3:	5d                   	pop    %rbp
+   425e4:	c3                   	ret
+    uint32_t count = lapic_timer_calibrate(lapic, &tsc);
+   425e5:	48 8d 75 a8          	lea    -0x58(%rbp),%rsi
+   425e9:	4c 89 e7             	mov    %r12,%rdi
+   425ec:	e8 cb 0e 00 00       	call   434bc <lapic_timer_calibrate>
+   425f1:	89 c1                	mov    %eax,%ecx
+    tsc_per_tick = tsc * 100 / HZ; // calibration takes 10 ms
+   425f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+   425f7:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+   425fb:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+   425ff:	48 c1 e2 02          	shl    $0x2,%rdx
+   42603:	48 c1 ea 02          	shr    $0x2,%rdx
+   42607:	48 be c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rsi
+   4260e:	c2 f5 28 
+   42611:	48 89 d0             	mov    %rdx,%rax
+   42614:	48 f7 e6             	mul    %rsi
+   42617:	48 c1 ea 02          	shr    $0x2,%rdx
+   4261b:	48 89 15 f6 c9 00 00 	mov    %rdx,0xc9f6(%rip)        # 4f018 <tsc_per_tick>
+    lapic_timer_count = (uint64_t)count * 100 / HZ;
+   42622:	89 0d c8 f0 00 00    	mov    %ecx,0xf0c8(%rip)        # 516f0 <lapic_timer_count>
+    asm volatile("cpuid"
+   42628:	b8 01 00 00 00       	mov    $0x1,%eax
+   4262d:	0f a2                	cpuid
+    tsc_deadline_supported = (cpuid(1).ecx & (1U << 24)) != 0;
+   4262f:	c1 e9 18             	shr    $0x18,%ecx
+   42632:	83 e1 01             	and    $0x1,%ecx
+   42635:	88 0d a5 f0 00 00    	mov    %cl,0xf0a5(%rip)        # 516e0 <tsc_deadline_supported>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   4263b:	0f 31                	rdtsc
+    return low | (high << 32);
+   4263d:	48 c1 e2 20          	shl    $0x20,%rdx
+   42641:	48 09 c2             	or     %rax,%rdx
+   42644:	48 89 15 9d f0 00 00 	mov    %rdx,0xf09d(%rip)        # 516e8 <tsc_boot>
+   4264b:	e9 09 ff ff ff       	jmp    42559 <init_cpu_state+0x1b4>
+
+0000000000042650 <itoa>:
+void itoa(int value, char *str, int base) {
+   42650:	41 89 d1             	mov    %edx,%r9d
+  if (value < 0 && base == 10) {
+   42653:	85 ff                	test   %edi,%edi
+   42655:	79 0e                	jns    42665 <itoa+0x15>
+   42657:	83 fa 0a             	cmp    $0xa,%edx
+   4265a:	75 09                	jne    42665 <itoa+0x15>
+    *str++ = '-';
+   4265c:	c6 06 2d             	movb   $0x2d,(%rsi)
+    value = -value;
+   4265f:	f7 df                	neg    %edi
+    *str++ = '-';
+   42661:	48 8d 76 01          	lea    0x1(%rsi),%rsi
+  ptr = str;
+   42665:	49 89 f0             	mov    %rsi,%r8
+    *ptr++ = digits[value % base];
+   42668:	4c 89 c1             	mov    %r8,%rcx
+   4266b:	49 83 c0 01          	add    $0x1,%r8
+   4266f:	89 f8                	mov    %edi,%eax
+   42671:	99                   	cltd
+   42672:	41 f7 f9             	idiv   %r9d
+   42675:	48 63 d2             	movslq %edx,%rdx
+   42678:	0f b6 92 66 74 04 00 	movzbl 0x47466(%rdx),%edx
+   4267f:	41 88 50 ff          	mov    %dl,-0x1(%r8)
+    value /= base;
+   42683:	89 c7                	mov    %eax,%edi
+  } while (value);
+   42685:	85 c0                	test   %eax,%eax
+   42687:	75 df                	jne    42668 <itoa+0x18>
+  *ptr-- = '\0';
+   42689:	41 c6 00 00          	movb   $0x0,(%r8)
+  for (low = str; low < ptr; low++, ptr--) {
+   4268d:	48 39 ce             	cmp    %rcx,%rsi
+   42690:	73 17                	jae    426a9 <itoa+0x59>
+    char temp = *low;
+   42692:	0f b6 06             	movzbl (%rsi),%eax
+    *low = *ptr;
+   42695:	0f b6 11             	movzbl (%rcx),%edx
+   42698:	88 16                	mov    %dl,(%rsi)
+    *ptr = temp;
+   4269a:	88 01                	mov    %al,(%rcx)
+  for (low = str; low < ptr; low++, ptr--) {
+   4269c:	48 83 c6 01          	add    $0x1,%rsi
+   426a0:	48 83 e9 01          	sub    $0x1,%rcx
+   426a4:	48 39 ce             	cmp    %rcx,%rsi
+   426a7:	72 e9                	jb     42692 <itoa+0x42>
+}
+   426a9:	c3                   	ret
+
+00000000000426aa <print_hex>:
+void print_hex(uint32_t value, uint8_t color) {
+   426aa:	55                   	push   %rbp
+   426ab:	48 89 e5             	mov    %rsp,%rbp
+   426ae:	53                   	push   %rbx
+   426af:	48 83 ec 18          	sub    $0x18,%rsp
+   426b3:	89 f3                	mov    %esi,%ebx
+  itoa(value, buffer, 16);
+   426b5:	ba 10 00 00 00       	mov    $0x10,%edx
+   426ba:	48 8d 75 e7          	lea    -0x19(%rbp),%rsi
+   426be:	e8 8d ff ff ff       	call   42650 <itoa>
+  vga_print("0x", color);
+   426c3:	0f b6 db             	movzbl %bl,%ebx
+   426c6:	89 de                	mov    %ebx,%esi
+   426c8:	bf 77 74 04 00       	mov    $0x47477,%edi
+   426cd:	e8 6a ef ff ff       	call   4163c <vga_print>
+  vga_print(buffer, color);
+   426d2:	89 de                	mov    %ebx,%esi
+   426d4:	48 8d 7d e7          	lea    -0x19(%rbp),%rdi
+   426d8:	e8 5f ef ff ff       	call   4163c <vga_print>
+}
+   426dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   426e1:	c9                   	leave
+   426e2:	c3                   	ret
+
+00000000000426e3 <sched_benchmark>:
+    d->last = mine = t;
+  }
+  bench_exit();
+}
+
+void sched_benchmark() {
+   426e3:	55                   	push   %rbp
+   426e4:	48 89 e5             	mov    %rsp,%rbp
+   426e7:	41 54                	push   %r12
+   426e9:	53                   	push   %rbx
+  schedbench = kalloc_zeroed(PAGESIZE);
+   426ea:	bf 00 10 00 00       	mov    $0x1000,%edi
+   426ef:	e8 71 ea ff ff       	call   41165 <kalloc_zeroed>
+   426f4:	48 89 05 65 ea 00 00 	mov    %rax,0xea65(%rip)        # 51160 <schedbench>
+  if (!schedbench) {
+   426fb:	48 85 c0             	test   %rax,%rax
+   426fe:	74 7b                	je     4277b <sched_benchmark+0x98>
+    log_printf("schedbench: out of memory\n");
+    return;
+  }
+  schedbench->gap = tsc_per_tick / 2;
+   42700:	48 8b 15 11 c9 00 00 	mov    0xc911(%rip),%rdx        # 4f018 <tsc_per_tick>
+   42707:	48 d1 ea             	shr    %rdx
+   4270a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+   4270e:	41 bc 10 f2 04 00    	mov    $0x4f210,%r12d
+  schedbench->gap = tsc_per_tick / 2;
+   42714:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (!bench_proc_start(&ptable[i + 1], schedbench_spin, (void *)schedbench, i)) {
+   42719:	48 89 d9             	mov    %rbx,%rcx
+   4271c:	48 8b 15 3d ea 00 00 	mov    0xea3d(%rip),%rdx        # 51160 <schedbench>
+   42723:	be 2f 6c 04 00       	mov    $0x46c2f,%esi
+   42728:	4c 89 e7             	mov    %r12,%rdi
+   4272b:	e8 25 ed ff ff       	call   41455 <bench_proc_start>
+   42730:	48 83 c3 01          	add    $0x1,%rbx
+   42734:	49 81 c4 d0 01 00 00 	add    $0x1d0,%r12
+   4273b:	84 c0                	test   %al,%al
+   4273d:	74 48                	je     42787 <sched_benchmark+0xa4>
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+   4273f:	48 83 fb 04          	cmp    $0x4,%rbx
+   42743:	75 d4                	jne    42719 <sched_benchmark+0x36>
+      log_printf("schedbench: out of memory\n");
+      return;
+    }
+  }
+  schedbench_end = ticks + SCHEDBENCH_TICKS;
+   42745:	8b 05 d5 c8 00 00    	mov    0xc8d5(%rip),%eax        # 4f020 <ticks>
+   4274b:	05 f4 01 00 00       	add    $0x1f4,%eax
+   42750:	89 05 02 ea 00 00    	mov    %eax,0xea02(%rip)        # 51158 <schedbench_end>
+  log_printf("schedbench nproc %d hz %d tick %lu cycles\n", SCHEDBENCH_NPROC,
+   42756:	48 8b 0d bb c8 00 00 	mov    0xc8bb(%rip),%rcx        # 4f018 <tsc_per_tick>
+   4275d:	ba 64 00 00 00       	mov    $0x64,%edx
+   42762:	be 04 00 00 00       	mov    $0x4,%esi
+   42767:	bf 20 73 04 00       	mov    $0x47320,%edi
+   4276c:	b8 00 00 00 00       	mov    $0x0,%eax
+   42771:	e8 f6 17 00 00       	call   43f6c <log_printf>
+             HZ, tsc_per_tick);
+}
+   42776:	5b                   	pop    %rbx
+   42777:	41 5c                	pop    %r12
+   42779:	5d                   	pop    %rbp
+   4277a:	c3                   	ret
+    log_printf("schedbench: out of memory\n");
+   4277b:	bf ba 74 04 00       	mov    $0x474ba,%edi
+   42780:	e8 e7 17 00 00       	call   43f6c <log_printf>
+    return;
+   42785:	eb ef                	jmp    42776 <sched_benchmark+0x93>
+      log_printf("schedbench: out of memory\n");
+   42787:	bf ba 74 04 00       	mov    $0x474ba,%edi
+   4278c:	e8 db 17 00 00       	call   43f6c <log_printf>
+      return;
+   42791:	eb e3                	jmp    42776 <sched_benchmark+0x93>
+
+0000000000042793 <sched_benchmark_tick>:
+
+void sched_benchmark_tick() {
+  if (!schedbench_end || ticks < schedbench_end) {
+   42793:	8b 05 bf e9 00 00    	mov    0xe9bf(%rip),%eax        # 51158 <schedbench_end>
+   42799:	85 c0                	test   %eax,%eax
+   4279b:	0f 84 36 01 00 00    	je     428d7 <sched_benchmark_tick+0x144>
+   427a1:	3b 05 79 c8 00 00    	cmp    0xc879(%rip),%eax        # 4f020 <ticks>
+   427a7:	0f 8f 2a 01 00 00    	jg     428d7 <sched_benchmark_tick+0x144>
+void sched_benchmark_tick() {
+   427ad:	55                   	push   %rbp
+   427ae:	48 89 e5             	mov    %rsp,%rbp
+   427b1:	41 57                	push   %r15
+   427b3:	41 56                	push   %r14
+   427b5:	41 55                	push   %r13
+   427b7:	41 54                	push   %r12
+   427b9:	53                   	push   %rbx
+   427ba:	48 83 ec 18          	sub    $0x18,%rsp
+    return;
+  }
+  schedbench_end = 0;
+   427be:	c7 05 90 e9 00 00 00 	movl   $0x0,0xe990(%rip)        # 51158 <schedbench_end>
+   427c5:	00 00 00 
+  // processes may still be running on other CPUs, so they are told to
+  // stop rather than freed
+  schedbench->stop = 1;
+   427c8:	48 8b 05 91 e9 00 00 	mov    0xe991(%rip),%rax        # 51160 <schedbench>
+   427cf:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%rax)
+  uint64_t runs = 0, switch_cycles = 0, switch_max = 0, wait_max = 0;
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+   427d6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  uint64_t runs = 0, switch_cycles = 0, switch_max = 0, wait_max = 0;
+   427dc:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+   427e3:	00 
+   427e4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+   427eb:	00 
+   427ec:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+   427f2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+   427f8:	eb 0a                	jmp    42804 <sched_benchmark_tick+0x71>
+  for (int i = 0; i < SCHEDBENCH_NPROC; ++i) {
+   427fa:	41 83 fc 04          	cmp    $0x4,%r12d
+   427fe:	0f 84 94 00 00 00    	je     42898 <sched_benchmark_tick+0x105>
+    volatile schedbench_stat *st = &schedbench->stats[i];
+   42804:	4c 8b 2d 55 e9 00 00 	mov    0xe955(%rip),%r13        # 51160 <schedbench>
+    log_printf("schedbench proc %d runs %lu switch %lu max %lu wait max "
+   4280b:	49 63 dc             	movslq %r12d,%rbx
+   4280e:	48 c1 e3 05          	shl    $0x5,%rbx
+   42812:	4c 01 eb             	add    %r13,%rbx
+               "%lu cycles\n",
+               i + 1, st->runs, st->runs ? st->switch_cycles / st->runs : 0,
+               st->switch_max, st->wait_max);
+   42815:	4c 8b 4b 30          	mov    0x30(%rbx),%r9
+   42819:	4c 8b 43 28          	mov    0x28(%rbx),%r8
+               i + 1, st->runs, st->runs ? st->switch_cycles / st->runs : 0,
+   4281d:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+    log_printf("schedbench proc %d runs %lu switch %lu max %lu wait max "
+   42821:	48 85 c9             	test   %rcx,%rcx
+   42824:	74 13                	je     42839 <sched_benchmark_tick+0xa6>
+               i + 1, st->runs, st->runs ? st->switch_cycles / st->runs : 0,
+   42826:	48 8b 43 20          	mov    0x20(%rbx),%rax
+   4282a:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+    log_printf("schedbench proc %d runs %lu switch %lu max %lu wait max "
+   4282e:	ba 00 00 00 00       	mov    $0x0,%edx
+   42833:	48 f7 f6             	div    %rsi
+   42836:	48 89 c1             	mov    %rax,%rcx
+               i + 1, st->runs, st->runs ? st->switch_cycles / st->runs : 0,
+   42839:	49 63 c4             	movslq %r12d,%rax
+   4283c:	48 c1 e0 05          	shl    $0x5,%rax
+   42840:	49 01 c5             	add    %rax,%r13
+   42843:	49 8b 55 18          	mov    0x18(%r13),%rdx
+    log_printf("schedbench proc %d runs %lu switch %lu max %lu wait max "
+   42847:	41 83 c4 01          	add    $0x1,%r12d
+   4284b:	44 89 e6             	mov    %r12d,%esi
+   4284e:	bf 50 73 04 00       	mov    $0x47350,%edi
+   42853:	b8 00 00 00 00       	mov    $0x0,%eax
+   42858:	e8 0f 17 00 00       	call   43f6c <log_printf>
+    runs += st->runs;
+   4285d:	49 8b 45 18          	mov    0x18(%r13),%rax
+   42861:	49 01 c6             	add    %rax,%r14
+    switch_cycles += st->switch_cycles;
+   42864:	49 8b 45 20          	mov    0x20(%r13),%rax
+   42868:	49 01 c7             	add    %rax,%r15
+    switch_max = st->switch_max > switch_max ? st->switch_max : switch_max;
+   4286b:	48 8b 43 28          	mov    0x28(%rbx),%rax
+   4286f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+   42873:	73 08                	jae    4287d <sched_benchmark_tick+0xea>
+   42875:	48 8b 43 28          	mov    0x28(%rbx),%rax
+   42879:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    wait_max = st->wait_max > wait_max ? st->wait_max : wait_max;
+   4287d:	48 8b 43 30          	mov    0x30(%rbx),%rax
+   42881:	48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+   42885:	0f 83 6f ff ff ff    	jae    427fa <sched_benchmark_tick+0x67>
+   4288b:	48 8b 43 30          	mov    0x30(%rbx),%rax
+   4288f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+   42893:	e9 62 ff ff ff       	jmp    427fa <sched_benchmark_tick+0x67>
+  }
+  log_printf("schedbench total runs %lu switch %lu max %lu wait max %lu "
+   42898:	4c 89 f0             	mov    %r14,%rax
+   4289b:	4d 85 f6             	test   %r14,%r14
+   4289e:	74 0b                	je     428ab <sched_benchmark_tick+0x118>
+   428a0:	4c 89 f8             	mov    %r15,%rax
+   428a3:	ba 00 00 00 00       	mov    $0x0,%edx
+   428a8:	49 f7 f6             	div    %r14
+   428ab:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+   428af:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+   428b3:	48 89 c2             	mov    %rax,%rdx
+   428b6:	4c 89 f6             	mov    %r14,%rsi
+   428b9:	bf 98 73 04 00       	mov    $0x47398,%edi
+   428be:	b8 00 00 00 00       	mov    $0x0,%eax
+   428c3:	e8 a4 16 00 00       	call   43f6c <log_printf>
+             "cycles\n",
+             runs, runs ? switch_cycles / runs : 0, switch_max, wait_max);
+}
+   428c8:	48 83 c4 18          	add    $0x18,%rsp
+   428cc:	5b                   	pop    %rbx
+   428cd:	41 5c                	pop    %r12
+   428cf:	41 5d                	pop    %r13
+   428d1:	41 5e                	pop    %r14
+   428d3:	41 5f                	pop    %r15
+   428d5:	5d                   	pop    %rbp
+   428d6:	c3                   	ret
+   428d7:	c3                   	ret
+
+00000000000428d8 <kernel_exception>:
+void kernel_exception(regstate *regs) {
+   428d8:	55                   	push   %rbp
+   428d9:	48 89 e5             	mov    %rsp,%rbp
+   428dc:	41 57                	push   %r15
+   428de:	41 56                	push   %r14
+   428e0:	41 55                	push   %r13
+   428e2:	41 54                	push   %r12
+   428e4:	53                   	push   %rbx
+   428e5:	48 83 ec 18          	sub    $0x18,%rsp
+   428e9:	48 89 fb             	mov    %rdi,%rbx
+  if (user) {
+   428ec:	4c 8b a7 a0 00 00 00 	mov    0xa0(%rdi),%r12
+   428f3:	41 83 e4 03          	and    $0x3,%r12d
+   428f7:	0f 84 23 03 00 00    	je     42c20 <kernel_exception+0x348>
+   428fd:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42904:	00 00 
+    current->regs = *regs;
+   42906:	48 8b 48 20          	mov    0x20(%rax),%rcx
+   4290a:	48 8d 79 10          	lea    0x10(%rcx),%rdi
+   4290e:	b9 18 00 00 00       	mov    $0x18,%ecx
+   42913:	48 89 de             	mov    %rbx,%rsi
+   42916:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    regs = &current->regs;
+   42919:	48 8b 40 20          	mov    0x20(%rax),%rax
+   4291d:	48 8d 58 10          	lea    0x10(%rax),%rbx
+  switch (regs->reg_intno) {
+   42921:	8b 80 98 00 00 00    	mov    0x98(%rax),%eax
+   42927:	83 f8 22             	cmp    $0x22,%eax
+   4292a:	0f 84 f4 00 00 00    	je     42a24 <kernel_exception+0x14c>
+   42930:	77 4a                	ja     4297c <kernel_exception+0xa4>
+   42932:	83 f8 0e             	cmp    $0xe,%eax
+   42935:	0f 84 2f 01 00 00    	je     42a6a <kernel_exception+0x192>
+   4293b:	83 f8 20             	cmp    $0x20,%eax
+   4293e:	0f 85 5e 01 00 00    	jne    42aa2 <kernel_exception+0x1ca>
+    lapic_ack(lapic_get());
+   42944:	b8 00 00 00 00       	mov    $0x0,%eax
+   42949:	e8 68 0b 00 00       	call   434b6 <lapic_get>
+   4294e:	48 89 c7             	mov    %rax,%rdi
+   42951:	e8 55 0b 00 00       	call   434ab <lapic_ack>
+   42956:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   4295d:	00 00 
+    this_cpu()->timer_deadline = 0;
+   4295f:	48 c7 40 40 00 00 00 	movq   $0x0,0x40(%rax)
+   42966:	00 
+    if (timer_update()) {
+   42967:	b8 00 00 00 00       	mov    $0x0,%eax
+   4296c:	e8 74 e4 ff ff       	call   40de5 <timer_update>
+   42971:	84 c0                	test   %al,%al
+   42973:	74 6a                	je     429df <kernel_exception+0x107>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   42975:	ba 01 00 00 00       	mov    $0x1,%edx
+   4297a:	eb 3f                	jmp    429bb <kernel_exception+0xe3>
+  switch (regs->reg_intno) {
+   4297c:	83 f8 33             	cmp    $0x33,%eax
+   4297f:	0f 84 bf 00 00 00    	je     42a44 <kernel_exception+0x16c>
+   42985:	83 f8 3f             	cmp    $0x3f,%eax
+   42988:	0f 85 14 01 00 00    	jne    42aa2 <kernel_exception+0x1ca>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4298e:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42995:	00 00 
+    if (current->state == P_RUNNABLE) {
+   42997:	48 8b 40 20          	mov    0x20(%rax),%rax
+   4299b:	83 78 0c 01          	cmpl   $0x1,0xc(%rax)
+   4299f:	0f 84 69 02 00 00    	je     42c0e <kernel_exception+0x336>
+    schedule();
+   429a5:	b8 00 00 00 00       	mov    $0x0,%eax
+   429aa:	e8 f0 f4 ff ff       	call   41e9f <schedule>
+    asm volatile("pause" : : : "memory");
+   429af:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   429b1:	8b 05 89 5e 01 00    	mov    0x15e89(%rip),%eax        # 58840 <kernel_lock>
+   429b7:	85 c0                	test   %eax,%eax
+   429b9:	75 f4                	jne    429af <kernel_exception+0xd7>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   429bb:	89 d0                	mov    %edx,%eax
+   429bd:	87 05 7d 5e 01 00    	xchg   %eax,0x15e7d(%rip)        # 58840 <kernel_lock>
+   429c3:	85 c0                	test   %eax,%eax
+   429c5:	75 ea                	jne    429b1 <kernel_exception+0xd9>
+      sched_benchmark_tick();
+   429c7:	e8 c7 fd ff ff       	call   42793 <sched_benchmark_tick>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   429cc:	c7 05 6a 5e 01 00 00 	movl   $0x0,0x15e6a(%rip)        # 58840 <kernel_lock>
+   429d3:	00 00 00 
+    if (sched_tick(user ? current : NULL) && user &&
+   429d6:	4d 85 e4             	test   %r12,%r12
+   429d9:	0f 84 99 02 00 00    	je     42c78 <kernel_exception+0x3a0>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   429df:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   429e6:	00 00 
+   429e8:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   429ec:	e8 b2 39 00 00       	call   463a3 <sched_tick>
+   429f1:	84 c0                	test   %al,%al
+   429f3:	74 99                	je     4298e <kernel_exception+0xb6>
+   429f5:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   429fc:	00 00 
+        current->state == P_RUNNABLE) {
+   429fe:	48 8b 40 20          	mov    0x20(%rax),%rax
+    if (sched_tick(user ? current : NULL) && user &&
+   42a02:	83 78 0c 01          	cmpl   $0x1,0xc(%rax)
+   42a06:	75 86                	jne    4298e <kernel_exception+0xb6>
+   42a08:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42a0f:	00 00 
+      sched_enqueue(current);
+   42a11:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42a15:	e8 32 37 00 00       	call   4614c <sched_enqueue>
+      schedule();
+   42a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+   42a1f:	e8 7b f4 ff ff       	call   41e9f <schedule>
+    lapic_ack(lapic_get());
+   42a24:	b8 00 00 00 00       	mov    $0x0,%eax
+   42a29:	e8 88 0a 00 00       	call   434b6 <lapic_get>
+   42a2e:	48 89 c7             	mov    %rax,%rdi
+   42a31:	e8 75 0a 00 00       	call   434ab <lapic_ack>
+  if (user) {
+   42a36:	4d 85 e4             	test   %r12,%r12
+   42a39:	0f 85 4f ff ff ff    	jne    4298e <kernel_exception+0xb6>
+   42a3f:	e9 52 02 00 00       	jmp    42c96 <kernel_exception+0x3be>
+    lapic_error(lapic_get());
+   42a44:	b8 00 00 00 00       	mov    $0x0,%eax
+   42a49:	e8 68 0a 00 00       	call   434b6 <lapic_get>
+   42a4e:	48 89 c7             	mov    %rax,%rdi
+   42a51:	e8 44 0a 00 00       	call   4349a <lapic_error>
+    lapic_ack(lapic_get());
+   42a56:	b8 00 00 00 00       	mov    $0x0,%eax
+   42a5b:	e8 56 0a 00 00       	call   434b6 <lapic_get>
+   42a60:	48 89 c7             	mov    %rax,%rdi
+   42a63:	e8 43 0a 00 00       	call   434ab <lapic_ack>
+    break;
+   42a68:	eb cc                	jmp    42a36 <kernel_exception+0x15e>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   42a6a:	0f 31                	rdtsc
+   42a6c:	49 89 d6             	mov    %rdx,%r14
+   42a6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    asm volatile("movq %%cr2, %0" : "=r" (x));
+   42a73:	41 0f 20 d7          	mov    %cr2,%r15
+    uint64_t err = regs->reg_errcode;
+   42a77:	4c 8b ab 90 00 00 00 	mov    0x90(%rbx),%r13
+   42a7e:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42a85:	00 00 
+    if (current && (err & PFERR_USER)) {
+   42a87:	48 83 78 20 00       	cmpq   $0x0,0x20(%rax)
+   42a8c:	74 0b                	je     42a99 <kernel_exception+0x1c1>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   42a8e:	ba 01 00 00 00       	mov    $0x1,%edx
+   42a93:	41 f6 c5 04          	test   $0x4,%r13b
+   42a97:	75 1f                	jne    42ab8 <kernel_exception+0x1e0>
+    if (!user) {
+   42a99:	4d 85 e4             	test   %r12,%r12
+   42a9c:	0f 84 de 00 00 00    	je     42b80 <kernel_exception+0x2a8>
+   42aa2:	ba 01 00 00 00       	mov    $0x1,%edx
+   42aa7:	e9 07 01 00 00       	jmp    42bb3 <kernel_exception+0x2db>
+    asm volatile("pause" : : : "memory");
+   42aac:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   42aae:	8b 05 8c 5d 01 00    	mov    0x15d8c(%rip),%eax        # 58840 <kernel_lock>
+   42ab4:	85 c0                	test   %eax,%eax
+   42ab6:	75 f4                	jne    42aac <kernel_exception+0x1d4>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   42ab8:	89 d0                	mov    %edx,%eax
+   42aba:	87 05 80 5d 01 00    	xchg   %eax,0x15d80(%rip)        # 58840 <kernel_lock>
+   42ac0:	85 c0                	test   %eax,%eax
+   42ac2:	75 ea                	jne    42aae <kernel_exception+0x1d6>
+      if (!(err & PFERR_PRESENT) && swap_in(current, addr, err)) {
+   42ac4:	41 f6 c5 01          	test   $0x1,%r13b
+   42ac8:	74 16                	je     42ae0 <kernel_exception+0x208>
+      } else if ((err & PFERR_WRITE) && (err & PFERR_PRESENT) &&
+   42aca:	41 83 e5 03          	and    $0x3,%r13d
+   42ace:	49 83 fd 03          	cmp    $0x3,%r13
+   42ad2:	74 4b                	je     42b1f <kernel_exception+0x247>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   42ad4:	c7 05 62 5d 01 00 00 	movl   $0x0,0x15d62(%rip)        # 58840 <kernel_lock>
+   42adb:	00 00 00 
+    if (st) {
+   42ade:	eb b9                	jmp    42a99 <kernel_exception+0x1c1>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   42ae0:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42ae7:	00 00 
+      if (!(err & PFERR_PRESENT) && swap_in(current, addr, err)) {
+   42ae9:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42aed:	4c 89 ea             	mov    %r13,%rdx
+   42af0:	4c 89 fe             	mov    %r15,%rsi
+   42af3:	e8 b2 32 00 00       	call   45daa <swap_in>
+   42af8:	84 c0                	test   %al,%al
+   42afa:	75 46                	jne    42b42 <kernel_exception+0x26a>
+   42afc:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42b03:	00 00 
+                 demand_fault(current, addr, err)) {
+   42b05:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42b09:	4c 89 ea             	mov    %r13,%rdx
+   42b0c:	4c 89 fe             	mov    %r15,%rsi
+   42b0f:	e8 bf ef ff ff       	call   41ad3 <demand_fault>
+      } else if (!(err & PFERR_PRESENT) &&
+   42b14:	84 c0                	test   %al,%al
+   42b16:	74 b2                	je     42aca <kernel_exception+0x1f2>
+        st = &pfstat_demand;
+   42b18:	b9 40 80 04 00       	mov    $0x48040,%ecx
+   42b1d:	eb 28                	jmp    42b47 <kernel_exception+0x26f>
+   42b1f:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42b26:	00 00 
+                 cow_fault(current->pagetable, addr)) {
+   42b28:	48 8b 40 20          	mov    0x20(%rax),%rax
+   42b2c:	48 8b 38             	mov    (%rax),%rdi
+   42b2f:	4c 89 fe             	mov    %r15,%rsi
+   42b32:	e8 c2 f0 ff ff       	call   41bf9 <cow_fault>
+        st = &pfstat_cow;
+   42b37:	b9 20 80 04 00       	mov    $0x48020,%ecx
+      } else if ((err & PFERR_WRITE) && (err & PFERR_PRESENT) &&
+   42b3c:	84 c0                	test   %al,%al
+   42b3e:	75 07                	jne    42b47 <kernel_exception+0x26f>
+   42b40:	eb 92                	jmp    42ad4 <kernel_exception+0x1fc>
+        st = &pfstat_swap;
+   42b42:	b9 00 80 04 00       	mov    $0x48000,%ecx
+  ++st->count;
+   42b47:	48 83 41 08 01       	addq   $0x1,0x8(%rcx)
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   42b4c:	0f 31                	rdtsc
+    return low | (high << 32);
+   42b4e:	4c 89 f7             	mov    %r14,%rdi
+   42b51:	48 c1 e7 20          	shl    $0x20,%rdi
+   42b55:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+   42b59:	48 09 f7             	or     %rsi,%rdi
+  st->cycles += rdtsc() - start;
+   42b5c:	48 8b 71 10          	mov    0x10(%rcx),%rsi
+   42b60:	48 29 fe             	sub    %rdi,%rsi
+   42b63:	48 c1 e2 20          	shl    $0x20,%rdx
+   42b67:	48 09 c2             	or     %rax,%rdx
+   42b6a:	48 01 d6             	add    %rdx,%rsi
+   42b6d:	48 89 71 10          	mov    %rsi,0x10(%rcx)
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   42b71:	c7 05 c5 5c 01 00 00 	movl   $0x0,0x15cc5(%rip)        # 58840 <kernel_lock>
+   42b78:	00 00 00 
+    if (st) {
+   42b7b:	e9 b6 fe ff ff       	jmp    42a36 <kernel_exception+0x15e>
+      log_printf("kernel exception %u at %p, error %lx\n", regs->reg_intno,
+   42b80:	48 8b 8b 90 00 00 00 	mov    0x90(%rbx),%rcx
+   42b87:	48 8b 93 98 00 00 00 	mov    0x98(%rbx),%rdx
+   42b8e:	8b b3 88 00 00 00    	mov    0x88(%rbx),%esi
+   42b94:	bf e0 73 04 00       	mov    $0x473e0,%edi
+   42b99:	b8 00 00 00 00       	mov    $0x0,%eax
+   42b9e:	e8 c9 13 00 00       	call   43f6c <log_printf>
+        asm volatile("cli; hlt");
+   42ba3:	fa                   	cli
+   42ba4:	f4                   	hlt
+      for (;;) {
+   42ba5:	eb fc                	jmp    42ba3 <kernel_exception+0x2cb>
+    asm volatile("pause" : : : "memory");
+   42ba7:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   42ba9:	8b 05 91 5c 01 00    	mov    0x15c91(%rip),%eax        # 58840 <kernel_lock>
+   42baf:	85 c0                	test   %eax,%eax
+   42bb1:	75 f4                	jne    42ba7 <kernel_exception+0x2cf>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   42bb3:	89 d0                	mov    %edx,%eax
+   42bb5:	87 05 85 5c 01 00    	xchg   %eax,0x15c85(%rip)        # 58840 <kernel_lock>
+   42bbb:	85 c0                	test   %eax,%eax
+   42bbd:	75 ea                	jne    42ba9 <kernel_exception+0x2d1>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   42bbf:	65 4c 8b 24 25 00 00 	mov    %gs:0x0,%r12
+   42bc6:	00 00 
+    log_printf("proc %d: exception %u at %p, error %lx\n", current->pid,
+   42bc8:	48 8b 8b 98 00 00 00 	mov    0x98(%rbx),%rcx
+   42bcf:	8b 93 88 00 00 00    	mov    0x88(%rbx),%edx
+   42bd5:	49 8b 44 24 20       	mov    0x20(%r12),%rax
+   42bda:	8b 70 08             	mov    0x8(%rax),%esi
+   42bdd:	4c 8b 83 90 00 00 00 	mov    0x90(%rbx),%r8
+   42be4:	bf 08 74 04 00       	mov    $0x47408,%edi
+   42be9:	b8 00 00 00 00       	mov    $0x0,%eax
+   42bee:	e8 79 13 00 00       	call   43f6c <log_printf>
+    current->state = P_BROKEN;
+   42bf3:	49 8b 44 24 20       	mov    0x20(%r12),%rax
+   42bf8:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%rax)
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   42bff:	c7 05 37 5c 01 00 00 	movl   $0x0,0x15c37(%rip)        # 58840 <kernel_lock>
+   42c06:	00 00 00 
+}
+   42c09:	e9 80 fd ff ff       	jmp    4298e <kernel_exception+0xb6>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   42c0e:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42c15:	00 00 
+      run(current);
+   42c17:	48 8b 78 20          	mov    0x20(%rax),%rdi
+   42c1b:	e8 35 f2 ff ff       	call   41e55 <run>
+  switch (regs->reg_intno) {
+   42c20:	8b 87 88 00 00 00    	mov    0x88(%rdi),%eax
+   42c26:	83 f8 22             	cmp    $0x22,%eax
+   42c29:	0f 84 f5 fd ff ff    	je     42a24 <kernel_exception+0x14c>
+   42c2f:	77 53                	ja     42c84 <kernel_exception+0x3ac>
+   42c31:	83 f8 0e             	cmp    $0xe,%eax
+   42c34:	0f 84 30 fe ff ff    	je     42a6a <kernel_exception+0x192>
+   42c3a:	83 f8 20             	cmp    $0x20,%eax
+   42c3d:	0f 85 3d ff ff ff    	jne    42b80 <kernel_exception+0x2a8>
+    lapic_ack(lapic_get());
+   42c43:	b8 00 00 00 00       	mov    $0x0,%eax
+   42c48:	e8 69 08 00 00       	call   434b6 <lapic_get>
+   42c4d:	48 89 c7             	mov    %rax,%rdi
+   42c50:	e8 56 08 00 00       	call   434ab <lapic_ack>
+   42c55:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   42c5c:	00 00 
+    this_cpu()->timer_deadline = 0;
+   42c5e:	48 c7 40 40 00 00 00 	movq   $0x0,0x40(%rax)
+   42c65:	00 
+    if (timer_update()) {
+   42c66:	b8 00 00 00 00       	mov    $0x0,%eax
+   42c6b:	e8 75 e1 ff ff       	call   40de5 <timer_update>
+   42c70:	84 c0                	test   %al,%al
+   42c72:	0f 85 fd fc ff ff    	jne    42975 <kernel_exception+0x9d>
+    if (sched_tick(user ? current : NULL) && user &&
+   42c78:	bf 00 00 00 00       	mov    $0x0,%edi
+   42c7d:	e8 21 37 00 00       	call   463a3 <sched_tick>
+   42c82:	eb 12                	jmp    42c96 <kernel_exception+0x3be>
+  switch (regs->reg_intno) {
+   42c84:	83 f8 33             	cmp    $0x33,%eax
+   42c87:	0f 84 b7 fd ff ff    	je     42a44 <kernel_exception+0x16c>
+   42c8d:	83 f8 3f             	cmp    $0x3f,%eax
+   42c90:	0f 85 ea fe ff ff    	jne    42b80 <kernel_exception+0x2a8>
+}
+   42c96:	48 83 c4 18          	add    $0x18,%rsp
+   42c9a:	5b                   	pop    %rbx
+   42c9b:	41 5c                	pop    %r12
+   42c9d:	41 5d                	pop    %r13
+   42c9f:	41 5e                	pop    %r14
+   42ca1:	41 5f                	pop    %r15
+   42ca3:	5d                   	pop    %rbp
+   42ca4:	c3                   	ret
+
+0000000000042ca5 <kernel_main>:
+  }
+  log_printf("bootprof total %lu\n", boottime.tsc[NBOOTTIME - 1] - first);
+  log_printf("bootprof end\n");
+}
+
+int kernel_main() {
+   42ca5:	55                   	push   %rbp
+   42ca6:	48 89 e5             	mov    %rsp,%rbp
+   42ca9:	41 57                	push   %r15
+   42cab:	41 56                	push   %r14
+   42cad:	41 55                	push   %r13
+   42caf:	41 54                	push   %r12
+   42cb1:	53                   	push   %rbx
+   42cb2:	48 83 ec 48          	sub    $0x48,%rsp
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   42cb6:	0f 31                	rdtsc
+    return low | (high << 32);
+   42cb8:	48 c1 e2 20          	shl    $0x20,%rdx
+   42cbc:	48 09 d0             	or     %rdx,%rax
+  if (loader->magic == BOOTTIME_MAGIC) {
+   42cbf:	81 3c 25 00 40 00 00 	cmpl   $0x454d4954,0x4000
+   42cc6:	54 49 4d 45 
+   42cca:	74 46                	je     42d12 <kernel_main+0x6d>
+  boottime.magic = BOOTTIME_MAGIC;
+   42ccc:	c7 05 2a e4 00 00 54 	movl   $0x454d4954,0xe42a(%rip)        # 51100 <boottime>
+   42cd3:	49 4d 45 
+  boottime.tsc[BOOTTIME_KERNEL] = now;
+   42cd6:	48 89 05 3b e4 00 00 	mov    %rax,0xe43b(%rip)        # 51118 <boottime+0x18>
+  boottime_init();
+  mem_init();
+   42cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+   42ce2:	e8 5d 18 00 00       	call   44544 <mem_init>
+  uint32_t n = map->nentries <= E820_MAXENTRIES ? map->nentries : 0;
+   42ce7:	8b 04 25 00 50 00 00 	mov    0x5000,%eax
+   42cee:	89 45 ac             	mov    %eax,-0x54(%rbp)
+   42cf1:	83 e8 01             	sub    $0x1,%eax
+   42cf4:	83 f8 3f             	cmp    $0x3f,%eax
+   42cf7:	0f 87 da 00 00 00    	ja     42dd7 <kernel_main+0x132>
+   42cfd:	8b 05 c5 e5 00 00    	mov    0xe5c5(%rip),%eax        # 512c8 <nram_regions>
+   42d03:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   42d06:	c6 45 a7 00          	movb   $0x0,-0x59(%rbp)
+  for (uint32_t i = 0; i < n; ++i) {
+   42d0a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+   42d10:	eb 21                	jmp    42d33 <kernel_main+0x8e>
+    boottime = *loader;
+   42d12:	be 00 40 00 00       	mov    $0x4000,%esi
+   42d17:	bf 00 11 05 00       	mov    $0x51100,%edi
+   42d1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+   42d21:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+   42d23:	eb a7                	jmp    42ccc <kernel_main+0x27>
+  for (uint32_t i = 0; i < n; ++i) {
+   42d25:	41 83 c5 01          	add    $0x1,%r13d
+   42d29:	44 39 6d ac          	cmp    %r13d,-0x54(%rbp)
+   42d2d:	0f 84 95 00 00 00    	je     42dc8 <kernel_main+0x123>
+    uintptr_t start = round_up(e->addr, PAGESIZE);
+   42d33:	45 89 ee             	mov    %r13d,%r14d
+   42d36:	4f 8d 24 36          	lea    (%r14,%r14,1),%r12
+   42d3a:	4b 8d 04 34          	lea    (%r12,%r14,1),%rax
+   42d3e:	4c 8d 3c c5 00 50 00 	lea    0x5000(,%rax,8),%r15
+   42d45:	00 
+   42d46:	49 8b 5f 08          	mov    0x8(%r15),%rbx
+   42d4a:	be 00 10 00 00       	mov    $0x1000,%esi
+   42d4f:	48 89 df             	mov    %rbx,%rdi
+   42d52:	e8 21 e2 ff ff       	call   40f78 <round_up>
+    uintptr_t end = (e->addr + e->size) & ~PAGEOFFMASK;
+   42d57:	49 03 5f 10          	add    0x10(%r15),%rbx
+   42d5b:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    if (e->type != E820_RAM || !(e->acpi & 1) || start >= end) {
+   42d62:	4d 01 f4             	add    %r14,%r12
+   42d65:	48 ba ff ff ff ff 01 	movabs $0x1ffffffff,%rdx
+   42d6c:	00 00 00 
+   42d6f:	4a 23 14 e5 18 50 00 	and    0x5018(,%r12,8),%rdx
+   42d76:	00 
+   42d77:	48 bf 01 00 00 00 01 	movabs $0x100000001,%rdi
+   42d7e:	00 00 00 
+   42d81:	48 39 fa             	cmp    %rdi,%rdx
+   42d84:	75 9f                	jne    42d25 <kernel_main+0x80>
+   42d86:	48 39 d8             	cmp    %rbx,%rax
+   42d89:	73 9a                	jae    42d25 <kernel_main+0x80>
+    if (end > MEMSIZE_MAX) {
+   42d8b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+   42d92:	00 00 00 
+   42d95:	48 39 d3             	cmp    %rdx,%rbx
+   42d98:	48 0f 47 da          	cmova  %rdx,%rbx
+    if (start < end) {
+   42d9c:	48 39 d8             	cmp    %rbx,%rax
+   42d9f:	73 84                	jae    42d25 <kernel_main+0x80>
+      ram_regions[nram_regions].start = start;
+   42da1:	8b 7d a8             	mov    -0x58(%rbp),%edi
+   42da4:	48 63 d7             	movslq %edi,%rdx
+   42da7:	48 c1 e2 04          	shl    $0x4,%rdx
+   42dab:	48 89 82 e0 12 05 00 	mov    %rax,0x512e0(%rdx)
+      ram_regions[nram_regions].end = end;
+   42db2:	48 89 9a e8 12 05 00 	mov    %rbx,0x512e8(%rdx)
+      ++nram_regions;
+   42db9:	83 c7 01             	add    $0x1,%edi
+   42dbc:	89 7d a8             	mov    %edi,-0x58(%rbp)
+   42dbf:	c6 45 a7 01          	movb   $0x1,-0x59(%rbp)
+   42dc3:	e9 5d ff ff ff       	jmp    42d25 <kernel_main+0x80>
+   42dc8:	80 7d a7 00          	cmpb   $0x0,-0x59(%rbp)
+   42dcc:	74 09                	je     42dd7 <kernel_main+0x132>
+   42dce:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   42dd1:	89 05 f1 e4 00 00    	mov    %eax,0xe4f1(%rip)        # 512c8 <nram_regions>
+  if (nram_regions == 0) {
+   42dd7:	83 3d ea e4 00 00 00 	cmpl   $0x0,0xe4ea(%rip)        # 512c8 <nram_regions>
+   42dde:	75 36                	jne    42e16 <kernel_main+0x171>
+    ram_regions[0].start = 0;
+   42de0:	48 c7 05 f5 e4 00 00 	movq   $0x0,0xe4f5(%rip)        # 512e0 <ram_regions>
+   42de7:	00 00 00 00 
+    ram_regions[0].end = IOPHYSMEM;
+   42deb:	48 c7 05 f2 e4 00 00 	movq   $0xa0000,0xe4f2(%rip)        # 512e8 <ram_regions+0x8>
+   42df2:	00 00 0a 00 
+    ram_regions[1].start = EXTPHYSMEM;
+   42df6:	48 c7 05 ef e4 00 00 	movq   $0x100000,0xe4ef(%rip)        # 512f0 <ram_regions+0x10>
+   42dfd:	00 00 10 00 
+    ram_regions[1].end = MEMSIZE_PHYSICAL;
+   42e01:	48 c7 05 ec e4 00 00 	movq   $0x200000,0xe4ec(%rip)        # 512f8 <ram_regions+0x18>
+   42e08:	00 00 20 00 
+    nram_regions = 2;
+   42e0c:	c7 05 b2 e4 00 00 02 	movl   $0x2,0xe4b2(%rip)        # 512c8 <nram_regions>
+   42e13:	00 00 00 
+  memsize_physical = 0;
+   42e16:	48 c7 05 ef c1 00 00 	movq   $0x0,0xc1ef(%rip)        # 4f010 <memsize_physical>
+   42e1d:	00 00 00 00 
+  for (int i = 0; i < nram_regions; ++i) {
+   42e21:	8b 05 a1 e4 00 00    	mov    0xe4a1(%rip),%eax        # 512c8 <nram_regions>
+   42e27:	85 c0                	test   %eax,%eax
+   42e29:	0f 8e 88 04 00 00    	jle    432b7 <kernel_main+0x612>
+   42e2f:	48 63 f0             	movslq %eax,%rsi
+   42e32:	48 c1 e6 04          	shl    $0x4,%rsi
+   42e36:	b8 00 00 00 00       	mov    $0x0,%eax
+   42e3b:	bf 00 00 00 00       	mov    $0x0,%edi
+   42e40:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (ram_regions[i].end > memsize_physical) {
+   42e45:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+   42e4b:	eb 09                	jmp    42e56 <kernel_main+0x1b1>
+  for (int i = 0; i < nram_regions; ++i) {
+   42e4d:	48 83 c0 10          	add    $0x10,%rax
+   42e51:	48 39 f0             	cmp    %rsi,%rax
+   42e54:	74 14                	je     42e6a <kernel_main+0x1c5>
+    if (ram_regions[i].end > memsize_physical) {
+   42e56:	48 8b 90 e8 12 05 00 	mov    0x512e8(%rax),%rdx
+   42e5d:	48 39 d1             	cmp    %rdx,%rcx
+   42e60:	73 eb                	jae    42e4d <kernel_main+0x1a8>
+      memsize_physical = ram_regions[i].end;
+   42e62:	48 89 d1             	mov    %rdx,%rcx
+    if (ram_regions[i].end > memsize_physical) {
+   42e65:	44 89 c7             	mov    %r8d,%edi
+   42e68:	eb e3                	jmp    42e4d <kernel_main+0x1a8>
+   42e6a:	40 84 ff             	test   %dil,%dil
+   42e6d:	74 07                	je     42e76 <kernel_main+0x1d1>
+   42e6f:	48 89 0d 9a c1 00 00 	mov    %rcx,0xc19a(%rip)        # 4f010 <memsize_physical>
+  npages = memsize_physical / PAGESIZE;
+   42e76:	4c 8b 0d 93 c1 00 00 	mov    0xc193(%rip),%r9        # 4f010 <memsize_physical>
+   42e7d:	49 c1 e9 0c          	shr    $0xc,%r9
+   42e81:	4c 89 0d 80 c1 00 00 	mov    %r9,0xc180(%rip)        # 4f008 <npages>
+   42e88:	b9 00 00 00 00       	mov    $0x0,%ecx
+   42e8d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  size_t room = 0;
+   42e93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+      pages = (pageinfo *)start;
+   42e99:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+   42e9f:	eb 09                	jmp    42eaa <kernel_main+0x205>
+  for (int i = 0; i < nram_regions; ++i) {
+   42ea1:	48 83 c1 10          	add    $0x10,%rcx
+   42ea5:	48 39 f1             	cmp    %rsi,%rcx
+   42ea8:	74 3f                	je     42ee9 <kernel_main+0x244>
+    uintptr_t start = ram_regions[i].start > EXTPHYSMEM ? ram_regions[i].start
+   42eaa:	48 8b 81 e0 12 05 00 	mov    0x512e0(%rcx),%rax
+   42eb1:	ba 00 00 10 00       	mov    $0x100000,%edx
+   42eb6:	48 39 d0             	cmp    %rdx,%rax
+   42eb9:	48 0f 43 d0          	cmovae %rax,%rdx
+    uintptr_t end = ram_regions[i].end < (1UL << 30) ? ram_regions[i].end
+   42ebd:	48 8b 81 e8 12 05 00 	mov    0x512e8(%rcx),%rax
+   42ec4:	bf 00 00 00 40       	mov    $0x40000000,%edi
+   42ec9:	48 39 f8             	cmp    %rdi,%rax
+   42ecc:	48 0f 47 c7          	cmova  %rdi,%rax
+    if (start < end && end - start > room) {
+   42ed0:	48 39 c2             	cmp    %rax,%rdx
+   42ed3:	73 cc                	jae    42ea1 <kernel_main+0x1fc>
+   42ed5:	48 29 d0             	sub    %rdx,%rax
+   42ed8:	49 39 c0             	cmp    %rax,%r8
+   42edb:	73 c4                	jae    42ea1 <kernel_main+0x1fc>
+      pages = (pageinfo *)start;
+   42edd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+      room = end - start;
+   42ee1:	49 89 c0             	mov    %rax,%r8
+      pages = (pageinfo *)start;
+   42ee4:	45 89 da             	mov    %r11d,%r10d
+   42ee7:	eb b8                	jmp    42ea1 <kernel_main+0x1fc>
+   42ee9:	45 84 d2             	test   %r10b,%r10b
+   42eec:	74 0b                	je     42ef9 <kernel_main+0x254>
+   42eee:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+   42ef2:	48 89 05 07 c1 00 00 	mov    %rax,0xc107(%rip)        # 4f000 <pages>
+  if (npages * sizeof(pageinfo) > room) {
+   42ef9:	49 c1 e1 04          	shl    $0x4,%r9
+   42efd:	4d 39 c8             	cmp    %r9,%r8
+   42f00:	73 6b                	jae    42f6d <kernel_main+0x2c8>
+    npages = room / sizeof(pageinfo);
+   42f02:	4c 89 c2             	mov    %r8,%rdx
+   42f05:	48 c1 ea 04          	shr    $0x4,%rdx
+   42f09:	48 89 15 f8 c0 00 00 	mov    %rdx,0xc0f8(%rip)        # 4f008 <npages>
+    memsize_physical = npages * PAGESIZE;
+   42f10:	48 c1 e2 0c          	shl    $0xc,%rdx
+   42f14:	48 89 15 f5 c0 00 00 	mov    %rdx,0xc0f5(%rip)        # 4f010 <memsize_physical>
+   42f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int keep = 0;
+   42f20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+   42f26:	eb 09                	jmp    42f31 <kernel_main+0x28c>
+    for (int i = 0; i < nram_regions; ++i) {
+   42f28:	48 83 c0 10          	add    $0x10,%rax
+   42f2c:	48 39 f0             	cmp    %rsi,%rax
+   42f2f:	74 35                	je     42f66 <kernel_main+0x2c1>
+      if (ram_regions[i].start < memsize_physical) {
+   42f31:	48 8b b8 e0 12 05 00 	mov    0x512e0(%rax),%rdi
+   42f38:	48 39 d7             	cmp    %rdx,%rdi
+   42f3b:	73 eb                	jae    42f28 <kernel_main+0x283>
+        ram_regions[keep].start = ram_regions[i].start;
+   42f3d:	49 63 c8             	movslq %r8d,%rcx
+   42f40:	48 c1 e1 04          	shl    $0x4,%rcx
+   42f44:	48 89 b9 e0 12 05 00 	mov    %rdi,0x512e0(%rcx)
+                                    : memsize_physical;
+   42f4b:	48 8b b8 e8 12 05 00 	mov    0x512e8(%rax),%rdi
+   42f52:	48 39 d7             	cmp    %rdx,%rdi
+   42f55:	48 0f 47 fa          	cmova  %rdx,%rdi
+        ram_regions[keep].end = ram_regions[i].end < memsize_physical
+   42f59:	48 89 b9 e8 12 05 00 	mov    %rdi,0x512e8(%rcx)
+        ++keep;
+   42f60:	41 83 c0 01          	add    $0x1,%r8d
+   42f64:	eb c2                	jmp    42f28 <kernel_main+0x283>
+    nram_regions = keep;
+   42f66:	44 89 05 5b e3 00 00 	mov    %r8d,0xe35b(%rip)        # 512c8 <nram_regions>
+  memset(pages, 0, npages * sizeof(pageinfo));
+   42f6d:	48 8b 15 94 c0 00 00 	mov    0xc094(%rip),%rdx        # 4f008 <npages>
+   42f74:	48 c1 e2 04          	shl    $0x4,%rdx
+   42f78:	be 00 00 00 00       	mov    $0x0,%esi
+   42f7d:	48 8b 3d 7c c0 00 00 	mov    0xc07c(%rip),%rdi        # 4f000 <pages>
+   42f84:	e8 f6 15 00 00       	call   4457f <memset>
+  for (uintptr_t pa = memsize_physical; pa > 0;) {
+   42f89:	48 8b 1d 80 c0 00 00 	mov    0xc080(%rip),%rbx        # 4f010 <memsize_physical>
+   42f90:	48 85 db             	test   %rbx,%rbx
+   42f93:	0f 85 16 01 00 00    	jne    430af <kernel_main+0x40a>
+  kernel_gdt_segments[0] = 0;
+   42f99:	48 c7 05 5c 70 00 00 	movq   $0x0,0x705c(%rip)        # 4a000 <kernel_gdt_segments>
+   42fa0:	00 00 00 00 
+  *segment = type | X86SEG_S                     // code/data segment
+   42fa4:	48 b8 00 00 00 00 00 	movabs $0x20980000000000,%rax
+   42fab:	98 20 00 
+   42fae:	48 89 05 53 70 00 00 	mov    %rax,0x7053(%rip)        # 4a008 <kernel_gdt_segments+0x8>
+   42fb5:	48 b8 00 00 00 00 00 	movabs $0x920000000000,%rax
+   42fbc:	92 00 00 
+   42fbf:	48 89 05 4a 70 00 00 	mov    %rax,0x704a(%rip)        # 4a010 <kernel_gdt_segments+0x10>
+   42fc6:	48 b8 00 00 00 00 00 	movabs $0x20f80000000000,%rax
+   42fcd:	f8 20 00 
+   42fd0:	48 89 05 41 70 00 00 	mov    %rax,0x7041(%rip)        # 4a018 <kernel_gdt_segments+0x18>
+   42fd7:	48 b8 00 00 00 00 00 	movabs $0xf20000000000,%rax
+   42fde:	f2 00 00 
+   42fe1:	48 89 05 38 70 00 00 	mov    %rax,0x7038(%rip)        # 4a020 <kernel_gdt_segments+0x20>
+  gdt.limit = (sizeof(uint64_t) * 3) - 1;
+   42fe8:	66 c7 45 be 17 00    	movw   $0x17,-0x42(%rbp)
+  gdt.base = (uint64_t)kernel_gdt_segments;
+   42fee:	48 c7 45 c0 00 a0 04 	movq   $0x4a000,-0x40(%rbp)
+   42ff5:	00 
+  asm volatile("lgdt %0" : : "m"(gdt.limit));
+   42ff6:	0f 01 55 be          	lgdt   -0x42(%rbp)
+  memset(kernel_pagetable, 0, sizeof(kernel_pagetable));
+   42ffa:	ba 00 40 00 00       	mov    $0x4000,%edx
+   42fff:	be 00 00 00 00       	mov    $0x0,%esi
+   43004:	bf 00 b0 04 00       	mov    $0x4b000,%edi
+   43009:	e8 71 15 00 00       	call   4457f <memset>
+      (x86_64_pageentry_t)&kernel_pagetable[1] | PTE_P | PTE_W | PTE_U;
+   4300e:	b8 00 c0 04 00       	mov    $0x4c000,%eax
+   43013:	48 83 c8 07          	or     $0x7,%rax
+   43017:	48 89 05 e2 7f 00 00 	mov    %rax,0x7fe2(%rip)        # 4b000 <kernel_pagetable>
+      (x86_64_pageentry_t)&kernel_pagetable[2] | PTE_P | PTE_W | PTE_U;
+   4301e:	b8 00 d0 04 00       	mov    $0x4d000,%eax
+   43023:	48 83 c8 07          	or     $0x7,%rax
+   43027:	48 89 05 d2 8f 00 00 	mov    %rax,0x8fd2(%rip)        # 4c000 <kernel_pagetable+0x1000>
+      (x86_64_pageentry_t)&kernel_pagetable[3] | PTE_P | PTE_W | PTE_U;
+   4302e:	b8 00 e0 04 00       	mov    $0x4e000,%eax
+   43033:	48 83 c8 07          	or     $0x7,%rax
+   43037:	48 89 05 c2 9f 00 00 	mov    %rax,0x9fc2(%rip)        # 4d000 <kernel_pagetable+0x2000>
+    asm volatile("cpuid"
+   4303e:	b8 00 00 00 80       	mov    $0x80000000,%eax
+   43043:	0f a2                	cpuid
+  int maxlevel = 1;
+   43045:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  if (ext.eax >= 0x80000001 && (cpuid(0x80000001).edx & (1U << 26))) {
+   4304b:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+   43050:	76 17                	jbe    43069 <kernel_main+0x3c4>
+   43052:	b8 01 00 00 80       	mov    $0x80000001,%eax
+   43057:	0f a2                	cpuid
+   43059:	81 e2 00 00 00 04    	and    $0x4000000,%edx
+  int maxlevel = 1;
+   4305f:	83 fa 01             	cmp    $0x1,%edx
+   43062:	45 19 ed             	sbb    %r13d,%r13d
+   43065:	41 83 c5 02          	add    $0x2,%r13d
+  direct_map(PAGESIZE, 4UL << 30, PTE_P | PTE_W | PTE_G, maxlevel);
+   43069:	44 89 e9             	mov    %r13d,%ecx
+   4306c:	ba 03 01 00 00       	mov    $0x103,%edx
+   43071:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+   43078:	00 00 00 
+   4307b:	bf 00 10 00 00       	mov    $0x1000,%edi
+   43080:	e8 52 e1 ff ff       	call   411d7 <direct_map>
+  for (int i = 0; i < nram_regions; ++i) {
+   43085:	83 3d 3c e2 00 00 00 	cmpl   $0x0,0xe23c(%rip)        # 512c8 <nram_regions>
+   4308c:	0f 8e af 00 00 00    	jle    43141 <kernel_main+0x49c>
+   43092:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (ram_regions[i].end > (4UL << 30)) {
+   43097:	49 bc 00 00 00 00 01 	movabs $0x100000000,%r12
+   4309e:	00 00 00 
+   430a1:	e9 86 00 00 00       	jmp    4312c <kernel_main+0x487>
+  for (uintptr_t pa = memsize_physical; pa > 0;) {
+   430a6:	48 85 db             	test   %rbx,%rbx
+   430a9:	0f 84 ea fe ff ff    	je     42f99 <kernel_main+0x2f4>
+    pa -= PAGESIZE;
+   430af:	49 89 dc             	mov    %rbx,%r12
+   430b2:	48 81 eb 00 10 00 00 	sub    $0x1000,%rbx
+    if (allocatable_physical_address(pa) &&
+   430b9:	48 89 df             	mov    %rbx,%rdi
+   430bc:	e8 d5 de ff ff       	call   40f96 <allocatable_physical_address>
+   430c1:	84 c0                	test   %al,%al
+   430c3:	74 e1                	je     430a6 <kernel_main+0x401>
+        !pageinfo_used(&pages[pa / PAGESIZE]) &&
+   430c5:	48 89 df             	mov    %rbx,%rdi
+   430c8:	48 c1 ef 0c          	shr    $0xc,%rdi
+bool pageinfo_used(pageinfo *page) { return page->refcount != 0; }
+   430cc:	48 89 f8             	mov    %rdi,%rax
+   430cf:	48 c1 e0 04          	shl    $0x4,%rax
+   430d3:	48 03 05 26 bf 00 00 	add    0xbf26(%rip),%rax        # 4f000 <pages>
+    if (allocatable_physical_address(pa) &&
+   430da:	80 38 00             	cmpb   $0x0,(%rax)
+   430dd:	75 c7                	jne    430a6 <kernel_main+0x401>
+        !pageinfo_used(&pages[pa / PAGESIZE]) &&
+   430df:	49 81 ec 00 20 00 00 	sub    $0x2000,%r12
+   430e6:	49 81 fc ff 1f 00 00 	cmp    $0x1fff,%r12
+   430ed:	76 b7                	jbe    430a6 <kernel_main+0x401>
+      buddy_free(pa / PAGESIZE, 0);
+   430ef:	be 00 00 00 00       	mov    $0x0,%esi
+   430f4:	e8 64 db ff ff       	call   40c5d <buddy_free>
+   430f9:	eb ab                	jmp    430a6 <kernel_main+0x401>
+      uintptr_t start = ram_regions[i].start > (4UL << 30)
+   430fb:	48 8b b8 e0 12 05 00 	mov    0x512e0(%rax),%rdi
+   43102:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+   43109:	00 00 00 
+   4310c:	48 39 c7             	cmp    %rax,%rdi
+   4310f:	48 0f 42 f8          	cmovb  %rax,%rdi
+      direct_map(start, ram_regions[i].end, PTE_P | PTE_W | PTE_G,
+   43113:	44 89 e9             	mov    %r13d,%ecx
+   43116:	ba 03 01 00 00       	mov    $0x103,%edx
+   4311b:	e8 b7 e0 ff ff       	call   411d7 <direct_map>
+  for (int i = 0; i < nram_regions; ++i) {
+   43120:	48 83 c3 01          	add    $0x1,%rbx
+   43124:	39 1d 9e e1 00 00    	cmp    %ebx,0xe19e(%rip)        # 512c8 <nram_regions>
+   4312a:	7e 15                	jle    43141 <kernel_main+0x49c>
+    if (ram_regions[i].end > (4UL << 30)) {
+   4312c:	48 89 d8             	mov    %rbx,%rax
+   4312f:	48 c1 e0 04          	shl    $0x4,%rax
+   43133:	48 8b b0 e8 12 05 00 	mov    0x512e8(%rax),%rsi
+   4313a:	49 39 f4             	cmp    %rsi,%r12
+   4313d:	73 e1                	jae    43120 <kernel_main+0x47b>
+   4313f:	eb ba                	jmp    430fb <kernel_main+0x456>
+    asm volatile("movq %%cr4, %0" : "=r" (x));
+   43141:	0f 20 e0             	mov    %cr4,%rax
+  wrcr4(rdcr4() | CR4_PGE);
+   43144:	0c 80                	or     $0x80,%al
+    asm volatile("movq %0, %%cr4" : : "r" (x));
+   43146:	0f 22 e0             	mov    %rax,%cr4
+    asm volatile("cpuid"
+   43149:	b8 01 00 00 00       	mov    $0x1,%eax
+   4314e:	0f a2                	cpuid
+  if (!(cpuid(1).ecx & (1U << 17))) {
+   43150:	f7 c1 00 00 02 00    	test   $0x20000,%ecx
+   43156:	74 45                	je     4319d <kernel_main+0x4f8>
+    asm volatile("movq %%cr4, %0" : "=r" (x));
+   43158:	0f 20 e0             	mov    %cr4,%rax
+  wrcr4(rdcr4() | CR4_PCIDE);
+   4315b:	48 0d 00 00 02 00    	or     $0x20000,%rax
+    asm volatile("movq %0, %%cr4" : : "r" (x));
+   43161:	0f 22 e0             	mov    %rax,%cr4
+  pcid_enabled = true;
+   43164:	c6 05 fe df 00 00 01 	movb   $0x1,0xdffe(%rip)        # 51169 <pcid_enabled>
+    asm volatile("cpuid"
+   4316b:	b8 00 00 00 00       	mov    $0x0,%eax
+   43170:	0f a2                	cpuid
+      cpuid(0).eax >= 7 && (cpuid_subleaf(7, 0).ebx & (1U << 10));
+   43172:	ba 00 00 00 00       	mov    $0x0,%edx
+   43177:	83 f8 06             	cmp    $0x6,%eax
+   4317a:	76 14                	jbe    43190 <kernel_main+0x4eb>
+    asm volatile("cpuid"
+   4317c:	b8 07 00 00 00       	mov    $0x7,%eax
+   43181:	b9 00 00 00 00       	mov    $0x0,%ecx
+   43186:	0f a2                	cpuid
+   43188:	c1 eb 0a             	shr    $0xa,%ebx
+   4318b:	89 da                	mov    %ebx,%edx
+   4318d:	83 e2 01             	and    $0x1,%edx
+   43190:	88 15 d2 df 00 00    	mov    %dl,0xdfd2(%rip)        # 51168 <invpcid_supported>
+   43196:	80 25 cb df 00 00 01 	andb   $0x1,0xdfcb(%rip)        # 51168 <invpcid_supported>
+    asm volatile("movq %0, %%cr3" : : "r" (x) : "memory");
+   4319d:	b8 00 b0 04 00       	mov    $0x4b000,%eax
+   431a2:	0f 22 d8             	mov    %rax,%cr3
+    buddy_free(pa / PAGESIZE, 0);
+   431a5:	be 00 00 00 00       	mov    $0x0,%esi
+   431aa:	bf 01 00 00 00       	mov    $0x1,%edi
+   431af:	e8 a9 da ff ff       	call   40c5d <buddy_free>
+   431b4:	be 00 00 00 00       	mov    $0x0,%esi
+   431b9:	bf 02 00 00 00       	mov    $0x2,%edi
+   431be:	e8 9a da ff ff       	call   40c5d <buddy_free>
+  init_kernel_memory();
+  merge_init();
+   431c3:	b8 00 00 00 00       	mov    $0x0,%eax
+   431c8:	e8 02 20 00 00       	call   451cf <merge_init>
+  swap_init();
+   431cd:	b8 00 00 00 00       	mov    $0x0,%eax
+   431d2:	e8 4b 2b 00 00       	call   45d22 <swap_init>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   431d7:	0f 31                	rdtsc
+    return low | (high << 32);
+   431d9:	48 c1 e2 20          	shl    $0x20,%rdx
+   431dd:	48 09 c2             	or     %rax,%rdx
+   431e0:	48 89 15 39 df 00 00 	mov    %rdx,0xdf39(%rip)        # 51120 <boottime+0x20>
+  for (int i = 0; i < 256; ++i) {
+   431e7:	b9 88 80 04 00       	mov    $0x48088,%ecx
+   431ec:	be 00 00 00 00       	mov    $0x0,%esi
+                 ((uint64_t)dpl << 45) | X86SEG_P |
+   431f1:	49 b9 00 00 00 00 00 	movabs $0x600000000000,%r9
+   431f8:	60 00 00 
+                 ((addr & 0x00000000FFFF0000UL) << 32);
+   431fb:	49 b8 00 00 00 00 00 	movabs $0xffff000000000000,%r8
+   43202:	00 ff ff 
+                 ((uint64_t)dpl << 45) | X86SEG_P |
+   43205:	48 bf 00 00 08 00 00 	movabs $0x8e0000080000,%rdi
+   4320c:	8e 00 00 
+   4320f:	e9 db 00 00 00       	jmp    432ef <kernel_main+0x64a>
+      log_printf("bootprof phase %s %lu\n", boottime_names[i],
+   43214:	48 29 c2             	sub    %rax,%rdx
+   43217:	48 8b b3 60 70 04 00 	mov    0x47060(%rbx),%rsi
+   4321e:	bf 60 75 04 00       	mov    $0x47560,%edi
+   43223:	b8 00 00 00 00       	mov    $0x0,%eax
+   43228:	e8 3f 0d 00 00       	call   43f6c <log_printf>
+    if (!first) {
+   4322d:	4d 85 e4             	test   %r12,%r12
+   43230:	75 07                	jne    43239 <kernel_main+0x594>
+      first = boottime.tsc[i - 1];
+   43232:	4c 8b a3 00 11 05 00 	mov    0x51100(%rbx),%r12
+  for (int i = 1; i < NBOOTTIME; ++i) {
+   43239:	48 83 c3 08          	add    $0x8,%rbx
+   4323d:	48 83 fb 38          	cmp    $0x38,%rbx
+   43241:	74 1a                	je     4325d <kernel_main+0x5b8>
+    if (boottime.tsc[i - 1] && boottime.tsc[i]) {
+   43243:	48 8b 83 00 11 05 00 	mov    0x51100(%rbx),%rax
+   4324a:	48 85 c0             	test   %rax,%rax
+   4324d:	74 de                	je     4322d <kernel_main+0x588>
+   4324f:	48 8b 93 08 11 05 00 	mov    0x51108(%rbx),%rdx
+   43256:	48 85 d2             	test   %rdx,%rdx
+   43259:	74 d2                	je     4322d <kernel_main+0x588>
+   4325b:	eb b7                	jmp    43214 <kernel_main+0x56f>
+  log_printf("bootprof total %lu\n", boottime.tsc[NBOOTTIME - 1] - first);
+   4325d:	48 8b 35 d4 de 00 00 	mov    0xded4(%rip),%rsi        # 51138 <boottime+0x38>
+   43264:	4c 29 e6             	sub    %r12,%rsi
+   43267:	bf 77 75 04 00       	mov    $0x47577,%edi
+   4326c:	b8 00 00 00 00       	mov    $0x0,%eax
+   43271:	e8 f6 0c 00 00       	call   43f6c <log_printf>
+  log_printf("bootprof end\n");
+   43276:	bf 8b 75 04 00       	mov    $0x4758b,%edi
+   4327b:	b8 00 00 00 00       	mov    $0x0,%eax
+   43280:	e8 e7 0c 00 00       	call   43f6c <log_printf>
+  itoa(num_cores, num_cores_str, 10);
+  vga_print(num_cores_str, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+  boottime_mark(BOOTTIME_VGA);
+  boottime_report();
+
+  spinlock_acquire(&kernel_lock);
+   43285:	bf 40 88 05 00       	mov    $0x58840,%edi
+   4328a:	e8 97 db ff ff       	call   40e26 <spinlock_acquire>
+  smp_init();
+   4328f:	b8 00 00 00 00       	mov    $0x0,%eax
+   43294:	e8 7a 38 00 00       	call   46b13 <smp_init>
+
+#ifdef SCHEDBENCH
+  sched_benchmark();
+   43299:	b8 00 00 00 00       	mov    $0x0,%eax
+   4329e:	e8 40 f4 ff ff       	call   426e3 <sched_benchmark>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   432a3:	c7 05 93 55 01 00 00 	movl   $0x0,0x15593(%rip)        # 58840 <kernel_lock>
+   432aa:	00 00 00 
+#ifdef SCHEDSCALE
+  sched_scale_benchmark();
+#endif
+
+  spinlock_release(&kernel_lock);
+  schedule();
+   432ad:	b8 00 00 00 00       	mov    $0x0,%eax
+   432b2:	e8 e8 eb ff ff       	call   41e9f <schedule>
+  npages = memsize_physical / PAGESIZE;
+   432b7:	48 c7 05 46 bd 00 00 	movq   $0x0,0xbd46(%rip)        # 4f008 <npages>
+   432be:	00 00 00 00 
+  if (npages * sizeof(pageinfo) > room) {
+   432c2:	e9 a6 fc ff ff       	jmp    42f6d <kernel_main+0x2c8>
+  gate->gd_low = (addr & 0x000000000000FFFFUL) | (SEGSEL_KERN_CODE << 16) |
+   432c7:	0f b7 c2             	movzwl %dx,%eax
+                 ((uint64_t)dpl << 45) | X86SEG_P |
+   432ca:	4c 09 c8             	or     %r9,%rax
+                 ((addr & 0x00000000FFFF0000UL) << 32);
+   432cd:	49 89 d2             	mov    %rdx,%r10
+   432d0:	49 c1 e2 20          	shl    $0x20,%r10
+   432d4:	4d 21 c2             	and    %r8,%r10
+                 ((uint64_t)dpl << 45) | X86SEG_P |
+   432d7:	4c 09 d0             	or     %r10,%rax
+   432da:	48 09 f8             	or     %rdi,%rax
+   432dd:	48 89 01             	mov    %rax,(%rcx)
+  gate->gd_high = addr >> 32;
+   432e0:	48 c1 ea 20          	shr    $0x20,%rdx
+   432e4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  for (int i = 0; i < 256; ++i) {
+   432e8:	83 c6 01             	add    $0x1,%esi
+   432eb:	48 83 c1 10          	add    $0x10,%rcx
+    uintptr_t addr = interrupt_descriptors[i].gd_low;
+   432ef:	48 8b 11             	mov    (%rcx),%rdx
+    set_gate(&interrupt_descriptors[i], addr, X86GATE_INTERRUPT,
+   432f2:	83 fe 03             	cmp    $0x3,%esi
+   432f5:	74 d0                	je     432c7 <kernel_main+0x622>
+                 ((addr & 0x00000000FFFF0000UL) << 32);
+   432f7:	48 89 d0             	mov    %rdx,%rax
+   432fa:	48 c1 e0 20          	shl    $0x20,%rax
+   432fe:	4c 21 c0             	and    %r8,%rax
+  gate->gd_low = (addr & 0x000000000000FFFFUL) | (SEGSEL_KERN_CODE << 16) |
+   43301:	44 0f b7 d2          	movzwl %dx,%r10d
+                 ((uint64_t)dpl << 45) | X86SEG_P |
+   43305:	4c 09 d0             	or     %r10,%rax
+   43308:	48 09 f8             	or     %rdi,%rax
+   4330b:	48 89 01             	mov    %rax,(%rcx)
+  gate->gd_high = addr >> 32;
+   4330e:	48 c1 ea 20          	shr    $0x20,%rdx
+   43312:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  for (int i = 0; i < 256; ++i) {
+   43316:	83 c6 01             	add    $0x1,%esi
+   43319:	48 83 c1 10          	add    $0x10,%rcx
+   4331d:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+   43323:	75 ca                	jne    432ef <kernel_main+0x64a>
+    asm volatile("rdmsr" : "=a" (low), "=d" (high) : "c" (msr));
+   43325:	b9 1b 00 00 00       	mov    $0x1b,%ecx
+   4332a:	0f 32                	rdmsr
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   4332c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   43331:	ba 21 00 00 00       	mov    $0x21,%edx
+   43336:	ee                   	out    %al,(%dx)
+   43337:	ba a1 00 00 00       	mov    $0xa1,%edx
+   4333c:	ee                   	out    %al,(%dx)
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   4333d:	0f 31                	rdtsc
+    return low | (high << 32);
+   4333f:	48 c1 e2 20          	shl    $0x20,%rdx
+   43343:	48 09 c2             	or     %rax,%rdx
+   43346:	48 89 15 db dd 00 00 	mov    %rdx,0xdddb(%rip)        # 51128 <boottime+0x28>
+  init_cpu_state(0, KERNEL_STACK_TOP);
+   4334d:	be 00 00 08 00       	mov    $0x80000,%esi
+   43352:	bf 00 00 00 00       	mov    $0x0,%edi
+   43357:	e8 49 f0 ff ff       	call   423a5 <init_cpu_state>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   4335c:	0f 31                	rdtsc
+    return low | (high << 32);
+   4335e:	48 c1 e2 20          	shl    $0x20,%rdx
+   43362:	48 09 c2             	or     %rax,%rdx
+   43365:	48 89 15 c4 dd 00 00 	mov    %rdx,0xddc4(%rip)        # 51130 <boottime+0x30>
+  clear_vga_buffer(VGA_BUFFER, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   4336c:	be 07 00 00 00       	mov    $0x7,%esi
+   43371:	bf 00 80 0b 00       	mov    $0xb8000,%edi
+   43376:	e8 8b e2 ff ff       	call   41606 <clear_vga_buffer>
+  vga_print(welcome_message, vga_entry_color(COLOR_LIGHT_GREEN, COLOR_BLACK));
+   4337b:	be 0a 00 00 00       	mov    $0xa,%esi
+   43380:	bf 00 75 04 00       	mov    $0x47500,%edi
+   43385:	e8 b2 e2 ff ff       	call   4163c <vga_print>
+    asm volatile("cpuid"
+   4338a:	b8 01 00 00 00       	mov    $0x1,%eax
+   4338f:	0f a2                	cpuid
+   43391:	41 89 d5             	mov    %edx,%r13d
+   43394:	41 89 ce             	mov    %ecx,%r14d
+   43397:	41 89 c4             	mov    %eax,%r12d
+  vga_print("CPUID Info:\nEAX: ",
+   4339a:	be 07 00 00 00       	mov    $0x7,%esi
+   4339f:	bf 16 75 04 00       	mov    $0x47516,%edi
+   433a4:	e8 93 e2 ff ff       	call   4163c <vga_print>
+  print_hex(cpu_info.eax, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433a9:	be 07 00 00 00       	mov    $0x7,%esi
+   433ae:	44 89 e7             	mov    %r12d,%edi
+   433b1:	e8 f4 f2 ff ff       	call   426aa <print_hex>
+  vga_print("\nEBX: ", vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433b6:	be 07 00 00 00       	mov    $0x7,%esi
+   433bb:	bf 28 75 04 00       	mov    $0x47528,%edi
+   433c0:	e8 77 e2 ff ff       	call   4163c <vga_print>
+  print_hex(cpu_info.ebx, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433c5:	be 07 00 00 00       	mov    $0x7,%esi
+   433ca:	89 df                	mov    %ebx,%edi
+   433cc:	e8 d9 f2 ff ff       	call   426aa <print_hex>
+  vga_print("\nECX: ", vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433d1:	be 07 00 00 00       	mov    $0x7,%esi
+   433d6:	bf 2f 75 04 00       	mov    $0x4752f,%edi
+   433db:	e8 5c e2 ff ff       	call   4163c <vga_print>
+  print_hex(cpu_info.ecx, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433e0:	be 07 00 00 00       	mov    $0x7,%esi
+   433e5:	44 89 f7             	mov    %r14d,%edi
+   433e8:	e8 bd f2 ff ff       	call   426aa <print_hex>
+  vga_print("\nEDX: ", vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433ed:	be 07 00 00 00       	mov    $0x7,%esi
+   433f2:	bf 36 75 04 00       	mov    $0x47536,%edi
+   433f7:	e8 40 e2 ff ff       	call   4163c <vga_print>
+  print_hex(cpu_info.edx, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   433fc:	be 07 00 00 00       	mov    $0x7,%esi
+   43401:	44 89 ef             	mov    %r13d,%edi
+   43404:	e8 a1 f2 ff ff       	call   426aa <print_hex>
+  vga_print("\nNumber of cores: ",
+   43409:	be 07 00 00 00       	mov    $0x7,%esi
+   4340e:	bf 3d 75 04 00       	mov    $0x4753d,%edi
+   43413:	e8 24 e2 ff ff       	call   4163c <vga_print>
+  uint8_t num_cores = (cpu_info.ebx >> 16) & 0xFF;
+   43418:	c1 eb 10             	shr    $0x10,%ebx
+  itoa(num_cores, num_cores_str, 10);
+   4341b:	0f b6 fb             	movzbl %bl,%edi
+   4341e:	ba 0a 00 00 00       	mov    $0xa,%edx
+   43423:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+   43427:	e8 24 f2 ff ff       	call   42650 <itoa>
+  vga_print(num_cores_str, vga_entry_color(COLOR_LIGHT_GREY, COLOR_BLACK));
+   4342c:	be 07 00 00 00       	mov    $0x7,%esi
+   43431:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+   43435:	e8 02 e2 ff ff       	call   4163c <vga_print>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   4343a:	0f 31                	rdtsc
+    return low | (high << 32);
+   4343c:	48 c1 e2 20          	shl    $0x20,%rdx
+   43440:	48 09 c2             	or     %rax,%rdx
+   43443:	48 89 15 ee dc 00 00 	mov    %rdx,0xdcee(%rip)        # 51138 <boottime+0x38>
+  log_printf("bootprof begin\n");
+   4344a:	bf 50 75 04 00       	mov    $0x47550,%edi
+   4344f:	b8 00 00 00 00       	mov    $0x0,%eax
+   43454:	e8 13 0b 00 00       	call   43f6c <log_printf>
+   43459:	bb 08 00 00 00       	mov    $0x8,%ebx
+  uint64_t first = 0;
+   4345e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+   43464:	e9 da fd ff ff       	jmp    43243 <kernel_main+0x59e>
+
+0000000000043469 <lapic_enable>:
+void lapic_enable(lapicstate_t *lapic, int vector) {
+  lapic_write(lapic, APIC_REG_SVR,
+              (lapic_read(lapic, APIC_REG_SVR) & ~0xFF) | 0x100 | vector);
+}
+
+uint32_t lapic_read(lapicstate_t *lapic, int reg) { return lapic->reg[reg].v; }
+   43469:	8b 87 f0 00 00 00    	mov    0xf0(%rdi),%eax
+              (lapic_read(lapic, APIC_REG_SVR) & ~0xFF) | 0x100 | vector);
+   4346f:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+   43474:	09 f0                	or     %esi,%eax
+  lapic_write(lapic, APIC_REG_SVR,
+   43476:	80 cc 01             	or     $0x1,%ah
+
+void lapic_write(lapicstate_t *lapic, int reg, uint32_t v) { lapic->reg[reg].v = v; }
+   43479:	89 87 f0 00 00 00    	mov    %eax,0xf0(%rdi)
+}
+   4347f:	c3                   	ret
+
+0000000000043480 <lapic_read>:
+uint32_t lapic_read(lapicstate_t *lapic, int reg) { return lapic->reg[reg].v; }
+   43480:	48 63 f6             	movslq %esi,%rsi
+   43483:	48 c1 e6 04          	shl    $0x4,%rsi
+   43487:	48 01 f7             	add    %rsi,%rdi
+   4348a:	8b 07                	mov    (%rdi),%eax
+   4348c:	c3                   	ret
+
+000000000004348d <lapic_write>:
+void lapic_write(lapicstate_t *lapic, int reg, uint32_t v) { lapic->reg[reg].v = v; }
+   4348d:	48 63 f6             	movslq %esi,%rsi
+   43490:	48 c1 e6 04          	shl    $0x4,%rsi
+   43494:	48 01 f7             	add    %rsi,%rdi
+   43497:	89 17                	mov    %edx,(%rdi)
+   43499:	c3                   	ret
+
+000000000004349a <lapic_error>:
+   4349a:	c7 87 80 02 00 00 00 	movl   $0x0,0x280(%rdi)
+   434a1:	00 00 00 
+uint32_t lapic_read(lapicstate_t *lapic, int reg) { return lapic->reg[reg].v; }
+   434a4:	8b 87 80 02 00 00    	mov    0x280(%rdi),%eax
+
+uint32_t lapic_error(lapicstate_t *lapic) {
+  // TODO: is this correct? setting the reg to 0 then reading it?
+  lapic_write(lapic, APIC_REG_ESR, 0);
+  return lapic_read(lapic, APIC_REG_ESR);
+}
+   434aa:	c3                   	ret
+
+00000000000434ab <lapic_ack>:
+void lapic_write(lapicstate_t *lapic, int reg, uint32_t v) { lapic->reg[reg].v = v; }
+   434ab:	c7 87 b0 00 00 00 00 	movl   $0x0,0xb0(%rdi)
+   434b2:	00 00 00 
+
+void lapic_ack(lapicstate_t* lapic) {
+    lapic_write(lapic, APIC_REG_EOI, 0);
+}
+   434b5:	c3                   	ret
+
+00000000000434b6 <lapic_get>:
+
+lapicstate_t* lapic_get() {
+    return (lapicstate_t*)lapic_pa;
+   434b6:	b8 00 00 e0 fe       	mov    $0xfee00000,%eax
+}
+   434bb:	c3                   	ret
+
+00000000000434bc <lapic_timer_calibrate>:
+#define PIT_CH2 0x42
+#define PIT_CMD 0x43
+#define PIT_PORTB 0x61      // bit 0: channel 2 gate, bit 5: channel 2 output
+#define PIT_CAL_MS 10
+
+uint32_t lapic_timer_calibrate(lapicstate_t *lapic, uint64_t *tsc) {
+   434bc:	48 89 f9             	mov    %rdi,%rcx
+   434bf:	49 89 f1             	mov    %rsi,%r9
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   434c2:	ba 61 00 00 00       	mov    $0x61,%edx
+   434c7:	ec                   	in     (%dx),%al
+  uint16_t count = PIT_FREQ * PIT_CAL_MS / 1000;
+  // hold the gate low (and the speaker off) while loading the count
+  uint8_t portb = inb(PIT_PORTB) & ~0x03;
+   434c8:	83 e0 fc             	and    $0xfffffffc,%eax
+   434cb:	89 c6                	mov    %eax,%esi
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   434cd:	41 b8 61 00 00 00    	mov    $0x61,%r8d
+   434d3:	44 89 c2             	mov    %r8d,%edx
+   434d6:	ee                   	out    %al,(%dx)
+   434d7:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+   434dc:	ba 43 00 00 00       	mov    $0x43,%edx
+   434e1:	ee                   	out    %al,(%dx)
+   434e2:	ba 42 00 00 00       	mov    $0x42,%edx
+   434e7:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+   434ec:	ee                   	out    %al,(%dx)
+   434ed:	b8 2e 00 00 00       	mov    $0x2e,%eax
+   434f2:	ee                   	out    %al,(%dx)
+void lapic_write(lapicstate_t *lapic, int reg, uint32_t v) { lapic->reg[reg].v = v; }
+   434f3:	c7 87 20 03 00 00 00 	movl   $0x10000,0x320(%rdi)
+   434fa:	00 01 00 
+   434fd:	c7 87 e0 03 00 00 0b 	movl   $0xb,0x3e0(%rdi)
+   43504:	00 00 00 
+   43507:	c7 87 80 03 00 00 ff 	movl   $0xffffffff,0x380(%rdi)
+   4350e:	ff ff ff 
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   43511:	0f 31                	rdtsc
+    return low | (high << 32);
+   43513:	48 c1 e2 20          	shl    $0x20,%rdx
+   43517:	48 89 d7             	mov    %rdx,%rdi
+   4351a:	48 09 c7             	or     %rax,%rdi
+
+  lapic_write(lapic, APIC_REG_LVT_TIMER, LVT_MASKED);
+  lapic_write(lapic, APIC_REG_TIMER_DIVIDE, TIMER_DIVIDE_1);
+  lapic_write(lapic, APIC_REG_TIMER_INITIAL_COUNT, UINT32_MAX);
+  uint64_t start = rdtsc();
+  outb(PIT_PORTB, portb | 0x01); // start counting
+   4351d:	89 f0                	mov    %esi,%eax
+   4351f:	83 c8 01             	or     $0x1,%eax
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   43522:	44 89 c2             	mov    %r8d,%edx
+   43525:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   43526:	ba 61 00 00 00       	mov    $0x61,%edx
+   4352b:	ec                   	in     (%dx),%al
+  while (!(inb(PIT_PORTB) & 0x20)) {
+   4352c:	a8 20                	test   $0x20,%al
+   4352e:	74 fb                	je     4352b <lapic_timer_calibrate+0x6f>
+uint32_t lapic_read(lapicstate_t *lapic, int reg) { return lapic->reg[reg].v; }
+   43530:	44 8b 81 90 03 00 00 	mov    0x390(%rcx),%r8d
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   43537:	0f 31                	rdtsc
+    return low | (high << 32);
+   43539:	48 c1 e2 20          	shl    $0x20,%rdx
+   4353d:	48 09 c2             	or     %rax,%rdx
+  }
+  uint32_t elapsed =
+      UINT32_MAX - lapic_read(lapic, APIC_REG_TIMER_CURRENT_COUNT);
+  *tsc = rdtsc() - start;
+   43540:	48 29 fa             	sub    %rdi,%rdx
+   43543:	49 89 11             	mov    %rdx,(%r9)
+void lapic_write(lapicstate_t *lapic, int reg, uint32_t v) { lapic->reg[reg].v = v; }
+   43546:	c7 81 80 03 00 00 00 	movl   $0x0,0x380(%rcx)
+   4354d:	00 00 00 
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   43550:	ba 61 00 00 00       	mov    $0x61,%edx
+   43555:	89 f0                	mov    %esi,%eax
+   43557:	ee                   	out    %al,(%dx)
+  uint32_t elapsed =
+   43558:	44 89 c0             	mov    %r8d,%eax
+   4355b:	f7 d0                	not    %eax
+  lapic_write(lapic, APIC_REG_TIMER_INITIAL_COUNT, 0);
+  outb(PIT_PORTB, portb);
+  return elapsed;
+}
+   4355d:	c3                   	ret
+
+000000000004355e <ptiter_sibling>:
+
+// ptiter_sibling(it)
+//    Move to the entry after the current one. If the current entry is the
+//    last in its table, move up to the entry pointing to that table
+//    instead, which is next in post-order, and return false.
+static bool ptiter_sibling(ptiter_t *it) {
+   4355e:	48 89 fa             	mov    %rdi,%rdx
+  uintptr_t va = (it->va | pageoffmask(it->level)) + 1;
+   43561:	4c 8b 47 28          	mov    0x28(%rdi),%r8
+   43565:	8b 77 20             	mov    0x20(%rdi),%esi
+    return (1UL << (PAGEOFFBITS + level * PAGEINDEXBITS)) - 1;
+   43568:	8d 3c f6             	lea    (%rsi,%rsi,8),%edi
+   4356b:	8d 4f 0c             	lea    0xc(%rdi),%ecx
+   4356e:	b8 01 00 00 00       	mov    $0x1,%eax
+   43573:	48 d3 e0             	shl    %cl,%rax
+   43576:	48 83 e8 01          	sub    $0x1,%rax
+   4357a:	4c 09 c0             	or     %r8,%rax
+   4357d:	48 83 c0 01          	add    $0x1,%rax
+  if (it->level < 3 && (va & pageoffmask(it->level + 1)) == 0) {
+   43581:	83 fe 02             	cmp    $0x2,%esi
+   43584:	7f 15                	jg     4359b <ptiter_sibling+0x3d>
+   43586:	8d 4f 15             	lea    0x15(%rdi),%ecx
+   43589:	48 c7 c7 ff ff ff ff 	mov    $0xffffffffffffffff,%rdi
+   43590:	48 d3 e7             	shl    %cl,%rdi
+   43593:	48 f7 d7             	not    %rdi
+   43596:	48 85 c7             	test   %rax,%rdi
+   43599:	74 12                	je     435ad <ptiter_sibling+0x4f>
+    ++it->level;
+    it->va &= ~pageoffmask(it->level);
+    return false;
+  }
+  it->va = va;
+   4359b:	48 89 42 28          	mov    %rax,0x28(%rdx)
+  ++it->pep[it->level];
+   4359f:	48 63 f6             	movslq %esi,%rsi
+   435a2:	48 83 04 f2 08       	addq   $0x8,(%rdx,%rsi,8)
+  return true;
+   435a7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+   435ac:	c3                   	ret
+  if (it->level < 3 && (va & pageoffmask(it->level + 1)) == 0) {
+   435ad:	83 c6 01             	add    $0x1,%esi
+   435b0:	89 72 20             	mov    %esi,0x20(%rdx)
+   435b3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    it->va &= ~pageoffmask(it->level);
+   435ba:	48 d3 e0             	shl    %cl,%rax
+   435bd:	4c 21 c0             	and    %r8,%rax
+   435c0:	48 89 42 28          	mov    %rax,0x28(%rdx)
+    return false;
+   435c4:	b8 00 00 00 00       	mov    $0x0,%eax
+   435c9:	c3                   	ret
+
+00000000000435ca <ptiter_down>:
+
+// ptiter_down(it)
+//    Starting from the current entry, find the first entry in post-order
+//    that points to a page-table page.
+static void ptiter_down(ptiter_t *it) {
+  while (it->va < VA_LOWEND) {
+   435ca:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+   435ce:	48 89 d0             	mov    %rdx,%rax
+   435d1:	48 c1 e8 2f          	shr    $0x2f,%rax
+   435d5:	0f 85 8d 00 00 00    	jne    43668 <ptiter_down+0x9e>
+static void ptiter_down(ptiter_t *it) {
+   435db:	55                   	push   %rbp
+   435dc:	48 89 e5             	mov    %rsp,%rbp
+   435df:	41 55                	push   %r13
+   435e1:	41 54                	push   %r12
+   435e3:	53                   	push   %rbx
+   435e4:	48 83 ec 08          	sub    $0x8,%rsp
+   435e8:	48 89 fb             	mov    %rdi,%rbx
+    x86_64_pageentry_t pe = *it->pep[it->level];
+    if ((pe & (PTE_P | PTE_PS)) == PTE_P) {
+      if (it->level == 1) {
+        return;
+      }
+      x86_64_pagetable *pt = (x86_64_pagetable *)(pe & PTE_PAMASK);
+   435eb:	49 bd 00 f0 ff ff ff 	movabs $0xffffffffff000,%r13
+   435f2:	ff 0f 00 
+  while (it->va < VA_LOWEND) {
+   435f5:	49 bc ff ff ff ff ff 	movabs $0x7fffffffffff,%r12
+   435fc:	7f 00 00 
+   435ff:	eb 15                	jmp    43616 <ptiter_down+0x4c>
+      --it->level;
+      it->pep[it->level] = &pt->entry[pageindex(it->va, it->level)];
+    } else if (!ptiter_sibling(it)) {
+   43601:	48 89 df             	mov    %rbx,%rdi
+   43604:	e8 55 ff ff ff       	call   4355e <ptiter_sibling>
+   43609:	84 c0                	test   %al,%al
+   4360b:	74 50                	je     4365d <ptiter_down+0x93>
+  while (it->va < VA_LOWEND) {
+   4360d:	48 8b 53 28          	mov    0x28(%rbx),%rdx
+   43611:	49 39 d4             	cmp    %rdx,%r12
+   43614:	72 47                	jb     4365d <ptiter_down+0x93>
+    x86_64_pageentry_t pe = *it->pep[it->level];
+   43616:	8b 43 20             	mov    0x20(%rbx),%eax
+   43619:	48 63 c8             	movslq %eax,%rcx
+   4361c:	48 8b 0c cb          	mov    (%rbx,%rcx,8),%rcx
+   43620:	48 8b 09             	mov    (%rcx),%rcx
+    if ((pe & (PTE_P | PTE_PS)) == PTE_P) {
+   43623:	48 89 ce             	mov    %rcx,%rsi
+   43626:	81 e6 81 00 00 00    	and    $0x81,%esi
+   4362c:	48 83 fe 01          	cmp    $0x1,%rsi
+   43630:	75 cf                	jne    43601 <ptiter_down+0x37>
+      if (it->level == 1) {
+   43632:	83 f8 01             	cmp    $0x1,%eax
+   43635:	74 26                	je     4365d <ptiter_down+0x93>
+      --it->level;
+   43637:	83 e8 01             	sub    $0x1,%eax
+   4363a:	89 43 20             	mov    %eax,0x20(%rbx)
+      it->pep[it->level] = &pt->entry[pageindex(it->va, it->level)];
+   4363d:	48 63 f8             	movslq %eax,%rdi
+      x86_64_pagetable *pt = (x86_64_pagetable *)(pe & PTE_PAMASK);
+   43640:	48 89 ce             	mov    %rcx,%rsi
+   43643:	4c 21 ee             	and    %r13,%rsi
+    return (int) (addr >> (PAGEOFFBITS + level * PAGEINDEXBITS)) & 0x1FF;
+   43646:	8d 4c c0 0c          	lea    0xc(%rax,%rax,8),%ecx
+   4364a:	48 d3 ea             	shr    %cl,%rdx
+      it->pep[it->level] = &pt->entry[pageindex(it->va, it->level)];
+   4364d:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+   43653:	48 8d 04 d6          	lea    (%rsi,%rdx,8),%rax
+   43657:	48 89 04 fb          	mov    %rax,(%rbx,%rdi,8)
+   4365b:	eb b0                	jmp    4360d <ptiter_down+0x43>
+      return;
+    }
+  }
+}
+   4365d:	48 83 c4 08          	add    $0x8,%rsp
+   43661:	5b                   	pop    %rbx
+   43662:	41 5c                	pop    %r12
+   43664:	41 5d                	pop    %r13
+   43666:	5d                   	pop    %rbp
+   43667:	c3                   	ret
+   43668:	c3                   	ret
+
+0000000000043669 <vmiter_down>:
+    while (it->level > 0 && (*(it->pep) & (PTE_P | PTE_PS)) == PTE_P) {
+   43669:	8b 57 10             	mov    0x10(%rdi),%edx
+   4366c:	85 d2                	test   %edx,%edx
+   4366e:	7e 52                	jle    436c2 <vmiter_down+0x59>
+   43670:	8d 4c d2 03          	lea    0x3(%rdx,%rdx,8),%ecx
+        uintptr_t pa = *(it->pep) & PTE_PAMASK;
+   43674:	49 b9 00 f0 ff ff ff 	movabs $0xffffffffff000,%r9
+   4367b:	ff 0f 00 
+    while (it->level > 0 && (*(it->pep) & (PTE_P | PTE_PS)) == PTE_P) {
+   4367e:	48 8b 77 08          	mov    0x8(%rdi),%rsi
+   43682:	48 8b 06             	mov    (%rsi),%rax
+   43685:	49 89 c0             	mov    %rax,%r8
+   43688:	41 81 e0 81 00 00 00 	and    $0x81,%r8d
+   4368f:	49 83 f8 01          	cmp    $0x1,%r8
+   43693:	75 2d                	jne    436c2 <vmiter_down+0x59>
+        it->perm &= *(it->pep);
+   43695:	21 47 14             	and    %eax,0x14(%rdi)
+        --(it->level);
+   43698:	83 ea 01             	sub    $0x1,%edx
+   4369b:	89 57 10             	mov    %edx,0x10(%rdi)
+        uintptr_t pa = *(it->pep) & PTE_PAMASK;
+   4369e:	4c 89 c8             	mov    %r9,%rax
+   436a1:	48 23 06             	and    (%rsi),%rax
+   436a4:	48 89 c6             	mov    %rax,%rsi
+   436a7:	48 8b 47 18          	mov    0x18(%rdi),%rax
+   436ab:	48 d3 e8             	shr    %cl,%rax
+        it->pep = &pt->entry[pageindex(it->va, it->level)];
+   436ae:	25 ff 01 00 00       	and    $0x1ff,%eax
+   436b3:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+   436b7:	48 89 47 08          	mov    %rax,0x8(%rdi)
+    while (it->level > 0 && (*(it->pep) & (PTE_P | PTE_PS)) == PTE_P) {
+   436bb:	83 e9 09             	sub    $0x9,%ecx
+   436be:	85 d2                	test   %edx,%edx
+   436c0:	75 bc                	jne    4367e <vmiter_down+0x15>
+}
+   436c2:	c3                   	ret
+
+00000000000436c3 <vmiter_va>:
+uintptr_t vmiter_va(vmiter_t *it) { return it->va; }
+   436c3:	48 8b 47 18          	mov    0x18(%rdi),%rax
+   436c7:	c3                   	ret
+
+00000000000436c8 <vmiter_present>:
+bool vmiter_present(vmiter_t *it) { return *(it->pep) & PTE_P; }
+   436c8:	48 8b 47 08          	mov    0x8(%rdi),%rax
+   436cc:	48 8b 00             	mov    (%rax),%rax
+   436cf:	83 e0 01             	and    $0x1,%eax
+   436d2:	c3                   	ret
+
+00000000000436d3 <vmiter_real_find>:
+void vmiter_real_find(vmiter_t *it, uintptr_t va) {
+   436d3:	55                   	push   %rbp
+   436d4:	48 89 e5             	mov    %rsp,%rbp
+   436d7:	48 89 f0             	mov    %rsi,%rax
+  if (it->level == 3 || ((it->va ^ va) & ~pageoffmask(it->level + 1)) != 0) {
+   436da:	8b 57 10             	mov    0x10(%rdi),%edx
+   436dd:	83 fa 03             	cmp    $0x3,%edx
+   436e0:	74 1d                	je     436ff <vmiter_real_find+0x2c>
+    return (1UL << (PAGEOFFBITS + level * PAGEINDEXBITS)) - 1;
+   436e2:	8d 74 d2 09          	lea    0x9(%rdx,%rdx,8),%esi
+   436e6:	8d 4e 0c             	lea    0xc(%rsi),%ecx
+   436e9:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+   436f0:	48 d3 e2             	shl    %cl,%rdx
+   436f3:	48 89 c1             	mov    %rax,%rcx
+   436f6:	48 33 4f 18          	xor    0x18(%rdi),%rcx
+   436fa:	48 85 ca             	test   %rcx,%rdx
+   436fd:	74 57                	je     43756 <vmiter_real_find+0x83>
+    it->level = 3;
+   436ff:	c7 47 10 03 00 00 00 	movl   $0x3,0x10(%rdi)
+    return va <= VA_LOWMAX || va >= VA_HIGHMIN;
+   43706:	48 ba 00 00 00 00 00 	movabs $0xffff800000000000,%rdx
+   4370d:	80 ff ff 
+   43710:	48 01 c2             	add    %rax,%rdx
+    if (va_is_canonical(va)) {
+   43713:	48 b9 ff ff ff ff ff 	movabs $0xfffeffffffffffff,%rcx
+   4371a:	ff fe ff 
+   4371d:	48 39 d1             	cmp    %rdx,%rcx
+   43720:	73 26                	jae    43748 <vmiter_real_find+0x75>
+      it->perm = initial_perm;
+   43722:	c7 47 14 ff 0f 00 00 	movl   $0xfff,0x14(%rdi)
+      it->pep = &it->pt->entry[pageindex(va, it->level)];
+   43729:	48 89 c2             	mov    %rax,%rdx
+   4372c:	48 c1 ea 24          	shr    $0x24,%rdx
+   43730:	81 e2 f8 0f 00 00    	and    $0xff8,%edx
+   43736:	48 03 17             	add    (%rdi),%rdx
+      it->pep = (x86_64_pageentry_t *)&zero_pe;
+   43739:	48 89 57 08          	mov    %rdx,0x8(%rdi)
+  it->va = va;
+   4373d:	48 89 47 18          	mov    %rax,0x18(%rdi)
+  vmiter_down(it);
+   43741:	e8 23 ff ff ff       	call   43669 <vmiter_down>
+}
+   43746:	5d                   	pop    %rbp
+   43747:	c3                   	ret
+      it->perm = 0;
+   43748:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%rdi)
+   4374f:	ba 98 70 04 00       	mov    $0x47098,%edx
+   43754:	eb e3                	jmp    43739 <vmiter_real_find+0x66>
+    int curidx = ((uintptr_t)it->pep & PAGEOFFMASK) >> 3;
+   43756:	4c 8b 47 08          	mov    0x8(%rdi),%r8
+    return (int) (addr >> (PAGEOFFBITS + level * PAGEINDEXBITS)) & 0x1FF;
+   4375a:	8d 4e 03             	lea    0x3(%rsi),%ecx
+   4375d:	48 89 c2             	mov    %rax,%rdx
+   43760:	48 d3 ea             	shr    %cl,%rdx
+   43763:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+   43769:	4c 89 c1             	mov    %r8,%rcx
+   4376c:	48 c1 e9 03          	shr    $0x3,%rcx
+   43770:	81 e1 ff 01 00 00    	and    $0x1ff,%ecx
+    it->pep += pageindex(va, it->level) - curidx;
+   43776:	29 ca                	sub    %ecx,%edx
+   43778:	48 63 d2             	movslq %edx,%rdx
+   4377b:	49 8d 14 d0          	lea    (%r8,%rdx,8),%rdx
+   4377f:	eb b8                	jmp    43739 <vmiter_real_find+0x66>
+
+0000000000043781 <vmiter_init>:
+vmiter_t vmiter_init(x86_64_pagetable *pt) {
+   43781:	55                   	push   %rbp
+   43782:	48 89 e5             	mov    %rsp,%rbp
+   43785:	53                   	push   %rbx
+   43786:	48 83 ec 28          	sub    $0x28,%rsp
+   4378a:	48 89 fb             	mov    %rdi,%rbx
+  vmiter_t it = {.pt = pt,
+   4378d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+   43791:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+   43795:	c7 45 e0 03 00 00 00 	movl   $0x3,-0x20(%rbp)
+   4379c:	c7 45 e4 ff 0f 00 00 	movl   $0xfff,-0x1c(%rbp)
+   437a3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+   437aa:	00 
+  vmiter_real_find(&it, it.va);
+   437ab:	be 00 00 00 00       	mov    $0x0,%esi
+   437b0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+   437b4:	e8 1a ff ff ff       	call   436d3 <vmiter_real_find>
+  return it;
+   437b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+   437bd:	48 89 03             	mov    %rax,(%rbx)
+   437c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+   437c4:	48 89 43 08          	mov    %rax,0x8(%rbx)
+   437c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+   437cc:	48 89 43 10          	mov    %rax,0x10(%rbx)
+   437d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+   437d4:	48 89 43 18          	mov    %rax,0x18(%rbx)
+}
+   437d8:	48 89 d8             	mov    %rbx,%rax
+   437db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   437df:	c9                   	leave
+   437e0:	c3                   	ret
+
+00000000000437e1 <vmiter_map>:
+int vmiter_map(vmiter_t *it, uintptr_t pa, int perm) {
+   437e1:	55                   	push   %rbp
+   437e2:	48 89 e5             	mov    %rsp,%rbp
+   437e5:	41 55                	push   %r13
+   437e7:	41 54                	push   %r12
+   437e9:	53                   	push   %rbx
+   437ea:	48 83 ec 08          	sub    $0x8,%rsp
+   437ee:	48 89 fb             	mov    %rdi,%rbx
+   437f1:	49 89 f5             	mov    %rsi,%r13
+   437f4:	41 89 d4             	mov    %edx,%r12d
+  if (pa == (uintptr_t)-1 && perm == 0) {
+   437f7:	48 83 fe ff          	cmp    $0xffffffffffffffff,%rsi
+   437fb:	75 0f                	jne    4380c <vmiter_map+0x2b>
+   437fd:	85 d2                	test   %edx,%edx
+   437ff:	75 0b                	jne    4380c <vmiter_map+0x2b>
+  while (it->level > 0 && perm) {
+   43801:	8b 47 10             	mov    0x10(%rdi),%eax
+    pa = 0;
+   43804:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+   4380a:	eb 35                	jmp    43841 <vmiter_map+0x60>
+  while (it->level > 0 && perm) {
+   4380c:	8b 43 10             	mov    0x10(%rbx),%eax
+   4380f:	45 85 e4             	test   %r12d,%r12d
+   43812:	74 2d                	je     43841 <vmiter_map+0x60>
+   43814:	85 c0                	test   %eax,%eax
+   43816:	7e 29                	jle    43841 <vmiter_map+0x60>
+    x86_64_pagetable *pt = kalloc_zeroed(PAGESIZE);
+   43818:	bf 00 10 00 00       	mov    $0x1000,%edi
+   4381d:	e8 43 d9 ff ff       	call   41165 <kalloc_zeroed>
+    if (!pt) {
+   43822:	48 85 c0             	test   %rax,%rax
+   43825:	74 36                	je     4385d <vmiter_map+0x7c>
+    *(it->pep) = (uintptr_t)pt | PTE_P | PTE_W | PTE_U;
+   43827:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+   4382b:	48 83 c8 07          	or     $0x7,%rax
+   4382f:	48 89 02             	mov    %rax,(%rdx)
+    vmiter_down(it);
+   43832:	48 89 df             	mov    %rbx,%rdi
+   43835:	e8 2f fe ff ff       	call   43669 <vmiter_down>
+  while (it->level > 0 && perm) {
+   4383a:	8b 43 10             	mov    0x10(%rbx),%eax
+   4383d:	85 c0                	test   %eax,%eax
+   4383f:	7f d7                	jg     43818 <vmiter_map+0x37>
+  if (it->level == 0) {
+   43841:	85 c0                	test   %eax,%eax
+   43843:	75 1f                	jne    43864 <vmiter_map+0x83>
+    *(it->pep) = pa | perm;
+   43845:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+   43849:	4d 63 e4             	movslq %r12d,%r12
+   4384c:	4d 09 ec             	or     %r13,%r12
+   4384f:	4c 89 22             	mov    %r12,(%rdx)
+}
+   43852:	48 83 c4 08          	add    $0x8,%rsp
+   43856:	5b                   	pop    %rbx
+   43857:	41 5c                	pop    %r12
+   43859:	41 5d                	pop    %r13
+   4385b:	5d                   	pop    %rbp
+   4385c:	c3                   	ret
+      return -1;
+   4385d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   43862:	eb ee                	jmp    43852 <vmiter_map+0x71>
+  return 0;
+   43864:	b8 00 00 00 00       	mov    $0x0,%eax
+   43869:	eb e7                	jmp    43852 <vmiter_map+0x71>
+
+000000000004386b <vmiter_unmap_range>:
+int vmiter_unmap_range(vmiter_t *it, size_t len) {
+   4386b:	55                   	push   %rbp
+   4386c:	48 89 e5             	mov    %rsp,%rbp
+   4386f:	41 57                	push   %r15
+   43871:	41 56                	push   %r14
+   43873:	41 55                	push   %r13
+   43875:	41 54                	push   %r12
+   43877:	53                   	push   %rbx
+   43878:	48 83 ec 08          	sub    $0x8,%rsp
+   4387c:	48 89 fb             	mov    %rdi,%rbx
+  uintptr_t start = it->va, end = start + len;
+   4387f:	4c 8b 77 18          	mov    0x18(%rdi),%r14
+   43883:	4d 8d 2c 36          	lea    (%r14,%rsi,1),%r13
+  for (int i = 0; i < 2 && len; ++i) {
+   43887:	48 85 f6             	test   %rsi,%rsi
+   4388a:	0f 84 85 00 00 00    	je     43915 <vmiter_unmap_range+0xaa>
+   43890:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    return (1UL << (PAGEOFFBITS + level * PAGEINDEXBITS)) - 1;
+   43896:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+   4389c:	eb 0a                	jmp    438a8 <vmiter_unmap_range+0x3d>
+   4389e:	41 83 c4 01          	add    $0x1,%r12d
+   438a2:	41 83 fc 02          	cmp    $0x2,%r12d
+   438a6:	74 6d                	je     43915 <vmiter_unmap_range+0xaa>
+    vmiter_real_find(it, i ? end - 1 : start);
+   438a8:	45 85 e4             	test   %r12d,%r12d
+   438ab:	0f 84 05 01 00 00    	je     439b6 <vmiter_unmap_range+0x14b>
+   438b1:	49 8d 75 ff          	lea    -0x1(%r13),%rsi
+   438b5:	48 89 df             	mov    %rbx,%rdi
+   438b8:	e8 16 fe ff ff       	call   436d3 <vmiter_real_find>
+    if (it->level > 0 && (*(it->pep) & PTE_P) &&
+   438bd:	8b 43 10             	mov    0x10(%rbx),%eax
+   438c0:	85 c0                	test   %eax,%eax
+   438c2:	7e da                	jle    4389e <vmiter_unmap_range+0x33>
+   438c4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+   438c8:	f6 02 01             	testb  $0x1,(%rdx)
+   438cb:	74 d1                	je     4389e <vmiter_unmap_range+0x33>
+        ((it->va & ~pageoffmask(it->level)) < start ||
+   438cd:	48 8b 53 18          	mov    0x18(%rbx),%rdx
+   438d1:	8d 4c c0 0c          	lea    0xc(%rax,%rax,8),%ecx
+   438d5:	4c 89 f8             	mov    %r15,%rax
+   438d8:	48 d3 e0             	shl    %cl,%rax
+   438db:	48 8d 48 ff          	lea    -0x1(%rax),%rcx
+   438df:	48 f7 d8             	neg    %rax
+   438e2:	48 21 d0             	and    %rdx,%rax
+    if (it->level > 0 && (*(it->pep) & PTE_P) &&
+   438e5:	4c 39 f0             	cmp    %r14,%rax
+   438e8:	72 0c                	jb     438f6 <vmiter_unmap_range+0x8b>
+         (it->va | pageoffmask(it->level)) > end - 1)) {
+   438ea:	48 09 ca             	or     %rcx,%rdx
+   438ed:	49 8d 45 ff          	lea    -0x1(%r13),%rax
+        ((it->va & ~pageoffmask(it->level)) < start ||
+   438f1:	48 39 d0             	cmp    %rdx,%rax
+   438f4:	73 a8                	jae    4389e <vmiter_unmap_range+0x33>
+      vmiter_real_find(it, start);
+   438f6:	4c 89 f6             	mov    %r14,%rsi
+   438f9:	48 89 df             	mov    %rbx,%rdi
+   438fc:	e8 d2 fd ff ff       	call   436d3 <vmiter_real_find>
+      return -1;
+   43901:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+   43906:	48 83 c4 08          	add    $0x8,%rsp
+   4390a:	5b                   	pop    %rbx
+   4390b:	41 5c                	pop    %r12
+   4390d:	41 5d                	pop    %r13
+   4390f:	41 5e                	pop    %r14
+   43911:	41 5f                	pop    %r15
+   43913:	5d                   	pop    %rbp
+   43914:	c3                   	ret
+  vmiter_real_find(it, start);
+   43915:	4c 89 f6             	mov    %r14,%rsi
+   43918:	48 89 df             	mov    %rbx,%rdi
+   4391b:	e8 b3 fd ff ff       	call   436d3 <vmiter_real_find>
+  while (it->va < end) {
+   43920:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+   43924:	4c 39 ee             	cmp    %r13,%rsi
+   43927:	73 79                	jae    439a2 <vmiter_unmap_range+0x137>
+   43929:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+   4392f:	eb 39                	jmp    4396a <vmiter_unmap_range+0xff>
+      x86_64_pageentry_t *pep = it->pep;
+   43931:	48 8b 43 08          	mov    0x8(%rbx),%rax
+        *pep++ = 0;
+   43935:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        va += PAGESIZE;
+   4393c:	48 81 c6 00 10 00 00 	add    $0x1000,%rsi
+      } while (va < end && pageindex(va, 0) != 0);
+   43943:	4c 39 ee             	cmp    %r13,%rsi
+   43946:	73 0c                	jae    43954 <vmiter_unmap_range+0xe9>
+   43948:	48 83 c0 08          	add    $0x8,%rax
+   4394c:	f7 c6 00 f0 1f 00    	test   $0x1ff000,%esi
+   43952:	75 e1                	jne    43935 <vmiter_unmap_range+0xca>
+    if (va == 0) {
+   43954:	48 85 f6             	test   %rsi,%rsi
+   43957:	74 53                	je     439ac <vmiter_unmap_range+0x141>
+    vmiter_real_find(it, va);
+   43959:	48 89 df             	mov    %rbx,%rdi
+   4395c:	e8 72 fd ff ff       	call   436d3 <vmiter_real_find>
+  while (it->va < end) {
+   43961:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+   43965:	4c 39 ee             	cmp    %r13,%rsi
+   43968:	73 2e                	jae    43998 <vmiter_unmap_range+0x12d>
+    if (it->level == 0) {
+   4396a:	8b 43 10             	mov    0x10(%rbx),%eax
+   4396d:	85 c0                	test   %eax,%eax
+   4396f:	74 c0                	je     43931 <vmiter_unmap_range+0xc6>
+   43971:	8d 4c c0 0c          	lea    0xc(%rax,%rax,8),%ecx
+   43975:	4c 89 e0             	mov    %r12,%rax
+   43978:	48 d3 e0             	shl    %cl,%rax
+   4397b:	48 83 e8 01          	sub    $0x1,%rax
+      va = (va | pageoffmask(it->level)) + 1;
+   4397f:	48 09 c6             	or     %rax,%rsi
+   43982:	48 83 c6 01          	add    $0x1,%rsi
+      if (*(it->pep) & PTE_P) {
+   43986:	48 8b 43 08          	mov    0x8(%rbx),%rax
+   4398a:	f6 00 01             	testb  $0x1,(%rax)
+   4398d:	74 c5                	je     43954 <vmiter_unmap_range+0xe9>
+        *(it->pep) = 0;
+   4398f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+   43996:	eb bc                	jmp    43954 <vmiter_unmap_range+0xe9>
+  return 0;
+   43998:	b8 00 00 00 00       	mov    $0x0,%eax
+   4399d:	e9 64 ff ff ff       	jmp    43906 <vmiter_unmap_range+0x9b>
+   439a2:	b8 00 00 00 00       	mov    $0x0,%eax
+   439a7:	e9 5a ff ff ff       	jmp    43906 <vmiter_unmap_range+0x9b>
+   439ac:	b8 00 00 00 00       	mov    $0x0,%eax
+   439b1:	e9 50 ff ff ff       	jmp    43906 <vmiter_unmap_range+0x9b>
+    vmiter_real_find(it, i ? end - 1 : start);
+   439b6:	4c 89 f6             	mov    %r14,%rsi
+   439b9:	48 89 df             	mov    %rbx,%rdi
+   439bc:	e8 12 fd ff ff       	call   436d3 <vmiter_real_find>
+    if (it->level > 0 && (*(it->pep) & PTE_P) &&
+   439c1:	8b 43 10             	mov    0x10(%rbx),%eax
+   439c4:	85 c0                	test   %eax,%eax
+   439c6:	0f 8f f8 fe ff ff    	jg     438c4 <vmiter_unmap_range+0x59>
+  for (int i = 0; i < 2 && len; ++i) {
+   439cc:	41 83 c4 01          	add    $0x1,%r12d
+   439d0:	e9 d3 fe ff ff       	jmp    438a8 <vmiter_unmap_range+0x3d>
+
+00000000000439d5 <vmiter_next>:
+void vmiter_next(vmiter_t *it) {
+   439d5:	55                   	push   %rbp
+   439d6:	48 89 e5             	mov    %rsp,%rbp
+   439d9:	8b 47 10             	mov    0x10(%rdi),%eax
+   439dc:	8d 4c c0 0c          	lea    0xc(%rax,%rax,8),%ecx
+   439e0:	be 01 00 00 00       	mov    $0x1,%esi
+   439e5:	48 d3 e6             	shl    %cl,%rsi
+   439e8:	48 83 ee 01          	sub    $0x1,%rsi
+  vmiter_real_find(it, (it->va | pageoffmask(it->level)) + 1);
+   439ec:	48 0b 77 18          	or     0x18(%rdi),%rsi
+   439f0:	48 83 c6 01          	add    $0x1,%rsi
+   439f4:	e8 da fc ff ff       	call   436d3 <vmiter_real_find>
+}
+   439f9:	5d                   	pop    %rbp
+   439fa:	c3                   	ret
+
+00000000000439fb <vmiter_va_add>:
+void vmiter_va_add(vmiter_t *it, unsigned long n) {
+   439fb:	55                   	push   %rbp
+   439fc:	48 89 e5             	mov    %rsp,%rbp
+  vmiter_real_find(it, it->va + n);
+   439ff:	48 03 77 18          	add    0x18(%rdi),%rsi
+   43a03:	e8 cb fc ff ff       	call   436d3 <vmiter_real_find>
+}
+   43a08:	5d                   	pop    %rbp
+   43a09:	c3                   	ret
+
+0000000000043a0a <ptiter_init>:
+
+ptiter_t ptiter_init(x86_64_pagetable *pt) {
+   43a0a:	55                   	push   %rbp
+   43a0b:	48 89 e5             	mov    %rsp,%rbp
+   43a0e:	53                   	push   %rbx
+   43a0f:	48 83 ec 38          	sub    $0x38,%rsp
+   43a13:	48 89 fb             	mov    %rdi,%rbx
+  ptiter_t it = {.level = 3, .va = PROC_START_ADDR};
+   43a16:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+   43a1d:	00 
+   43a1e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+   43a25:	00 
+   43a26:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+   43a2d:	00 
+   43a2e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+   43a35:	00 
+   43a36:	c7 45 e0 03 00 00 00 	movl   $0x3,-0x20(%rbp)
+   43a3d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+   43a44:	00 00 00 
+   43a47:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  it.pep[3] = &pt->entry[pageindex(it.va, 3)];
+   43a4b:	48 83 c6 08          	add    $0x8,%rsi
+   43a4f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  ptiter_down(&it);
+   43a53:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   43a57:	e8 6e fb ff ff       	call   435ca <ptiter_down>
+  return it;
+   43a5c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+   43a60:	48 89 03             	mov    %rax,(%rbx)
+   43a63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   43a67:	48 89 43 08          	mov    %rax,0x8(%rbx)
+   43a6b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+   43a6f:	48 89 43 10          	mov    %rax,0x10(%rbx)
+   43a73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+   43a77:	48 89 43 18          	mov    %rax,0x18(%rbx)
+   43a7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+   43a7f:	48 89 43 20          	mov    %rax,0x20(%rbx)
+   43a83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+   43a87:	48 89 43 28          	mov    %rax,0x28(%rbx)
+}
+   43a8b:	48 89 d8             	mov    %rbx,%rax
+   43a8e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   43a92:	c9                   	leave
+   43a93:	c3                   	ret
+
+0000000000043a94 <ptiter_next>:
+
+bool ptiter_done(ptiter_t *it) { return it->va >= VA_LOWEND; }
+
+void ptiter_next(ptiter_t *it) {
+   43a94:	55                   	push   %rbp
+   43a95:	48 89 e5             	mov    %rsp,%rbp
+   43a98:	53                   	push   %rbx
+   43a99:	48 83 ec 08          	sub    $0x8,%rsp
+   43a9d:	48 89 fb             	mov    %rdi,%rbx
+  if (ptiter_sibling(it)) {
+   43aa0:	e8 b9 fa ff ff       	call   4355e <ptiter_sibling>
+   43aa5:	84 c0                	test   %al,%al
+   43aa7:	75 06                	jne    43aaf <ptiter_next+0x1b>
+    ptiter_down(it);
+  }
+}
+   43aa9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   43aad:	c9                   	leave
+   43aae:	c3                   	ret
+    ptiter_down(it);
+   43aaf:	48 89 df             	mov    %rbx,%rdi
+   43ab2:	e8 13 fb ff ff       	call   435ca <ptiter_down>
+}
+   43ab7:	eb f0                	jmp    43aa9 <ptiter_next+0x15>
+
+0000000000043ab9 <ptiter_kptr>:
+
+x86_64_pagetable *ptiter_kptr(ptiter_t *it) {
+  return (x86_64_pagetable *)(*it->pep[it->level] & PTE_PAMASK);
+   43ab9:	48 63 47 20          	movslq 0x20(%rdi),%rax
+   43abd:	48 8b 14 c7          	mov    (%rdi,%rax,8),%rdx
+   43ac1:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   43ac8:	ff 0f 00 
+   43acb:	48 23 02             	and    (%rdx),%rax
+}
+   43ace:	c3                   	ret
+
+0000000000043acf <pagetable_new>:
+
+int ptiter_level(ptiter_t *it) { return it->level - 1; }
+
+x86_64_pagetable *pagetable_new() {
+   43acf:	55                   	push   %rbp
+   43ad0:	48 89 e5             	mov    %rsp,%rbp
+  x86_64_pagetable *pt = kalloc_zeroed(PAGESIZE);
+   43ad3:	bf 00 10 00 00       	mov    $0x1000,%edi
+   43ad8:	e8 88 d6 ff ff       	call   41165 <kalloc_zeroed>
+  if (pt) {
+   43add:	48 85 c0             	test   %rax,%rax
+   43ae0:	74 0a                	je     43aec <pagetable_new+0x1d>
+    pt->entry[0] = kernel_pagetable[0].entry[0];
+   43ae2:	48 8b 15 17 75 00 00 	mov    0x7517(%rip),%rdx        # 4b000 <kernel_pagetable>
+   43ae9:	48 89 10             	mov    %rdx,(%rax)
+  }
+  return pt;
+}
+   43aec:	5d                   	pop    %rbp
+   43aed:	c3                   	ret
+
+0000000000043aee <pagetable_free>:
+    }
+  }
+  return npt;
+}
+
+void pagetable_free(x86_64_pagetable *pt) {
+   43aee:	55                   	push   %rbp
+   43aef:	48 89 e5             	mov    %rsp,%rbp
+   43af2:	41 57                	push   %r15
+   43af4:	41 56                	push   %r14
+   43af6:	41 55                	push   %r13
+   43af8:	41 54                	push   %r12
+   43afa:	53                   	push   %rbx
+   43afb:	48 83 ec 48          	sub    $0x48,%rsp
+   43aff:	48 89 fe             	mov    %rdi,%rsi
+   43b02:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  for (ptiter_t it = ptiter_init(pt); !ptiter_done(&it); ptiter_next(&it)) {
+   43b06:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+   43b0a:	e8 fb fe ff ff       	call   43a0a <ptiter_init>
+   43b0f:	48 b8 ff ff ff ff ff 	movabs $0x7fffffffffff,%rax
+   43b16:	7f 00 00 
+   43b19:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+   43b1d:	72 6d                	jb     43b8c <pagetable_free+0x9e>
+    x86_64_pagetable *table = ptiter_kptr(&it);
+    if (ptiter_level(&it) == 0) {
+      for (int i = 0; i < (1 << PAGEINDEXBITS); ++i) {
+        if (table->entry[i] & PTE_P) {
+          kfree((void *)(table->entry[i] & PTE_PAMASK));
+   43b1f:	49 bd 00 f0 ff ff ff 	movabs $0xffffffffff000,%r13
+   43b26:	ff 0f 00 
+  for (ptiter_t it = ptiter_init(pt); !ptiter_done(&it); ptiter_next(&it)) {
+   43b29:	49 89 c7             	mov    %rax,%r15
+   43b2c:	eb 40                	jmp    43b6e <pagetable_free+0x80>
+          kfree((void *)(table->entry[i] & PTE_PAMASK));
+   43b2e:	4c 21 ef             	and    %r13,%rdi
+   43b31:	e8 0c d8 ff ff       	call   41342 <kfree>
+      for (int i = 0; i < (1 << PAGEINDEXBITS); ++i) {
+   43b36:	48 83 c3 08          	add    $0x8,%rbx
+   43b3a:	4c 39 e3             	cmp    %r12,%rbx
+   43b3d:	74 18                	je     43b57 <pagetable_free+0x69>
+        if (table->entry[i] & PTE_P) {
+   43b3f:	48 8b 3b             	mov    (%rbx),%rdi
+   43b42:	40 f6 c7 01          	test   $0x1,%dil
+   43b46:	75 e6                	jne    43b2e <pagetable_free+0x40>
+        } else if (table->entry[i] & PTE_SWAP) {
+   43b48:	f7 c7 00 08 00 00    	test   $0x800,%edi
+   43b4e:	74 e6                	je     43b36 <pagetable_free+0x48>
+          swap_free(table->entry[i]);
+   43b50:	e8 b6 23 00 00       	call   45f0b <swap_free>
+   43b55:	eb df                	jmp    43b36 <pagetable_free+0x48>
+        }
+      }
+    }
+    kfree(table);
+   43b57:	4c 89 f7             	mov    %r14,%rdi
+   43b5a:	e8 e3 d7 ff ff       	call   41342 <kfree>
+  for (ptiter_t it = ptiter_init(pt); !ptiter_done(&it); ptiter_next(&it)) {
+   43b5f:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+   43b63:	e8 2c ff ff ff       	call   43a94 <ptiter_next>
+   43b68:	4c 3b 7d c8          	cmp    -0x38(%rbp),%r15
+   43b6c:	72 1e                	jb     43b8c <pagetable_free+0x9e>
+    x86_64_pagetable *table = ptiter_kptr(&it);
+   43b6e:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+   43b72:	e8 42 ff ff ff       	call   43ab9 <ptiter_kptr>
+   43b77:	49 89 c6             	mov    %rax,%r14
+    if (ptiter_level(&it) == 0) {
+   43b7a:	83 7d c0 01          	cmpl   $0x1,-0x40(%rbp)
+   43b7e:	75 d7                	jne    43b57 <pagetable_free+0x69>
+   43b80:	48 89 c3             	mov    %rax,%rbx
+   43b83:	4c 8d a0 00 10 00 00 	lea    0x1000(%rax),%r12
+   43b8a:	eb b3                	jmp    43b3f <pagetable_free+0x51>
+  }
+  kfree(pt);
+   43b8c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+   43b90:	e8 ad d7 ff ff       	call   41342 <kfree>
+}
+   43b95:	48 83 c4 48          	add    $0x48,%rsp
+   43b99:	5b                   	pop    %rbx
+   43b9a:	41 5c                	pop    %r12
+   43b9c:	41 5d                	pop    %r13
+   43b9e:	41 5e                	pop    %r14
+   43ba0:	41 5f                	pop    %r15
+   43ba2:	5d                   	pop    %rbp
+   43ba3:	c3                   	ret
+
+0000000000043ba4 <pagetable_copy>:
+x86_64_pagetable *pagetable_copy(x86_64_pagetable *pt, bool cow) {
+   43ba4:	55                   	push   %rbp
+   43ba5:	48 89 e5             	mov    %rsp,%rbp
+   43ba8:	41 57                	push   %r15
+   43baa:	41 56                	push   %r14
+   43bac:	41 55                	push   %r13
+   43bae:	41 54                	push   %r12
+   43bb0:	53                   	push   %rbx
+   43bb1:	48 83 ec 58          	sub    $0x58,%rsp
+   43bb5:	48 89 fb             	mov    %rdi,%rbx
+   43bb8:	40 88 75 8b          	mov    %sil,-0x75(%rbp)
+  x86_64_pagetable *npt = pagetable_new();
+   43bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+   43bc1:	e8 09 ff ff ff       	call   43acf <pagetable_new>
+   43bc6:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+  if (!npt) {
+   43bca:	48 85 c0             	test   %rax,%rax
+   43bcd:	0f 84 a5 00 00 00    	je     43c78 <pagetable_copy+0xd4>
+  vmiter_t dst = vmiter_init(npt);
+   43bd3:	48 89 c6             	mov    %rax,%rsi
+   43bd6:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   43bda:	e8 a2 fb ff ff       	call   43781 <vmiter_init>
+  vmiter_t src = vmiter_init(pt);
+   43bdf:	48 89 de             	mov    %rbx,%rsi
+   43be2:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   43be6:	e8 96 fb ff ff       	call   43781 <vmiter_init>
+  for (vmiter_va_add(&src, PROC_START_ADDR); vmiter_va(&src) < VA_LOWEND;
+   43beb:	48 be 00 00 00 00 80 	movabs $0x8000000000,%rsi
+   43bf2:	00 00 00 
+   43bf5:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   43bf9:	e8 fd fd ff ff       	call   439fb <vmiter_va_add>
+uintptr_t vmiter_va(vmiter_t *it) { return it->va; }
+   43bfe:	48 8b 5d a8          	mov    -0x58(%rbp),%rbx
+  for (vmiter_va_add(&src, PROC_START_ADDR); vmiter_va(&src) < VA_LOWEND;
+   43c02:	48 89 d8             	mov    %rbx,%rax
+   43c05:	48 c1 e8 2f          	shr    $0x2f,%rax
+   43c09:	75 6d                	jne    43c78 <pagetable_copy+0xd4>
+   43c0b:	49 bf ff ff ff ff ff 	movabs $0x7fffffffffff,%r15
+   43c12:	7f 00 00 
+   43c15:	e9 51 01 00 00       	jmp    43d6b <pagetable_copy+0x1c7>
+      vmiter_va_add(&dst, vmiter_va(&src) - vmiter_va(&dst));
+   43c1a:	48 89 de             	mov    %rbx,%rsi
+   43c1d:	48 2b 75 c8          	sub    -0x38(%rbp),%rsi
+   43c21:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   43c25:	e8 d1 fd ff ff       	call   439fb <vmiter_va_add>
+      if (swap_dup(*(src.pep)) < 0) {
+   43c2a:	4c 89 e7             	mov    %r12,%rdi
+   43c2d:	e8 b1 22 00 00       	call   45ee3 <swap_dup>
+   43c32:	85 c0                	test   %eax,%eax
+   43c34:	78 55                	js     43c8b <pagetable_copy+0xe7>
+                     *(src.pep) & PAGEOFFMASK) < 0) {
+   43c36:	49 8b 36             	mov    (%r14),%rsi
+      if (vmiter_map(&dst, *(src.pep) & PTE_PAMASK,
+   43c39:	89 f2                	mov    %esi,%edx
+   43c3b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+   43c41:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   43c48:	ff 0f 00 
+   43c4b:	48 21 c6             	and    %rax,%rsi
+   43c4e:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   43c52:	e8 8a fb ff ff       	call   437e1 <vmiter_map>
+   43c57:	85 c0                	test   %eax,%eax
+   43c59:	0f 89 f6 00 00 00    	jns    43d55 <pagetable_copy+0x1b1>
+        swap_free(*(src.pep));
+   43c5f:	49 8b 3e             	mov    (%r14),%rdi
+   43c62:	e8 a4 22 00 00       	call   45f0b <swap_free>
+        pagetable_free(npt);
+   43c67:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+   43c6b:	e8 7e fe ff ff       	call   43aee <pagetable_free>
+        return NULL;
+   43c70:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+   43c77:	00 
+}
+   43c78:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+   43c7c:	48 83 c4 58          	add    $0x58,%rsp
+   43c80:	5b                   	pop    %rbx
+   43c81:	41 5c                	pop    %r12
+   43c83:	41 5d                	pop    %r13
+   43c85:	41 5e                	pop    %r14
+   43c87:	41 5f                	pop    %r15
+   43c89:	5d                   	pop    %rbp
+   43c8a:	c3                   	ret
+        pagetable_free(npt);
+   43c8b:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+   43c8f:	e8 5a fe ff ff       	call   43aee <pagetable_free>
+        return NULL;
+   43c94:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+   43c9b:	00 
+   43c9c:	eb da                	jmp    43c78 <pagetable_copy+0xd4>
+        pagetable_free(npt);
+   43c9e:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+   43ca2:	e8 47 fe ff ff       	call   43aee <pagetable_free>
+        return NULL;
+   43ca7:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+   43cae:	00 
+   43caf:	eb c7                	jmp    43c78 <pagetable_copy+0xd4>
+    } else if (!cow || pages[pa / PAGESIZE].refcount == UINT8_MAX) {
+   43cb1:	80 7d 8b 00          	cmpb   $0x0,-0x75(%rbp)
+   43cb5:	74 4e                	je     43d05 <pagetable_copy+0x161>
+   43cb7:	4c 89 e8             	mov    %r13,%rax
+   43cba:	48 c1 e8 0c          	shr    $0xc,%rax
+   43cbe:	48 c1 e0 04          	shl    $0x4,%rax
+   43cc2:	48 8b 15 37 b3 00 00 	mov    0xb337(%rip),%rdx        # 4f000 <pages>
+   43cc9:	80 3c 02 ff          	cmpb   $0xff,(%rdx,%rax,1)
+   43ccd:	74 36                	je     43d05 <pagetable_copy+0x161>
+      if (perm & PTE_W) {
+   43ccf:	41 f6 c4 02          	test   $0x2,%r12b
+   43cd3:	74 1b                	je     43cf0 <pagetable_copy+0x14c>
+        perm = (perm & ~PTE_W) | PTE_COW;
+   43cd5:	41 81 e4 fd 0d 00 00 	and    $0xdfd,%r12d
+   43cdc:	41 81 cc 00 02 00 00 	or     $0x200,%r12d
+   43ce3:	44 89 65 8c          	mov    %r12d,-0x74(%rbp)
+        *(src.pep) = pa | perm;
+   43ce7:	49 63 d4             	movslq %r12d,%rdx
+   43cea:	4c 09 ea             	or     %r13,%rdx
+   43ced:	49 89 16             	mov    %rdx,(%r14)
+      if ((void *)pa != zero_frame) {
+   43cf0:	4c 39 2d c9 e0 00 00 	cmp    %r13,0xe0c9(%rip)        # 51dc0 <zero_frame>
+   43cf7:	74 35                	je     43d2e <pagetable_copy+0x18a>
+        ++pages[pa / PAGESIZE].refcount;
+   43cf9:	48 03 05 00 b3 00 00 	add    0xb300(%rip),%rax        # 4f000 <pages>
+   43d00:	80 00 01             	addb   $0x1,(%rax)
+   43d03:	eb 29                	jmp    43d2e <pagetable_copy+0x18a>
+      void *copy = kalloc(PAGESIZE);
+   43d05:	bf 00 10 00 00       	mov    $0x1000,%edi
+   43d0a:	e8 de d3 ff ff       	call   410ed <kalloc>
+   43d0f:	49 89 c4             	mov    %rax,%r12
+      if (!copy) {
+   43d12:	48 85 c0             	test   %rax,%rax
+   43d15:	0f 84 c0 00 00 00    	je     43ddb <pagetable_copy+0x237>
+      memcpy(copy, (void *)pa, PAGESIZE);
+   43d1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+   43d20:	4c 89 ee             	mov    %r13,%rsi
+   43d23:	48 89 c7             	mov    %rax,%rdi
+   43d26:	e8 80 08 00 00       	call   445ab <memcpy>
+      pa = (uintptr_t)copy;
+   43d2b:	4d 89 e5             	mov    %r12,%r13
+    vmiter_va_add(&dst, vmiter_va(&src) - vmiter_va(&dst));
+   43d2e:	48 2b 5d c8          	sub    -0x38(%rbp),%rbx
+   43d32:	48 89 de             	mov    %rbx,%rsi
+   43d35:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   43d39:	e8 bd fc ff ff       	call   439fb <vmiter_va_add>
+    if (vmiter_map(&dst, pa, perm) < 0) {
+   43d3e:	8b 55 8c             	mov    -0x74(%rbp),%edx
+   43d41:	4c 89 ee             	mov    %r13,%rsi
+   43d44:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   43d48:	e8 94 fa ff ff       	call   437e1 <vmiter_map>
+   43d4d:	85 c0                	test   %eax,%eax
+   43d4f:	0f 88 98 00 00 00    	js     43ded <pagetable_copy+0x249>
+       vmiter_next(&src)) {
+   43d55:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   43d59:	e8 77 fc ff ff       	call   439d5 <vmiter_next>
+uintptr_t vmiter_va(vmiter_t *it) { return it->va; }
+   43d5e:	48 8b 5d a8          	mov    -0x58(%rbp),%rbx
+  for (vmiter_va_add(&src, PROC_START_ADDR); vmiter_va(&src) < VA_LOWEND;
+   43d62:	49 39 df             	cmp    %rbx,%r15
+   43d65:	0f 82 0d ff ff ff    	jb     43c78 <pagetable_copy+0xd4>
+    if (src.level == 0 && (*(src.pep) & PTE_SWAP)) {
+   43d6b:	83 7d a0 00          	cmpl   $0x0,-0x60(%rbp)
+   43d6f:	75 e4                	jne    43d55 <pagetable_copy+0x1b1>
+   43d71:	4c 8b 75 98          	mov    -0x68(%rbp),%r14
+   43d75:	4d 8b 26             	mov    (%r14),%r12
+   43d78:	41 f7 c4 00 08 00 00 	test   $0x800,%r12d
+   43d7f:	0f 85 95 fe ff ff    	jne    43c1a <pagetable_copy+0x76>
+    if (!vmiter_present(&src) || src.level != 0) {
+   43d85:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   43d89:	e8 3a f9 ff ff       	call   436c8 <vmiter_present>
+   43d8e:	84 c0                	test   %al,%al
+   43d90:	74 c3                	je     43d55 <pagetable_copy+0x1b1>
+    uintptr_t pa = *(src.pep) & PTE_PAMASK;
+   43d92:	49 bd 00 f0 ff ff ff 	movabs $0xffffffffff000,%r13
+   43d99:	ff 0f 00 
+   43d9c:	4d 21 e5             	and    %r12,%r13
+    int perm = *(src.pep) & PAGEOFFMASK;
+   43d9f:	44 89 e0             	mov    %r12d,%eax
+   43da2:	25 ff 0f 00 00       	and    $0xfff,%eax
+   43da7:	89 45 8c             	mov    %eax,-0x74(%rbp)
+    if (perm & PTE_SHARED) {
+   43daa:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+   43db1:	0f 84 fa fe ff ff    	je     43cb1 <pagetable_copy+0x10d>
+      if (pages[pa / PAGESIZE].refcount == UINT8_MAX) {
+   43db7:	4c 89 e8             	mov    %r13,%rax
+   43dba:	48 c1 e8 08          	shr    $0x8,%rax
+   43dbe:	48 03 05 3b b2 00 00 	add    0xb23b(%rip),%rax        # 4f000 <pages>
+   43dc5:	0f b6 10             	movzbl (%rax),%edx
+   43dc8:	80 fa ff             	cmp    $0xff,%dl
+   43dcb:	0f 84 cd fe ff ff    	je     43c9e <pagetable_copy+0xfa>
+      ++pages[pa / PAGESIZE].refcount;
+   43dd1:	83 c2 01             	add    $0x1,%edx
+   43dd4:	88 10                	mov    %dl,(%rax)
+   43dd6:	e9 53 ff ff ff       	jmp    43d2e <pagetable_copy+0x18a>
+        pagetable_free(npt);
+   43ddb:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+   43ddf:	e8 0a fd ff ff       	call   43aee <pagetable_free>
+        return NULL;
+   43de4:	4c 89 65 80          	mov    %r12,-0x80(%rbp)
+   43de8:	e9 8b fe ff ff       	jmp    43c78 <pagetable_copy+0xd4>
+      kfree((void *)pa);
+   43ded:	4c 89 ef             	mov    %r13,%rdi
+   43df0:	e8 4d d5 ff ff       	call   41342 <kfree>
+      pagetable_free(npt);
+   43df5:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+   43df9:	e8 f0 fc ff ff       	call   43aee <pagetable_free>
+      return NULL;
+   43dfe:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+   43e05:	00 
+   43e06:	e9 6d fe ff ff       	jmp    43c78 <pagetable_copy+0xd4>
+
+0000000000043e0b <pagetable_free_deferred>:
+// moves on in `schedule`.
+#define REAP_LINK ((1 << PAGEINDEXBITS) - 1)
+static x86_64_pagetable *pagetable_reap_list;
+
+void pagetable_free_deferred(x86_64_pagetable *pt) {
+  pt->entry[REAP_LINK] = (x86_64_pageentry_t)pagetable_reap_list;
+   43e0b:	48 8b 05 e6 d8 00 00 	mov    0xd8e6(%rip),%rax        # 516f8 <pagetable_reap_list>
+   43e12:	48 89 87 f8 0f 00 00 	mov    %rax,0xff8(%rdi)
+  pagetable_reap_list = pt;
+   43e19:	48 89 3d d8 d8 00 00 	mov    %rdi,0xd8d8(%rip)        # 516f8 <pagetable_reap_list>
+}
+   43e20:	c3                   	ret
+
+0000000000043e21 <pagetable_reap>:
+  return false;
+}
+
+bool pagetable_reap() {
+  x86_64_pagetable *prev = NULL;
+  for (x86_64_pagetable *pt = pagetable_reap_list; pt;
+   43e21:	4c 8b 0d d0 d8 00 00 	mov    0xd8d0(%rip),%r9        # 516f8 <pagetable_reap_list>
+   43e28:	4d 85 c9             	test   %r9,%r9
+   43e2b:	74 79                	je     43ea6 <pagetable_reap+0x85>
+  for (int i = 0; i < ncpu; ++i) {
+   43e2d:	8b 0d 51 42 00 00    	mov    0x4251(%rip),%ecx        # 48084 <ncpu>
+   43e33:	41 b8 60 88 05 00    	mov    $0x58860,%r8d
+   43e39:	48 63 d1             	movslq %ecx,%rdx
+   43e3c:	48 69 d2 e8 00 00 00 	imul   $0xe8,%rdx,%rdx
+   43e43:	4c 01 c2             	add    %r8,%rdx
+  for (x86_64_pagetable *pt = pagetable_reap_list; pt;
+   43e46:	4c 89 cf             	mov    %r9,%rdi
+  x86_64_pagetable *prev = NULL;
+   43e49:	be 00 00 00 00       	mov    $0x0,%esi
+   43e4e:	eb 1b                	jmp    43e6b <pagetable_reap+0x4a>
+    if (!pagetable_loaded(pt)) {
+      x86_64_pagetable *next = (x86_64_pagetable *)pt->entry[REAP_LINK];
+      if (prev) {
+        prev->entry[REAP_LINK] = (x86_64_pageentry_t)next;
+      } else {
+        pagetable_reap_list = next;
+   43e50:	48 89 05 a1 d8 00 00 	mov    %rax,0xd8a1(%rip)        # 516f8 <pagetable_reap_list>
+   43e57:	eb 41                	jmp    43e9a <pagetable_reap+0x79>
+       prev = pt, pt = (x86_64_pagetable *)pt->entry[REAP_LINK]) {
+   43e59:	48 8b 87 f8 0f 00 00 	mov    0xff8(%rdi),%rax
+  for (x86_64_pagetable *pt = pagetable_reap_list; pt;
+   43e60:	48 89 fe             	mov    %rdi,%rsi
+   43e63:	48 85 c0             	test   %rax,%rax
+   43e66:	74 3e                	je     43ea6 <pagetable_reap+0x85>
+       prev = pt, pt = (x86_64_pagetable *)pt->entry[REAP_LINK]) {
+   43e68:	48 89 c7             	mov    %rax,%rdi
+  for (int i = 0; i < ncpu; ++i) {
+   43e6b:	85 c9                	test   %ecx,%ecx
+   43e6d:	7e 14                	jle    43e83 <pagetable_reap+0x62>
+   43e6f:	4c 89 c0             	mov    %r8,%rax
+    if (cpus[i].pagetable == pt) {
+   43e72:	48 39 78 28          	cmp    %rdi,0x28(%rax)
+   43e76:	74 e1                	je     43e59 <pagetable_reap+0x38>
+  for (int i = 0; i < ncpu; ++i) {
+   43e78:	48 05 e8 00 00 00    	add    $0xe8,%rax
+   43e7e:	48 39 d0             	cmp    %rdx,%rax
+   43e81:	75 ef                	jne    43e72 <pagetable_reap+0x51>
+bool pagetable_reap() {
+   43e83:	55                   	push   %rbp
+   43e84:	48 89 e5             	mov    %rsp,%rbp
+      x86_64_pagetable *next = (x86_64_pagetable *)pt->entry[REAP_LINK];
+   43e87:	48 8b 87 f8 0f 00 00 	mov    0xff8(%rdi),%rax
+      if (prev) {
+   43e8e:	48 85 f6             	test   %rsi,%rsi
+   43e91:	74 bd                	je     43e50 <pagetable_reap+0x2f>
+        prev->entry[REAP_LINK] = (x86_64_pageentry_t)next;
+   43e93:	48 89 86 f8 0f 00 00 	mov    %rax,0xff8(%rsi)
+      }
+      pagetable_free(pt);
+   43e9a:	e8 4f fc ff ff       	call   43aee <pagetable_free>
+      return true;
+   43e9f:	b8 01 00 00 00       	mov    $0x1,%eax
+    }
+  }
+  return pagetable_reap_list != NULL;
+}
+   43ea4:	5d                   	pop    %rbp
+   43ea5:	c3                   	ret
+  return pagetable_reap_list != NULL;
+   43ea6:	4d 85 c9             	test   %r9,%r9
+   43ea9:	0f 95 c0             	setne  %al
+}
+   43eac:	c3                   	ret
+
+0000000000043ead <log_putc>:
+#define IO_PARALLEL_CONTROL_INIT 0x04
+#define IO_PARALLEL_CONTROL_STROBE 0x01
+
+static void log_putc(unsigned char c) {
+  static bool initialized;
+  if (!initialized) {
+   43ead:	80 3d 4c d8 00 00 00 	cmpb   $0x0,0xd84c(%rip)        # 51700 <initialized.0>
+   43eb4:	75 12                	jne    43ec8 <log_putc+0x1b>
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   43eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+   43ebb:	ba 7a 03 00 00       	mov    $0x37a,%edx
+   43ec0:	ee                   	out    %al,(%dx)
+    outb(IO_PARALLEL1_CONTROL, 0);
+    initialized = true;
+   43ec1:	c6 05 38 d8 00 00 01 	movb   $0x1,0xd838(%rip)        # 51700 <initialized.0>
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   43ec8:	ba 79 03 00 00       	mov    $0x379,%edx
+   43ecd:	ec                   	in     (%dx),%al
+  }
+
+  // wait (briefly) for the printer to become ready
+  for (int i = 0;
+       i < 12800 && (inb(IO_PARALLEL1_STATUS) & IO_PARALLEL_STATUS_BUSY) == 0;
+   43ece:	84 c0                	test   %al,%al
+   43ed0:	78 11                	js     43ee3 <log_putc+0x36>
+   43ed2:	b9 00 32 00 00       	mov    $0x3200,%ecx
+    asm volatile("pause" : : : "memory");
+   43ed7:	f3 90                	pause
+   43ed9:	83 e9 01             	sub    $0x1,%ecx
+   43edc:	74 05                	je     43ee3 <log_putc+0x36>
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   43ede:	ec                   	in     (%dx),%al
+   43edf:	84 c0                	test   %al,%al
+   43ee1:	79 f4                	jns    43ed7 <log_putc+0x2a>
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   43ee3:	ba 78 03 00 00       	mov    $0x378,%edx
+   43ee8:	89 f8                	mov    %edi,%eax
+   43eea:	ee                   	out    %al,(%dx)
+   43eeb:	ba 7a 03 00 00       	mov    $0x37a,%edx
+   43ef0:	b8 0d 00 00 00       	mov    $0xd,%eax
+   43ef5:	ee                   	out    %al,(%dx)
+   43ef6:	b8 0c 00 00 00       	mov    $0xc,%eax
+   43efb:	ee                   	out    %al,(%dx)
+  outb(IO_PARALLEL1_CONTROL, IO_PARALLEL_CONTROL_SELECT |
+                                 IO_PARALLEL_CONTROL_INIT |
+                                 IO_PARALLEL_CONTROL_STROBE);
+  outb(IO_PARALLEL1_CONTROL,
+       IO_PARALLEL_CONTROL_SELECT | IO_PARALLEL_CONTROL_INIT);
+}
+   43efc:	c3                   	ret
+
+0000000000043efd <log_puts>:
+
+static void log_puts(const char *s) {
+   43efd:	55                   	push   %rbp
+   43efe:	48 89 e5             	mov    %rsp,%rbp
+   43f01:	53                   	push   %rbx
+   43f02:	48 83 ec 08          	sub    $0x8,%rsp
+   43f06:	48 89 fb             	mov    %rdi,%rbx
+  for (; *s; ++s) {
+   43f09:	0f b6 3f             	movzbl (%rdi),%edi
+   43f0c:	40 84 ff             	test   %dil,%dil
+   43f0f:	74 15                	je     43f26 <log_puts+0x29>
+    log_putc(*s);
+   43f11:	40 0f b6 ff          	movzbl %dil,%edi
+   43f15:	e8 93 ff ff ff       	call   43ead <log_putc>
+  for (; *s; ++s) {
+   43f1a:	48 83 c3 01          	add    $0x1,%rbx
+   43f1e:	0f b6 3b             	movzbl (%rbx),%edi
+   43f21:	40 84 ff             	test   %dil,%dil
+   43f24:	75 eb                	jne    43f11 <log_puts+0x14>
+  }
+}
+   43f26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   43f2a:	c9                   	leave
+   43f2b:	c3                   	ret
+
+0000000000043f2c <log_putu>:
+
+static void log_putu(uint64_t value, int base) {
+   43f2c:	55                   	push   %rbp
+   43f2d:	48 89 e5             	mov    %rsp,%rbp
+   43f30:	48 83 ec 20          	sub    $0x20,%rsp
+  char buffer[21];
+  char *p = &buffer[sizeof(buffer) - 1];
+  *p = '\0';
+   43f34:	c6 45 ff 00          	movb   $0x0,-0x1(%rbp)
+  char *p = &buffer[sizeof(buffer) - 1];
+   43f38:	48 8d 4d ff          	lea    -0x1(%rbp),%rcx
+  do {
+    *--p = "0123456789abcdef"[value % base];
+   43f3c:	48 63 f6             	movslq %esi,%rsi
+   43f3f:	48 83 e9 01          	sub    $0x1,%rcx
+   43f43:	48 89 f8             	mov    %rdi,%rax
+   43f46:	ba 00 00 00 00       	mov    $0x0,%edx
+   43f4b:	48 f7 f6             	div    %rsi
+   43f4e:	0f b6 92 d3 75 04 00 	movzbl 0x475d3(%rdx),%edx
+   43f55:	88 11                	mov    %dl,(%rcx)
+    value /= base;
+   43f57:	48 89 fa             	mov    %rdi,%rdx
+   43f5a:	48 89 c7             	mov    %rax,%rdi
+  } while (value);
+   43f5d:	48 39 f2             	cmp    %rsi,%rdx
+   43f60:	73 dd                	jae    43f3f <log_putu+0x13>
+  log_puts(p);
+   43f62:	48 89 cf             	mov    %rcx,%rdi
+   43f65:	e8 93 ff ff ff       	call   43efd <log_puts>
+}
+   43f6a:	c9                   	leave
+   43f6b:	c3                   	ret
+
+0000000000043f6c <log_printf>:
+
+void log_printf(const char *format, ...) {
+   43f6c:	55                   	push   %rbp
+   43f6d:	48 89 e5             	mov    %rsp,%rbp
+   43f70:	41 54                	push   %r12
+   43f72:	53                   	push   %rbx
+   43f73:	48 83 ec 50          	sub    $0x50,%rsp
+   43f77:	48 89 fb             	mov    %rdi,%rbx
+   43f7a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+   43f7e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+   43f82:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+   43f86:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+   43f8a:	4c 89 4d e8          	mov    %r9,-0x18(%rbp)
+  va_list val;
+  va_start(val, format);
+   43f8e:	c7 45 a8 08 00 00 00 	movl   $0x8,-0x58(%rbp)
+   43f95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+   43f99:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   43f9d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+   43fa1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  for (; *format; ++format) {
+   43fa5:	0f b6 3f             	movzbl (%rdi),%edi
+   43fa8:	40 84 ff             	test   %dil,%dil
+   43fab:	75 25                	jne    43fd2 <log_printf+0x66>
+      va_end(val);
+      return;
+    }
+  }
+  va_end(val);
+}
+   43fad:	48 83 c4 50          	add    $0x50,%rsp
+   43fb1:	5b                   	pop    %rbx
+   43fb2:	41 5c                	pop    %r12
+   43fb4:	5d                   	pop    %rbp
+   43fb5:	c3                   	ret
+      log_putc(*format);
+   43fb6:	40 0f b6 ff          	movzbl %dil,%edi
+   43fba:	e8 ee fe ff ff       	call   43ead <log_putc>
+      continue;
+   43fbf:	49 89 dc             	mov    %rbx,%r12
+  for (; *format; ++format) {
+   43fc2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+   43fc7:	41 0f b6 7c 24 01    	movzbl 0x1(%r12),%edi
+   43fcd:	40 84 ff             	test   %dil,%dil
+   43fd0:	74 db                	je     43fad <log_printf+0x41>
+    if (*format != '%') {
+   43fd2:	40 80 ff 25          	cmp    $0x25,%dil
+   43fd6:	75 de                	jne    43fb6 <log_printf+0x4a>
+    bool is_long = *format == 'l';
+   43fd8:	0f b6 43 01          	movzbl 0x1(%rbx),%eax
+    if (is_long) {
+   43fdc:	3c 6c                	cmp    $0x6c,%al
+   43fde:	74 20                	je     44000 <log_printf+0x94>
+    ++format;
+   43fe0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+    switch (*format) {
+   43fe4:	3c 25                	cmp    $0x25,%al
+   43fe6:	0f 84 ff 01 00 00    	je     441eb <log_printf+0x27f>
+   43fec:	8d 50 9d             	lea    -0x63(%rax),%edx
+   43fef:	80 fa 15             	cmp    $0x15,%dl
+   43ff2:	77 b9                	ja     43fad <log_printf+0x41>
+   43ff4:	77 b7                	ja     43fad <log_printf+0x41>
+   43ff6:	0f b6 d2             	movzbl %dl,%edx
+   43ff9:	ff 24 d5 a0 70 04 00 	jmp    *0x470a0(,%rdx,8)
+      ++format;
+   44000:	4c 8d 63 02          	lea    0x2(%rbx),%r12
+    switch (*format) {
+   44004:	0f b6 53 02          	movzbl 0x2(%rbx),%edx
+   44008:	80 fa 25             	cmp    $0x25,%dl
+   4400b:	0f 84 da 01 00 00    	je     441eb <log_printf+0x27f>
+   44011:	8d 4a 9d             	lea    -0x63(%rdx),%ecx
+   44014:	80 f9 15             	cmp    $0x15,%cl
+   44017:	77 94                	ja     43fad <log_printf+0x41>
+   44019:	77 92                	ja     43fad <log_printf+0x41>
+   4401b:	0f b6 d1             	movzbl %cl,%edx
+   4401e:	ff 24 d5 50 71 04 00 	jmp    *0x47150(,%rdx,8)
+      log_puts(va_arg(val, const char *));
+   44025:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   44028:	83 f8 2f             	cmp    $0x2f,%eax
+   4402b:	77 19                	ja     44046 <log_printf+0xda>
+   4402d:	89 c2                	mov    %eax,%edx
+   4402f:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44033:	83 c0 08             	add    $0x8,%eax
+   44036:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   44039:	48 8b 3a             	mov    (%rdx),%rdi
+   4403c:	e8 bc fe ff ff       	call   43efd <log_puts>
+      break;
+   44041:	e9 7c ff ff ff       	jmp    43fc2 <log_printf+0x56>
+      log_puts(va_arg(val, const char *));
+   44046:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   4404a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   4404e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   44052:	eb e5                	jmp    44039 <log_printf+0xcd>
+      log_putc(va_arg(val, int));
+   44054:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   44057:	83 f8 2f             	cmp    $0x2f,%eax
+   4405a:	77 19                	ja     44075 <log_printf+0x109>
+   4405c:	89 c2                	mov    %eax,%edx
+   4405e:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44062:	83 c0 08             	add    $0x8,%eax
+   44065:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   44068:	0f b6 3a             	movzbl (%rdx),%edi
+   4406b:	e8 3d fe ff ff       	call   43ead <log_putc>
+      break;
+   44070:	e9 4d ff ff ff       	jmp    43fc2 <log_printf+0x56>
+      log_putc(va_arg(val, int));
+   44075:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   44079:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   4407d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   44081:	eb e5                	jmp    44068 <log_printf+0xfc>
+      int64_t v = is_long ? va_arg(val, int64_t) : va_arg(val, int);
+   44083:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   44086:	83 f8 2f             	cmp    $0x2f,%eax
+   44089:	77 11                	ja     4409c <log_printf+0x130>
+   4408b:	89 c2                	mov    %eax,%edx
+   4408d:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44091:	83 c0 08             	add    $0x8,%eax
+   44094:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   44097:	48 8b 1a             	mov    (%rdx),%rbx
+   4409a:	eb 25                	jmp    440c1 <log_printf+0x155>
+   4409c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   440a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   440a4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   440a8:	eb ed                	jmp    44097 <log_printf+0x12b>
+   440aa:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   440ad:	83 f8 2f             	cmp    $0x2f,%eax
+   440b0:	77 26                	ja     440d8 <log_printf+0x16c>
+   440b2:	89 c2                	mov    %eax,%edx
+   440b4:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   440b8:	83 c0 08             	add    $0x8,%eax
+   440bb:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   440be:	48 63 1a             	movslq (%rdx),%rbx
+      if (v < 0) {
+   440c1:	48 85 db             	test   %rbx,%rbx
+   440c4:	78 20                	js     440e6 <log_printf+0x17a>
+      log_putu(v, 10);
+   440c6:	be 0a 00 00 00       	mov    $0xa,%esi
+   440cb:	48 89 df             	mov    %rbx,%rdi
+   440ce:	e8 59 fe ff ff       	call   43f2c <log_putu>
+      break;
+   440d3:	e9 ea fe ff ff       	jmp    43fc2 <log_printf+0x56>
+      int64_t v = is_long ? va_arg(val, int64_t) : va_arg(val, int);
+   440d8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   440dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   440e0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   440e4:	eb d8                	jmp    440be <log_printf+0x152>
+        log_putc('-');
+   440e6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+   440eb:	e8 bd fd ff ff       	call   43ead <log_putc>
+        v = -v;
+   440f0:	48 f7 db             	neg    %rbx
+   440f3:	eb d1                	jmp    440c6 <log_printf+0x15a>
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 10);
+   440f5:	3c 6c                	cmp    $0x6c,%al
+   440f7:	74 25                	je     4411e <log_printf+0x1b2>
+   440f9:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   440fc:	83 f8 2f             	cmp    $0x2f,%eax
+   440ff:	77 44                	ja     44145 <log_printf+0x1d9>
+   44101:	89 c2                	mov    %eax,%edx
+   44103:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44107:	83 c0 08             	add    $0x8,%eax
+   4410a:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   4410d:	8b 3a                	mov    (%rdx),%edi
+   4410f:	be 0a 00 00 00       	mov    $0xa,%esi
+   44114:	e8 13 fe ff ff       	call   43f2c <log_putu>
+      break;
+   44119:	e9 a4 fe ff ff       	jmp    43fc2 <log_printf+0x56>
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 10);
+   4411e:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   44121:	83 f8 2f             	cmp    $0x2f,%eax
+   44124:	77 11                	ja     44137 <log_printf+0x1cb>
+   44126:	89 c2                	mov    %eax,%edx
+   44128:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   4412c:	83 c0 08             	add    $0x8,%eax
+   4412f:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   44132:	48 8b 3a             	mov    (%rdx),%rdi
+   44135:	eb d8                	jmp    4410f <log_printf+0x1a3>
+   44137:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   4413b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   4413f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   44143:	eb ed                	jmp    44132 <log_printf+0x1c6>
+   44145:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   44149:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   4414d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   44151:	eb ba                	jmp    4410d <log_printf+0x1a1>
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 16);
+   44153:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   44156:	83 f8 2f             	cmp    $0x2f,%eax
+   44159:	77 11                	ja     4416c <log_printf+0x200>
+   4415b:	89 c2                	mov    %eax,%edx
+   4415d:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44161:	83 c0 08             	add    $0x8,%eax
+   44164:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   44167:	48 8b 3a             	mov    (%rdx),%rdi
+   4416a:	eb 24                	jmp    44190 <log_printf+0x224>
+   4416c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   44170:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   44174:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   44178:	eb ed                	jmp    44167 <log_printf+0x1fb>
+   4417a:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   4417d:	83 f8 2f             	cmp    $0x2f,%eax
+   44180:	77 1d                	ja     4419f <log_printf+0x233>
+   44182:	89 c2                	mov    %eax,%edx
+   44184:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   44188:	83 c0 08             	add    $0x8,%eax
+   4418b:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   4418e:	8b 3a                	mov    (%rdx),%edi
+   44190:	be 10 00 00 00       	mov    $0x10,%esi
+   44195:	e8 92 fd ff ff       	call   43f2c <log_putu>
+      break;
+   4419a:	e9 23 fe ff ff       	jmp    43fc2 <log_printf+0x56>
+      log_putu(is_long ? va_arg(val, uint64_t) : va_arg(val, unsigned), 16);
+   4419f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   441a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   441a7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   441ab:	eb e1                	jmp    4418e <log_printf+0x222>
+      log_puts("0x");
+   441ad:	bf 77 74 04 00       	mov    $0x47477,%edi
+   441b2:	e8 46 fd ff ff       	call   43efd <log_puts>
+      log_putu((uintptr_t)va_arg(val, void *), 16);
+   441b7:	8b 45 a8             	mov    -0x58(%rbp),%eax
+   441ba:	83 f8 2f             	cmp    $0x2f,%eax
+   441bd:	77 1e                	ja     441dd <log_printf+0x271>
+   441bf:	89 c2                	mov    %eax,%edx
+   441c1:	48 03 55 b8          	add    -0x48(%rbp),%rdx
+   441c5:	83 c0 08             	add    $0x8,%eax
+   441c8:	89 45 a8             	mov    %eax,-0x58(%rbp)
+   441cb:	48 8b 3a             	mov    (%rdx),%rdi
+   441ce:	be 10 00 00 00       	mov    $0x10,%esi
+   441d3:	e8 54 fd ff ff       	call   43f2c <log_putu>
+      break;
+   441d8:	e9 e5 fd ff ff       	jmp    43fc2 <log_printf+0x56>
+      log_putu((uintptr_t)va_arg(val, void *), 16);
+   441dd:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+   441e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+   441e5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   441e9:	eb e0                	jmp    441cb <log_printf+0x25f>
+      log_putc('%');
+   441eb:	bf 25 00 00 00       	mov    $0x25,%edi
+   441f0:	e8 b8 fc ff ff       	call   43ead <log_putc>
+      break;
+   441f5:	e9 c8 fd ff ff       	jmp    43fc2 <log_printf+0x56>
+
+00000000000441fa <kmalloc>:
+    }
+  }
+  return NULL;
+}
+
+void *kmalloc(size_t sz) {
+   441fa:	55                   	push   %rbp
+   441fb:	48 89 e5             	mov    %rsp,%rbp
+   441fe:	53                   	push   %rbx
+   441ff:	48 83 ec 08          	sub    $0x8,%rsp
+  if (sz > KMALLOC_MAX) {
+   44203:	48 81 ff 00 08 00 00 	cmp    $0x800,%rdi
+   4420a:	0f 87 ff 00 00 00    	ja     4430f <kmalloc+0x115>
+  int cls = 0;
+   44210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while ((1UL << (cls + SLAB_MINSHIFT)) < sz) {
+   44215:	be 01 00 00 00       	mov    $0x1,%esi
+   4421a:	ba 10 00 00 00       	mov    $0x10,%edx
+   4421f:	b8 04 00 00 00       	mov    $0x4,%eax
+   44224:	48 83 ff 10          	cmp    $0x10,%rdi
+   44228:	76 15                	jbe    4423f <kmalloc+0x45>
+    ++cls;
+   4422a:	89 d8                	mov    %ebx,%eax
+   4422c:	83 c3 01             	add    $0x1,%ebx
+  while ((1UL << (cls + SLAB_MINSHIFT)) < sz) {
+   4422f:	83 c0 05             	add    $0x5,%eax
+   44232:	48 89 f2             	mov    %rsi,%rdx
+   44235:	89 c1                	mov    %eax,%ecx
+   44237:	48 d3 e2             	shl    %cl,%rdx
+   4423a:	48 39 fa             	cmp    %rdi,%rdx
+   4423d:	72 eb                	jb     4422a <kmalloc+0x30>
+  if (!sc->size) {
+   4423f:	48 63 cb             	movslq %ebx,%rcx
+   44242:	48 c1 e1 05          	shl    $0x5,%rcx
+   44246:	48 83 b9 20 17 05 00 	cmpq   $0x0,0x51720(%rcx)
+   4424d:	00 
+   4424e:	75 6c                	jne    442bc <kmalloc+0xc2>
+    sc->size = 1UL << (cls + SLAB_MINSHIFT);
+   44250:	48 63 cb             	movslq %ebx,%rcx
+   44253:	48 c1 e1 05          	shl    $0x5,%rcx
+   44257:	48 89 91 20 17 05 00 	mov    %rdx,0x51720(%rcx)
+    while (((PAGESIZE << sc->order) - SLAB_HDRSIZE) / sc->size <
+   4425e:	8b b1 28 17 05 00    	mov    0x51728(%rcx),%esi
+   44264:	ba 00 10 00 00       	mov    $0x1000,%edx
+   44269:	89 f1                	mov    %esi,%ecx
+   4426b:	48 d3 e2             	shl    %cl,%rdx
+   4426e:	48 83 ea 30          	sub    $0x30,%rdx
+   44272:	89 c1                	mov    %eax,%ecx
+   44274:	48 d3 ea             	shr    %cl,%rdx
+   44277:	48 83 fa 07          	cmp    $0x7,%rdx
+   4427b:	77 32                	ja     442af <kmalloc+0xb5>
+   4427d:	83 c6 01             	add    $0x1,%esi
+   44280:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+      ++sc->order;
+   44286:	89 f7                	mov    %esi,%edi
+    while (((PAGESIZE << sc->order) - SLAB_HDRSIZE) / sc->size <
+   44288:	4c 89 c2             	mov    %r8,%rdx
+   4428b:	89 f1                	mov    %esi,%ecx
+   4428d:	48 d3 e2             	shl    %cl,%rdx
+   44290:	48 83 ea 30          	sub    $0x30,%rdx
+   44294:	89 c1                	mov    %eax,%ecx
+   44296:	48 d3 ea             	shr    %cl,%rdx
+   44299:	83 c6 01             	add    $0x1,%esi
+   4429c:	48 83 fa 07          	cmp    $0x7,%rdx
+   442a0:	76 e4                	jbe    44286 <kmalloc+0x8c>
+   442a2:	48 63 c3             	movslq %ebx,%rax
+   442a5:	48 c1 e0 05          	shl    $0x5,%rax
+   442a9:	89 b8 28 17 05 00    	mov    %edi,0x51728(%rax)
+    sc->nobjs = ((PAGESIZE << sc->order) - SLAB_HDRSIZE) / sc->size;
+   442af:	48 63 c3             	movslq %ebx,%rax
+   442b2:	48 c1 e0 05          	shl    $0x5,%rax
+   442b6:	89 90 2c 17 05 00    	mov    %edx,0x5172c(%rax)
+    return kalloc(sz);
+  }
+
+  slab_cache *sc = slab_cache_for(sz);
+  slab *s = sc->partial;
+   442bc:	48 63 c3             	movslq %ebx,%rax
+   442bf:	48 c1 e0 05          	shl    $0x5,%rax
+   442c3:	48 8b 90 30 17 05 00 	mov    0x51730(%rax),%rdx
+  if (!s && !(s = slab_create(sc))) {
+   442ca:	48 85 d2             	test   %rdx,%rdx
+   442cd:	74 47                	je     44316 <kmalloc+0x11c>
+    return NULL;
+  }
+  if (s == sc->empty) {
+   442cf:	48 63 c3             	movslq %ebx,%rax
+   442d2:	48 c1 e0 05          	shl    $0x5,%rax
+   442d6:	48 39 90 38 17 05 00 	cmp    %rdx,0x51738(%rax)
+   442dd:	0f 84 ba 00 00 00    	je     4439d <kmalloc+0x1a3>
+    sc->empty = NULL;
+  }
+
+  void *obj = s->freelist;
+   442e3:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  if (obj) {
+   442e7:	48 85 c0             	test   %rax,%rax
+   442ea:	0f 84 c4 00 00 00    	je     443b4 <kmalloc+0x1ba>
+    s->freelist = *(void **)obj;
+   442f0:	48 8b 08             	mov    (%rax),%rcx
+   442f3:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+  } else {
+    obj = (void *)s->bump;
+    s->bump += sc->size;
+  }
+  if (++s->inuse == s->nobjs) {
+   442f7:	8b 7a 28             	mov    0x28(%rdx),%edi
+   442fa:	8d 4f 01             	lea    0x1(%rdi),%ecx
+   442fd:	89 4a 28             	mov    %ecx,0x28(%rdx)
+   44300:	3b 4a 2c             	cmp    0x2c(%rdx),%ecx
+   44303:	0f 84 c9 00 00 00    	je     443d2 <kmalloc+0x1d8>
+    slab_unlink(s);
+  }
+  return obj;
+}
+   44309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   4430d:	c9                   	leave
+   4430e:	c3                   	ret
+    return kalloc(sz);
+   4430f:	e8 d9 cd ff ff       	call   410ed <kalloc>
+   44314:	eb f3                	jmp    44309 <kmalloc+0x10f>
+  slab *s = kalloc(PAGESIZE << sc->order);
+   44316:	48 63 c3             	movslq %ebx,%rax
+   44319:	48 c1 e0 05          	shl    $0x5,%rax
+   4431d:	8b 88 28 17 05 00    	mov    0x51728(%rax),%ecx
+   44323:	bf 00 10 00 00       	mov    $0x1000,%edi
+   44328:	48 d3 e7             	shl    %cl,%rdi
+   4432b:	e8 bd cd ff ff       	call   410ed <kalloc>
+   44330:	48 89 c2             	mov    %rax,%rdx
+  if (!s) {
+   44333:	48 85 c0             	test   %rax,%rax
+   44336:	74 d1                	je     44309 <kmalloc+0x10f>
+  pages[(uintptr_t)s / PAGESIZE].slab = true;
+   44338:	48 c1 e8 0c          	shr    $0xc,%rax
+   4433c:	48 c1 e0 04          	shl    $0x4,%rax
+   44340:	48 03 05 b9 ac 00 00 	add    0xacb9(%rip),%rax        # 4f000 <pages>
+   44347:	80 48 02 02          	orb    $0x2,0x2(%rax)
+  slab_cache *sc = &slab_caches[cls];
+   4434b:	48 63 c3             	movslq %ebx,%rax
+   4434e:	48 c1 e0 05          	shl    $0x5,%rax
+   44352:	48 05 20 17 05 00    	add    $0x51720,%rax
+   44358:	48 89 02             	mov    %rax,(%rdx)
+  s->freelist = NULL;
+   4435b:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+   44362:	00 
+  s->bump = (uintptr_t)s + SLAB_HDRSIZE;
+   44363:	48 8d 4a 30          	lea    0x30(%rdx),%rcx
+   44367:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+  s->inuse = 0;
+   4436b:	c7 42 28 00 00 00 00 	movl   $0x0,0x28(%rdx)
+  s->nobjs = sc->nobjs;
+   44372:	8b 48 0c             	mov    0xc(%rax),%ecx
+   44375:	89 4a 2c             	mov    %ecx,0x2c(%rdx)
+  s->prev = NULL;
+   44378:	48 c7 42 10 00 00 00 	movq   $0x0,0x10(%rdx)
+   4437f:	00 
+  s->next = s->cache->partial;
+   44380:	48 8b 40 10          	mov    0x10(%rax),%rax
+   44384:	48 89 42 08          	mov    %rax,0x8(%rdx)
+  if (s->next) {
+   44388:	48 85 c0             	test   %rax,%rax
+   4438b:	74 04                	je     44391 <kmalloc+0x197>
+    s->next->prev = s;
+   4438d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  s->cache->partial = s;
+   44391:	48 8b 02             	mov    (%rdx),%rax
+   44394:	48 89 50 10          	mov    %rdx,0x10(%rax)
+   44398:	e9 32 ff ff ff       	jmp    442cf <kmalloc+0xd5>
+    sc->empty = NULL;
+   4439d:	48 63 c3             	movslq %ebx,%rax
+   443a0:	48 c1 e0 05          	shl    $0x5,%rax
+   443a4:	48 c7 80 38 17 05 00 	movq   $0x0,0x51738(%rax)
+   443ab:	00 00 00 00 
+   443af:	e9 2f ff ff ff       	jmp    442e3 <kmalloc+0xe9>
+    obj = (void *)s->bump;
+   443b4:	48 8b 42 20          	mov    0x20(%rdx),%rax
+    s->bump += sc->size;
+   443b8:	48 63 db             	movslq %ebx,%rbx
+   443bb:	48 c1 e3 05          	shl    $0x5,%rbx
+   443bf:	48 89 c1             	mov    %rax,%rcx
+   443c2:	48 03 8b 20 17 05 00 	add    0x51720(%rbx),%rcx
+   443c9:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+   443cd:	e9 25 ff ff ff       	jmp    442f7 <kmalloc+0xfd>
+  if (s->prev) {
+   443d2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+   443d6:	48 85 c9             	test   %rcx,%rcx
+   443d9:	74 22                	je     443fd <kmalloc+0x203>
+    s->prev->next = s->next;
+   443db:	48 8b 72 08          	mov    0x8(%rdx),%rsi
+   443df:	48 89 71 08          	mov    %rsi,0x8(%rcx)
+  if (s->next) {
+   443e3:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+   443e7:	48 85 c9             	test   %rcx,%rcx
+   443ea:	0f 84 19 ff ff ff    	je     44309 <kmalloc+0x10f>
+    s->next->prev = s->prev;
+   443f0:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+   443f4:	48 89 51 10          	mov    %rdx,0x10(%rcx)
+   443f8:	e9 0c ff ff ff       	jmp    44309 <kmalloc+0x10f>
+    s->cache->partial = s->next;
+   443fd:	48 8b 0a             	mov    (%rdx),%rcx
+   44400:	48 8b 72 08          	mov    0x8(%rdx),%rsi
+   44404:	48 89 71 10          	mov    %rsi,0x10(%rcx)
+   44408:	eb d9                	jmp    443e3 <kmalloc+0x1e9>
+
+000000000004440a <kmfree>:
+
+void kmfree(void *ptr) {
+  if (!ptr) {
+   4440a:	48 85 ff             	test   %rdi,%rdi
+   4440d:	0f 84 0b 01 00 00    	je     4451e <kmfree+0x114>
+void kmfree(void *ptr) {
+   44413:	55                   	push   %rbp
+   44414:	48 89 e5             	mov    %rsp,%rbp
+   44417:	48 89 fe             	mov    %rdi,%rsi
+  uintptr_t pn = (uintptr_t)ptr / PAGESIZE;
+   4441a:	49 89 f9             	mov    %rdi,%r9
+   4441d:	49 c1 e9 0c          	shr    $0xc,%r9
+    if (pages[head].slab && pages[head].order == k &&
+   44421:	4c 8b 05 d8 ab 00 00 	mov    0xabd8(%rip),%r8        # 4f000 <pages>
+  for (int k = 0; k <= SLAB_MAXORDER; ++k) {
+   44428:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t head = pn & ~((1UL << k) - 1);
+   4442d:	bf 01 00 00 00       	mov    $0x1,%edi
+   44432:	eb 0c                	jmp    44440 <kmfree+0x36>
+  for (int k = 0; k <= SLAB_MAXORDER; ++k) {
+   44434:	83 c1 01             	add    $0x1,%ecx
+   44437:	83 f9 04             	cmp    $0x4,%ecx
+   4443a:	0f 84 9c 00 00 00    	je     444dc <kmfree+0xd2>
+    uintptr_t head = pn & ~((1UL << k) - 1);
+   44440:	48 89 f8             	mov    %rdi,%rax
+   44443:	48 d3 e0             	shl    %cl,%rax
+   44446:	48 f7 d8             	neg    %rax
+   44449:	4c 21 c8             	and    %r9,%rax
+    if (pages[head].slab && pages[head].order == k &&
+   4444c:	48 89 c2             	mov    %rax,%rdx
+   4444f:	48 c1 e2 04          	shl    $0x4,%rdx
+   44453:	4c 01 c2             	add    %r8,%rdx
+   44456:	f6 42 02 02          	testb  $0x2,0x2(%rdx)
+   4445a:	74 d8                	je     44434 <kmfree+0x2a>
+   4445c:	44 0f b6 52 01       	movzbl 0x1(%rdx),%r10d
+   44461:	44 39 d1             	cmp    %r10d,%ecx
+   44464:	75 ce                	jne    44434 <kmfree+0x2a>
+   44466:	80 3a 00             	cmpb   $0x0,(%rdx)
+   44469:	74 c9                	je     44434 <kmfree+0x2a>
+    return;
+  }
+  slab *s = slab_find(ptr);
+  if (!s) {
+   4446b:	48 89 c7             	mov    %rax,%rdi
+   4446e:	48 c1 e7 0c          	shl    $0xc,%rdi
+   44472:	74 68                	je     444dc <kmfree+0xd2>
+    kfree(ptr);
+    return;
+  }
+
+  slab_cache *sc = s->cache;
+   44474:	4c 8b 07             	mov    (%rdi),%r8
+  *(void **)ptr = s->freelist;
+   44477:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+   4447b:	48 89 16             	mov    %rdx,(%rsi)
+  s->freelist = ptr;
+   4447e:	48 89 77 18          	mov    %rsi,0x18(%rdi)
+  if (s->inuse-- == s->nobjs) {
+   44482:	8b 57 28             	mov    0x28(%rdi),%edx
+   44485:	8d 4a ff             	lea    -0x1(%rdx),%ecx
+   44488:	89 4f 28             	mov    %ecx,0x28(%rdi)
+   4448b:	3b 57 2c             	cmp    0x2c(%rdi),%edx
+   4448e:	74 56                	je     444e6 <kmfree+0xdc>
+    slab_link(s);
+  }
+
+  if (s->inuse == 0) {
+   44490:	83 7f 28 00          	cmpl   $0x0,0x28(%rdi)
+   44494:	75 44                	jne    444da <kmfree+0xd0>
+    if (!sc->empty) {
+   44496:	49 8b 50 18          	mov    0x18(%r8),%rdx
+   4449a:	48 85 d2             	test   %rdx,%rdx
+   4449d:	74 6c                	je     4450b <kmfree+0x101>
+      sc->empty = s;
+    } else if (sc->empty != s) {
+   4449f:	48 39 fa             	cmp    %rdi,%rdx
+   444a2:	74 36                	je     444da <kmfree+0xd0>
+  if (s->prev) {
+   444a4:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+   444a8:	48 85 d2             	test   %rdx,%rdx
+   444ab:	74 64                	je     44511 <kmfree+0x107>
+    s->prev->next = s->next;
+   444ad:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+   444b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  if (s->next) {
+   444b5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+   444b9:	48 85 d2             	test   %rdx,%rdx
+   444bc:	74 08                	je     444c6 <kmfree+0xbc>
+    s->next->prev = s->prev;
+   444be:	48 8b 4f 10          	mov    0x10(%rdi),%rcx
+   444c2:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+      slab_unlink(s);
+      pages[(uintptr_t)s / PAGESIZE].slab = false;
+   444c6:	48 c1 e0 04          	shl    $0x4,%rax
+   444ca:	48 03 05 2f ab 00 00 	add    0xab2f(%rip),%rax        # 4f000 <pages>
+   444d1:	80 60 02 fd          	andb   $0xfd,0x2(%rax)
+      kfree(s);
+   444d5:	e8 68 ce ff ff       	call   41342 <kfree>
+    }
+  }
+}
+   444da:	5d                   	pop    %rbp
+   444db:	c3                   	ret
+    kfree(ptr);
+   444dc:	48 89 f7             	mov    %rsi,%rdi
+   444df:	e8 5e ce ff ff       	call   41342 <kfree>
+    return;
+   444e4:	eb f4                	jmp    444da <kmfree+0xd0>
+  s->prev = NULL;
+   444e6:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+   444ed:	00 
+  s->next = s->cache->partial;
+   444ee:	48 8b 17             	mov    (%rdi),%rdx
+   444f1:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+   444f5:	48 89 57 08          	mov    %rdx,0x8(%rdi)
+  if (s->next) {
+   444f9:	48 85 d2             	test   %rdx,%rdx
+   444fc:	74 04                	je     44502 <kmfree+0xf8>
+    s->next->prev = s;
+   444fe:	48 89 7a 10          	mov    %rdi,0x10(%rdx)
+  s->cache->partial = s;
+   44502:	48 8b 17             	mov    (%rdi),%rdx
+   44505:	48 89 7a 10          	mov    %rdi,0x10(%rdx)
+}
+   44509:	eb 85                	jmp    44490 <kmfree+0x86>
+      sc->empty = s;
+   4450b:	49 89 78 18          	mov    %rdi,0x18(%r8)
+   4450f:	eb c9                	jmp    444da <kmfree+0xd0>
+    s->cache->partial = s->next;
+   44511:	48 8b 17             	mov    (%rdi),%rdx
+   44514:	48 8b 4f 08          	mov    0x8(%rdi),%rcx
+   44518:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+   4451c:	eb 97                	jmp    444b5 <kmfree+0xab>
+   4451e:	c3                   	ret
+
+000000000004451f <memset_stosq>:
+    *p = c;
+  }
+}
+
+static void memset_stosq(void *v, int c, size_t n) {
+  uint64_t pattern = (uint8_t)c * 0x0101010101010101UL;
+   4451f:	40 0f b6 c6          	movzbl %sil,%eax
+   44523:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+   4452a:	01 01 01 
+   4452d:	48 0f af c1          	imul   %rcx,%rax
+  size_t nq = n / 8, nb = n % 8;
+   44531:	48 89 d1             	mov    %rdx,%rcx
+   44534:	48 c1 e9 03          	shr    $0x3,%rcx
+   44538:	83 e2 07             	and    $0x7,%edx
+  asm volatile("rep stosq" : "+D"(v), "+c"(nq) : "a"(pattern) : "memory");
+   4453b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  asm volatile("rep stosb" : "+D"(v), "+c"(nb) : "a"(pattern) : "memory");
+   4453e:	48 89 d1             	mov    %rdx,%rcx
+   44541:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+   44543:	c3                   	ret
+
+0000000000044544 <mem_init>:
+void mem_init() {
+   44544:	55                   	push   %rbp
+   44545:	48 89 e5             	mov    %rsp,%rbp
+   44548:	53                   	push   %rbx
+    asm volatile("cpuid"
+   44549:	b8 00 00 00 00       	mov    $0x0,%eax
+   4454e:	0f a2                	cpuid
+  if (cpuid(0).eax >= 7) {
+   44550:	83 f8 06             	cmp    $0x6,%eax
+   44553:	76 24                	jbe    44579 <mem_init+0x35>
+    asm volatile("cpuid"
+   44555:	b8 07 00 00 00       	mov    $0x7,%eax
+   4455a:	b9 00 00 00 00       	mov    $0x0,%ecx
+   4455f:	0f a2                	cpuid
+    mem_erms = (leaf7.ebx >> 9) & 1;
+   44561:	c1 eb 09             	shr    $0x9,%ebx
+   44564:	83 e3 01             	and    $0x1,%ebx
+   44567:	88 1d b4 d2 00 00    	mov    %bl,0xd2b4(%rip)        # 51821 <mem_erms>
+    mem_fsrm = (leaf7.edx >> 4) & 1;
+   4456d:	c1 ea 04             	shr    $0x4,%edx
+   44570:	83 e2 01             	and    $0x1,%edx
+   44573:	88 15 a7 d2 00 00    	mov    %dl,0xd2a7(%rip)        # 51820 <mem_fsrm>
+}
+   44579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   4457d:	c9                   	leave
+   4457e:	c3                   	ret
+
+000000000004457f <memset>:
+
+static void memcpy_movsb(void *dst, const void *src, size_t n) {
+  asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(n) : : "memory");
+}
+
+void *memset(void *v, int c, size_t n) {
+   4457f:	55                   	push   %rbp
+   44580:	48 89 e5             	mov    %rsp,%rbp
+   44583:	53                   	push   %rbx
+   44584:	48 83 ec 08          	sub    $0x8,%rsp
+   44588:	48 89 fb             	mov    %rdi,%rbx
+  if (mem_erms) {
+   4458b:	80 3d 8f d2 00 00 00 	cmpb   $0x0,0xd28f(%rip)        # 51821 <mem_erms>
+   44592:	74 10                	je     445a4 <memset+0x25>
+  asm volatile("rep stosb" : "+D"(v), "+c"(n) : "a"(c) : "memory");
+   44594:	48 89 d1             	mov    %rdx,%rcx
+   44597:	89 f0                	mov    %esi,%eax
+   44599:	f3 aa                	rep stos %al,%es:(%rdi)
+    memset_stosb(v, c, n);
+  } else {
+    memset_stosq(v, c, n);
+  }
+  return v;
+}
+   4459b:	48 89 d8             	mov    %rbx,%rax
+   4459e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   445a2:	c9                   	leave
+   445a3:	c3                   	ret
+    memset_stosq(v, c, n);
+   445a4:	e8 76 ff ff ff       	call   4451f <memset_stosq>
+   445a9:	eb f0                	jmp    4459b <memset+0x1c>
+
+00000000000445ab <memcpy>:
+
+void *memcpy(void *dst, const void *src, size_t n) {
+   445ab:	48 89 f8             	mov    %rdi,%rax
+  if (mem_fsrm || (mem_erms && n >= MEM_MOVSB_MIN)) {
+   445ae:	80 3d 6b d2 00 00 00 	cmpb   $0x0,0xd26b(%rip)        # 51820 <mem_fsrm>
+   445b5:	75 0f                	jne    445c6 <memcpy+0x1b>
+   445b7:	80 3d 63 d2 00 00 00 	cmpb   $0x0,0xd263(%rip)        # 51821 <mem_erms>
+   445be:	74 0f                	je     445cf <memcpy+0x24>
+   445c0:	48 83 fa 7f          	cmp    $0x7f,%rdx
+   445c4:	76 09                	jbe    445cf <memcpy+0x24>
+  asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(n) : : "memory");
+   445c6:	48 89 c7             	mov    %rax,%rdi
+   445c9:	48 89 d1             	mov    %rdx,%rcx
+   445cc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+   445ce:	c3                   	ret
+  size_t nq = n / 8, nb = n % 8;
+   445cf:	48 89 d1             	mov    %rdx,%rcx
+   445d2:	48 c1 e9 03          	shr    $0x3,%rcx
+   445d6:	83 e2 07             	and    $0x7,%edx
+  asm volatile("rep movsq" : "+D"(dst), "+S"(src), "+c"(nq) : : "memory");
+   445d9:	48 89 c7             	mov    %rax,%rdi
+   445dc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  asm volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(nb) : : "memory");
+   445df:	48 89 d1             	mov    %rdx,%rcx
+   445e2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    memcpy_movsb(dst, src, n);
+  } else {
+    memcpy_movsq(dst, src, n);
+  }
+  return dst;
+}
+   445e4:	c3                   	ret
+
+00000000000445e5 <memmove>:
+
+// memmove(dst, src, n)
+//    A forward copy is safe unless `dst` lies inside `[src, src + n)`.
+//    Otherwise copy backward with the direction flag set: quadwords from
+//    the end, then the leftover bytes at the start.
+void *memmove(void *dst, const void *src, size_t n) {
+   445e5:	48 89 f8             	mov    %rdi,%rax
+  if ((uintptr_t)dst - (uintptr_t)src >= n) {
+   445e8:	48 89 f9             	mov    %rdi,%rcx
+   445eb:	48 29 f1             	sub    %rsi,%rcx
+   445ee:	48 39 d1             	cmp    %rdx,%rcx
+   445f1:	73 2c                	jae    4461f <memmove+0x3a>
+    return memcpy(dst, src, n);
+  }
+  size_t nq = n / 8, nb = n % 8;
+   445f3:	48 89 d1             	mov    %rdx,%rcx
+   445f6:	48 c1 e9 03          	shr    $0x3,%rcx
+   445fa:	49 89 d0             	mov    %rdx,%r8
+   445fd:	41 83 e0 07          	and    $0x7,%r8d
+  char *d = (char *)dst + n - 8;
+   44601:	48 83 ea 08          	sub    $0x8,%rdx
+   44605:	48 8d 3c 17          	lea    (%rdi,%rdx,1),%rdi
+  const char *s = (const char *)src + n - 8;
+   44609:	48 01 d6             	add    %rdx,%rsi
+  asm volatile("std; rep movsq"
+   4460c:	fd                   	std
+   4460d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+               : "+D"(d), "+S"(s), "+c"(nq)
+               :
+               : "memory");
+  d += 7;
+   44610:	48 83 c7 07          	add    $0x7,%rdi
+  s += 7;
+   44614:	48 83 c6 07          	add    $0x7,%rsi
+  asm volatile("rep movsb; cld"
+   44618:	4c 89 c1             	mov    %r8,%rcx
+   4461b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+   4461d:	fc                   	cld
+               : "+D"(d), "+S"(s), "+c"(nb)
+               :
+               : "memory");
+  return dst;
+}
+   4461e:	c3                   	ret
+void *memmove(void *dst, const void *src, size_t n) {
+   4461f:	55                   	push   %rbp
+   44620:	48 89 e5             	mov    %rsp,%rbp
+    return memcpy(dst, src, n);
+   44623:	e8 83 ff ff ff       	call   445ab <memcpy>
+}
+   44628:	5d                   	pop    %rbp
+   44629:	c3                   	ret
+
+000000000004462a <memcmp>:
+
+int memcmp(const void *a, const void *b, size_t n) {
+  const uint64_t *qa = (const uint64_t *)a, *qb = (const uint64_t *)b;
+  for (; n >= 8 && *qa == *qb; n -= 8) {
+   4462a:	48 83 fa 07          	cmp    $0x7,%rdx
+   4462e:	76 1a                	jbe    4464a <memcmp+0x20>
+   44630:	48 8b 06             	mov    (%rsi),%rax
+   44633:	48 39 07             	cmp    %rax,(%rdi)
+   44636:	75 12                	jne    4464a <memcmp+0x20>
+    ++qa, ++qb;
+   44638:	48 83 c7 08          	add    $0x8,%rdi
+   4463c:	48 83 c6 08          	add    $0x8,%rsi
+  for (; n >= 8 && *qa == *qb; n -= 8) {
+   44640:	48 83 ea 08          	sub    $0x8,%rdx
+   44644:	48 83 fa 07          	cmp    $0x7,%rdx
+   44648:	77 e6                	ja     44630 <memcmp+0x6>
+  }
+  const uint8_t *ba = (const uint8_t *)qa, *bb = (const uint8_t *)qb;
+  for (; n > 0; --n, ++ba, ++bb) {
+   4464a:	b8 00 00 00 00       	mov    $0x0,%eax
+   4464f:	48 85 d2             	test   %rdx,%rdx
+   44652:	74 1d                	je     44671 <memcmp+0x47>
+    if (*ba != *bb) {
+   44654:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+   44658:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+   4465d:	44 38 c1             	cmp    %r8b,%cl
+   44660:	75 10                	jne    44672 <memcmp+0x48>
+  for (; n > 0; --n, ++ba, ++bb) {
+   44662:	48 83 c0 01          	add    $0x1,%rax
+   44666:	48 39 d0             	cmp    %rdx,%rax
+   44669:	75 e9                	jne    44654 <memcmp+0x2a>
+      return *ba - *bb;
+    }
+  }
+  return 0;
+   4466b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   44670:	c3                   	ret
+   44671:	c3                   	ret
+      return *ba - *bb;
+   44672:	0f b6 c1             	movzbl %cl,%eax
+   44675:	45 0f b6 c0          	movzbl %r8b,%r8d
+   44679:	44 29 c0             	sub    %r8d,%eax
+   4467c:	c3                   	ret
+
+000000000004467d <memzero_nt>:
+
+void memzero_nt(void *v, size_t n) {
+  uint64_t *p = (uint64_t *)v;
+  uint64_t *end = p + n / 8;
+   4467d:	48 83 e6 f8          	and    $0xfffffffffffffff8,%rsi
+   44681:	48 01 fe             	add    %rdi,%rsi
+  for (; p < end; ++p) {
+   44684:	48 39 f7             	cmp    %rsi,%rdi
+   44687:	73 12                	jae    4469b <memzero_nt+0x1e>
+    asm volatile("movnti %1, %0" : "=m"(*p) : "r"(0UL));
+   44689:	b8 00 00 00 00       	mov    $0x0,%eax
+   4468e:	48 0f c3 07          	movnti %rax,(%rdi)
+  for (; p < end; ++p) {
+   44692:	48 83 c7 08          	add    $0x8,%rdi
+   44696:	48 39 f7             	cmp    %rsi,%rdi
+   44699:	72 f3                	jb     4468e <memzero_nt+0x11>
+  }
+  // order the weakly-ordered stores before anything that publishes `v`
+  asm volatile("sfence" : : : "memory");
+   4469b:	0f ae f8             	sfence
+}
+   4469e:	c3                   	ret
+
+000000000004469f <shm_destroy>:
+
+static shmseg shmsegs[NSHM]; // `shmsegs[0]` is never used
+
+#define SHM_PERM (PTE_P | PTE_W | PTE_U | PTE_SHARED)
+
+static void shm_destroy(shmseg *seg) {
+   4469f:	55                   	push   %rbp
+   446a0:	48 89 e5             	mov    %rsp,%rbp
+   446a3:	41 54                	push   %r12
+   446a5:	53                   	push   %rbx
+   446a6:	49 89 fc             	mov    %rdi,%r12
+  for (size_t i = 0; i < seg->npages; ++i) {
+   446a9:	48 83 3f 00          	cmpq   $0x0,(%rdi)
+   446ad:	74 20                	je     446cf <shm_destroy+0x30>
+   446af:	bb 00 00 00 00       	mov    $0x0,%ebx
+    kfree((void *)((uintptr_t)seg->frames[i] * PAGESIZE));
+   446b4:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+   446b9:	8b 3c 98             	mov    (%rax,%rbx,4),%edi
+   446bc:	48 c1 e7 0c          	shl    $0xc,%rdi
+   446c0:	e8 7d cc ff ff       	call   41342 <kfree>
+  for (size_t i = 0; i < seg->npages; ++i) {
+   446c5:	48 83 c3 01          	add    $0x1,%rbx
+   446c9:	49 3b 1c 24          	cmp    (%r12),%rbx
+   446cd:	72 e5                	jb     446b4 <shm_destroy+0x15>
+  }
+  kmfree(seg->frames);
+   446cf:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+   446d4:	e8 31 fd ff ff       	call   4440a <kmfree>
+  seg->npages = 0;
+   446d9:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+   446e0:	00 
+}
+   446e1:	5b                   	pop    %rbx
+   446e2:	41 5c                	pop    %r12
+   446e4:	5d                   	pop    %rbp
+   446e5:	c3                   	ret
+
+00000000000446e6 <shm_put>:
+
+static void shm_put(shmseg *seg) {
+  if (--seg->nrefs == 0) {
+   446e6:	8b 47 10             	mov    0x10(%rdi),%eax
+   446e9:	83 e8 01             	sub    $0x1,%eax
+   446ec:	89 47 10             	mov    %eax,0x10(%rdi)
+   446ef:	74 01                	je     446f2 <shm_put+0xc>
+   446f1:	c3                   	ret
+static void shm_put(shmseg *seg) {
+   446f2:	55                   	push   %rbp
+   446f3:	48 89 e5             	mov    %rsp,%rbp
+    shm_destroy(seg);
+   446f6:	e8 a4 ff ff ff       	call   4469f <shm_destroy>
+  }
+}
+   446fb:	5d                   	pop    %rbp
+   446fc:	c3                   	ret
+
+00000000000446fd <shm_create>:
+    seg->owner = 0;
+    shm_put(seg);
+  }
+}
+
+int shm_create(proc *p, size_t size) {
+   446fd:	55                   	push   %rbp
+   446fe:	48 89 e5             	mov    %rsp,%rbp
+   44701:	41 56                	push   %r14
+   44703:	41 55                	push   %r13
+   44705:	41 54                	push   %r12
+   44707:	53                   	push   %rbx
+  size_t n = (size + PAGESIZE - 1) / PAGESIZE;
+   44708:	4c 8d ae ff 0f 00 00 	lea    0xfff(%rsi),%r13
+   4470f:	49 c1 ed 0c          	shr    $0xc,%r13
+  if (n == 0 || n > SHM_MAXPAGES) {
+   44713:	49 8d 45 ff          	lea    -0x1(%r13),%rax
+   44717:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+   4471d:	0f 87 f3 00 00 00    	ja     44816 <shm_create+0x119>
+   44723:	49 89 fe             	mov    %rdi,%r14
+   44726:	b8 58 18 05 00       	mov    $0x51858,%eax
+    return -1;
+  }
+  int id = 1;
+   4472b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  while (id < NSHM && shmsegs[id].npages) {
+   44730:	48 83 38 00          	cmpq   $0x0,(%rax)
+   44734:	74 16                	je     4474c <shm_create+0x4f>
+    ++id;
+   44736:	83 c3 01             	add    $0x1,%ebx
+  while (id < NSHM && shmsegs[id].npages) {
+   44739:	48 83 c0 18          	add    $0x18,%rax
+   4473d:	83 fb 20             	cmp    $0x20,%ebx
+   44740:	75 ee                	jne    44730 <shm_create+0x33>
+  }
+  if (id == NSHM) {
+    return -1;
+   44742:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44747:	e9 a4 00 00 00       	jmp    447f0 <shm_create+0xf3>
+  if (id == NSHM) {
+   4474c:	83 fb 20             	cmp    $0x20,%ebx
+   4474f:	0f 84 c8 00 00 00    	je     4481d <shm_create+0x120>
+  }
+
+  shmseg *seg = &shmsegs[id];
+  seg->frames = kmalloc(n * sizeof(uint32_t));
+   44755:	4a 8d 3c ad 00 00 00 	lea    0x0(,%r13,4),%rdi
+   4475c:	00 
+   4475d:	e8 98 fa ff ff       	call   441fa <kmalloc>
+   44762:	48 63 d3             	movslq %ebx,%rdx
+   44765:	48 8d 14 52          	lea    (%rdx,%rdx,2),%rdx
+   44769:	48 89 04 d5 48 18 05 	mov    %rax,0x51848(,%rdx,8)
+   44770:	00 
+  if (!seg->frames) {
+   44771:	48 85 c0             	test   %rax,%rax
+   44774:	0f 84 aa 00 00 00    	je     44824 <shm_create+0x127>
+    return -1;
+  }
+  for (seg->npages = 0; seg->npages < n; ++seg->npages) {
+   4477a:	48 c7 04 d5 40 18 05 	movq   $0x0,0x51840(,%rdx,8)
+   44781:	00 00 00 00 00 
+    void *page = kalloc_zeroed(PAGESIZE);
+    if (!page) {
+      shm_destroy(seg);
+      return -1;
+    }
+    seg->frames[seg->npages] = (uintptr_t)page / PAGESIZE;
+   44786:	49 89 d4             	mov    %rdx,%r12
+   44789:	49 c1 e4 03          	shl    $0x3,%r12
+    void *page = kalloc_zeroed(PAGESIZE);
+   4478d:	bf 00 10 00 00       	mov    $0x1000,%edi
+   44792:	e8 ce c9 ff ff       	call   41165 <kalloc_zeroed>
+    if (!page) {
+   44797:	48 85 c0             	test   %rax,%rax
+   4479a:	74 5f                	je     447fb <shm_create+0xfe>
+    seg->frames[seg->npages] = (uintptr_t)page / PAGESIZE;
+   4479c:	49 8b 8c 24 40 18 05 	mov    0x51840(%r12),%rcx
+   447a3:	00 
+   447a4:	49 8b 94 24 48 18 05 	mov    0x51848(%r12),%rdx
+   447ab:	00 
+   447ac:	48 c1 e8 0c          	shr    $0xc,%rax
+   447b0:	89 04 8a             	mov    %eax,(%rdx,%rcx,4)
+  for (seg->npages = 0; seg->npages < n; ++seg->npages) {
+   447b3:	49 8b 84 24 40 18 05 	mov    0x51840(%r12),%rax
+   447ba:	00 
+   447bb:	48 83 c0 01          	add    $0x1,%rax
+   447bf:	49 89 84 24 40 18 05 	mov    %rax,0x51840(%r12)
+   447c6:	00 
+   447c7:	4c 39 e8             	cmp    %r13,%rax
+   447ca:	72 c1                	jb     4478d <shm_create+0x90>
+  }
+  seg->nrefs = 1;
+   447cc:	48 63 d3             	movslq %ebx,%rdx
+   447cf:	48 8d 04 12          	lea    (%rdx,%rdx,1),%rax
+   447d3:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+   447d7:	c7 04 cd 50 18 05 00 	movl   $0x1,0x51850(,%rcx,8)
+   447de:	01 00 00 00 
+  seg->owner = p->pid;
+   447e2:	41 8b 4e 08          	mov    0x8(%r14),%ecx
+   447e6:	48 01 d0             	add    %rdx,%rax
+   447e9:	89 0c c5 54 18 05 00 	mov    %ecx,0x51854(,%rax,8)
+  return id;
+}
+   447f0:	89 d8                	mov    %ebx,%eax
+   447f2:	5b                   	pop    %rbx
+   447f3:	41 5c                	pop    %r12
+   447f5:	41 5d                	pop    %r13
+   447f7:	41 5e                	pop    %r14
+   447f9:	5d                   	pop    %rbp
+   447fa:	c3                   	ret
+  shmseg *seg = &shmsegs[id];
+   447fb:	48 63 db             	movslq %ebx,%rbx
+   447fe:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+   44802:	48 8d 3c c5 40 18 05 	lea    0x51840(,%rax,8),%rdi
+   44809:	00 
+      shm_destroy(seg);
+   4480a:	e8 90 fe ff ff       	call   4469f <shm_destroy>
+      return -1;
+   4480f:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44814:	eb da                	jmp    447f0 <shm_create+0xf3>
+    return -1;
+   44816:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   4481b:	eb d3                	jmp    447f0 <shm_create+0xf3>
+    return -1;
+   4481d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44822:	eb cc                	jmp    447f0 <shm_create+0xf3>
+    return -1;
+   44824:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44829:	eb c5                	jmp    447f0 <shm_create+0xf3>
+
+000000000004482b <shm_map>:
+    }
+  }
+  return NULL;
+}
+
+int shm_map(proc *p, int id, uintptr_t addr) {
+   4482b:	55                   	push   %rbp
+   4482c:	48 89 e5             	mov    %rsp,%rbp
+   4482f:	41 57                	push   %r15
+   44831:	41 56                	push   %r14
+   44833:	41 55                	push   %r13
+   44835:	41 54                	push   %r12
+   44837:	53                   	push   %rbx
+   44838:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+   4483f:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+   44846:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%rbp)
+  if (id <= 0 || id >= NSHM || !shmsegs[id].npages) {
+   4484c:	8d 46 ff             	lea    -0x1(%rsi),%eax
+   4484f:	83 f8 1e             	cmp    $0x1e,%eax
+   44852:	0f 87 ad 02 00 00    	ja     44b05 <shm_map+0x2da>
+   44858:	49 89 d5             	mov    %rdx,%r13
+   4485b:	48 63 c6             	movslq %esi,%rax
+   4485e:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44862:	4c 8b 24 c5 40 18 05 	mov    0x51840(,%rax,8),%r12
+   44869:	00 
+   4486a:	4d 85 e4             	test   %r12,%r12
+   4486d:	0f 84 9c 02 00 00    	je     44b0f <shm_map+0x2e4>
+    return -1;
+  }
+  shmseg *seg = &shmsegs[id];
+  uintptr_t end = addr + seg->npages * PAGESIZE;
+   44873:	49 c1 e4 0c          	shl    $0xc,%r12
+   44877:	49 01 d4             	add    %rdx,%r12
+  if ((addr & PAGEOFFMASK) || addr < PROC_START_ADDR || end > VA_LOWEND ||
+   4487a:	48 89 d0             	mov    %rdx,%rax
+   4487d:	25 ff 0f 00 00       	and    $0xfff,%eax
+   44882:	48 89 85 68 ff ff ff 	mov    %rax,-0x98(%rbp)
+   44889:	0f 85 8a 02 00 00    	jne    44b19 <shm_map+0x2ee>
+   4488f:	48 89 d0             	mov    %rdx,%rax
+   44892:	48 c1 e8 27          	shr    $0x27,%rax
+   44896:	0f 94 c0             	sete   %al
+   44899:	48 ba 00 00 00 00 00 	movabs $0x800000000000,%rdx
+   448a0:	80 00 00 
+   448a3:	4c 39 e2             	cmp    %r12,%rdx
+   448a6:	0f 92 c2             	setb   %dl
+   448a9:	08 d0                	or     %dl,%al
+   448ab:	0f 85 72 02 00 00    	jne    44b23 <shm_map+0x2f8>
+   448b1:	4d 39 ec             	cmp    %r13,%r12
+   448b4:	0f 82 69 02 00 00    	jb     44b23 <shm_map+0x2f8>
+   448ba:	48 8d 87 e0 00 00 00 	lea    0xe0(%rdi),%rax
+   448c1:	48 81 c7 a0 01 00 00 	add    $0x1a0,%rdi
+      end < addr) {
+    return -1;
+  }
+
+  // find a free region slot; the range must not overlap another region
+  vmregion *slot = NULL;
+   448c8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+   448ce:	eb 10                	jmp    448e0 <shm_map+0xb5>
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    vmregion *r = &p->regions[i];
+    if (r->start == r->end) {
+      slot = slot ? slot : r;
+   448d0:	4d 85 ff             	test   %r15,%r15
+   448d3:	4c 0f 44 f8          	cmove  %rax,%r15
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   448d7:	48 83 c0 18          	add    $0x18,%rax
+   448db:	48 39 f8             	cmp    %rdi,%rax
+   448de:	74 1d                	je     448fd <shm_map+0xd2>
+    if (r->start == r->end) {
+   448e0:	48 8b 08             	mov    (%rax),%rcx
+   448e3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+   448e7:	48 39 d1             	cmp    %rdx,%rcx
+   448ea:	74 e4                	je     448d0 <shm_map+0xa5>
+    } else if (r->start < end && addr < r->end) {
+   448ec:	49 39 d5             	cmp    %rdx,%r13
+   448ef:	73 e6                	jae    448d7 <shm_map+0xac>
+   448f1:	4c 39 e1             	cmp    %r12,%rcx
+   448f4:	73 e1                	jae    448d7 <shm_map+0xac>
+      return -1;
+   448f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   448fb:	eb 7c                	jmp    44979 <shm_map+0x14e>
+    }
+  }
+  // `refcount` is 8 bits wide
+  if (!slot || pages[seg->frames[0]].refcount == UINT8_MAX) {
+   448fd:	4d 85 ff             	test   %r15,%r15
+   44900:	0f 84 27 02 00 00    	je     44b2d <shm_map+0x302>
+   44906:	48 63 85 64 ff ff ff 	movslq -0x9c(%rbp),%rax
+   4490d:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44911:	48 8b 04 c5 48 18 05 	mov    0x51848(,%rax,8),%rax
+   44918:	00 
+   44919:	8b 00                	mov    (%rax),%eax
+   4491b:	48 c1 e0 04          	shl    $0x4,%rax
+   4491f:	48 03 05 da a6 00 00 	add    0xa6da(%rip),%rax        # 4f000 <pages>
+   44926:	80 38 ff             	cmpb   $0xff,(%rax)
+   44929:	0f 84 08 02 00 00    	je     44b37 <shm_map+0x30c>
+    return -1;
+  }
+
+  vmiter_t it = vmiter_init(p->pagetable);
+   4492f:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+   44936:	48 8b 30             	mov    (%rax),%rsi
+   44939:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   4493d:	e8 3f ee ff ff       	call   43781 <vmiter_init>
+  for (vmiter_va_add(&it, addr); vmiter_va(&it) < end; vmiter_next(&it)) {
+   44942:	4c 89 ee             	mov    %r13,%rsi
+   44945:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44949:	e8 ad f0 ff ff       	call   439fb <vmiter_va_add>
+   4494e:	eb 09                	jmp    44959 <shm_map+0x12e>
+   44950:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44954:	e8 7c f0 ff ff       	call   439d5 <vmiter_next>
+   44959:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   4495d:	e8 61 ed ff ff       	call   436c3 <vmiter_va>
+   44962:	4c 39 e0             	cmp    %r12,%rax
+   44965:	73 24                	jae    4498b <shm_map+0x160>
+    if (vmiter_present(&it)) {
+   44967:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   4496b:	e8 58 ed ff ff       	call   436c8 <vmiter_present>
+   44970:	84 c0                	test   %al,%al
+   44972:	74 dc                	je     44950 <shm_map+0x125>
+      return -1;
+   44974:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  slot->end = end;
+  slot->perm = SHM_PERM;
+  slot->shm = id;
+  ++seg->nrefs;
+  return 0;
+}
+   44979:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+   44980:	5b                   	pop    %rbx
+   44981:	41 5c                	pop    %r12
+   44983:	41 5d                	pop    %r13
+   44985:	41 5e                	pop    %r14
+   44987:	41 5f                	pop    %r15
+   44989:	5d                   	pop    %rbp
+   4498a:	c3                   	ret
+  it = vmiter_init(p->pagetable);
+   4498b:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+   44992:	48 8b 30             	mov    (%rax),%rsi
+   44995:	48 8d bd 70 ff ff ff 	lea    -0x90(%rbp),%rdi
+   4499c:	e8 e0 ed ff ff       	call   43781 <vmiter_init>
+   449a1:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+   449a8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+   449ac:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+   449b3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+   449b7:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+   449bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+   449bf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+   449c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  vmiter_va_add(&it, addr);
+   449c7:	4c 89 ee             	mov    %r13,%rsi
+   449ca:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   449ce:	e8 28 f0 ff ff       	call   439fb <vmiter_va_add>
+  for (size_t i = 0; i < seg->npages; ++i, vmiter_va_add(&it, PAGESIZE)) {
+   449d3:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+   449d9:	48 63 c2             	movslq %edx,%rax
+   449dc:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   449e0:	48 83 3c c5 40 18 05 	cmpq   $0x0,0x51840(,%rax,8)
+   449e7:	00 00 
+   449e9:	74 5f                	je     44a4a <shm_map+0x21f>
+   449eb:	48 8b 9d 68 ff ff ff 	mov    -0x98(%rbp),%rbx
+    if (vmiter_map(&it, (uintptr_t)seg->frames[i] * PAGESIZE, SHM_PERM) < 0) {
+   449f2:	48 63 c2             	movslq %edx,%rax
+   449f5:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   449f9:	4c 8d 34 c5 40 18 05 	lea    0x51840(,%rax,8),%r14
+   44a00:	00 
+   44a01:	49 8b 46 08          	mov    0x8(%r14),%rax
+   44a05:	8b 34 98             	mov    (%rax,%rbx,4),%esi
+   44a08:	48 c1 e6 0c          	shl    $0xc,%rsi
+   44a0c:	ba 07 04 00 00       	mov    $0x407,%edx
+   44a11:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44a15:	e8 c7 ed ff ff       	call   437e1 <vmiter_map>
+   44a1a:	85 c0                	test   %eax,%eax
+   44a1c:	78 6a                	js     44a88 <shm_map+0x25d>
+    ++pages[seg->frames[i]].refcount;
+   44a1e:	49 8b 46 08          	mov    0x8(%r14),%rax
+   44a22:	8b 04 98             	mov    (%rax,%rbx,4),%eax
+   44a25:	48 c1 e0 04          	shl    $0x4,%rax
+   44a29:	48 03 05 d0 a5 00 00 	add    0xa5d0(%rip),%rax        # 4f000 <pages>
+   44a30:	80 00 01             	addb   $0x1,(%rax)
+  for (size_t i = 0; i < seg->npages; ++i, vmiter_va_add(&it, PAGESIZE)) {
+   44a33:	48 83 c3 01          	add    $0x1,%rbx
+   44a37:	be 00 10 00 00       	mov    $0x1000,%esi
+   44a3c:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44a40:	e8 b6 ef ff ff       	call   439fb <vmiter_va_add>
+   44a45:	49 3b 1e             	cmp    (%r14),%rbx
+   44a48:	72 b7                	jb     44a01 <shm_map+0x1d6>
+  slot->start = addr;
+   44a4a:	4d 89 2f             	mov    %r13,(%r15)
+  slot->end = end;
+   44a4d:	4d 89 67 08          	mov    %r12,0x8(%r15)
+  slot->perm = SHM_PERM;
+   44a51:	41 c7 47 10 07 04 00 	movl   $0x407,0x10(%r15)
+   44a58:	00 
+  slot->shm = id;
+   44a59:	8b 85 64 ff ff ff    	mov    -0x9c(%rbp),%eax
+   44a5f:	41 89 47 14          	mov    %eax,0x14(%r15)
+  ++seg->nrefs;
+   44a63:	48 98                	cltq
+   44a65:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+   44a69:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+   44a6d:	8b 04 cd 50 18 05 00 	mov    0x51850(,%rcx,8),%eax
+   44a74:	83 c0 01             	add    $0x1,%eax
+   44a77:	89 04 cd 50 18 05 00 	mov    %eax,0x51850(,%rcx,8)
+  return 0;
+   44a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+   44a83:	e9 f1 fe ff ff       	jmp    44979 <shm_map+0x14e>
+      vmiter_t undo = vmiter_init(p->pagetable);
+   44a88:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+   44a8f:	48 8b 30             	mov    (%rax),%rsi
+   44a92:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   44a96:	e8 e6 ec ff ff       	call   43781 <vmiter_init>
+      vmiter_va_add(&undo, addr);
+   44a9b:	4c 89 ee             	mov    %r13,%rsi
+   44a9e:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   44aa2:	e8 54 ef ff ff       	call   439fb <vmiter_va_add>
+      vmiter_unmap_range(&undo, i * PAGESIZE);
+   44aa7:	48 89 de             	mov    %rbx,%rsi
+   44aaa:	48 c1 e6 0c          	shl    $0xc,%rsi
+   44aae:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+   44ab2:	e8 b4 ed ff ff       	call   4386b <vmiter_unmap_range>
+      for (size_t j = 0; j < i; ++j) {
+   44ab7:	48 85 db             	test   %rbx,%rbx
+   44aba:	74 3f                	je     44afb <shm_map+0x2d0>
+        --pages[seg->frames[j]].refcount;
+   44abc:	48 63 85 64 ff ff ff 	movslq -0x9c(%rbp),%rax
+   44ac3:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44ac7:	48 8d 14 c5 40 18 05 	lea    0x51840(,%rax,8),%rdx
+   44ace:	00 
+   44acf:	48 8b 42 08          	mov    0x8(%rdx),%rax
+   44ad3:	48 8b 8d 68 ff ff ff 	mov    -0x98(%rbp),%rcx
+   44ada:	8b 04 88             	mov    (%rax,%rcx,4),%eax
+   44add:	48 c1 e0 04          	shl    $0x4,%rax
+   44ae1:	48 03 05 18 a5 00 00 	add    0xa518(%rip),%rax        # 4f000 <pages>
+   44ae8:	80 28 01             	subb   $0x1,(%rax)
+      for (size_t j = 0; j < i; ++j) {
+   44aeb:	48 83 c1 01          	add    $0x1,%rcx
+   44aef:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+   44af6:	48 39 d9             	cmp    %rbx,%rcx
+   44af9:	75 d4                	jne    44acf <shm_map+0x2a4>
+      return -1;
+   44afb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b00:	e9 74 fe ff ff       	jmp    44979 <shm_map+0x14e>
+    return -1;
+   44b05:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b0a:	e9 6a fe ff ff       	jmp    44979 <shm_map+0x14e>
+   44b0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b14:	e9 60 fe ff ff       	jmp    44979 <shm_map+0x14e>
+    return -1;
+   44b19:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b1e:	e9 56 fe ff ff       	jmp    44979 <shm_map+0x14e>
+   44b23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b28:	e9 4c fe ff ff       	jmp    44979 <shm_map+0x14e>
+    return -1;
+   44b2d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b32:	e9 42 fe ff ff       	jmp    44979 <shm_map+0x14e>
+   44b37:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44b3c:	e9 38 fe ff ff       	jmp    44979 <shm_map+0x14e>
+
+0000000000044b41 <shm_unmap>:
+
+int shm_unmap(proc *p, uintptr_t addr) {
+   44b41:	55                   	push   %rbp
+   44b42:	48 89 e5             	mov    %rsp,%rbp
+   44b45:	41 57                	push   %r15
+   44b47:	41 56                	push   %r14
+   44b49:	41 55                	push   %r13
+   44b4b:	41 54                	push   %r12
+   44b4d:	53                   	push   %rbx
+   44b4e:	48 83 ec 38          	sub    $0x38,%rsp
+   44b52:	49 89 fe             	mov    %rdi,%r14
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   44b55:	48 8d 87 e0 00 00 00 	lea    0xe0(%rdi),%rax
+   44b5c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+   44b62:	eb 12                	jmp    44b76 <shm_unmap+0x35>
+   44b64:	41 83 c4 01          	add    $0x1,%r12d
+   44b68:	48 83 c0 18          	add    $0x18,%rax
+   44b6c:	41 83 fc 08          	cmp    $0x8,%r12d
+   44b70:	0f 84 27 01 00 00    	je     44c9d <shm_unmap+0x15c>
+    if (p->regions[i].shm && p->regions[i].start == addr) {
+   44b76:	83 78 14 00          	cmpl   $0x0,0x14(%rax)
+   44b7a:	74 e8                	je     44b64 <shm_unmap+0x23>
+   44b7c:	48 3b 30             	cmp    (%rax),%rsi
+   44b7f:	75 e3                	jne    44b64 <shm_unmap+0x23>
+  vmregion *r = shm_region(p, addr);
+  if (!r) {
+    return -1;
+  }
+  vmiter_t it = vmiter_init(p->pagetable);
+   44b81:	49 8b 36             	mov    (%r14),%rsi
+   44b84:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44b88:	e8 f4 eb ff ff       	call   43781 <vmiter_init>
+  vmiter_va_add(&it, r->start);
+   44b8d:	4d 63 ec             	movslq %r12d,%r13
+   44b90:	4b 8d 5c 2d 00       	lea    0x0(%r13,%r13,1),%rbx
+   44b95:	4a 8d 04 2b          	lea    (%rbx,%r13,1),%rax
+   44b99:	49 8b b4 c6 e0 00 00 	mov    0xe0(%r14,%rax,8),%rsi
+   44ba0:	00 
+   44ba1:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44ba5:	e8 51 ee ff ff       	call   439fb <vmiter_va_add>
+  if (vmiter_unmap_range(&it, r->end - r->start) < 0) {
+   44baa:	4a 8d 04 2b          	lea    (%rbx,%r13,1),%rax
+   44bae:	49 8b b4 c6 e8 00 00 	mov    0xe8(%r14,%rax,8),%rsi
+   44bb5:	00 
+   44bb6:	49 2b b4 c6 e0 00 00 	sub    0xe0(%r14,%rax,8),%rsi
+   44bbd:	00 
+   44bbe:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   44bc2:	e8 a4 ec ff ff       	call   4386b <vmiter_unmap_range>
+   44bc7:	85 c0                	test   %eax,%eax
+   44bc9:	0f 88 eb 00 00 00    	js     44cba <shm_unmap+0x179>
+    asm volatile("movq %%cr3, %0" : "=r" (x));
+   44bcf:	0f 20 d8             	mov    %cr3,%rax
+    asm volatile("movq %0, %%cr3" : : "r" (x) : "memory");
+   44bd2:	0f 22 d8             	mov    %rax,%cr3
+  }
+  // drop stale entries for the unmapped range (kernel entries are global)
+  wrcr3(rdcr3());
+
+  // the mapping held a reference to every frame (see `shm_map`)
+  shmseg *seg = &shmsegs[r->shm];
+   44bd5:	49 63 c4             	movslq %r12d,%rax
+   44bd8:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44bdc:	45 8b bc c6 f4 00 00 	mov    0xf4(%r14,%rax,8),%r15d
+   44be3:	00 
+   44be4:	49 63 d7             	movslq %r15d,%rdx
+   44be7:	48 8d 04 12          	lea    (%rdx,%rdx,1),%rax
+   44beb:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+   44bef:	48 8d 0c cd 40 18 05 	lea    0x51840(,%rcx,8),%rcx
+   44bf6:	00 
+   44bf7:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  for (size_t i = 0; i < seg->npages; ++i) {
+   44bfb:	48 01 d0             	add    %rdx,%rax
+   44bfe:	48 83 3c c5 40 18 05 	cmpq   $0x0,0x51840(,%rax,8)
+   44c05:	00 00 
+   44c07:	74 22                	je     44c2b <shm_unmap+0xea>
+   44c09:	bb 00 00 00 00       	mov    $0x0,%ebx
+    kfree((void *)((uintptr_t)seg->frames[i] * PAGESIZE));
+   44c0e:	49 89 cd             	mov    %rcx,%r13
+   44c11:	49 8b 45 08          	mov    0x8(%r13),%rax
+   44c15:	8b 3c 98             	mov    (%rax,%rbx,4),%edi
+   44c18:	48 c1 e7 0c          	shl    $0xc,%rdi
+   44c1c:	e8 21 c7 ff ff       	call   41342 <kfree>
+  for (size_t i = 0; i < seg->npages; ++i) {
+   44c21:	48 83 c3 01          	add    $0x1,%rbx
+   44c25:	49 3b 5d 00          	cmp    0x0(%r13),%rbx
+   44c29:	72 e6                	jb     44c11 <shm_unmap+0xd0>
+  }
+  r->start = r->end = 0;
+   44c2b:	4d 63 e4             	movslq %r12d,%r12
+   44c2e:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+   44c32:	4a 8d 14 20          	lea    (%rax,%r12,1),%rdx
+   44c36:	49 c7 84 d6 e8 00 00 	movq   $0x0,0xe8(%r14,%rdx,8)
+   44c3d:	00 00 00 00 00 
+   44c42:	49 c7 84 d6 e0 00 00 	movq   $0x0,0xe0(%r14,%rdx,8)
+   44c49:	00 00 00 00 00 
+  r->shm = 0;
+   44c4e:	41 c7 84 d6 f4 00 00 	movl   $0x0,0xf4(%r14,%rdx,8)
+   44c55:	00 00 00 00 00 
+  if (seg->npages && seg->owner == p->pid) {
+   44c5a:	49 63 c7             	movslq %r15d,%rax
+   44c5d:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44c61:	48 83 3c c5 40 18 05 	cmpq   $0x0,0x51840(,%rax,8)
+   44c68:	00 00 
+   44c6a:	74 14                	je     44c80 <shm_unmap+0x13f>
+   44c6c:	49 63 c7             	movslq %r15d,%rax
+   44c6f:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44c73:	41 8b 4e 08          	mov    0x8(%r14),%ecx
+   44c77:	39 0c c5 54 18 05 00 	cmp    %ecx,0x51854(,%rax,8)
+   44c7e:	74 24                	je     44ca4 <shm_unmap+0x163>
+  shm_disown(p, seg);
+  shm_put(seg);
+   44c80:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   44c84:	e8 5d fa ff ff       	call   446e6 <shm_put>
+  return 0;
+   44c89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   44c8e:	48 83 c4 38          	add    $0x38,%rsp
+   44c92:	5b                   	pop    %rbx
+   44c93:	41 5c                	pop    %r12
+   44c95:	41 5d                	pop    %r13
+   44c97:	41 5e                	pop    %r14
+   44c99:	41 5f                	pop    %r15
+   44c9b:	5d                   	pop    %rbp
+   44c9c:	c3                   	ret
+    return -1;
+   44c9d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44ca2:	eb ea                	jmp    44c8e <shm_unmap+0x14d>
+    seg->owner = 0;
+   44ca4:	c7 04 c5 54 18 05 00 	movl   $0x0,0x51854(,%rax,8)
+   44cab:	00 00 00 00 
+    shm_put(seg);
+   44caf:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   44cb3:	e8 2e fa ff ff       	call   446e6 <shm_put>
+   44cb8:	eb c6                	jmp    44c80 <shm_unmap+0x13f>
+    return -1;
+   44cba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   44cbf:	eb cd                	jmp    44c8e <shm_unmap+0x14d>
+
+0000000000044cc1 <shm_fork>:
+
+void shm_fork(proc *p) {
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   44cc1:	48 8d 97 f4 00 00 00 	lea    0xf4(%rdi),%rdx
+   44cc8:	48 81 c7 b4 01 00 00 	add    $0x1b4,%rdi
+   44ccf:	eb 09                	jmp    44cda <shm_fork+0x19>
+   44cd1:	48 83 c2 18          	add    $0x18,%rdx
+   44cd5:	48 39 fa             	cmp    %rdi,%rdx
+   44cd8:	74 23                	je     44cfd <shm_fork+0x3c>
+    if (p->regions[i].shm) {
+   44cda:	8b 02                	mov    (%rdx),%eax
+   44cdc:	85 c0                	test   %eax,%eax
+   44cde:	74 f1                	je     44cd1 <shm_fork+0x10>
+      ++shmsegs[p->regions[i].shm].nrefs;
+   44ce0:	48 98                	cltq
+   44ce2:	48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+   44ce6:	48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+   44cea:	8b 04 f5 50 18 05 00 	mov    0x51850(,%rsi,8),%eax
+   44cf1:	83 c0 01             	add    $0x1,%eax
+   44cf4:	89 04 f5 50 18 05 00 	mov    %eax,0x51850(,%rsi,8)
+   44cfb:	eb d4                	jmp    44cd1 <shm_fork+0x10>
+    }
+  }
+}
+   44cfd:	c3                   	ret
+
+0000000000044cfe <shm_release>:
+
+void shm_release(proc *p) {
+   44cfe:	55                   	push   %rbp
+   44cff:	48 89 e5             	mov    %rsp,%rbp
+   44d02:	41 55                	push   %r13
+   44d04:	41 54                	push   %r12
+   44d06:	53                   	push   %rbx
+   44d07:	48 83 ec 08          	sub    $0x8,%rsp
+   44d0b:	49 89 fd             	mov    %rdi,%r13
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+   44d0e:	48 8d 9f e0 00 00 00 	lea    0xe0(%rdi),%rbx
+   44d15:	4c 8d a7 a0 01 00 00 	lea    0x1a0(%rdi),%r12
+   44d1c:	eb 09                	jmp    44d27 <shm_release+0x29>
+   44d1e:	48 83 c3 18          	add    $0x18,%rbx
+   44d22:	4c 39 e3             	cmp    %r12,%rbx
+   44d25:	74 32                	je     44d59 <shm_release+0x5b>
+    vmregion *r = &p->regions[i];
+    if (r->shm) {
+   44d27:	8b 43 14             	mov    0x14(%rbx),%eax
+   44d2a:	85 c0                	test   %eax,%eax
+   44d2c:	74 f0                	je     44d1e <shm_release+0x20>
+      shmseg *seg = &shmsegs[r->shm];
+      r->start = r->end = 0;
+   44d2e:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+   44d35:	00 
+   44d36:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+      r->shm = 0;
+   44d3d:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%rbx)
+      shmseg *seg = &shmsegs[r->shm];
+   44d44:	48 98                	cltq
+   44d46:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   44d4a:	48 8d 3c c5 40 18 05 	lea    0x51840(,%rax,8),%rdi
+   44d51:	00 
+      shm_put(seg);
+   44d52:	e8 8f f9 ff ff       	call   446e6 <shm_put>
+   44d57:	eb c5                	jmp    44d1e <shm_release+0x20>
+   44d59:	bb 58 18 05 00       	mov    $0x51858,%ebx
+   44d5e:	41 bc 40 1b 05 00    	mov    $0x51b40,%r12d
+   44d64:	eb 09                	jmp    44d6f <shm_release+0x71>
+    }
+  }
+  for (int id = 1; id < NSHM; ++id) {
+   44d66:	48 83 c3 18          	add    $0x18,%rbx
+   44d6a:	4c 39 e3             	cmp    %r12,%rbx
+   44d6d:	74 20                	je     44d8f <shm_release+0x91>
+  if (seg->npages && seg->owner == p->pid) {
+   44d6f:	48 89 df             	mov    %rbx,%rdi
+   44d72:	48 83 3b 00          	cmpq   $0x0,(%rbx)
+   44d76:	74 ee                	je     44d66 <shm_release+0x68>
+   44d78:	41 8b 45 08          	mov    0x8(%r13),%eax
+   44d7c:	39 43 14             	cmp    %eax,0x14(%rbx)
+   44d7f:	75 e5                	jne    44d66 <shm_release+0x68>
+    seg->owner = 0;
+   44d81:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%rbx)
+    shm_put(seg);
+   44d88:	e8 59 f9 ff ff       	call   446e6 <shm_put>
+   44d8d:	eb d7                	jmp    44d66 <shm_release+0x68>
+    shm_disown(p, &shmsegs[id]);
+  }
+}
+   44d8f:	48 83 c4 08          	add    $0x8,%rsp
+   44d93:	5b                   	pop    %rbx
+   44d94:	41 5c                	pop    %r12
+   44d96:	41 5d                	pop    %r13
+   44d98:	5d                   	pop    %rbp
+   44d99:	c3                   	ret
+
+0000000000044d9a <pipe_get>:
+} pipe;
+
+static pipe pipes[NPIPE]; // `pipes[0]` is never used
+
+static pipe *pipe_get(int id) {
+  if (id <= 0 || id >= NPIPE || !pipes[id].buf) {
+   44d9a:	8d 47 ff             	lea    -0x1(%rdi),%eax
+   44d9d:	83 f8 0e             	cmp    $0xe,%eax
+   44da0:	77 24                	ja     44dc6 <pipe_get+0x2c>
+   44da2:	48 63 c7             	movslq %edi,%rax
+   44da5:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+   44da9:	48 8b 04 c5 40 1b 05 	mov    0x51b40(,%rax,8),%rax
+   44db0:	00 
+   44db1:	48 85 c0             	test   %rax,%rax
+   44db4:	74 15                	je     44dcb <pipe_get+0x31>
+    return NULL;
+  }
+  return &pipes[id];
+   44db6:	48 63 ff             	movslq %edi,%rdi
+   44db9:	48 8d 04 bf          	lea    (%rdi,%rdi,4),%rax
+   44dbd:	48 8d 04 c5 40 1b 05 	lea    0x51b40(,%rax,8),%rax
+   44dc4:	00 
+   44dc5:	c3                   	ret
+    return NULL;
+   44dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   44dcb:	c3                   	ret
+
+0000000000044dcc <pipe_wake>:
+
+// pipe_wake(waiters)
+//    Wake every process chained from `*waiters` and empty the chain.
+static void pipe_wake(pid_t *waiters) {
+   44dcc:	55                   	push   %rbp
+   44dcd:	48 89 e5             	mov    %rsp,%rbp
+   44dd0:	53                   	push   %rbx
+   44dd1:	48 83 ec 08          	sub    $0x8,%rsp
+  pid_t pid = *waiters;
+   44dd5:	8b 1f                	mov    (%rdi),%ebx
+  *waiters = 0;
+   44dd7:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+  while (pid) {
+   44ddd:	85 db                	test   %ebx,%ebx
+   44ddf:	74 20                	je     44e01 <pipe_wake+0x35>
+    proc *w = &ptable[pid];
+   44de1:	48 63 db             	movslq %ebx,%rbx
+   44de4:	48 69 db d0 01 00 00 	imul   $0x1d0,%rbx,%rbx
+   44deb:	48 8d bb 40 f0 04 00 	lea    0x4f040(%rbx),%rdi
+    pid = w->next; // `sched_wake` reuses the link
+   44df2:	8b 9f bc 01 00 00    	mov    0x1bc(%rdi),%ebx
+    sched_wake(w);
+   44df8:	e8 d0 13 00 00       	call   461cd <sched_wake>
+  while (pid) {
+   44dfd:	85 db                	test   %ebx,%ebx
+   44dff:	75 e0                	jne    44de1 <pipe_wake+0x15>
+  }
+}
+   44e01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   44e05:	c9                   	leave
+   44e06:	c3                   	ret
+
+0000000000044e07 <pipe_create>:
+  p->state = P_BLOCKED;
+  p->regs.reg_rip -= 2;
+  return p->regs.reg_rax;
+}
+
+int pipe_create() {
+   44e07:	55                   	push   %rbp
+   44e08:	48 89 e5             	mov    %rsp,%rbp
+   44e0b:	53                   	push   %rbx
+   44e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  int id = 1;
+  while (id < NPIPE && pipes[id].buf) {
+   44e10:	b8 68 1b 05 00       	mov    $0x51b68,%eax
+  int id = 1;
+   44e15:	bb 01 00 00 00       	mov    $0x1,%ebx
+  while (id < NPIPE && pipes[id].buf) {
+   44e1a:	48 83 38 00          	cmpq   $0x0,(%rax)
+   44e1e:	74 13                	je     44e33 <pipe_create+0x2c>
+    ++id;
+   44e20:	83 c3 01             	add    $0x1,%ebx
+  while (id < NPIPE && pipes[id].buf) {
+   44e23:	48 83 c0 28          	add    $0x28,%rax
+   44e27:	83 fb 10             	cmp    $0x10,%ebx
+   44e2a:	75 ee                	jne    44e1a <pipe_create+0x13>
+  }
+  if (id == NPIPE) {
+    return -1;
+   44e2c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44e31:	eb 70                	jmp    44ea3 <pipe_create+0x9c>
+  if (id == NPIPE) {
+   44e33:	83 fb 10             	cmp    $0x10,%ebx
+   44e36:	74 73                	je     44eab <pipe_create+0xa4>
+  }
+  pipe *pp = &pipes[id];
+  pp->buf = kalloc(PIPE_SIZE);
+   44e38:	bf 00 00 01 00       	mov    $0x10000,%edi
+   44e3d:	e8 ab c2 ff ff       	call   410ed <kalloc>
+   44e42:	48 63 d3             	movslq %ebx,%rdx
+   44e45:	48 8d 14 92          	lea    (%rdx,%rdx,4),%rdx
+   44e49:	48 89 04 d5 40 1b 05 	mov    %rax,0x51b40(,%rdx,8)
+   44e50:	00 
+  if (!pp->buf) {
+   44e51:	48 85 c0             	test   %rax,%rax
+   44e54:	74 5c                	je     44eb2 <pipe_create+0xab>
+    return -1;
+  }
+  pp->head = pp->tail = 0;
+   44e56:	48 63 d3             	movslq %ebx,%rdx
+   44e59:	48 8d 04 95 00 00 00 	lea    0x0(,%rdx,4),%rax
+   44e60:	00 
+   44e61:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+   44e65:	48 c7 04 cd 50 1b 05 	movq   $0x0,0x51b50(,%rcx,8)
+   44e6c:	00 00 00 00 00 
+   44e71:	48 c7 04 cd 48 1b 05 	movq   $0x0,0x51b48(,%rcx,8)
+   44e78:	00 00 00 00 00 
+  pp->readers = pp->writers = 0;
+   44e7d:	c7 04 cd 5c 1b 05 00 	movl   $0x0,0x51b5c(,%rcx,8)
+   44e84:	00 00 00 00 
+   44e88:	c7 04 cd 58 1b 05 00 	movl   $0x0,0x51b58(,%rcx,8)
+   44e8f:	00 00 00 00 
+  pp->closed[0] = pp->closed[1] = false;
+   44e93:	c6 04 cd 61 1b 05 00 	movb   $0x0,0x51b61(,%rcx,8)
+   44e9a:	00 
+   44e9b:	c6 04 cd 60 1b 05 00 	movb   $0x0,0x51b60(,%rcx,8)
+   44ea2:	00 
+  return id;
+}
+   44ea3:	89 d8                	mov    %ebx,%eax
+   44ea5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   44ea9:	c9                   	leave
+   44eaa:	c3                   	ret
+    return -1;
+   44eab:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44eb0:	eb f1                	jmp    44ea3 <pipe_create+0x9c>
+    return -1;
+   44eb2:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+   44eb7:	eb ea                	jmp    44ea3 <pipe_create+0x9c>
+
+0000000000044eb9 <pipe_read>:
+
+long pipe_read(proc *p, int id, uintptr_t buf, size_t n) {
+   44eb9:	55                   	push   %rbp
+   44eba:	48 89 e5             	mov    %rsp,%rbp
+   44ebd:	41 57                	push   %r15
+   44ebf:	41 56                	push   %r14
+   44ec1:	41 55                	push   %r13
+   44ec3:	41 54                	push   %r12
+   44ec5:	53                   	push   %rbx
+   44ec6:	48 83 ec 08          	sub    $0x8,%rsp
+   44eca:	49 89 ff             	mov    %rdi,%r15
+   44ecd:	89 f7                	mov    %esi,%edi
+   44ecf:	49 89 d5             	mov    %rdx,%r13
+   44ed2:	49 89 cc             	mov    %rcx,%r12
+  pipe *pp = pipe_get(id);
+   44ed5:	e8 c0 fe ff ff       	call   44d9a <pipe_get>
+  if (!pp || pp->closed[0]) {
+   44eda:	48 85 c0             	test   %rax,%rax
+   44edd:	0f 84 cb 00 00 00    	je     44fae <pipe_read+0xf5>
+   44ee3:	48 89 c3             	mov    %rax,%rbx
+   44ee6:	80 78 20 00          	cmpb   $0x0,0x20(%rax)
+   44eea:	0f 85 ca 00 00 00    	jne    44fba <pipe_read+0x101>
+    return -1;
+  }
+  uint64_t head = pp->head;
+   44ef0:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  size_t avail = pp->tail - head;
+  if (avail == 0) {
+   44ef4:	48 8b 40 10          	mov    0x10(%rax),%rax
+   44ef8:	4c 29 f0             	sub    %r14,%rax
+   44efb:	75 46                	jne    44f43 <pipe_read+0x8a>
+    if (!pp->closed[1] && n > 0) {
+   44efd:	80 7b 21 01          	cmpb   $0x1,0x21(%rbx)
+   44f01:	74 05                	je     44f08 <pipe_read+0x4f>
+   44f03:	4d 85 e4             	test   %r12,%r12
+   44f06:	75 14                	jne    44f1c <pipe_read+0x63>
+      return pipe_block(p, &pp->readers);
+    }
+    return 0;
+   44f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  memcpy((void *)buf, pp->buf + off, first);
+  memcpy((void *)(buf + first), pp->buf, n - first);
+  pp->head = head + n;
+  pipe_wake(&pp->writers);
+  return n;
+}
+   44f0d:	48 83 c4 08          	add    $0x8,%rsp
+   44f11:	5b                   	pop    %rbx
+   44f12:	41 5c                	pop    %r12
+   44f14:	41 5d                	pop    %r13
+   44f16:	41 5e                	pop    %r14
+   44f18:	41 5f                	pop    %r15
+   44f1a:	5d                   	pop    %rbp
+   44f1b:	c3                   	ret
+  p->next = *waiters;
+   44f1c:	8b 43 18             	mov    0x18(%rbx),%eax
+   44f1f:	41 89 87 bc 01 00 00 	mov    %eax,0x1bc(%r15)
+  *waiters = p->pid;
+   44f26:	41 8b 47 08          	mov    0x8(%r15),%eax
+   44f2a:	89 43 18             	mov    %eax,0x18(%rbx)
+  p->state = P_BLOCKED;
+   44f2d:	41 c7 47 0c 02 00 00 	movl   $0x2,0xc(%r15)
+   44f34:	00 
+  p->regs.reg_rip -= 2;
+   44f35:	49 83 af a8 00 00 00 	subq   $0x2,0xa8(%r15)
+   44f3c:	02 
+  return p->regs.reg_rax;
+   44f3d:	49 8b 47 10          	mov    0x10(%r15),%rax
+      return pipe_block(p, &pp->readers);
+   44f41:	eb ca                	jmp    44f0d <pipe_read+0x54>
+  n = n < avail ? n : avail;
+   44f43:	4c 39 e0             	cmp    %r12,%rax
+   44f46:	4c 0f 46 e0          	cmovbe %rax,%r12
+  if (!proc_access(p, buf, n, true)) {
+   44f4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+   44f4f:	4c 89 e2             	mov    %r12,%rdx
+   44f52:	4c 89 ee             	mov    %r13,%rsi
+   44f55:	4c 89 ff             	mov    %r15,%rdi
+   44f58:	e8 9c cd ff ff       	call   41cf9 <proc_access>
+   44f5d:	84 c0                	test   %al,%al
+   44f5f:	74 65                	je     44fc6 <pipe_read+0x10d>
+  size_t off = head % PIPE_SIZE;
+   44f61:	41 0f b7 f6          	movzwl %r14w,%esi
+  size_t first = n < PIPE_SIZE - off ? n : PIPE_SIZE - off;
+   44f65:	41 bf 00 00 01 00    	mov    $0x10000,%r15d
+   44f6b:	49 29 f7             	sub    %rsi,%r15
+   44f6e:	4d 39 e7             	cmp    %r12,%r15
+   44f71:	4d 0f 47 fc          	cmova  %r12,%r15
+  memcpy((void *)buf, pp->buf + off, first);
+   44f75:	48 03 33             	add    (%rbx),%rsi
+   44f78:	4c 89 fa             	mov    %r15,%rdx
+   44f7b:	4c 89 ef             	mov    %r13,%rdi
+   44f7e:	e8 28 f6 ff ff       	call   445ab <memcpy>
+  memcpy((void *)(buf + first), pp->buf, n - first);
+   44f83:	4c 89 e2             	mov    %r12,%rdx
+   44f86:	4c 29 fa             	sub    %r15,%rdx
+   44f89:	48 8b 33             	mov    (%rbx),%rsi
+   44f8c:	4b 8d 7c 3d 00       	lea    0x0(%r13,%r15,1),%rdi
+   44f91:	e8 15 f6 ff ff       	call   445ab <memcpy>
+  pp->head = head + n;
+   44f96:	4d 01 e6             	add    %r12,%r14
+   44f99:	4c 89 73 08          	mov    %r14,0x8(%rbx)
+  pipe_wake(&pp->writers);
+   44f9d:	48 8d 7b 1c          	lea    0x1c(%rbx),%rdi
+   44fa1:	e8 26 fe ff ff       	call   44dcc <pipe_wake>
+  return n;
+   44fa6:	4c 89 e0             	mov    %r12,%rax
+   44fa9:	e9 5f ff ff ff       	jmp    44f0d <pipe_read+0x54>
+    return -1;
+   44fae:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   44fb5:	e9 53 ff ff ff       	jmp    44f0d <pipe_read+0x54>
+   44fba:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   44fc1:	e9 47 ff ff ff       	jmp    44f0d <pipe_read+0x54>
+    return -1;
+   44fc6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   44fcd:	e9 3b ff ff ff       	jmp    44f0d <pipe_read+0x54>
+
+0000000000044fd2 <pipe_write>:
+
+long pipe_write(proc *p, int id, uintptr_t buf, size_t n) {
+   44fd2:	55                   	push   %rbp
+   44fd3:	48 89 e5             	mov    %rsp,%rbp
+   44fd6:	41 57                	push   %r15
+   44fd8:	41 56                	push   %r14
+   44fda:	41 55                	push   %r13
+   44fdc:	41 54                	push   %r12
+   44fde:	53                   	push   %rbx
+   44fdf:	48 83 ec 08          	sub    $0x8,%rsp
+   44fe3:	49 89 ff             	mov    %rdi,%r15
+   44fe6:	89 f7                	mov    %esi,%edi
+   44fe8:	49 89 d5             	mov    %rdx,%r13
+   44feb:	48 89 cb             	mov    %rcx,%rbx
+  pipe *pp = pipe_get(id);
+   44fee:	e8 a7 fd ff ff       	call   44d9a <pipe_get>
+  if (!pp || pp->closed[1] || pp->closed[0]) {
+   44ff3:	48 85 c0             	test   %rax,%rax
+   44ff6:	0f 84 d3 00 00 00    	je     450cf <pipe_write+0xfd>
+   44ffc:	49 89 c4             	mov    %rax,%r12
+   44fff:	66 83 78 20 00       	cmpw   $0x0,0x20(%rax)
+   45004:	0f 85 ce 00 00 00    	jne    450d8 <pipe_write+0x106>
+    return -1;
+  }
+  uint64_t tail = pp->tail;
+   4500a:	4c 8b 70 10          	mov    0x10(%rax),%r14
+  size_t space = PIPE_SIZE - (tail - pp->head);
+   4500e:	48 8b 40 08          	mov    0x8(%rax),%rax
+   45012:	48 05 00 00 01 00    	add    $0x10000,%rax
+  if (space == 0) {
+   45018:	4c 29 f0             	sub    %r14,%rax
+   4501b:	75 39                	jne    45056 <pipe_write+0x84>
+    return n > 0 ? pipe_block(p, &pp->writers) : 0;
+   4501d:	b8 00 00 00 00       	mov    $0x0,%eax
+   45022:	48 85 db             	test   %rbx,%rbx
+   45025:	0f 84 95 00 00 00    	je     450c0 <pipe_write+0xee>
+  p->next = *waiters;
+   4502b:	41 8b 44 24 1c       	mov    0x1c(%r12),%eax
+   45030:	41 89 87 bc 01 00 00 	mov    %eax,0x1bc(%r15)
+  *waiters = p->pid;
+   45037:	41 8b 47 08          	mov    0x8(%r15),%eax
+   4503b:	41 89 44 24 1c       	mov    %eax,0x1c(%r12)
+  p->state = P_BLOCKED;
+   45040:	41 c7 47 0c 02 00 00 	movl   $0x2,0xc(%r15)
+   45047:	00 
+  p->regs.reg_rip -= 2;
+   45048:	49 83 af a8 00 00 00 	subq   $0x2,0xa8(%r15)
+   4504f:	02 
+  return p->regs.reg_rax;
+   45050:	49 8b 47 10          	mov    0x10(%r15),%rax
+   45054:	eb 6a                	jmp    450c0 <pipe_write+0xee>
+  }
+
+  n = n < space ? n : space;
+   45056:	48 39 d8             	cmp    %rbx,%rax
+   45059:	48 0f 46 d8          	cmovbe %rax,%rbx
+  if (!proc_access(p, buf, n, false)) {
+   4505d:	b9 00 00 00 00       	mov    $0x0,%ecx
+   45062:	48 89 da             	mov    %rbx,%rdx
+   45065:	4c 89 ee             	mov    %r13,%rsi
+   45068:	4c 89 ff             	mov    %r15,%rdi
+   4506b:	e8 89 cc ff ff       	call   41cf9 <proc_access>
+   45070:	84 c0                	test   %al,%al
+   45072:	74 6d                	je     450e1 <pipe_write+0x10f>
+    return -1;
+  }
+  size_t off = tail % PIPE_SIZE;
+   45074:	41 0f b7 fe          	movzwl %r14w,%edi
+  size_t first = n < PIPE_SIZE - off ? n : PIPE_SIZE - off;
+   45078:	41 bf 00 00 01 00    	mov    $0x10000,%r15d
+   4507e:	49 29 ff             	sub    %rdi,%r15
+   45081:	49 39 df             	cmp    %rbx,%r15
+   45084:	4c 0f 47 fb          	cmova  %rbx,%r15
+  memcpy(pp->buf + off, (const void *)buf, first);
+   45088:	49 03 3c 24          	add    (%r12),%rdi
+   4508c:	4c 89 fa             	mov    %r15,%rdx
+   4508f:	4c 89 ee             	mov    %r13,%rsi
+   45092:	e8 14 f5 ff ff       	call   445ab <memcpy>
+  memcpy(pp->buf, (const void *)(buf + first), n - first);
+   45097:	48 89 da             	mov    %rbx,%rdx
+   4509a:	4c 29 fa             	sub    %r15,%rdx
+   4509d:	4b 8d 74 3d 00       	lea    0x0(%r13,%r15,1),%rsi
+   450a2:	49 8b 3c 24          	mov    (%r12),%rdi
+   450a6:	e8 00 f5 ff ff       	call   445ab <memcpy>
+  pp->tail = tail + n;
+   450ab:	49 01 de             	add    %rbx,%r14
+   450ae:	4d 89 74 24 10       	mov    %r14,0x10(%r12)
+  pipe_wake(&pp->readers);
+   450b3:	49 8d 7c 24 18       	lea    0x18(%r12),%rdi
+   450b8:	e8 0f fd ff ff       	call   44dcc <pipe_wake>
+  return n;
+   450bd:	48 89 d8             	mov    %rbx,%rax
+}
+   450c0:	48 83 c4 08          	add    $0x8,%rsp
+   450c4:	5b                   	pop    %rbx
+   450c5:	41 5c                	pop    %r12
+   450c7:	41 5d                	pop    %r13
+   450c9:	41 5e                	pop    %r14
+   450cb:	41 5f                	pop    %r15
+   450cd:	5d                   	pop    %rbp
+   450ce:	c3                   	ret
+    return -1;
+   450cf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   450d6:	eb e8                	jmp    450c0 <pipe_write+0xee>
+   450d8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   450df:	eb df                	jmp    450c0 <pipe_write+0xee>
+    return -1;
+   450e1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+   450e8:	eb d6                	jmp    450c0 <pipe_write+0xee>
+
+00000000000450ea <pipe_close>:
+
+int pipe_close(int id, int end) {
+   450ea:	55                   	push   %rbp
+   450eb:	48 89 e5             	mov    %rsp,%rbp
+   450ee:	41 54                	push   %r12
+   450f0:	53                   	push   %rbx
+   450f1:	41 89 f4             	mov    %esi,%r12d
+  pipe *pp = pipe_get(id);
+   450f4:	e8 a1 fc ff ff       	call   44d9a <pipe_get>
+  if (!pp || (end != 0 && end != 1) || pp->closed[end]) {
+   450f9:	48 85 c0             	test   %rax,%rax
+   450fc:	74 58                	je     45156 <pipe_close+0x6c>
+   450fe:	48 89 c3             	mov    %rax,%rbx
+   45101:	41 83 fc 01          	cmp    $0x1,%r12d
+   45105:	77 4f                	ja     45156 <pipe_close+0x6c>
+   45107:	49 63 c4             	movslq %r12d,%rax
+   4510a:	80 7c 03 20 00       	cmpb   $0x0,0x20(%rbx,%rax,1)
+   4510f:	75 4c                	jne    4515d <pipe_close+0x73>
+    return -1;
+  }
+  pp->closed[end] = true;
+   45111:	c6 44 03 20 01       	movb   $0x1,0x20(%rbx,%rax,1)
+  // blocked peers retry and see end of file or an error
+  pipe_wake(end ? &pp->readers : &pp->writers);
+   45116:	48 8d 43 18          	lea    0x18(%rbx),%rax
+   4511a:	48 8d 7b 1c          	lea    0x1c(%rbx),%rdi
+   4511e:	45 85 e4             	test   %r12d,%r12d
+   45121:	48 0f 45 f8          	cmovne %rax,%rdi
+   45125:	e8 a2 fc ff ff       	call   44dcc <pipe_wake>
+  if (pp->closed[0] && pp->closed[1]) {
+    kfree(pp->buf);
+    pp->buf = NULL;
+  }
+  return 0;
+   4512a:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (pp->closed[0] && pp->closed[1]) {
+   4512f:	80 7b 20 00          	cmpb   $0x0,0x20(%rbx)
+   45133:	74 06                	je     4513b <pipe_close+0x51>
+   45135:	80 7b 21 00          	cmpb   $0x0,0x21(%rbx)
+   45139:	75 05                	jne    45140 <pipe_close+0x56>
+}
+   4513b:	5b                   	pop    %rbx
+   4513c:	41 5c                	pop    %r12
+   4513e:	5d                   	pop    %rbp
+   4513f:	c3                   	ret
+    kfree(pp->buf);
+   45140:	48 8b 3b             	mov    (%rbx),%rdi
+   45143:	e8 fa c1 ff ff       	call   41342 <kfree>
+    pp->buf = NULL;
+   45148:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  return 0;
+   4514f:	b8 00 00 00 00       	mov    $0x0,%eax
+   45154:	eb e5                	jmp    4513b <pipe_close+0x51>
+    return -1;
+   45156:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   4515b:	eb de                	jmp    4513b <pipe_close+0x51>
+   4515d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   45162:	eb d7                	jmp    4513b <pipe_close+0x51>
+
+0000000000045164 <merge_remap>:
+}
+
+// merge_remap(p, pep, pa)
+//    Point `p`'s leaf entry `pep` at canonical page `pa`, dropping the old
+//    page's reference.
+static void merge_remap(proc *p, x86_64_pageentry_t *pep, uintptr_t pa) {
+   45164:	55                   	push   %rbp
+   45165:	48 89 e5             	mov    %rsp,%rbp
+   45168:	53                   	push   %rbx
+   45169:	48 83 ec 08          	sub    $0x8,%rsp
+   4516d:	48 89 fb             	mov    %rdi,%rbx
+  x86_64_pageentry_t pe = *pep;
+   45170:	48 8b 3e             	mov    (%rsi),%rdi
+  int perm = pe & PAGEOFFMASK;
+   45173:	89 f9                	mov    %edi,%ecx
+   45175:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+   4517b:	89 f8                	mov    %edi,%eax
+   4517d:	25 fd 0d 00 00       	and    $0xdfd,%eax
+   45182:	80 cc 02             	or     $0x2,%ah
+   45185:	40 f6 c7 02          	test   $0x2,%dil
+   45189:	0f 44 c1             	cmove  %ecx,%eax
+  if (perm & PTE_W) {
+    perm = (perm & ~PTE_W) | PTE_COW;
+  }
+  *pep = pa | perm;
+   4518c:	48 98                	cltq
+   4518e:	48 09 d0             	or     %rdx,%rax
+   45191:	48 89 06             	mov    %rax,(%rsi)
+  if ((void *)pa != zero_frame) {
+   45194:	48 39 15 25 cc 00 00 	cmp    %rdx,0xcc25(%rip)        # 51dc0 <zero_frame>
+   4519b:	74 12                	je     451af <merge_remap+0x4b>
+    ++pages[pa / PAGESIZE].refcount;
+   4519d:	48 c1 ea 0c          	shr    $0xc,%rdx
+   451a1:	48 c1 e2 04          	shl    $0x4,%rdx
+   451a5:	48 03 15 54 9e 00 00 	add    0x9e54(%rip),%rdx        # 4f000 <pages>
+   451ac:	80 02 01             	addb   $0x1,(%rdx)
+  }
+  kfree((void *)(pe & PTE_PAMASK));
+   451af:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   451b6:	ff 0f 00 
+   451b9:	48 21 c7             	and    %rax,%rdi
+   451bc:	e8 81 c1 ff ff       	call   41342 <kfree>
+  proc_tlb_invalidate(p);
+   451c1:	48 89 df             	mov    %rbx,%rdi
+   451c4:	e8 48 c6 ff ff       	call   41811 <proc_tlb_invalidate>
+}
+   451c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   451cd:	c9                   	leave
+   451ce:	c3                   	ret
+
+00000000000451cf <merge_init>:
+void merge_init() {
+   451cf:	55                   	push   %rbp
+   451d0:	48 89 e5             	mov    %rsp,%rbp
+  zero_frame = kalloc_zeroed(PAGESIZE);
+   451d3:	bf 00 10 00 00       	mov    $0x1000,%edi
+   451d8:	e8 88 bf ff ff       	call   41165 <kalloc_zeroed>
+   451dd:	48 89 05 dc cb 00 00 	mov    %rax,0xcbdc(%rip)        # 51dc0 <zero_frame>
+  pages[(uintptr_t)zero_frame / PAGESIZE].merged = true;
+   451e4:	48 c1 e8 0c          	shr    $0xc,%rax
+   451e8:	48 c1 e0 04          	shl    $0x4,%rax
+   451ec:	48 03 05 0d 9e 00 00 	add    0x9e0d(%rip),%rax        # 4f000 <pages>
+   451f3:	80 48 02 04          	orb    $0x4,0x2(%rax)
+}
+   451f7:	5d                   	pop    %rbp
+   451f8:	c3                   	ret
+
+00000000000451f9 <merge_scan>:
+    e->pn = pn;
+    pages[pn].merged = true;
+  }
+}
+
+void merge_scan() {
+   451f9:	55                   	push   %rbp
+   451fa:	48 89 e5             	mov    %rsp,%rbp
+   451fd:	41 57                	push   %r15
+   451ff:	41 56                	push   %r14
+   45201:	41 55                	push   %r13
+   45203:	41 54                	push   %r12
+   45205:	53                   	push   %rbx
+   45206:	48 83 ec 58          	sub    $0x58,%rsp
+  int budget = MERGE_BATCH;
+  for (int nproc = 0; nproc < NPROC && budget > 0; ++nproc) {
+   4520a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  int budget = MERGE_BATCH;
+   45210:	41 bf 40 00 00 00    	mov    $0x40,%r15d
+        }
+      }
+      proc_unclaim(p);
+    }
+    merge_pid = merge_pid + 1 < NPROC ? merge_pid + 1 : 1;
+    merge_va = PROC_START_ADDR;
+   45216:	49 bd 00 00 00 00 80 	movabs $0x8000000000,%r13
+   4521d:	00 00 00 
+   45220:	e9 cc 00 00 00       	jmp    452f1 <merge_scan+0xf8>
+            merge_va = vmiter_va(&it);
+   45225:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   45229:	e8 95 e4 ff ff       	call   436c3 <vmiter_va>
+   4522e:	48 89 05 2b 2e 00 00 	mov    %rax,0x2e2b(%rip)        # 48060 <merge_va>
+            proc_unclaim(p);
+   45235:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   45239:	e8 1e c6 ff ff       	call   4185c <proc_unclaim>
+  }
+}
+   4523e:	48 83 c4 58          	add    $0x58,%rsp
+   45242:	5b                   	pop    %rbx
+   45243:	41 5c                	pop    %r12
+   45245:	41 5d                	pop    %r13
+   45247:	41 5e                	pop    %r14
+   45249:	41 5f                	pop    %r15
+   4524b:	5d                   	pop    %rbp
+   4524c:	c3                   	ret
+  if (cpn && e->hash == hash && pages[cpn].merged && pages[cpn].refcount &&
+   4524d:	8b 55 90             	mov    -0x70(%rbp),%edx
+   45250:	48 89 d0             	mov    %rdx,%rax
+   45253:	48 c1 e0 04          	shl    $0x4,%rax
+   45257:	48 01 f8             	add    %rdi,%rax
+   4525a:	f6 40 02 04          	testb  $0x4,0x2(%rax)
+   4525e:	0f 84 80 01 00 00    	je     453e4 <merge_scan+0x1eb>
+   45264:	0f b6 00             	movzbl (%rax),%eax
+   45267:	83 e8 01             	sub    $0x1,%eax
+   4526a:	3c fd                	cmp    $0xfd,%al
+   4526c:	0f 87 72 01 00 00    	ja     453e4 <merge_scan+0x1eb>
+      memcmp((void *)((uintptr_t)cpn * PAGESIZE), data, PAGESIZE) == 0) {
+   45272:	48 c1 e2 0c          	shl    $0xc,%rdx
+   45276:	48 89 d7             	mov    %rdx,%rdi
+   45279:	48 89 55 80          	mov    %rdx,-0x80(%rbp)
+   4527d:	ba 00 10 00 00       	mov    $0x1000,%edx
+   45282:	e8 a3 f3 ff ff       	call   4462a <memcmp>
+      pages[cpn].refcount < UINT8_MAX &&
+   45287:	85 c0                	test   %eax,%eax
+   45289:	0f 85 55 01 00 00    	jne    453e4 <merge_scan+0x1eb>
+    merge_remap(p, pep, (uintptr_t)cpn * PAGESIZE);
+   4528f:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+   45293:	4c 89 f6             	mov    %r14,%rsi
+   45296:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   4529a:	e8 c5 fe ff ff       	call   45164 <merge_remap>
+    ++merge_stats.dup;
+   4529f:	48 83 05 49 cb 00 00 	addq   $0x1,0xcb49(%rip)        # 51df0 <merge_stats+0x10>
+   452a6:	01 
+   452a7:	e9 79 01 00 00       	jmp    45425 <merge_scan+0x22c>
+      proc_unclaim(p);
+   452ac:	44 8b 75 94          	mov    -0x6c(%rbp),%r14d
+   452b0:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   452b4:	e8 a3 c5 ff ff       	call   4185c <proc_unclaim>
+    merge_pid = merge_pid + 1 < NPROC ? merge_pid + 1 : 1;
+   452b9:	8b 15 a9 2d 00 00    	mov    0x2da9(%rip),%edx        # 48068 <merge_pid>
+   452bf:	8d 42 01             	lea    0x1(%rdx),%eax
+   452c2:	83 fa 0f             	cmp    $0xf,%edx
+   452c5:	ba 01 00 00 00       	mov    $0x1,%edx
+   452ca:	0f 4d c2             	cmovge %edx,%eax
+   452cd:	89 05 95 2d 00 00    	mov    %eax,0x2d95(%rip)        # 48068 <merge_pid>
+    merge_va = PROC_START_ADDR;
+   452d3:	4c 89 2d 86 2d 00 00 	mov    %r13,0x2d86(%rip)        # 48060 <merge_va>
+  for (int nproc = 0; nproc < NPROC && budget > 0; ++nproc) {
+   452da:	41 83 c6 01          	add    $0x1,%r14d
+   452de:	41 83 fe 0f          	cmp    $0xf,%r14d
+   452e2:	0f 8f 56 ff ff ff    	jg     4523e <merge_scan+0x45>
+   452e8:	45 85 ff             	test   %r15d,%r15d
+   452eb:	0f 8e 4d ff ff ff    	jle    4523e <merge_scan+0x45>
+    proc *p = &ptable[merge_pid];
+   452f1:	8b 1d 71 2d 00 00    	mov    0x2d71(%rip),%ebx        # 48068 <merge_pid>
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+   452f7:	48 63 c3             	movslq %ebx,%rax
+   452fa:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   45301:	83 b8 4c f0 04 00 00 	cmpl   $0x0,0x4f04c(%rax)
+   45308:	74 af                	je     452b9 <merge_scan+0xc0>
+   4530a:	48 63 c3             	movslq %ebx,%rax
+   4530d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   45314:	48 83 b8 40 f0 04 00 	cmpq   $0x0,0x4f040(%rax)
+   4531b:	00 
+   4531c:	74 9b                	je     452b9 <merge_scan+0xc0>
+    proc *p = &ptable[merge_pid];
+   4531e:	48 63 c3             	movslq %ebx,%rax
+   45321:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   45328:	48 05 40 f0 04 00    	add    $0x4f040,%rax
+   4532e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+   45332:	48 89 c7             	mov    %rax,%rdi
+   45335:	e8 e3 c4 ff ff       	call   4181d <proc_claim>
+   4533a:	84 c0                	test   %al,%al
+   4533c:	0f 84 77 ff ff ff    	je     452b9 <merge_scan+0xc0>
+      vmiter_t it = vmiter_init(p->pagetable);
+   45342:	48 63 c3             	movslq %ebx,%rax
+   45345:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   4534c:	48 8b b0 40 f0 04 00 	mov    0x4f040(%rax),%rsi
+   45353:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   45357:	e8 25 e4 ff ff       	call   43781 <vmiter_init>
+      for (vmiter_va_add(&it, merge_va); vmiter_va(&it) < VA_LOWEND;
+   4535c:	48 8b 35 fd 2c 00 00 	mov    0x2cfd(%rip),%rsi        # 48060 <merge_va>
+   45363:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   45367:	e8 8f e6 ff ff       	call   439fb <vmiter_va_add>
+   4536c:	49 bc ff ff ff ff ff 	movabs $0x7fffffffffff,%r12
+   45373:	7f 00 00 
+   45376:	44 89 75 94          	mov    %r14d,-0x6c(%rbp)
+   4537a:	e9 b3 00 00 00       	jmp    45432 <merge_scan+0x239>
+  if (*pep & PTE_W) {
+   4537f:	f6 c1 02             	test   $0x2,%cl
+   45382:	0f 85 9d 00 00 00    	jne    45425 <merge_scan+0x22c>
+   45388:	48 89 f0             	mov    %rsi,%rax
+  uint64_t h = 0xCBF29CE484222325UL;
+   4538b:	48 bb 25 23 22 84 e4 	movabs $0xcbf29ce484222325,%rbx
+   45392:	9c f2 cb 
+    h = (h ^ page[i]) * 0x100000001B3UL;
+   45395:	48 b9 b3 01 00 00 00 	movabs $0x100000001b3,%rcx
+   4539c:	01 00 00 
+   4539f:	48 33 18             	xor    (%rax),%rbx
+   453a2:	48 0f af d9          	imul   %rcx,%rbx
+  for (size_t i = 0; i < PAGESIZE / sizeof(uint64_t); ++i) {
+   453a6:	48 83 c0 08          	add    $0x8,%rax
+   453aa:	48 39 d0             	cmp    %rdx,%rax
+   453ad:	75 f0                	jne    4539f <merge_scan+0x1a6>
+  merge_entry *e = &merge_table[hash % MERGE_TABLE_SIZE];
+   453af:	48 89 d9             	mov    %rbx,%rcx
+   453b2:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+   453b8:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+  uint32_t cpn = e->pn;
+   453bc:	48 89 c8             	mov    %rcx,%rax
+   453bf:	48 c1 e0 04          	shl    $0x4,%rax
+   453c3:	8b 80 08 1e 05 00    	mov    0x51e08(%rax),%eax
+   453c9:	89 45 90             	mov    %eax,-0x70(%rbp)
+  if (cpn && e->hash == hash && pages[cpn].merged && pages[cpn].refcount &&
+   453cc:	85 c0                	test   %eax,%eax
+   453ce:	74 2d                	je     453fd <merge_scan+0x204>
+   453d0:	48 89 c8             	mov    %rcx,%rax
+   453d3:	48 c1 e0 04          	shl    $0x4,%rax
+   453d7:	48 39 98 00 1e 05 00 	cmp    %rbx,0x51e00(%rax)
+   453de:	0f 84 69 fe ff ff    	je     4524d <merge_scan+0x54>
+  } else if (!cpn || !pages[cpn].merged || !pages[cpn].refcount) {
+   453e4:	8b 45 90             	mov    -0x70(%rbp),%eax
+   453e7:	48 c1 e0 04          	shl    $0x4,%rax
+   453eb:	48 03 05 0e 9c 00 00 	add    0x9c0e(%rip),%rax        # 4f000 <pages>
+   453f2:	f6 40 02 04          	testb  $0x4,0x2(%rax)
+   453f6:	74 05                	je     453fd <merge_scan+0x204>
+   453f8:	80 38 00             	cmpb   $0x0,(%rax)
+   453fb:	75 28                	jne    45425 <merge_scan+0x22c>
+    e->hash = hash;
+   453fd:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+   45401:	48 c1 e0 04          	shl    $0x4,%rax
+   45405:	48 89 98 00 1e 05 00 	mov    %rbx,0x51e00(%rax)
+  uint32_t pn = pa / PAGESIZE;
+   4540c:	8b 75 a0             	mov    -0x60(%rbp),%esi
+   4540f:	89 b0 08 1e 05 00    	mov    %esi,0x51e08(%rax)
+    pages[pn].merged = true;
+   45415:	48 8b 05 e4 9b 00 00 	mov    0x9be4(%rip),%rax        # 4f000 <pages>
+   4541c:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+   45420:	80 4c 30 02 04       	orb    $0x4,0x2(%rax,%rsi,1)
+          --budget;
+   45425:	41 83 ef 01          	sub    $0x1,%r15d
+           vmiter_next(&it)) {
+   45429:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   4542d:	e8 a3 e5 ff ff       	call   439d5 <vmiter_next>
+      for (vmiter_va_add(&it, merge_va); vmiter_va(&it) < VA_LOWEND;
+   45432:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   45436:	e8 88 e2 ff ff       	call   436c3 <vmiter_va>
+   4543b:	49 39 c4             	cmp    %rax,%r12
+   4543e:	0f 82 68 fe ff ff    	jb     452ac <merge_scan+0xb3>
+        if (vmiter_present(&it) && it.level == 0) {
+   45444:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+   45448:	e8 7b e2 ff ff       	call   436c8 <vmiter_present>
+   4544d:	84 c0                	test   %al,%al
+   4544f:	74 d8                	je     45429 <merge_scan+0x230>
+   45451:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+   45455:	75 d2                	jne    45429 <merge_scan+0x230>
+          if (budget == 0) {
+   45457:	45 85 ff             	test   %r15d,%r15d
+   4545a:	0f 84 c5 fd ff ff    	je     45225 <merge_scan+0x2c>
+          merge_page(p, it.pep);
+   45460:	4c 8b 75 b8          	mov    -0x48(%rbp),%r14
+  uintptr_t pa = *pep & PTE_PAMASK;
+   45464:	49 8b 0e             	mov    (%r14),%rcx
+  ++merge_stats.scanned;
+   45467:	48 83 05 71 c9 00 00 	addq   $0x1,0xc971(%rip)        # 51de0 <merge_stats>
+   4546e:	01 
+  if (!(*pep & PTE_U) || (*pep & PTE_SHARED) || pages[pn].merged) {
+   4546f:	48 89 c8             	mov    %rcx,%rax
+   45472:	25 04 04 00 00       	and    $0x404,%eax
+   45477:	48 83 f8 04          	cmp    $0x4,%rax
+   4547b:	75 a8                	jne    45425 <merge_scan+0x22c>
+  uintptr_t pa = *pep & PTE_PAMASK;
+   4547d:	48 be 00 f0 ff ff ff 	movabs $0xffffffffff000,%rsi
+   45484:	ff 0f 00 
+   45487:	48 21 ce             	and    %rcx,%rsi
+  uint32_t pn = pa / PAGESIZE;
+   4548a:	48 89 f0             	mov    %rsi,%rax
+   4548d:	48 c1 e8 0c          	shr    $0xc,%rax
+   45491:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  if (!(*pep & PTE_U) || (*pep & PTE_SHARED) || pages[pn].merged) {
+   45495:	48 8b 3d 64 9b 00 00 	mov    0x9b64(%rip),%rdi        # 4f000 <pages>
+   4549c:	89 c0                	mov    %eax,%eax
+   4549e:	48 c1 e0 04          	shl    $0x4,%rax
+   454a2:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+   454a6:	f6 44 07 02 04       	testb  $0x4,0x2(%rdi,%rax,1)
+   454ab:	0f 85 74 ff ff ff    	jne    45425 <merge_scan+0x22c>
+   454b1:	48 8d 96 00 10 00 00 	lea    0x1000(%rsi),%rdx
+   454b8:	48 89 f0             	mov    %rsi,%rax
+    if (page[i]) {
+   454bb:	48 83 38 00          	cmpq   $0x0,(%rax)
+   454bf:	0f 85 ba fe ff ff    	jne    4537f <merge_scan+0x186>
+  for (size_t i = 0; i < PAGESIZE / sizeof(uint64_t); ++i) {
+   454c5:	48 83 c0 08          	add    $0x8,%rax
+   454c9:	48 39 d0             	cmp    %rdx,%rax
+   454cc:	75 ed                	jne    454bb <merge_scan+0x2c2>
+    merge_remap(p, pep, (uintptr_t)zero_frame);
+   454ce:	48 8b 15 eb c8 00 00 	mov    0xc8eb(%rip),%rdx        # 51dc0 <zero_frame>
+   454d5:	4c 89 f6             	mov    %r14,%rsi
+   454d8:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+   454dc:	e8 83 fc ff ff       	call   45164 <merge_remap>
+    ++merge_stats.zero;
+   454e1:	48 83 05 ff c8 00 00 	addq   $0x1,0xc8ff(%rip)        # 51de8 <merge_stats+0x8>
+   454e8:	01 
+    return;
+   454e9:	e9 37 ff ff ff       	jmp    45425 <merge_scan+0x22c>
+
+00000000000454ee <merge_report>:
+
+void merge_report() {
+   454ee:	55                   	push   %rbp
+   454ef:	48 89 e5             	mov    %rsp,%rbp
+   454f2:	53                   	push   %rbx
+   454f3:	48 83 ec 08          	sub    $0x8,%rsp
+  uint64_t saved = merge_stats.zero + merge_stats.dup;
+   454f7:	48 8b 15 ea c8 00 00 	mov    0xc8ea(%rip),%rdx        # 51de8 <merge_stats+0x8>
+   454fe:	48 8b 0d eb c8 00 00 	mov    0xc8eb(%rip),%rcx        # 51df0 <merge_stats+0x10>
+  if (saved && saved >= 2 * merge_stats.reported) {
+   45505:	48 89 d3             	mov    %rdx,%rbx
+   45508:	48 01 cb             	add    %rcx,%rbx
+   4550b:	74 0f                	je     4551c <merge_report+0x2e>
+   4550d:	48 8b 05 e4 c8 00 00 	mov    0xc8e4(%rip),%rax        # 51df8 <merge_stats+0x18>
+   45514:	48 01 c0             	add    %rax,%rax
+   45517:	48 39 c3             	cmp    %rax,%rbx
+   4551a:	73 06                	jae    45522 <merge_report+0x34>
+    log_printf("merge %lu scanned %lu zero %lu dup %lu KiB saved\n",
+               merge_stats.scanned, merge_stats.zero, merge_stats.dup,
+               saved * (PAGESIZE / 1024));
+    merge_stats.reported = saved;
+  }
+}
+   4551c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   45520:	c9                   	leave
+   45521:	c3                   	ret
+    log_printf("merge %lu scanned %lu zero %lu dup %lu KiB saved\n",
+   45522:	4c 8d 04 9d 00 00 00 	lea    0x0(,%rbx,4),%r8
+   45529:	00 
+   4552a:	48 8b 35 af c8 00 00 	mov    0xc8af(%rip),%rsi        # 51de0 <merge_stats>
+   45531:	bf e8 75 04 00       	mov    $0x475e8,%edi
+   45536:	b8 00 00 00 00       	mov    $0x0,%eax
+   4553b:	e8 2c ea ff ff       	call   43f6c <log_printf>
+    merge_stats.reported = saved;
+   45540:	48 89 1d b1 c8 00 00 	mov    %rbx,0xc8b1(%rip)        # 51df8 <merge_stats+0x18>
+}
+   45547:	eb d3                	jmp    4551c <merge_report+0x2e>
+
+0000000000045549 <ata_wait>:
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   45549:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   4554e:	ec                   	in     (%dx),%al
+
+// ata_wait()
+//    Wait until the disk is not busy. Returns its status, or -1 on error.
+static int ata_wait() {
+  uint8_t status;
+  while ((status = inb(ATA_STATUS)) & ATA_SR_BSY) {
+   4554f:	84 c0                	test   %al,%al
+   45551:	78 fb                	js     4554e <ata_wait+0x5>
+  }
+  return status & (ATA_SR_ERR | ATA_SR_DF) ? -1 : status;
+   45553:	0f b6 d0             	movzbl %al,%edx
+   45556:	a8 21                	test   $0x21,%al
+   45558:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   4555d:	0f 45 d0             	cmovne %eax,%edx
+}
+   45560:	89 d0                	mov    %edx,%eax
+   45562:	c3                   	ret
+
+0000000000045563 <ata_wait_drq>:
+}
+
+// ata_wait_drq()
+//    Wait until the disk is ready to transfer a sector (not busy, DRQ
+//    set). Returns -1 if it reports an error instead.
+static int ata_wait_drq() {
+   45563:	55                   	push   %rbp
+   45564:	48 89 e5             	mov    %rsp,%rbp
+   45567:	ba f6 03 00 00       	mov    $0x3f6,%edx
+   4556c:	ec                   	in     (%dx),%al
+   4556d:	ec                   	in     (%dx),%al
+   4556e:	ec                   	in     (%dx),%al
+   4556f:	ec                   	in     (%dx),%al
+  ata_delay();
+  int status = ata_wait();
+   45570:	b8 00 00 00 00       	mov    $0x0,%eax
+   45575:	e8 cf ff ff ff       	call   45549 <ata_wait>
+  return status < 0 || !(status & ATA_SR_DRQ) ? -1 : 0;
+   4557a:	85 c0                	test   %eax,%eax
+   4557c:	78 0c                	js     4558a <ata_wait_drq+0x27>
+   4557e:	a8 08                	test   $0x8,%al
+   45580:	0f 94 c0             	sete   %al
+   45583:	0f b6 c0             	movzbl %al,%eax
+   45586:	f7 d8                	neg    %eax
+}
+   45588:	5d                   	pop    %rbp
+   45589:	c3                   	ret
+  return status < 0 || !(status & ATA_SR_DRQ) ? -1 : 0;
+   4558a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   4558f:	eb f7                	jmp    45588 <ata_wait_drq+0x25>
+
+0000000000045591 <ata_command>:
+
+// ata_command(cmd, sect, nsect)
+//    Issue `cmd` for `nsect` (1 to ATA_MAXSECTS) sectors from `sect`.
+static int ata_command(int cmd, uint32_t sect, unsigned nsect) {
+   45591:	55                   	push   %rbp
+   45592:	48 89 e5             	mov    %rsp,%rbp
+   45595:	41 55                	push   %r13
+   45597:	41 54                	push   %r12
+   45599:	53                   	push   %rbx
+   4559a:	48 83 ec 08          	sub    $0x8,%rsp
+   4559e:	41 89 fc             	mov    %edi,%r12d
+   455a1:	89 f3                	mov    %esi,%ebx
+   455a3:	41 89 d5             	mov    %edx,%r13d
+  if (ata_wait() < 0) {
+   455a6:	b8 00 00 00 00       	mov    $0x0,%eax
+   455ab:	e8 99 ff ff ff       	call   45549 <ata_wait>
+   455b0:	85 c0                	test   %eax,%eax
+   455b2:	78 51                	js     45605 <ata_command+0x74>
+    asm volatile("outb %0, %w1" : : "a" (data), "d" (port));
+   455b4:	ba f2 01 00 00       	mov    $0x1f2,%edx
+   455b9:	44 89 e8             	mov    %r13d,%eax
+   455bc:	ee                   	out    %al,(%dx)
+   455bd:	ba f3 01 00 00       	mov    $0x1f3,%edx
+   455c2:	89 d8                	mov    %ebx,%eax
+   455c4:	ee                   	out    %al,(%dx)
+    return -1;
+  }
+  outb(ATA_NSECT, nsect); // 256 is sent as 0
+  outb(ATA_LBA0, sect);
+  outb(ATA_LBA1, sect >> 8);
+   455c5:	89 d8                	mov    %ebx,%eax
+   455c7:	c1 e8 08             	shr    $0x8,%eax
+   455ca:	ba f4 01 00 00       	mov    $0x1f4,%edx
+   455cf:	ee                   	out    %al,(%dx)
+  outb(ATA_LBA2, sect >> 16);
+   455d0:	89 d8                	mov    %ebx,%eax
+   455d2:	c1 e8 10             	shr    $0x10,%eax
+   455d5:	ba f5 01 00 00       	mov    $0x1f5,%edx
+   455da:	ee                   	out    %al,(%dx)
+  outb(ATA_DEVICE, ((sect >> 24) & 0x0F) | 0xE0);
+   455db:	89 d8                	mov    %ebx,%eax
+   455dd:	c1 e8 18             	shr    $0x18,%eax
+   455e0:	83 e0 0f             	and    $0xf,%eax
+   455e3:	83 c8 e0             	or     $0xffffffe0,%eax
+   455e6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+   455eb:	ee                   	out    %al,(%dx)
+   455ec:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   455f1:	44 89 e0             	mov    %r12d,%eax
+   455f4:	ee                   	out    %al,(%dx)
+  outb(ATA_COMMAND, cmd);
+  return 0;
+   455f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   455fa:	48 83 c4 08          	add    $0x8,%rsp
+   455fe:	5b                   	pop    %rbx
+   455ff:	41 5c                	pop    %r12
+   45601:	41 5d                	pop    %r13
+   45603:	5d                   	pop    %rbp
+   45604:	c3                   	ret
+    return -1;
+   45605:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   4560a:	eb ee                	jmp    455fa <ata_command+0x69>
+
+000000000004560c <ata_init>:
+   4560c:	b8 02 00 00 00       	mov    $0x2,%eax
+   45611:	ba f6 03 00 00       	mov    $0x3f6,%edx
+   45616:	ee                   	out    %al,(%dx)
+void ata_init() { outb(ATA_CONTROL, ATA_CTL_NIEN); }
+   45617:	c3                   	ret
+
+0000000000045618 <ata_read>:
+
+int ata_read(uint32_t sect, void *dst, unsigned nsect) {
+   45618:	55                   	push   %rbp
+   45619:	48 89 e5             	mov    %rsp,%rbp
+   4561c:	41 55                	push   %r13
+   4561e:	41 54                	push   %r12
+   45620:	53                   	push   %rbx
+   45621:	48 83 ec 08          	sub    $0x8,%rsp
+   45625:	48 89 f3             	mov    %rsi,%rbx
+   45628:	41 89 d5             	mov    %edx,%r13d
+  if (ata_command(ATA_CMD_READ, sect, nsect) < 0) {
+   4562b:	89 fe                	mov    %edi,%esi
+   4562d:	bf 20 00 00 00       	mov    $0x20,%edi
+   45632:	e8 5a ff ff ff       	call   45591 <ata_command>
+   45637:	85 c0                	test   %eax,%eax
+   45639:	78 44                	js     4567f <ata_read+0x67>
+    return -1;
+  }
+  // the disk raises DRQ once per sector
+  for (char *p = (char *)dst; nsect > 0; --nsect, p += SECTORSIZE) {
+   4563b:	45 85 ed             	test   %r13d,%r13d
+   4563e:	74 46                	je     45686 <ata_read+0x6e>
+   45640:	45 89 ed             	mov    %r13d,%r13d
+   45643:	49 c1 e5 09          	shl    $0x9,%r13
+   45647:	49 01 dd             	add    %rbx,%r13
+    asm volatile("cld; rep; insl"
+   4564a:	41 bc f0 01 00 00    	mov    $0x1f0,%r12d
+    if (ata_wait_drq() < 0) {
+   45650:	b8 00 00 00 00       	mov    $0x0,%eax
+   45655:	e8 09 ff ff ff       	call   45563 <ata_wait_drq>
+   4565a:	85 c0                	test   %eax,%eax
+   4565c:	78 2f                	js     4568d <ata_read+0x75>
+   4565e:	48 89 df             	mov    %rbx,%rdi
+   45661:	b9 80 00 00 00       	mov    $0x80,%ecx
+   45666:	44 89 e2             	mov    %r12d,%edx
+   45669:	fc                   	cld
+   4566a:	f3 6d                	rep insl (%dx),%es:(%rdi)
+  for (char *p = (char *)dst; nsect > 0; --nsect, p += SECTORSIZE) {
+   4566c:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+   45673:	4c 39 eb             	cmp    %r13,%rbx
+   45676:	75 d8                	jne    45650 <ata_read+0x38>
+      return -1;
+    }
+    insl(ATA_DATA, p, SECTORSIZE / 4);
+  }
+  return 0;
+   45678:	b8 00 00 00 00       	mov    $0x0,%eax
+   4567d:	eb 13                	jmp    45692 <ata_read+0x7a>
+    return -1;
+   4567f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   45684:	eb 0c                	jmp    45692 <ata_read+0x7a>
+  return 0;
+   45686:	b8 00 00 00 00       	mov    $0x0,%eax
+   4568b:	eb 05                	jmp    45692 <ata_read+0x7a>
+      return -1;
+   4568d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+   45692:	48 83 c4 08          	add    $0x8,%rsp
+   45696:	5b                   	pop    %rbx
+   45697:	41 5c                	pop    %r12
+   45699:	41 5d                	pop    %r13
+   4569b:	5d                   	pop    %rbp
+   4569c:	c3                   	ret
+
+000000000004569d <ata_write_pages>:
+
+int ata_write_pages(uint32_t sect, void *const *srcs, unsigned npages) {
+   4569d:	55                   	push   %rbp
+   4569e:	48 89 e5             	mov    %rsp,%rbp
+   456a1:	41 57                	push   %r15
+   456a3:	41 56                	push   %r14
+   456a5:	41 55                	push   %r13
+   456a7:	41 54                	push   %r12
+   456a9:	53                   	push   %rbx
+   456aa:	48 83 ec 08          	sub    $0x8,%rsp
+   456ae:	49 89 f4             	mov    %rsi,%r12
+   456b1:	89 d3                	mov    %edx,%ebx
+  if (ata_command(ATA_CMD_WRITE, sect, npages * ATA_SECTS_PER_PAGE) < 0) {
+   456b3:	8d 14 d5 00 00 00 00 	lea    0x0(,%rdx,8),%edx
+   456ba:	89 fe                	mov    %edi,%esi
+   456bc:	bf 30 00 00 00       	mov    $0x30,%edi
+   456c1:	e8 cb fe ff ff       	call   45591 <ata_command>
+   456c6:	85 c0                	test   %eax,%eax
+   456c8:	78 6a                	js     45734 <ata_write_pages+0x97>
+    return -1;
+  }
+  for (unsigned i = 0; i < npages; ++i) {
+   456ca:	85 db                	test   %ebx,%ebx
+   456cc:	74 4e                	je     4571c <ata_write_pages+0x7f>
+   456ce:	4d 89 e6             	mov    %r12,%r14
+   456d1:	89 db                	mov    %ebx,%ebx
+   456d3:	4d 8d 3c dc          	lea    (%r12,%rbx,8),%r15
+    asm volatile("cld; rep; outsl"
+   456d7:	41 bc f0 01 00 00    	mov    $0x1f0,%r12d
+   456dd:	eb 09                	jmp    456e8 <ata_write_pages+0x4b>
+   456df:	49 83 c6 08          	add    $0x8,%r14
+   456e3:	4d 39 fe             	cmp    %r15,%r14
+   456e6:	74 34                	je     4571c <ata_write_pages+0x7f>
+    const char *p = (const char *)srcs[i];
+   456e8:	49 8b 1e             	mov    (%r14),%rbx
+    for (unsigned s = 0; s < ATA_SECTS_PER_PAGE; ++s, p += SECTORSIZE) {
+   456eb:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+      if (ata_wait_drq() < 0) {
+   456f2:	b8 00 00 00 00       	mov    $0x0,%eax
+   456f7:	e8 67 fe ff ff       	call   45563 <ata_wait_drq>
+   456fc:	85 c0                	test   %eax,%eax
+   456fe:	78 3b                	js     4573b <ata_write_pages+0x9e>
+   45700:	48 89 de             	mov    %rbx,%rsi
+   45703:	b9 80 00 00 00       	mov    $0x80,%ecx
+   45708:	44 89 e2             	mov    %r12d,%edx
+   4570b:	fc                   	cld
+   4570c:	f3 6f                	rep outsl %ds:(%rsi),(%dx)
+    for (unsigned s = 0; s < ATA_SECTS_PER_PAGE; ++s, p += SECTORSIZE) {
+   4570e:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+   45715:	4c 39 eb             	cmp    %r13,%rbx
+   45718:	75 d8                	jne    456f2 <ata_write_pages+0x55>
+   4571a:	eb c3                	jmp    456df <ata_write_pages+0x42>
+    asm volatile("inb %w1, %0" : "=a" (data) : "d" (port));
+   4571c:	ba f6 03 00 00       	mov    $0x3f6,%edx
+   45721:	ec                   	in     (%dx),%al
+   45722:	ec                   	in     (%dx),%al
+   45723:	ec                   	in     (%dx),%al
+   45724:	ec                   	in     (%dx),%al
+      outsl(ATA_DATA, p, SECTORSIZE / 4);
+    }
+  }
+  // the last sector is on its way to the disk once BSY clears
+  ata_delay();
+  return ata_wait() < 0 ? -1 : 0;
+   45725:	b8 00 00 00 00       	mov    $0x0,%eax
+   4572a:	e8 1a fe ff ff       	call   45549 <ata_wait>
+   4572f:	c1 f8 1f             	sar    $0x1f,%eax
+   45732:	eb 0c                	jmp    45740 <ata_write_pages+0xa3>
+    return -1;
+   45734:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   45739:	eb 05                	jmp    45740 <ata_write_pages+0xa3>
+        return -1;
+   4573b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+   45740:	48 83 c4 08          	add    $0x8,%rsp
+   45744:	5b                   	pop    %rbx
+   45745:	41 5c                	pop    %r12
+   45747:	41 5d                	pop    %r13
+   45749:	41 5e                	pop    %r14
+   4574b:	41 5f                	pop    %r15
+   4574d:	5d                   	pop    %rbp
+   4574e:	c3                   	ret
+
+000000000004574f <swap_unclaim>:
+  swap_flush(v->p, v->va);
+  kfree((void *)(pe & PTE_PAMASK));
+  ++swap_stats.out;
+}
+
+static void swap_unclaim(uint32_t claimed) {
+   4574f:	55                   	push   %rbp
+   45750:	48 89 e5             	mov    %rsp,%rbp
+   45753:	41 56                	push   %r14
+   45755:	41 55                	push   %r13
+   45757:	41 54                	push   %r12
+   45759:	53                   	push   %rbx
+   4575a:	41 89 fd             	mov    %edi,%r13d
+  for (pid_t pid = 1; pid < NPROC; ++pid) {
+   4575d:	41 bc 10 f2 04 00    	mov    $0x4f210,%r12d
+   45763:	bb 01 00 00 00       	mov    $0x1,%ebx
+    if (claimed & (1U << pid)) {
+   45768:	41 be 01 00 00 00    	mov    $0x1,%r14d
+   4576e:	eb 0f                	jmp    4577f <swap_unclaim+0x30>
+  for (pid_t pid = 1; pid < NPROC; ++pid) {
+   45770:	83 c3 01             	add    $0x1,%ebx
+   45773:	49 81 c4 d0 01 00 00 	add    $0x1d0,%r12
+   4577a:	83 fb 10             	cmp    $0x10,%ebx
+   4577d:	74 16                	je     45795 <swap_unclaim+0x46>
+    if (claimed & (1U << pid)) {
+   4577f:	44 89 f0             	mov    %r14d,%eax
+   45782:	89 d9                	mov    %ebx,%ecx
+   45784:	d3 e0                	shl    %cl,%eax
+   45786:	44 85 e8             	test   %r13d,%eax
+   45789:	74 e5                	je     45770 <swap_unclaim+0x21>
+      proc_unclaim(&ptable[pid]);
+   4578b:	4c 89 e7             	mov    %r12,%rdi
+   4578e:	e8 c9 c0 ff ff       	call   4185c <proc_unclaim>
+   45793:	eb db                	jmp    45770 <swap_unclaim+0x21>
+    }
+  }
+}
+   45795:	5b                   	pop    %rbx
+   45796:	41 5c                	pop    %r12
+   45798:	41 5d                	pop    %r13
+   4579a:	41 5e                	pop    %r14
+   4579c:	5d                   	pop    %rbp
+   4579d:	c3                   	ret
+
+000000000004579e <swap_evict>:
+static void swap_evict(swap_victim *v, uint32_t slot) {
+   4579e:	55                   	push   %rbp
+   4579f:	48 89 e5             	mov    %rsp,%rbp
+   457a2:	53                   	push   %rbx
+   457a3:	48 83 ec 08          	sub    $0x8,%rsp
+  x86_64_pageentry_t pe = *v->pep;
+   457a7:	48 8b 47 08          	mov    0x8(%rdi),%rax
+   457ab:	48 8b 18             	mov    (%rax),%rbx
+  *v->pep = ((uintptr_t)slot << PAGEOFFBITS) | PTE_SWAP | (pe & SWAP_PERM);
+   457ae:	89 f6                	mov    %esi,%esi
+   457b0:	48 c1 e6 0c          	shl    $0xc,%rsi
+   457b4:	48 89 da             	mov    %rbx,%rdx
+   457b7:	81 e2 06 02 00 00    	and    $0x206,%edx
+   457bd:	48 09 d6             	or     %rdx,%rsi
+   457c0:	48 81 ce 00 08 00 00 	or     $0x800,%rsi
+   457c7:	48 89 30             	mov    %rsi,(%rax)
+  swap_flush(v->p, v->va);
+   457ca:	48 8b 4f 10          	mov    0x10(%rdi),%rcx
+   457ce:	48 8b 3f             	mov    (%rdi),%rdi
+    asm volatile("movq %%cr3, %0" : "=r" (x));
+   457d1:	0f 20 d8             	mov    %cr3,%rax
+  if ((rdcr3() & PTE_PAMASK) == (uintptr_t)p->pagetable) {
+   457d4:	48 ba 00 f0 ff ff ff 	movabs $0xffffffffff000,%rdx
+   457db:	ff 0f 00 
+   457de:	48 21 d0             	and    %rdx,%rax
+   457e1:	48 39 07             	cmp    %rax,(%rdi)
+   457e4:	75 26                	jne    4580c <swap_evict+0x6e>
+    asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+   457e6:	0f 01 39             	invlpg (%rcx)
+  kfree((void *)(pe & PTE_PAMASK));
+   457e9:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   457f0:	ff 0f 00 
+   457f3:	48 21 c3             	and    %rax,%rbx
+   457f6:	48 89 df             	mov    %rbx,%rdi
+   457f9:	e8 44 bb ff ff       	call   41342 <kfree>
+  ++swap_stats.out;
+   457fe:	48 83 05 1a 09 01 00 	addq   $0x1,0x1091a(%rip)        # 56120 <swap_stats>
+   45805:	01 
+}
+   45806:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+   4580a:	c9                   	leave
+   4580b:	c3                   	ret
+    proc_tlb_invalidate(p);
+   4580c:	e8 00 c0 ff ff       	call   41811 <proc_tlb_invalidate>
+   45811:	eb d6                	jmp    457e9 <swap_evict+0x4b>
+
+0000000000045813 <swap_evict_batch>:
+
+// swap_evict_batch()
+//    Evict one batch of victims. Returns the number of pages freed, or 0
+//    if there were no victims or the swap area is full.
+static int swap_evict_batch() {
+   45813:	55                   	push   %rbp
+   45814:	48 89 e5             	mov    %rsp,%rbp
+   45817:	41 57                	push   %r15
+   45819:	41 56                	push   %r14
+   4581b:	41 55                	push   %r13
+   4581d:	41 54                	push   %r12
+   4581f:	53                   	push   %rbx
+   45820:	48 81 ec 28 01 00 00 	sub    $0x128,%rsp
+   45827:	bb 21 00 00 00       	mov    $0x21,%ebx
+  *claimed = 0;
+   4582c:	c7 85 b8 fe ff ff 00 	movl   $0x0,-0x148(%rbp)
+   45833:	00 00 00 
+  int n = 0;
+   45836:	c7 85 bc fe ff ff 00 	movl   $0x0,-0x144(%rbp)
+   4583d:	00 00 00 
+      for (vmiter_va_add(&it, swap_va); vmiter_va(&it) < VA_LOWEND;
+   45840:	49 bf ff ff ff ff ff 	movabs $0x7fffffffffff,%r15
+   45847:	7f 00 00 
+    swap_va = PROC_START_ADDR;
+   4584a:	49 be 00 00 00 00 80 	movabs $0x8000000000,%r14
+   45851:	00 00 00 
+   45854:	e9 d4 01 00 00       	jmp    45a2d <swap_evict_batch+0x21a>
+        if (!vmiter_present(&it) || it.level != 0 ||
+   45859:	48 3b 05 e8 08 01 00 	cmp    0x108e8(%rip),%rax        # 56148 <pin_end>
+   45860:	72 28                	jb     4588a <swap_evict_batch+0x77>
+        if (n == SWAP_BATCH) {
+   45862:	83 bd c0 fe ff ff 20 	cmpl   $0x20,-0x140(%rbp)
+   45869:	0f 84 d9 00 00 00    	je     45948 <swap_evict_batch+0x135>
+        if (*it.pep & PTE_A) {
+   4586f:	4c 8b a5 d8 fe ff ff 	mov    -0x128(%rbp),%r12
+   45876:	49 8b 04 24          	mov    (%r12),%rax
+   4587a:	a8 20                	test   $0x20,%al
+   4587c:	0f 84 db 00 00 00    	je     4595d <swap_evict_batch+0x14a>
+          *it.pep &= ~PTE_A;
+   45882:	48 83 e0 df          	and    $0xffffffffffffffdf,%rax
+   45886:	49 89 04 24          	mov    %rax,(%r12)
+           vmiter_next(&it)) {
+   4588a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   45891:	e8 3f e1 ff ff       	call   439d5 <vmiter_next>
+      for (vmiter_va_add(&it, swap_va); vmiter_va(&it) < VA_LOWEND;
+   45896:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   4589d:	e8 21 de ff ff       	call   436c3 <vmiter_va>
+   458a2:	49 39 c7             	cmp    %rax,%r15
+   458a5:	0f 82 18 01 00 00    	jb     459c3 <swap_evict_batch+0x1b0>
+        if (!vmiter_present(&it) || it.level != 0 ||
+   458ab:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   458b2:	e8 11 de ff ff       	call   436c8 <vmiter_present>
+   458b7:	41 89 c4             	mov    %eax,%r12d
+   458ba:	84 c0                	test   %al,%al
+   458bc:	74 cc                	je     4588a <swap_evict_batch+0x77>
+   458be:	83 bd e0 fe ff ff 00 	cmpl   $0x0,-0x120(%rbp)
+   458c5:	75 c3                	jne    4588a <swap_evict_batch+0x77>
+            !swap_evictable(p, vmiter_va(&it), *it.pep)) {
+   458c7:	48 8b 85 d8 fe ff ff 	mov    -0x128(%rbp),%rax
+   458ce:	48 8b 00             	mov    (%rax),%rax
+   458d1:	48 89 85 c8 fe ff ff 	mov    %rax,-0x138(%rbp)
+   458d8:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   458df:	e8 df dd ff ff       	call   436c3 <vmiter_va>
+  pageinfo *pi = &pages[pa / PAGESIZE];
+   458e4:	48 8b 0d 15 97 00 00 	mov    0x9715(%rip),%rcx        # 4f000 <pages>
+  return (pe & PTE_U) && !(pe & PTE_SHARED) && pi->refcount == 1 &&
+   458eb:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+   458f2:	81 e2 04 04 00 00    	and    $0x404,%edx
+         !pi->merged && !(p == pin_proc && va >= pin_start && va < pin_end);
+   458f8:	48 83 fa 04          	cmp    $0x4,%rdx
+   458fc:	75 8c                	jne    4588a <swap_evict_batch+0x77>
+  uintptr_t pa = pe & PTE_PAMASK;
+   458fe:	48 ba 00 f0 ff ff ff 	movabs $0xffffffffff000,%rdx
+   45905:	ff 0f 00 
+   45908:	48 23 95 c8 fe ff ff 	and    -0x138(%rbp),%rdx
+  pageinfo *pi = &pages[pa / PAGESIZE];
+   4590f:	48 c1 ea 08          	shr    $0x8,%rdx
+   45913:	48 01 d1             	add    %rdx,%rcx
+  return (pe & PTE_U) && !(pe & PTE_SHARED) && pi->refcount == 1 &&
+   45916:	80 39 01             	cmpb   $0x1,(%rcx)
+   45919:	0f 85 6b ff ff ff    	jne    4588a <swap_evict_batch+0x77>
+   4591f:	f6 41 02 04          	testb  $0x4,0x2(%rcx)
+   45923:	0f 85 61 ff ff ff    	jne    4588a <swap_evict_batch+0x77>
+         !pi->merged && !(p == pin_proc && va >= pin_start && va < pin_end);
+   45929:	4c 3b 2d 28 08 01 00 	cmp    0x10828(%rip),%r13        # 56158 <pin_proc>
+   45930:	0f 85 2c ff ff ff    	jne    45862 <swap_evict_batch+0x4f>
+   45936:	48 3b 05 13 08 01 00 	cmp    0x10813(%rip),%rax        # 56150 <pin_start>
+   4593d:	0f 82 1f ff ff ff    	jb     45862 <swap_evict_batch+0x4f>
+   45943:	e9 11 ff ff ff       	jmp    45859 <swap_evict_batch+0x46>
+          swap_va = vmiter_va(&it);
+   45948:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   4594f:	e8 6f dd ff ff       	call   436c3 <vmiter_va>
+   45954:	48 89 05 15 27 00 00 	mov    %rax,0x2715(%rip)        # 48070 <swap_va>
+          break;
+   4595b:	eb 6c                	jmp    459c9 <swap_evict_batch+0x1b6>
+          v[n++] = (swap_victim){p, it.pep, vmiter_va(&it)};
+   4595d:	8b 85 c0 fe ff ff    	mov    -0x140(%rbp),%eax
+   45963:	8d 70 01             	lea    0x1(%rax),%esi
+   45966:	89 b5 c8 fe ff ff    	mov    %esi,-0x138(%rbp)
+   4596c:	48 98                	cltq
+   4596e:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   45972:	48 89 85 b0 fe ff ff 	mov    %rax,-0x150(%rbp)
+   45979:	48 8d 0c c5 20 5e 05 	lea    0x55e20(,%rax,8),%rcx
+   45980:	00 
+   45981:	48 89 8d c0 fe ff ff 	mov    %rcx,-0x140(%rbp)
+   45988:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   4598f:	e8 2f dd ff ff       	call   436c3 <vmiter_va>
+   45994:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+   4599b:	4c 89 2c f5 20 5e 05 	mov    %r13,0x55e20(,%rsi,8)
+   459a2:	00 
+   459a3:	48 8b 8d c0 fe ff ff 	mov    -0x140(%rbp),%rcx
+   459aa:	4c 89 61 08          	mov    %r12,0x8(%rcx)
+   459ae:	48 89 41 10          	mov    %rax,0x10(%rcx)
+   459b2:	8b b5 c8 fe ff ff    	mov    -0x138(%rbp),%esi
+   459b8:	89 b5 c0 fe ff ff    	mov    %esi,-0x140(%rbp)
+   459be:	e9 c7 fe ff ff       	jmp    4588a <swap_evict_batch+0x77>
+      bool full = false;
+   459c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+      if (n > first) {
+   459c9:	8b b5 bc fe ff ff    	mov    -0x144(%rbp),%esi
+   459cf:	39 b5 c0 fe ff ff    	cmp    %esi,-0x140(%rbp)
+   459d5:	0f 8e d8 00 00 00    	jle    45ab3 <swap_evict_batch+0x2a0>
+        *claimed |= 1U << swap_pid;
+   459db:	8b 0d 97 26 00 00    	mov    0x2697(%rip),%ecx        # 48078 <swap_pid>
+   459e1:	b8 01 00 00 00       	mov    $0x1,%eax
+   459e6:	d3 e0                	shl    %cl,%eax
+   459e8:	09 85 b8 fe ff ff    	or     %eax,-0x148(%rbp)
+      if (full) {
+   459ee:	45 84 e4             	test   %r12b,%r12b
+   459f1:	0f 85 c9 00 00 00    	jne    45ac0 <swap_evict_batch+0x2ad>
+   459f7:	8b 85 c0 fe ff ff    	mov    -0x140(%rbp),%eax
+   459fd:	89 85 bc fe ff ff    	mov    %eax,-0x144(%rbp)
+    swap_pid = swap_pid + 1 < NPROC ? swap_pid + 1 : 1;
+   45a03:	8b 15 6f 26 00 00    	mov    0x266f(%rip),%edx        # 48078 <swap_pid>
+   45a09:	8d 42 01             	lea    0x1(%rdx),%eax
+   45a0c:	83 fa 0f             	cmp    $0xf,%edx
+   45a0f:	ba 01 00 00 00       	mov    $0x1,%edx
+   45a14:	0f 4d c2             	cmovge %edx,%eax
+   45a17:	89 05 5b 26 00 00    	mov    %eax,0x265b(%rip)        # 48078 <swap_pid>
+    swap_va = PROC_START_ADDR;
+   45a1d:	4c 89 35 4c 26 00 00 	mov    %r14,0x264c(%rip)        # 48070 <swap_va>
+  for (int nvisit = 0; nvisit <= 2 * NPROC; ++nvisit) {
+   45a24:	83 eb 01             	sub    $0x1,%ebx
+   45a27:	0f 84 9f 00 00 00    	je     45acc <swap_evict_batch+0x2b9>
+    proc *p = &ptable[swap_pid];
+   45a2d:	44 8b 25 44 26 00 00 	mov    0x2644(%rip),%r12d        # 48078 <swap_pid>
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+   45a34:	49 63 c4             	movslq %r12d,%rax
+   45a37:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   45a3e:	83 b8 4c f0 04 00 00 	cmpl   $0x0,0x4f04c(%rax)
+   45a45:	74 bc                	je     45a03 <swap_evict_batch+0x1f0>
+   45a47:	49 63 c4             	movslq %r12d,%rax
+   45a4a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   45a51:	48 83 b8 40 f0 04 00 	cmpq   $0x0,0x4f040(%rax)
+   45a58:	00 
+   45a59:	74 a8                	je     45a03 <swap_evict_batch+0x1f0>
+    proc *p = &ptable[swap_pid];
+   45a5b:	49 89 c5             	mov    %rax,%r13
+   45a5e:	49 81 c5 40 f0 04 00 	add    $0x4f040,%r13
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+   45a65:	4c 89 ef             	mov    %r13,%rdi
+   45a68:	e8 b0 bd ff ff       	call   4181d <proc_claim>
+   45a6d:	84 c0                	test   %al,%al
+   45a6f:	74 92                	je     45a03 <swap_evict_batch+0x1f0>
+      vmiter_t it = vmiter_init(p->pagetable);
+   45a71:	4d 63 e4             	movslq %r12d,%r12
+   45a74:	4d 69 e4 d0 01 00 00 	imul   $0x1d0,%r12,%r12
+   45a7b:	49 8b b4 24 40 f0 04 	mov    0x4f040(%r12),%rsi
+   45a82:	00 
+   45a83:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   45a8a:	e8 f2 dc ff ff       	call   43781 <vmiter_init>
+      for (vmiter_va_add(&it, swap_va); vmiter_va(&it) < VA_LOWEND;
+   45a8f:	48 8b 35 da 25 00 00 	mov    0x25da(%rip),%rsi        # 48070 <swap_va>
+   45a96:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+   45a9d:	e8 59 df ff ff       	call   439fb <vmiter_va_add>
+   45aa2:	8b 85 bc fe ff ff    	mov    -0x144(%rbp),%eax
+   45aa8:	89 85 c0 fe ff ff    	mov    %eax,-0x140(%rbp)
+   45aae:	e9 e3 fd ff ff       	jmp    45896 <swap_evict_batch+0x83>
+        proc_unclaim(p);
+   45ab3:	4c 89 ef             	mov    %r13,%rdi
+   45ab6:	e8 a1 bd ff ff       	call   4185c <proc_unclaim>
+   45abb:	e9 2e ff ff ff       	jmp    459ee <swap_evict_batch+0x1db>
+        return n;
+   45ac0:	8b 85 c0 fe ff ff    	mov    -0x140(%rbp),%eax
+   45ac6:	89 85 bc fe ff ff    	mov    %eax,-0x144(%rbp)
+  uint32_t claimed;
+  int nv = swap_collect(v, &claimed);
+
+  // clean pages with a valid slot go without a write
+  int freed = 0, ndirty = 0;
+  for (int i = 0; i < nv; ++i) {
+   45acc:	8b 85 bc fe ff ff    	mov    -0x144(%rbp),%eax
+   45ad2:	85 c0                	test   %eax,%eax
+   45ad4:	0f 8e 21 02 00 00    	jle    45cfb <swap_evict_batch+0x4e8>
+   45ada:	41 be 20 5e 05 00    	mov    $0x55e20,%r14d
+   45ae0:	48 98                	cltq
+   45ae2:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   45ae6:	4c 8d 2c c5 20 5e 05 	lea    0x55e20(,%rax,8),%r13
+   45aed:	00 
+   45aee:	4c 89 f3             	mov    %r14,%rbx
+  int freed = 0, ndirty = 0;
+   45af1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+   45af7:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+   45afd:	eb 38                	jmp    45b37 <swap_evict_batch+0x324>
+      ++swap_ref[slot];
+      swap_evict(&v[i], slot);
+      ++swap_stats.clean;
+      ++freed;
+    } else {
+      v[ndirty++] = v[i];
+   45aff:	49 63 c4             	movslq %r12d,%rax
+   45b02:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+   45b06:	48 8d 04 d5 20 5e 05 	lea    0x55e20(,%rdx,8),%rax
+   45b0d:	00 
+   45b0e:	48 8b 0f             	mov    (%rdi),%rcx
+   45b11:	48 89 0c d5 20 5e 05 	mov    %rcx,0x55e20(,%rdx,8)
+   45b18:	00 
+   45b19:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+   45b1d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+   45b21:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+   45b25:	48 89 50 10          	mov    %rdx,0x10(%rax)
+   45b29:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+  for (int i = 0; i < nv; ++i) {
+   45b2e:	48 83 c3 18          	add    $0x18,%rbx
+   45b32:	4c 39 eb             	cmp    %r13,%rbx
+   45b35:	74 4a                	je     45b81 <swap_evict_batch+0x36e>
+    x86_64_pageentry_t pe = *v[i].pep;
+   45b37:	48 89 df             	mov    %rbx,%rdi
+   45b3a:	48 8b 43 08          	mov    0x8(%rbx),%rax
+   45b3e:	48 8b 10             	mov    (%rax),%rdx
+    uint32_t slot = pages[(pe & PTE_PAMASK) / PAGESIZE].swapslot;
+   45b41:	48 b8 00 f0 ff ff ff 	movabs $0xffffffffff000,%rax
+   45b48:	ff 0f 00 
+   45b4b:	48 21 d0             	and    %rdx,%rax
+   45b4e:	48 c1 e8 08          	shr    $0x8,%rax
+   45b52:	48 03 05 a7 94 00 00 	add    0x94a7(%rip),%rax        # 4f000 <pages>
+   45b59:	8b 70 04             	mov    0x4(%rax),%esi
+    if (slot && !(pe & PTE_D)) {
+   45b5c:	85 f6                	test   %esi,%esi
+   45b5e:	74 9f                	je     45aff <swap_evict_batch+0x2ec>
+   45b60:	f6 c2 40             	test   $0x40,%dl
+   45b63:	75 9a                	jne    45aff <swap_evict_batch+0x2ec>
+      ++swap_ref[slot];
+   45b65:	89 f0                	mov    %esi,%eax
+   45b67:	80 80 60 61 05 00 01 	addb   $0x1,0x56160(%rax)
+      swap_evict(&v[i], slot);
+   45b6e:	e8 2b fc ff ff       	call   4579e <swap_evict>
+      ++swap_stats.clean;
+   45b73:	48 83 05 ad 05 01 00 	addq   $0x1,0x105ad(%rip)        # 56128 <swap_stats+0x8>
+   45b7a:	01 
+      ++freed;
+   45b7b:	41 83 c7 01          	add    $0x1,%r15d
+   45b7f:	eb ad                	jmp    45b2e <swap_evict_batch+0x31b>
+    }
+  }
+
+  // dirty pages go to consecutive slots in one write
+  uint32_t first;
+  uint32_t nslots = ndirty ? swap_alloc_run(ndirty, &first) : 0;
+   45b81:	45 85 e4             	test   %r12d,%r12d
+   45b84:	0f 84 33 01 00 00    	je     45cbd <swap_evict_batch+0x4aa>
+  uint32_t s = swap_hint;
+   45b8a:	8b 1d ec 24 00 00    	mov    0x24ec(%rip),%ebx        # 4807c <swap_hint>
+   45b90:	b8 ff 1f 00 00       	mov    $0x1fff,%eax
+    s = s + 1 < SWAP_NSLOTS ? s + 1 : 1;
+   45b95:	b9 01 00 00 00       	mov    $0x1,%ecx
+  for (uint32_t i = 1; i < SWAP_NSLOTS && swap_ref[s]; ++i) {
+   45b9a:	89 da                	mov    %ebx,%edx
+   45b9c:	80 ba 60 61 05 00 00 	cmpb   $0x0,0x56160(%rdx)
+   45ba3:	74 20                	je     45bc5 <swap_evict_batch+0x3b2>
+    s = s + 1 < SWAP_NSLOTS ? s + 1 : 1;
+   45ba5:	83 c3 01             	add    $0x1,%ebx
+   45ba8:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+   45bae:	0f 43 d9             	cmovae %ecx,%ebx
+  for (uint32_t i = 1; i < SWAP_NSLOTS && swap_ref[s]; ++i) {
+   45bb1:	83 e8 01             	sub    $0x1,%eax
+   45bb4:	75 e4                	jne    45b9a <swap_evict_batch+0x387>
+  if (swap_ref[s]) {
+   45bb6:	89 d8                	mov    %ebx,%eax
+   45bb8:	80 b8 60 61 05 00 00 	cmpb   $0x0,0x56160(%rax)
+   45bbf:	0f 85 f8 00 00 00    	jne    45cbd <swap_evict_batch+0x4aa>
+  uint32_t nslots = ndirty ? swap_alloc_run(ndirty, &first) : 0;
+   45bc5:	44 89 e1             	mov    %r12d,%ecx
+  while (len < n && s + len < SWAP_NSLOTS && !swap_ref[s + len]) {
+   45bc8:	41 83 fc 01          	cmp    $0x1,%r12d
+   45bcc:	0f 86 46 01 00 00    	jbe    45d18 <swap_evict_batch+0x505>
+   45bd2:	8d 43 01             	lea    0x1(%rbx),%eax
+   45bd5:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+   45bda:	0f 87 23 01 00 00    	ja     45d03 <swap_evict_batch+0x4f0>
+   45be0:	89 c0                	mov    %eax,%eax
+   45be2:	48 05 60 61 05 00    	add    $0x56160,%rax
+   45be8:	ba 00 20 00 00       	mov    $0x2000,%edx
+   45bed:	29 da                	sub    %ebx,%edx
+  uint32_t len = 1;
+   45bef:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  while (len < n && s + len < SWAP_NSLOTS && !swap_ref[s + len]) {
+   45bf5:	80 38 00             	cmpb   $0x0,(%rax)
+   45bf8:	75 2a                	jne    45c24 <swap_evict_batch+0x411>
+    ++len;
+   45bfa:	41 83 c4 01          	add    $0x1,%r12d
+  while (len < n && s + len < SWAP_NSLOTS && !swap_ref[s + len]) {
+   45bfe:	44 39 e1             	cmp    %r12d,%ecx
+   45c01:	74 21                	je     45c24 <swap_evict_batch+0x411>
+   45c03:	48 83 c0 01          	add    $0x1,%rax
+   45c07:	41 39 d4             	cmp    %edx,%r12d
+   45c0a:	75 e9                	jne    45bf5 <swap_evict_batch+0x3e2>
+  swap_hint = s + len < SWAP_NSLOTS ? s + len : 1;
+   45c0c:	8d 04 13             	lea    (%rbx,%rdx,1),%eax
+   45c0f:	41 89 d4             	mov    %edx,%r12d
+   45c12:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+   45c17:	77 16                	ja     45c2f <swap_evict_batch+0x41c>
+   45c19:	89 05 5d 24 00 00    	mov    %eax,0x245d(%rip)        # 4807c <swap_hint>
+   45c1f:	41 89 d4             	mov    %edx,%r12d
+   45c22:	eb 1b                	jmp    45c3f <swap_evict_batch+0x42c>
+   45c24:	42 8d 04 23          	lea    (%rbx,%r12,1),%eax
+   45c28:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+   45c2d:	76 05                	jbe    45c34 <swap_evict_batch+0x421>
+   45c2f:	b8 01 00 00 00       	mov    $0x1,%eax
+   45c34:	89 05 42 24 00 00    	mov    %eax,0x2442(%rip)        # 4807c <swap_hint>
+  if (nslots) {
+   45c3a:	45 85 e4             	test   %r12d,%r12d
+   45c3d:	74 7e                	je     45cbd <swap_evict_batch+0x4aa>
+   45c3f:	ba 28 5e 05 00       	mov    $0x55e28,%edx
+   45c44:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+   45c4b:	44 89 e1             	mov    %r12d,%ecx
+   45c4e:	48 8d 3c c8          	lea    (%rax,%rcx,8),%rdi
+    void *srcs[SWAP_BATCH];
+    for (uint32_t i = 0; i < nslots; ++i) {
+      srcs[i] = (void *)(*v[i].pep & PTE_PAMASK);
+   45c52:	48 be 00 f0 ff ff ff 	movabs $0xffffffffff000,%rsi
+   45c59:	ff 0f 00 
+   45c5c:	48 8b 0a             	mov    (%rdx),%rcx
+   45c5f:	49 89 f0             	mov    %rsi,%r8
+   45c62:	4c 23 01             	and    (%rcx),%r8
+   45c65:	4c 89 00             	mov    %r8,(%rax)
+    for (uint32_t i = 0; i < nslots; ++i) {
+   45c68:	48 83 c2 18          	add    $0x18,%rdx
+   45c6c:	48 83 c0 08          	add    $0x8,%rax
+   45c70:	48 39 c7             	cmp    %rax,%rdi
+   45c73:	75 e7                	jne    45c5c <swap_evict_batch+0x449>
+  return SWAP_START_SECTOR + slot * SWAP_SECTS_PER_PAGE;
+   45c75:	8d 3c dd 00 10 00 00 	lea    0x1000(,%rbx,8),%edi
+    }
+    if (ata_write_pages(swap_sector(first), srcs, nslots) < 0) {
+   45c7c:	44 89 e2             	mov    %r12d,%edx
+   45c7f:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+   45c86:	e8 12 fa ff ff       	call   4569d <ata_write_pages>
+   45c8b:	85 c0                	test   %eax,%eax
+   45c8d:	78 4e                	js     45cdd <swap_evict_batch+0x4ca>
+      log_printf("swap: write error at slot %u\n", first);
+      swap_unclaim(claimed);
+      return freed;
+    }
+    ++swap_stats.writes;
+   45c8f:	48 83 05 99 04 01 00 	addq   $0x1,0x10499(%rip)        # 56130 <swap_stats+0x10>
+   45c96:	01 
+    for (uint32_t i = 0; i < nslots; ++i) {
+   45c97:	46 8d 2c 23          	lea    (%rbx,%r12,1),%r13d
+      swap_ref[first + i] = 1;
+   45c9b:	89 d8                	mov    %ebx,%eax
+   45c9d:	c6 80 60 61 05 00 01 	movb   $0x1,0x56160(%rax)
+      swap_evict(&v[i], first + i);
+   45ca4:	89 de                	mov    %ebx,%esi
+   45ca6:	4c 89 f7             	mov    %r14,%rdi
+   45ca9:	e8 f0 fa ff ff       	call   4579e <swap_evict>
+    for (uint32_t i = 0; i < nslots; ++i) {
+   45cae:	83 c3 01             	add    $0x1,%ebx
+   45cb1:	49 83 c6 18          	add    $0x18,%r14
+   45cb5:	41 39 dd             	cmp    %ebx,%r13d
+   45cb8:	75 e1                	jne    45c9b <swap_evict_batch+0x488>
+      ++freed;
+   45cba:	45 01 e7             	add    %r12d,%r15d
+    }
+  }
+  swap_unclaim(claimed);
+   45cbd:	8b bd b8 fe ff ff    	mov    -0x148(%rbp),%edi
+   45cc3:	e8 87 fa ff ff       	call   4574f <swap_unclaim>
+  return freed;
+}
+   45cc8:	44 89 f8             	mov    %r15d,%eax
+   45ccb:	48 81 c4 28 01 00 00 	add    $0x128,%rsp
+   45cd2:	5b                   	pop    %rbx
+   45cd3:	41 5c                	pop    %r12
+   45cd5:	41 5d                	pop    %r13
+   45cd7:	41 5e                	pop    %r14
+   45cd9:	41 5f                	pop    %r15
+   45cdb:	5d                   	pop    %rbp
+   45cdc:	c3                   	ret
+      log_printf("swap: write error at slot %u\n", first);
+   45cdd:	89 de                	mov    %ebx,%esi
+   45cdf:	bf 1a 76 04 00       	mov    $0x4761a,%edi
+   45ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+   45ce9:	e8 7e e2 ff ff       	call   43f6c <log_printf>
+      swap_unclaim(claimed);
+   45cee:	8b bd b8 fe ff ff    	mov    -0x148(%rbp),%edi
+   45cf4:	e8 56 fa ff ff       	call   4574f <swap_unclaim>
+      return freed;
+   45cf9:	eb cd                	jmp    45cc8 <swap_evict_batch+0x4b5>
+  int freed = 0, ndirty = 0;
+   45cfb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+   45d01:	eb ba                	jmp    45cbd <swap_evict_batch+0x4aa>
+  swap_hint = s + len < SWAP_NSLOTS ? s + len : 1;
+   45d03:	c7 05 6f 23 00 00 01 	movl   $0x1,0x236f(%rip)        # 4807c <swap_hint>
+   45d0a:	00 00 00 
+  uint32_t len = 1;
+   45d0d:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+   45d13:	e9 27 ff ff ff       	jmp    45c3f <swap_evict_batch+0x42c>
+   45d18:	ba 01 00 00 00       	mov    $0x1,%edx
+   45d1d:	e9 ea fe ff ff       	jmp    45c0c <swap_evict_batch+0x3f9>
+
+0000000000045d22 <swap_init>:
+void swap_init() { ata_init(); }
+   45d22:	55                   	push   %rbp
+   45d23:	48 89 e5             	mov    %rsp,%rbp
+   45d26:	b8 00 00 00 00       	mov    $0x0,%eax
+   45d2b:	e8 dc f8 ff ff       	call   4560c <ata_init>
+   45d30:	5d                   	pop    %rbp
+   45d31:	c3                   	ret
+
+0000000000045d32 <swap_reclaim>:
+
+int swap_reclaim(int n) {
+   45d32:	55                   	push   %rbp
+   45d33:	48 89 e5             	mov    %rsp,%rbp
+   45d36:	41 54                	push   %r12
+   45d38:	53                   	push   %rbx
+   45d39:	41 89 fc             	mov    %edi,%r12d
+  int freed = 0, k;
+   45d3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while (freed < n && (k = swap_evict_batch()) > 0) {
+   45d41:	85 ff                	test   %edi,%edi
+   45d43:	7e 15                	jle    45d5a <swap_reclaim+0x28>
+   45d45:	b8 00 00 00 00       	mov    $0x0,%eax
+   45d4a:	e8 c4 fa ff ff       	call   45813 <swap_evict_batch>
+   45d4f:	85 c0                	test   %eax,%eax
+   45d51:	7e 07                	jle    45d5a <swap_reclaim+0x28>
+    freed += k;
+   45d53:	01 c3                	add    %eax,%ebx
+  while (freed < n && (k = swap_evict_batch()) > 0) {
+   45d55:	41 39 dc             	cmp    %ebx,%r12d
+   45d58:	7f eb                	jg     45d45 <swap_reclaim+0x13>
+  }
+  return freed;
+}
+   45d5a:	89 d8                	mov    %ebx,%eax
+   45d5c:	5b                   	pop    %rbx
+   45d5d:	41 5c                	pop    %r12
+   45d5f:	5d                   	pop    %rbp
+   45d60:	c3                   	ret
+
+0000000000045d61 <swap_balance>:
+
+void swap_balance() {
+   45d61:	55                   	push   %rbp
+   45d62:	48 89 e5             	mov    %rsp,%rbp
+  static bool reclaiming;
+  size_t nfree = kalloc_nfree();
+   45d65:	b8 00 00 00 00       	mov    $0x0,%eax
+   45d6a:	e8 88 b8 ff ff       	call   415f7 <kalloc_nfree>
+  if (nfree < SWAP_LOW_WATER) {
+   45d6f:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+   45d75:	77 17                	ja     45d8e <swap_balance+0x2d>
+    reclaiming = true;
+   45d77:	c6 05 82 00 01 00 01 	movb   $0x1,0x10082(%rip)        # 55e00 <reclaiming.0>
+  }
+  if (reclaiming &&
+      (nfree >= SWAP_HIGH_WATER || swap_reclaim(SWAP_BATCH) == 0)) {
+   45d7e:	bf 20 00 00 00       	mov    $0x20,%edi
+   45d83:	e8 aa ff ff ff       	call   45d32 <swap_reclaim>
+   45d88:	85 c0                	test   %eax,%eax
+   45d8a:	75 0b                	jne    45d97 <swap_balance+0x36>
+   45d8c:	eb 13                	jmp    45da1 <swap_balance+0x40>
+  if (reclaiming &&
+   45d8e:	80 3d 6b 00 01 00 00 	cmpb   $0x0,0x1006b(%rip)        # 55e00 <reclaiming.0>
+   45d95:	75 02                	jne    45d99 <swap_balance+0x38>
+    reclaiming = false;
+  }
+}
+   45d97:	5d                   	pop    %rbp
+   45d98:	c3                   	ret
+  if (reclaiming &&
+   45d99:	48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+   45d9f:	76 dd                	jbe    45d7e <swap_balance+0x1d>
+    reclaiming = false;
+   45da1:	c6 05 58 00 01 00 00 	movb   $0x0,0x10058(%rip)        # 55e00 <reclaiming.0>
+}
+   45da8:	eb ed                	jmp    45d97 <swap_balance+0x36>
+
+0000000000045daa <swap_in>:
+
+bool swap_in(proc *p, uintptr_t va, uint64_t err) {
+   45daa:	55                   	push   %rbp
+   45dab:	48 89 e5             	mov    %rsp,%rbp
+   45dae:	41 56                	push   %r14
+   45db0:	41 55                	push   %r13
+   45db2:	41 54                	push   %r12
+   45db4:	53                   	push   %rbx
+   45db5:	48 83 ec 20          	sub    $0x20,%rsp
+   45db9:	48 89 f3             	mov    %rsi,%rbx
+   45dbc:	49 89 d4             	mov    %rdx,%r12
+  vmiter_t it = vmiter_init(p->pagetable);
+   45dbf:	48 8b 37             	mov    (%rdi),%rsi
+   45dc2:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   45dc6:	e8 b6 d9 ff ff       	call   43781 <vmiter_init>
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+   45dcb:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+   45dd2:	48 89 de             	mov    %rbx,%rsi
+   45dd5:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+   45dd9:	e8 1d dc ff ff       	call   439fb <vmiter_va_add>
+  x86_64_pageentry_t pe = *it.pep;
+  if (it.level != 0 || (pe & PTE_P) || !(pe & PTE_SWAP) ||
+      ((err & PFERR_WRITE) && !(pe & (PTE_W | PTE_COW)))) {
+    return false;
+   45dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (it.level != 0 || (pe & PTE_P) || !(pe & PTE_SWAP) ||
+   45de3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+   45de7:	0f 85 aa 00 00 00    	jne    45e97 <swap_in+0xed>
+  x86_64_pageentry_t pe = *it.pep;
+   45ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   45df1:	48 8b 18             	mov    (%rax),%rbx
+  if (it.level != 0 || (pe & PTE_P) || !(pe & PTE_SWAP) ||
+   45df4:	48 89 da             	mov    %rbx,%rdx
+   45df7:	81 e2 01 08 00 00    	and    $0x801,%edx
+    return false;
+   45dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (it.level != 0 || (pe & PTE_P) || !(pe & PTE_SWAP) ||
+   45e02:	48 81 fa 00 08 00 00 	cmp    $0x800,%rdx
+   45e09:	0f 85 88 00 00 00    	jne    45e97 <swap_in+0xed>
+   45e0f:	41 f6 c4 02          	test   $0x2,%r12b
+   45e13:	74 08                	je     45e1d <swap_in+0x73>
+      ((err & PFERR_WRITE) && !(pe & (PTE_W | PTE_COW)))) {
+   45e15:	f7 c3 02 02 00 00    	test   $0x202,%ebx
+   45e1b:	74 7a                	je     45e97 <swap_in+0xed>
+  }
+  uint32_t slot = swap_slot(pe);
+  void *page = proc_page_alloc(false);
+   45e1d:	bf 00 00 00 00       	mov    $0x0,%edi
+   45e22:	e8 4c bc ff ff       	call   41a73 <proc_page_alloc>
+   45e27:	49 89 c4             	mov    %rax,%r12
+  if (!page) {
+    return false;
+   45e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (!page) {
+   45e2f:	4d 85 e4             	test   %r12,%r12
+   45e32:	74 63                	je     45e97 <swap_in+0xed>
+  return (pe & PTE_PAMASK) >> PAGEOFFBITS;
+   45e34:	49 89 dd             	mov    %rbx,%r13
+   45e37:	49 c1 ed 0c          	shr    $0xc,%r13
+  return SWAP_START_SECTOR + slot * SWAP_SECTS_PER_PAGE;
+   45e3b:	42 8d 3c ed 00 10 00 	lea    0x1000(,%r13,8),%edi
+   45e42:	00 
+  }
+  if (ata_read(swap_sector(slot), page, SWAP_SECTS_PER_PAGE) < 0) {
+   45e43:	ba 08 00 00 00       	mov    $0x8,%edx
+   45e48:	4c 89 e6             	mov    %r12,%rsi
+   45e4b:	e8 c8 f7 ff ff       	call   45618 <ata_read>
+   45e50:	85 c0                	test   %eax,%eax
+   45e52:	78 50                	js     45ea4 <swap_in+0xfa>
+    kfree(page);
+    return false;
+  }
+  // the new page is private, so a copy-on-write page becomes writable
+  int perm = (pe & SWAP_PERM) | PTE_P;
+  if (perm & PTE_COW) {
+   45e54:	f6 c7 02             	test   $0x2,%bh
+   45e57:	75 6c                	jne    45ec5 <swap_in+0x11b>
+  int perm = (pe & SWAP_PERM) | PTE_P;
+   45e59:	81 e3 06 02 00 00    	and    $0x206,%ebx
+   45e5f:	83 cb 01             	or     $0x1,%ebx
+    perm = (perm & ~PTE_COW) | PTE_W;
+  }
+  // `proc_page_alloc` may have reclaimed pages, but never this entry's
+  *it.pep = (uintptr_t)page | perm;
+   45e62:	48 63 db             	movslq %ebx,%rbx
+   45e65:	4c 09 e3             	or     %r12,%rbx
+   45e68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+   45e6c:	48 89 18             	mov    %rbx,(%rax)
+  if (swap_ref[slot] == 1) {
+   45e6f:	44 89 e8             	mov    %r13d,%eax
+   45e72:	0f b6 80 60 61 05 00 	movzbl 0x56160(%rax),%eax
+   45e79:	3c 01                	cmp    $0x1,%al
+   45e7b:	74 50                	je     45ecd <swap_in+0x123>
+    // this entry's reference now belongs to the page: while the page
+    // stays clean, evicting it again needs no write
+    pages[(uintptr_t)page / PAGESIZE].swapslot = slot;
+  } else {
+    --swap_ref[slot];
+   45e7d:	45 89 ed             	mov    %r13d,%r13d
+   45e80:	83 e8 01             	sub    $0x1,%eax
+   45e83:	41 88 85 60 61 05 00 	mov    %al,0x56160(%r13)
+  }
+  ++swap_stats.in;
+   45e8a:	48 83 05 a6 02 01 00 	addq   $0x1,0x102a6(%rip)        # 56138 <swap_stats+0x18>
+   45e91:	01 
+  return true;
+   45e92:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+   45e97:	48 83 c4 20          	add    $0x20,%rsp
+   45e9b:	5b                   	pop    %rbx
+   45e9c:	41 5c                	pop    %r12
+   45e9e:	41 5d                	pop    %r13
+   45ea0:	41 5e                	pop    %r14
+   45ea2:	5d                   	pop    %rbp
+   45ea3:	c3                   	ret
+    log_printf("swap: read error at slot %u\n", slot);
+   45ea4:	44 89 ee             	mov    %r13d,%esi
+   45ea7:	bf 38 76 04 00       	mov    $0x47638,%edi
+   45eac:	b8 00 00 00 00       	mov    $0x0,%eax
+   45eb1:	e8 b6 e0 ff ff       	call   43f6c <log_printf>
+    kfree(page);
+   45eb6:	4c 89 e7             	mov    %r12,%rdi
+   45eb9:	e8 84 b4 ff ff       	call   41342 <kfree>
+    return false;
+   45ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+   45ec3:	eb d2                	jmp    45e97 <swap_in+0xed>
+    perm = (perm & ~PTE_COW) | PTE_W;
+   45ec5:	83 e3 04             	and    $0x4,%ebx
+   45ec8:	83 cb 03             	or     $0x3,%ebx
+   45ecb:	eb 95                	jmp    45e62 <swap_in+0xb8>
+    pages[(uintptr_t)page / PAGESIZE].swapslot = slot;
+   45ecd:	49 c1 ec 0c          	shr    $0xc,%r12
+   45ed1:	49 c1 e4 04          	shl    $0x4,%r12
+   45ed5:	4c 03 25 24 91 00 00 	add    0x9124(%rip),%r12        # 4f000 <pages>
+   45edc:	45 89 6c 24 04       	mov    %r13d,0x4(%r12)
+   45ee1:	eb a7                	jmp    45e8a <swap_in+0xe0>
+
+0000000000045ee3 <swap_dup>:
+  return (pe & PTE_PAMASK) >> PAGEOFFBITS;
+   45ee3:	48 c1 ef 0c          	shr    $0xc,%rdi
+
+int swap_dup(x86_64_pageentry_t pe) {
+  uint32_t slot = swap_slot(pe);
+  if (swap_ref[slot] == UINT8_MAX) {
+   45ee7:	89 f8                	mov    %edi,%eax
+   45ee9:	0f b6 80 60 61 05 00 	movzbl 0x56160(%rax),%eax
+   45ef0:	3c ff                	cmp    $0xff,%al
+   45ef2:	74 11                	je     45f05 <swap_dup+0x22>
+    return -1;
+  }
+  ++swap_ref[slot];
+   45ef4:	89 ff                	mov    %edi,%edi
+   45ef6:	83 c0 01             	add    $0x1,%eax
+   45ef9:	88 87 60 61 05 00    	mov    %al,0x56160(%rdi)
+  return 0;
+   45eff:	b8 00 00 00 00       	mov    $0x0,%eax
+   45f04:	c3                   	ret
+    return -1;
+   45f05:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+   45f0a:	c3                   	ret
+
+0000000000045f0b <swap_free>:
+  return (pe & PTE_PAMASK) >> PAGEOFFBITS;
+   45f0b:	48 c1 ef 0c          	shr    $0xc,%rdi
+
+void swap_free(x86_64_pageentry_t pe) { --swap_ref[swap_slot(pe)]; }
+   45f0f:	89 ff                	mov    %edi,%edi
+   45f11:	80 af 60 61 05 00 01 	subb   $0x1,0x56160(%rdi)
+   45f18:	c3                   	ret
+
+0000000000045f19 <swap_forget>:
+
+void swap_forget(uint32_t pn) {
+  --swap_ref[pages[pn].swapslot];
+   45f19:	89 ff                	mov    %edi,%edi
+   45f1b:	48 c1 e7 04          	shl    $0x4,%rdi
+   45f1f:	48 03 3d da 90 00 00 	add    0x90da(%rip),%rdi        # 4f000 <pages>
+   45f26:	8b 47 04             	mov    0x4(%rdi),%eax
+   45f29:	80 a8 60 61 05 00 01 	subb   $0x1,0x56160(%rax)
+  pages[pn].swapslot = 0;
+   45f30:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+}
+   45f37:	c3                   	ret
+
+0000000000045f38 <swap_pin>:
+
+void swap_pin(proc *p, uintptr_t va, size_t len) {
+  pin_proc = p;
+   45f38:	48 89 3d 19 02 01 00 	mov    %rdi,0x10219(%rip)        # 56158 <pin_proc>
+  pin_start = va & ~PAGEOFFMASK;
+   45f3f:	48 89 f0             	mov    %rsi,%rax
+   45f42:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+   45f48:	48 89 05 01 02 01 00 	mov    %rax,0x10201(%rip)        # 56150 <pin_start>
+  pin_end = va + len;
+   45f4f:	48 01 d6             	add    %rdx,%rsi
+   45f52:	48 89 35 ef 01 01 00 	mov    %rsi,0x101ef(%rip)        # 56148 <pin_end>
+}
+   45f59:	c3                   	ret
+
+0000000000045f5a <swap_report>:
+
+void swap_report() {
+  if (swap_stats.out && swap_stats.out >= 2 * swap_stats.reported) {
+   45f5a:	48 8b 35 bf 01 01 00 	mov    0x101bf(%rip),%rsi        # 56120 <swap_stats>
+   45f61:	48 85 f6             	test   %rsi,%rsi
+   45f64:	74 0f                	je     45f75 <swap_report+0x1b>
+   45f66:	48 8b 05 d3 01 01 00 	mov    0x101d3(%rip),%rax        # 56140 <swap_stats+0x20>
+   45f6d:	48 01 c0             	add    %rax,%rax
+   45f70:	48 39 c6             	cmp    %rax,%rsi
+   45f73:	73 01                	jae    45f76 <swap_report+0x1c>
+   45f75:	c3                   	ret
+void swap_report() {
+   45f76:	55                   	push   %rbp
+   45f77:	48 89 e5             	mov    %rsp,%rbp
+    log_printf("swap %lu out %lu clean %lu writes %lu in\n", swap_stats.out,
+   45f7a:	4c 8b 05 b7 01 01 00 	mov    0x101b7(%rip),%r8        # 56138 <swap_stats+0x18>
+   45f81:	48 8b 0d a8 01 01 00 	mov    0x101a8(%rip),%rcx        # 56130 <swap_stats+0x10>
+   45f88:	48 8b 15 99 01 01 00 	mov    0x10199(%rip),%rdx        # 56128 <swap_stats+0x8>
+   45f8f:	bf 58 76 04 00       	mov    $0x47658,%edi
+   45f94:	b8 00 00 00 00       	mov    $0x0,%eax
+   45f99:	e8 ce df ff ff       	call   43f6c <log_printf>
+               swap_stats.clean, swap_stats.writes, swap_stats.in);
+    swap_stats.reported = swap_stats.out;
+   45f9e:	48 8b 05 7b 01 01 00 	mov    0x1017b(%rip),%rax        # 56120 <swap_stats>
+   45fa5:	48 89 05 94 01 01 00 	mov    %rax,0x10194(%rip)        # 56140 <swap_stats+0x20>
+  }
+}
+   45fac:	5d                   	pop    %rbp
+   45fad:	c3                   	ret
+
+0000000000045fae <runqueue_push>:
+
+// The `runqueue_*` functions require `rq->lock`.
+
+static void runqueue_push(runqueue *rq, proc *p) {
+  runlevel *l = &rq->levels[p->priority];
+  p->next = 0;
+   45fae:	c7 86 bc 01 00 00 00 	movl   $0x0,0x1bc(%rsi)
+   45fb5:	00 00 00 
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   45fb8:	0f 31                	rdtsc
+    return low | (high << 32);
+   45fba:	48 c1 e2 20          	shl    $0x20,%rdx
+   45fbe:	48 09 c2             	or     %rax,%rdx
+   45fc1:	48 89 96 c8 01 00 00 	mov    %rdx,0x1c8(%rsi)
+  p->enqueue_tsc = rdtsc();
+  if (l->head) {
+   45fc8:	48 63 86 b4 01 00 00 	movslq 0x1b4(%rsi),%rax
+   45fcf:	48 c1 e0 05          	shl    $0x5,%rax
+   45fd3:	48 01 f8             	add    %rdi,%rax
+   45fd6:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+   45fda:	74 22                	je     45ffe <runqueue_push+0x50>
+    ptable[l->tail].next = p->pid;
+   45fdc:	8b 4e 08             	mov    0x8(%rsi),%ecx
+   45fdf:	48 63 50 0c          	movslq 0xc(%rax),%rdx
+   45fe3:	48 69 d2 d0 01 00 00 	imul   $0x1d0,%rdx,%rdx
+   45fea:	89 8a fc f1 04 00    	mov    %ecx,0x4f1fc(%rdx)
+  } else {
+    l->head = p->pid;
+    rq->bitmap |= 1U << p->priority;
+  }
+  l->tail = p->pid;
+   45ff0:	8b 56 08             	mov    0x8(%rsi),%edx
+   45ff3:	89 50 0c             	mov    %edx,0xc(%rax)
+  ++rq->nqueued;
+   45ff6:	83 87 8c 00 00 00 01 	addl   $0x1,0x8c(%rdi)
+}
+   45ffd:	c3                   	ret
+    l->head = p->pid;
+   45ffe:	8b 56 08             	mov    0x8(%rsi),%edx
+   46001:	89 50 08             	mov    %edx,0x8(%rax)
+    rq->bitmap |= 1U << p->priority;
+   46004:	8b 8e b4 01 00 00    	mov    0x1b4(%rsi),%ecx
+   4600a:	ba 01 00 00 00       	mov    $0x1,%edx
+   4600f:	d3 e2                	shl    %cl,%edx
+   46011:	09 97 88 00 00 00    	or     %edx,0x88(%rdi)
+   46017:	eb d7                	jmp    45ff0 <runqueue_push+0x42>
+
+0000000000046019 <runqueue_busiest>:
+//    Return the peer of `self` (any queue, if `self` is `nullptr`) with
+//    the most queued processes, or `nullptr` if none has at least `min`.
+//    Reads the counts unlocked, so the answer may be stale.
+static runqueue *runqueue_busiest(runqueue *self, int min) {
+  runqueue *busiest = NULL;
+  int most = min - 1;
+   46019:	83 ee 01             	sub    $0x1,%esi
+  for (int i = 0; i < MAXCPU; ++i) {
+   4601c:	b8 00 82 05 00       	mov    $0x58200,%eax
+   46021:	41 b9 00 88 05 00    	mov    $0x58800,%r9d
+  runqueue *busiest = NULL;
+   46027:	b9 00 00 00 00       	mov    $0x0,%ecx
+   4602c:	eb 0b                	jmp    46039 <runqueue_busiest+0x20>
+  for (int i = 0; i < MAXCPU; ++i) {
+   4602e:	48 05 c0 00 00 00    	add    $0xc0,%rax
+   46034:	4c 39 c8             	cmp    %r9,%rax
+   46037:	74 16                	je     4604f <runqueue_busiest+0x36>
+    runqueue *rq = &runqueues[i];
+    int n = __atomic_load_n(&rq->nqueued, __ATOMIC_RELAXED);
+   46039:	8b 90 8c 00 00 00    	mov    0x8c(%rax),%edx
+    if (rq != self && n > most) {
+   4603f:	48 39 c7             	cmp    %rax,%rdi
+   46042:	74 ea                	je     4602e <runqueue_busiest+0x15>
+   46044:	39 f2                	cmp    %esi,%edx
+      busiest = rq;
+      most = n;
+   46046:	0f 4f f2             	cmovg  %edx,%esi
+   46049:	48 0f 4f c8          	cmovg  %rax,%rcx
+   4604d:	eb df                	jmp    4602e <runqueue_busiest+0x15>
+    }
+  }
+  return busiest;
+}
+   4604f:	48 89 c8             	mov    %rcx,%rax
+   46052:	c3                   	ret
+
+0000000000046053 <runqueue_pop>:
+  if (!rq->bitmap) {
+   46053:	8b 8f 88 00 00 00    	mov    0x88(%rdi),%ecx
+   46059:	85 c9                	test   %ecx,%ecx
+   4605b:	74 42                	je     4609f <runqueue_pop+0x4c>
+  int level = __builtin_ctz(rq->bitmap);
+   4605d:	45 31 c0             	xor    %r8d,%r8d
+   46060:	f3 44 0f bc c1       	tzcnt  %ecx,%r8d
+  proc *p = &ptable[l->head];
+   46065:	49 63 d0             	movslq %r8d,%rdx
+   46068:	48 c1 e2 05          	shl    $0x5,%rdx
+   4606c:	48 01 fa             	add    %rdi,%rdx
+   4606f:	48 63 42 08          	movslq 0x8(%rdx),%rax
+   46073:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   4607a:	48 05 40 f0 04 00    	add    $0x4f040,%rax
+  l->head = p->next;
+   46080:	8b b0 bc 01 00 00    	mov    0x1bc(%rax),%esi
+   46086:	89 72 08             	mov    %esi,0x8(%rdx)
+  if (!l->head) {
+   46089:	85 f6                	test   %esi,%esi
+   4608b:	75 0a                	jne    46097 <runqueue_pop+0x44>
+    rq->bitmap &= ~(1U << level);
+   4608d:	44 0f b3 c1          	btr    %r8d,%ecx
+   46091:	89 8f 88 00 00 00    	mov    %ecx,0x88(%rdi)
+  --rq->nqueued;
+   46097:	83 af 8c 00 00 00 01 	subl   $0x1,0x8c(%rdi)
+  return p;
+   4609e:	c3                   	ret
+    return NULL;
+   4609f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   460a4:	c3                   	ret
+
+00000000000460a5 <sched_kick>:
+// sched_kick(cpu, nqueued)
+//    Call after queueing work on CPU `cpu`, which now has `nqueued`
+//    processes waiting, not counting one it is running. Wakes `cpu` if it
+//    is idle, or else another idle CPU to steal if `cpu` has more queued
+//    than it will run next.
+static void sched_kick(int cpu, int nqueued) {
+   460a5:	89 f9                	mov    %edi,%ecx
+  // order the push before reading `idle_cpus`; `sched_idle_enter` does
+  // the reverse
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+   460a7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+  uint32_t idle = __atomic_load_n(&idle_cpus, __ATOMIC_RELAXED);
+   460ad:	8b 15 0d 21 01 00    	mov    0x1210d(%rip),%edx        # 581c0 <idle_cpus>
+  int target;
+  if (idle & (1U << cpu)) {
+   460b3:	b8 01 00 00 00       	mov    $0x1,%eax
+   460b8:	d3 e0                	shl    %cl,%eax
+   460ba:	85 d0                	test   %edx,%eax
+   460bc:	75 0f                	jne    460cd <sched_kick+0x28>
+    target = cpu;
+  } else if (idle && nqueued > 1) {
+   460be:	85 d2                	test   %edx,%edx
+   460c0:	74 2d                	je     460ef <sched_kick+0x4a>
+   460c2:	83 fe 01             	cmp    $0x1,%esi
+   460c5:	7e 28                	jle    460ef <sched_kick+0x4a>
+    target = __builtin_ctz(idle);
+   460c7:	31 c9                	xor    %ecx,%ecx
+   460c9:	f3 0f bc ca          	tzcnt  %edx,%ecx
+  } else {
+    return;
+  }
+  // only the first kicker sends the IPI
+  if (__atomic_fetch_and(&idle_cpus, ~(1U << target), __ATOMIC_RELAXED) &
+   460cd:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+   460d2:	d3 c2                	rol    %cl,%edx
+   460d4:	8b 05 e6 20 01 00    	mov    0x120e6(%rip),%eax        # 581c0 <idle_cpus>
+   460da:	89 c6                	mov    %eax,%esi
+   460dc:	89 c7                	mov    %eax,%edi
+   460de:	21 d7                	and    %edx,%edi
+   460e0:	f0 0f b1 3d d8 20 01 	lock cmpxchg %edi,0x120d8(%rip)        # 581c0 <idle_cpus>
+   460e7:	00 
+   460e8:	75 f0                	jne    460da <sched_kick+0x35>
+   460ea:	0f a3 ce             	bt     %ecx,%esi
+   460ed:	72 01                	jb     460f0 <sched_kick+0x4b>
+   460ef:	c3                   	ret
+static void sched_kick(int cpu, int nqueued) {
+   460f0:	55                   	push   %rbp
+   460f1:	48 89 e5             	mov    %rsp,%rbp
+      (1U << target)) {
+    smp_wake(target);
+   460f4:	89 cf                	mov    %ecx,%edi
+   460f6:	e8 ee 0a 00 00       	call   46be9 <smp_wake>
+  }
+}
+   460fb:	5d                   	pop    %rbp
+   460fc:	c3                   	ret
+
+00000000000460fd <runqueue_steal>:
+static proc *runqueue_steal(runqueue *self, int min) {
+   460fd:	55                   	push   %rbp
+   460fe:	48 89 e5             	mov    %rsp,%rbp
+   46101:	41 54                	push   %r12
+   46103:	53                   	push   %rbx
+   46104:	49 89 fc             	mov    %rdi,%r12
+  runqueue *victim = runqueue_busiest(self, min);
+   46107:	e8 0d ff ff ff       	call   46019 <runqueue_busiest>
+  if (!victim) {
+   4610c:	48 85 c0             	test   %rax,%rax
+   4610f:	74 36                	je     46147 <runqueue_steal+0x4a>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46111:	b9 01 00 00 00       	mov    $0x1,%ecx
+   46116:	eb 08                	jmp    46120 <runqueue_steal+0x23>
+    asm volatile("pause" : : : "memory");
+   46118:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   4611a:	8b 13                	mov    (%rbx),%edx
+   4611c:	85 d2                	test   %edx,%edx
+   4611e:	75 f8                	jne    46118 <runqueue_steal+0x1b>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46120:	48 89 c3             	mov    %rax,%rbx
+   46123:	89 ca                	mov    %ecx,%edx
+   46125:	87 10                	xchg   %edx,(%rax)
+   46127:	85 d2                	test   %edx,%edx
+   46129:	75 ef                	jne    4611a <runqueue_steal+0x1d>
+  proc *p = runqueue_pop(victim);
+   4612b:	48 89 c7             	mov    %rax,%rdi
+   4612e:	e8 20 ff ff ff       	call   46053 <runqueue_pop>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   46133:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  if (p) {
+   46139:	48 85 c0             	test   %rax,%rax
+   4613c:	74 09                	je     46147 <runqueue_steal+0x4a>
+    ++self->migrations;
+   4613e:	49 83 84 24 a0 00 00 	addq   $0x1,0xa0(%r12)
+   46145:	00 01 
+}
+   46147:	5b                   	pop    %rbx
+   46148:	41 5c                	pop    %r12
+   4614a:	5d                   	pop    %rbp
+   4614b:	c3                   	ret
+
+000000000004614c <sched_enqueue>:
+
+void sched_enqueue(proc *p) {
+   4614c:	55                   	push   %rbp
+   4614d:	48 89 e5             	mov    %rsp,%rbp
+   46150:	41 55                	push   %r13
+   46152:	41 54                	push   %r12
+   46154:	53                   	push   %rbx
+   46155:	48 83 ec 08          	sub    $0x8,%rsp
+   46159:	48 89 fb             	mov    %rdi,%rbx
+  runqueue *rq = &runqueues[p->cpu];
+   4615c:	44 8b a7 c0 01 00 00 	mov    0x1c0(%rdi),%r12d
+   46163:	49 63 c4             	movslq %r12d,%rax
+   46166:	4c 8d 2c 40          	lea    (%rax,%rax,2),%r13
+   4616a:	49 c1 e5 06          	shl    $0x6,%r13
+   4616e:	49 8d bd 00 82 05 00 	lea    0x58200(%r13),%rdi
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46175:	ba 01 00 00 00       	mov    $0x1,%edx
+   4617a:	eb 08                	jmp    46184 <sched_enqueue+0x38>
+   4617c:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   4617e:	8b 07                	mov    (%rdi),%eax
+   46180:	85 c0                	test   %eax,%eax
+   46182:	75 f8                	jne    4617c <sched_enqueue+0x30>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46184:	89 d0                	mov    %edx,%eax
+   46186:	87 07                	xchg   %eax,(%rdi)
+   46188:	85 c0                	test   %eax,%eax
+   4618a:	75 f2                	jne    4617e <sched_enqueue+0x32>
+  spinlock_acquire(&rq->lock);
+  p->state = P_RUNNABLE;
+   4618c:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+  runqueue_push(rq, p);
+   46193:	48 89 de             	mov    %rbx,%rsi
+   46196:	e8 13 fe ff ff       	call   45fae <runqueue_push>
+  int n = rq->nqueued;
+   4619b:	4d 63 e4             	movslq %r12d,%r12
+   4619e:	4b 8d 04 64          	lea    (%r12,%r12,2),%rax
+   461a2:	48 c1 e0 06          	shl    $0x6,%rax
+   461a6:	8b b0 8c 82 05 00    	mov    0x5828c(%rax),%esi
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   461ac:	41 c7 85 00 82 05 00 	movl   $0x0,0x58200(%r13)
+   461b3:	00 00 00 00 
+  spinlock_release(&rq->lock);
+  sched_kick(p->cpu, n);
+   461b7:	8b bb c0 01 00 00    	mov    0x1c0(%rbx),%edi
+   461bd:	e8 e3 fe ff ff       	call   460a5 <sched_kick>
+}
+   461c2:	48 83 c4 08          	add    $0x8,%rsp
+   461c6:	5b                   	pop    %rbx
+   461c7:	41 5c                	pop    %r12
+   461c9:	41 5d                	pop    %r13
+   461cb:	5d                   	pop    %rbp
+   461cc:	c3                   	ret
+
+00000000000461cd <sched_wake>:
+
+void sched_wake(proc *p) {
+   461cd:	55                   	push   %rbp
+   461ce:	48 89 e5             	mov    %rsp,%rbp
+   461d1:	41 55                	push   %r13
+   461d3:	41 54                	push   %r12
+   461d5:	53                   	push   %rbx
+   461d6:	48 83 ec 08          	sub    $0x8,%rsp
+   461da:	48 89 fb             	mov    %rdi,%rbx
+  runqueue *rq = &runqueues[p->cpu];
+   461dd:	44 8b a7 c0 01 00 00 	mov    0x1c0(%rdi),%r12d
+   461e4:	49 63 c4             	movslq %r12d,%rax
+   461e7:	4c 8d 2c 40          	lea    (%rax,%rax,2),%r13
+   461eb:	49 c1 e5 06          	shl    $0x6,%r13
+   461ef:	49 8d bd 00 82 05 00 	lea    0x58200(%r13),%rdi
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   461f6:	ba 01 00 00 00       	mov    $0x1,%edx
+   461fb:	eb 08                	jmp    46205 <sched_wake+0x38>
+   461fd:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   461ff:	8b 07                	mov    (%rdi),%eax
+   46201:	85 c0                	test   %eax,%eax
+   46203:	75 f8                	jne    461fd <sched_wake+0x30>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46205:	89 d0                	mov    %edx,%eax
+   46207:	87 07                	xchg   %eax,(%rdi)
+   46209:	85 c0                	test   %eax,%eax
+   4620b:	75 f2                	jne    461ff <sched_wake+0x32>
+  if (p->priority > 0) {
+   4620d:	8b 83 b4 01 00 00    	mov    0x1b4(%rbx),%eax
+   46213:	85 c0                	test   %eax,%eax
+   46215:	7e 16                	jle    4622d <sched_wake+0x60>
+    --p->priority;
+   46217:	8d 48 ff             	lea    -0x1(%rax),%ecx
+   4621a:	89 8b b4 01 00 00    	mov    %ecx,0x1b4(%rbx)
+static int sched_quantum(int level) { return 1 << level; }
+   46220:	b8 01 00 00 00       	mov    $0x1,%eax
+   46225:	d3 e0                	shl    %cl,%eax
+   46227:	89 83 b8 01 00 00    	mov    %eax,0x1b8(%rbx)
+  p->state = P_RUNNABLE;
+   4622d:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+  runqueue_push(rq, p);
+   46234:	48 89 de             	mov    %rbx,%rsi
+   46237:	e8 72 fd ff ff       	call   45fae <runqueue_push>
+  spinlock_acquire(&rq->lock);
+  runqueue_wake(rq, p);
+  int n = rq->nqueued;
+   4623c:	4d 63 e4             	movslq %r12d,%r12
+   4623f:	4b 8d 04 64          	lea    (%r12,%r12,2),%rax
+   46243:	48 c1 e0 06          	shl    $0x6,%rax
+   46247:	8b b0 8c 82 05 00    	mov    0x5828c(%rax),%esi
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   4624d:	41 c7 85 00 82 05 00 	movl   $0x0,0x58200(%r13)
+   46254:	00 00 00 00 
+  spinlock_release(&rq->lock);
+  sched_kick(p->cpu, n);
+   46258:	8b bb c0 01 00 00    	mov    0x1c0(%rbx),%edi
+   4625e:	e8 42 fe ff ff       	call   460a5 <sched_kick>
+}
+   46263:	48 83 c4 08          	add    $0x8,%rsp
+   46267:	5b                   	pop    %rbx
+   46268:	41 5c                	pop    %r12
+   4626a:	41 5d                	pop    %r13
+   4626c:	5d                   	pop    %rbp
+   4626d:	c3                   	ret
+
+000000000004626e <sched_pick>:
+
+proc *sched_pick() {
+   4626e:	55                   	push   %rbp
+   4626f:	48 89 e5             	mov    %rsp,%rbp
+   46272:	41 56                	push   %r14
+   46274:	41 55                	push   %r13
+   46276:	41 54                	push   %r12
+   46278:	53                   	push   %rbx
+    asm("movq %%gs:0, %0" : "=r"(c));
+   46279:	65 4c 8b 34 25 00 00 	mov    %gs:0x0,%r14
+   46280:	00 00 
+  cpustate *c = this_cpu();
+  runqueue *rq = &runqueues[c->index];
+   46282:	45 8b 66 18          	mov    0x18(%r14),%r12d
+   46286:	49 63 c4             	movslq %r12d,%rax
+   46289:	4c 8d 2c 40          	lea    (%rax,%rax,2),%r13
+   4628d:	49 c1 e5 06          	shl    $0x6,%r13
+   46291:	49 8d 9d 00 82 05 00 	lea    0x58200(%r13),%rbx
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46298:	ba 01 00 00 00       	mov    $0x1,%edx
+   4629d:	eb 08                	jmp    462a7 <sched_pick+0x39>
+   4629f:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   462a1:	8b 03                	mov    (%rbx),%eax
+   462a3:	85 c0                	test   %eax,%eax
+   462a5:	75 f8                	jne    4629f <sched_pick+0x31>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   462a7:	89 d0                	mov    %edx,%eax
+   462a9:	87 03                	xchg   %eax,(%rbx)
+   462ab:	85 c0                	test   %eax,%eax
+   462ad:	75 f2                	jne    462a1 <sched_pick+0x33>
+  spinlock_acquire(&rq->lock);
+  proc *p = runqueue_pop(rq);
+   462af:	48 89 df             	mov    %rbx,%rdi
+   462b2:	e8 9c fd ff ff       	call   46053 <runqueue_pop>
+   462b7:	48 89 c6             	mov    %rax,%rsi
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   462ba:	41 c7 85 00 82 05 00 	movl   $0x0,0x58200(%r13)
+   462c1:	00 00 00 00 
+  spinlock_release(&rq->lock);
+  if (!p && !(p = runqueue_steal(rq, 1))) {
+   462c5:	48 85 c0             	test   %rax,%rax
+   462c8:	0f 84 93 00 00 00    	je     46361 <sched_pick+0xf3>
+    return NULL;
+  }
+  p->cpu = c->index;
+   462ce:	41 8b 46 18          	mov    0x18(%r14),%eax
+   462d2:	89 86 c0 01 00 00    	mov    %eax,0x1c0(%rsi)
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   462d8:	0f 31                	rdtsc
+    return low | (high << 32);
+   462da:	48 c1 e2 20          	shl    $0x20,%rdx
+   462de:	48 09 c2             	or     %rax,%rdx
+
+  runlevel *l = &rq->levels[p->priority];
+  uint64_t wait = rdtsc() - p->enqueue_tsc;
+   462e1:	48 89 d0             	mov    %rdx,%rax
+   462e4:	48 2b 86 c8 01 00 00 	sub    0x1c8(%rsi),%rax
+  ++l->picks;
+   462eb:	48 63 96 b4 01 00 00 	movslq 0x1b4(%rsi),%rdx
+   462f2:	4d 63 e4             	movslq %r12d,%r12
+   462f5:	4b 8d 0c 24          	lea    (%r12,%r12,1),%rcx
+   462f9:	4a 8d 3c 21          	lea    (%rcx,%r12,1),%rdi
+   462fd:	48 8d 3c 7a          	lea    (%rdx,%rdi,2),%rdi
+   46301:	48 c1 e7 05          	shl    $0x5,%rdi
+   46305:	4c 8b 87 10 82 05 00 	mov    0x58210(%rdi),%r8
+   4630c:	49 83 c0 01          	add    $0x1,%r8
+   46310:	4c 89 87 10 82 05 00 	mov    %r8,0x58210(%rdi)
+  l->wait_cycles += wait;
+   46317:	4a 8d 3c 21          	lea    (%rcx,%r12,1),%rdi
+   4631b:	48 8d 3c 7a          	lea    (%rdx,%rdi,2),%rdi
+   4631f:	48 c1 e7 05          	shl    $0x5,%rdi
+   46323:	48 89 c3             	mov    %rax,%rbx
+   46326:	48 03 9f 18 82 05 00 	add    0x58218(%rdi),%rbx
+   4632d:	48 89 9f 18 82 05 00 	mov    %rbx,0x58218(%rdi)
+  l->wait_max = wait > l->wait_max ? wait : l->wait_max;
+   46334:	4a 8d 3c 21          	lea    (%rcx,%r12,1),%rdi
+   46338:	48 8d 3c 7a          	lea    (%rdx,%rdi,2),%rdi
+   4633c:	48 c1 e7 05          	shl    $0x5,%rdi
+   46340:	48 8b 97 20 82 05 00 	mov    0x58220(%rdi),%rdx
+   46347:	48 39 c2             	cmp    %rax,%rdx
+   4634a:	48 0f 42 d0          	cmovb  %rax,%rdx
+   4634e:	48 89 97 20 82 05 00 	mov    %rdx,0x58220(%rdi)
+  return p;
+}
+   46355:	48 89 f0             	mov    %rsi,%rax
+   46358:	5b                   	pop    %rbx
+   46359:	41 5c                	pop    %r12
+   4635b:	41 5d                	pop    %r13
+   4635d:	41 5e                	pop    %r14
+   4635f:	5d                   	pop    %rbp
+   46360:	c3                   	ret
+  if (!p && !(p = runqueue_steal(rq, 1))) {
+   46361:	be 01 00 00 00       	mov    $0x1,%esi
+   46366:	48 89 df             	mov    %rbx,%rdi
+   46369:	e8 8f fd ff ff       	call   460fd <runqueue_steal>
+   4636e:	48 89 c6             	mov    %rax,%rsi
+   46371:	48 85 c0             	test   %rax,%rax
+   46374:	0f 85 54 ff ff ff    	jne    462ce <sched_pick+0x60>
+   4637a:	eb d9                	jmp    46355 <sched_pick+0xe7>
+
+000000000004637c <sched_init_proc>:
+  p->priority = 0;
+   4637c:	c7 87 b4 01 00 00 00 	movl   $0x0,0x1b4(%rdi)
+   46383:	00 00 00 
+  p->quantum = sched_quantum(0);
+   46386:	c7 87 b8 01 00 00 01 	movl   $0x1,0x1b8(%rdi)
+   4638d:	00 00 00 
+    asm("movq %%gs:0, %0" : "=r"(c));
+   46390:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   46397:	00 00 
+
+void sched_init_proc(proc *p) {
+  sched_refresh(p);
+  p->cpu = this_cpu()->index;
+   46399:	8b 40 18             	mov    0x18(%rax),%eax
+   4639c:	89 87 c0 01 00 00    	mov    %eax,0x1c0(%rdi)
+}
+   463a2:	c3                   	ret
+
+00000000000463a3 <sched_tick>:
+
+bool sched_tick(proc *p) {
+   463a3:	55                   	push   %rbp
+   463a4:	48 89 e5             	mov    %rsp,%rbp
+   463a7:	41 57                	push   %r15
+   463a9:	41 56                	push   %r14
+   463ab:	41 55                	push   %r13
+   463ad:	41 54                	push   %r12
+   463af:	53                   	push   %rbx
+   463b0:	48 83 ec 08          	sub    $0x8,%rsp
+   463b4:	49 89 fd             	mov    %rdi,%r13
+   463b7:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   463be:	00 00 
+static runqueue *this_runqueue() { return &runqueues[this_cpu()->index]; }
+   463c0:	44 8b 60 18          	mov    0x18(%rax),%r12d
+   463c4:	49 63 c4             	movslq %r12d,%rax
+   463c7:	4c 8d 34 40          	lea    (%rax,%rax,2),%r14
+   463cb:	49 c1 e6 06          	shl    $0x6,%r14
+   463cf:	49 8d 9e 00 82 05 00 	lea    0x58200(%r14),%rbx
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   463d6:	ba 01 00 00 00       	mov    $0x1,%edx
+   463db:	eb 08                	jmp    463e5 <sched_tick+0x42>
+    asm volatile("pause" : : : "memory");
+   463dd:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   463df:	8b 03                	mov    (%rbx),%eax
+   463e1:	85 c0                	test   %eax,%eax
+   463e3:	75 f8                	jne    463dd <sched_tick+0x3a>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   463e5:	89 d0                	mov    %edx,%eax
+   463e7:	87 03                	xchg   %eax,(%rbx)
+   463e9:	85 c0                	test   %eax,%eax
+   463eb:	75 f2                	jne    463df <sched_tick+0x3c>
+  runqueue *rq = this_runqueue();
+  spinlock_acquire(&rq->lock);
+  bool woke = false;
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+   463ed:	49 63 c4             	movslq %r12d,%rax
+   463f0:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   463f4:	48 c1 e0 06          	shl    $0x6,%rax
+   463f8:	8b 80 90 82 05 00    	mov    0x58290(%rax),%eax
+  bool woke = false;
+   463fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+   46403:	85 c0                	test   %eax,%eax
+   46405:	74 0d                	je     46414 <sched_tick+0x71>
+                                   ptable[rq->sleep_head].sleep_time <=
+                               (size_t)ticks) {
+    proc *s = &ptable[rq->sleep_head];
+    rq->sleep_head = s->next;
+   46407:	49 63 d4             	movslq %r12d,%rdx
+   4640a:	4c 8d 3c 52          	lea    (%rdx,%rdx,2),%r15
+   4640e:	49 c1 e7 06          	shl    $0x6,%r15
+   46412:	eb 35                	jmp    46449 <sched_tick+0xa6>
+  bool woke = false;
+   46414:	bf 00 00 00 00       	mov    $0x0,%edi
+   46419:	e9 9a 00 00 00       	jmp    464b8 <sched_tick+0x115>
+  p->state = P_RUNNABLE;
+   4641e:	48 98                	cltq
+   46420:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   46427:	c7 80 4c f0 04 00 01 	movl   $0x1,0x4f04c(%rax)
+   4642e:	00 00 00 
+  runqueue_push(rq, p);
+   46431:	48 89 df             	mov    %rbx,%rdi
+   46434:	e8 75 fb ff ff       	call   45fae <runqueue_push>
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+   46439:	41 8b 87 90 82 05 00 	mov    0x58290(%r15),%eax
+    runqueue_wake(rq, s);
+    woke = true;
+   46440:	bf 01 00 00 00       	mov    $0x1,%edi
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+   46445:	85 c0                	test   %eax,%eax
+   46447:	74 6a                	je     464b3 <sched_tick+0x110>
+   46449:	48 63 d0             	movslq %eax,%rdx
+   4644c:	48 69 d2 d0 01 00 00 	imul   $0x1d0,%rdx,%rdx
+   46453:	48 8b 8a 10 f1 04 00 	mov    0x4f110(%rdx),%rcx
+   4645a:	48 03 8a 18 f1 04 00 	add    0x4f118(%rdx),%rcx
+   46461:	48 89 ca             	mov    %rcx,%rdx
+                                   ptable[rq->sleep_head].sleep_time <=
+   46464:	48 63 0d b5 8b 00 00 	movslq 0x8bb5(%rip),%rcx        # 4f020 <ticks>
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+   4646b:	48 39 d1             	cmp    %rdx,%rcx
+   4646e:	72 48                	jb     464b8 <sched_tick+0x115>
+    proc *s = &ptable[rq->sleep_head];
+   46470:	48 63 f0             	movslq %eax,%rsi
+   46473:	48 69 f6 d0 01 00 00 	imul   $0x1d0,%rsi,%rsi
+   4647a:	48 81 c6 40 f0 04 00 	add    $0x4f040,%rsi
+    rq->sleep_head = s->next;
+   46481:	8b 96 bc 01 00 00    	mov    0x1bc(%rsi),%edx
+   46487:	41 89 97 90 82 05 00 	mov    %edx,0x58290(%r15)
+  if (p->priority > 0) {
+   4648e:	8b 8e b4 01 00 00    	mov    0x1b4(%rsi),%ecx
+   46494:	85 c9                	test   %ecx,%ecx
+   46496:	7e 86                	jle    4641e <sched_tick+0x7b>
+    --p->priority;
+   46498:	83 e9 01             	sub    $0x1,%ecx
+   4649b:	89 8e b4 01 00 00    	mov    %ecx,0x1b4(%rsi)
+static int sched_quantum(int level) { return 1 << level; }
+   464a1:	bf 01 00 00 00       	mov    $0x1,%edi
+   464a6:	d3 e7                	shl    %cl,%edi
+   464a8:	89 be b8 01 00 00    	mov    %edi,0x1b8(%rsi)
+   464ae:	e9 6b ff ff ff       	jmp    4641e <sched_tick+0x7b>
+    woke = true;
+   464b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  }
+  if (++rq->boost_tick == SCHED_BOOST_TICKS) {
+   464b8:	49 63 cc             	movslq %r12d,%rcx
+   464bb:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+   464bf:	48 8d 14 08          	lea    (%rax,%rcx,1),%rdx
+   464c3:	48 c1 e2 06          	shl    $0x6,%rdx
+   464c7:	8b 92 94 82 05 00    	mov    0x58294(%rdx),%edx
+   464cd:	83 c2 01             	add    $0x1,%edx
+   464d0:	48 01 c8             	add    %rcx,%rax
+   464d3:	48 c1 e0 06          	shl    $0x6,%rax
+   464d7:	89 90 94 82 05 00    	mov    %edx,0x58294(%rax)
+   464dd:	83 fa 64             	cmp    $0x64,%edx
+   464e0:	0f 84 ab 00 00 00    	je     46591 <sched_tick+0x1ee>
+    rq->boost_tick = 0;
+    runqueue_boost(rq, p);
+  }
+
+  bool preempt = false;
+   464e6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  if (p && --p->quantum <= 0) {
+   464ec:	4d 85 ed             	test   %r13,%r13
+   464ef:	74 3e                	je     4652f <sched_tick+0x18c>
+   464f1:	41 8b 85 b8 01 00 00 	mov    0x1b8(%r13),%eax
+   464f8:	83 e8 01             	sub    $0x1,%eax
+   464fb:	41 89 85 b8 01 00 00 	mov    %eax,0x1b8(%r13)
+   46502:	85 c0                	test   %eax,%eax
+   46504:	0f 8e 9d 01 00 00    	jle    466a7 <sched_tick+0x304>
+    }
+    p->quantum = sched_quantum(p->priority);
+    preempt = true;
+  } else if (p) {
+    // a higher-priority process is waiting
+    preempt = (rq->bitmap & ((1U << p->priority) - 1)) != 0;
+   4650a:	41 8b 8d b4 01 00 00 	mov    0x1b4(%r13),%ecx
+   46511:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+   46516:	d3 e0                	shl    %cl,%eax
+   46518:	f7 d0                	not    %eax
+   4651a:	49 63 d4             	movslq %r12d,%rdx
+   4651d:	48 8d 14 52          	lea    (%rdx,%rdx,2),%rdx
+   46521:	48 c1 e2 06          	shl    $0x6,%rdx
+   46525:	23 82 88 82 05 00    	and    0x58288(%rdx),%eax
+   4652b:	41 0f 95 c7          	setne  %r15b
+  }
+  bool balance = ++rq->balance_tick == SCHED_BALANCE_TICKS;
+   4652f:	49 63 cc             	movslq %r12d,%rcx
+   46532:	48 8d 04 09          	lea    (%rcx,%rcx,1),%rax
+   46536:	48 8d 14 08          	lea    (%rax,%rcx,1),%rdx
+   4653a:	48 c1 e2 06          	shl    $0x6,%rdx
+   4653e:	8b 92 98 82 05 00    	mov    0x58298(%rdx),%edx
+   46544:	83 c2 01             	add    $0x1,%edx
+   46547:	48 01 c8             	add    %rcx,%rax
+   4654a:	48 c1 e0 06          	shl    $0x6,%rax
+   4654e:	89 90 98 82 05 00    	mov    %edx,0x58298(%rax)
+  if (balance) {
+   46554:	83 fa 0a             	cmp    $0xa,%edx
+   46557:	0f 84 b5 01 00 00    	je     46712 <sched_tick+0x36f>
+    rq->balance_tick = 0;
+  }
+  int n = rq->nqueued + (p != NULL);
+   4655d:	48 8d 04 49          	lea    (%rcx,%rcx,2),%rax
+   46561:	48 c1 e0 06          	shl    $0x6,%rax
+   46565:	8b b0 8c 82 05 00    	mov    0x5828c(%rax),%esi
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   4656b:	41 c7 86 00 82 05 00 	movl   $0x0,0x58200(%r14)
+   46572:	00 00 00 00 
+  spinlock_release(&rq->lock);
+
+  if (woke) {
+   46576:	40 84 ff             	test   %dil,%dil
+   46579:	0f 85 5e 01 00 00    	jne    466dd <sched_tick+0x33a>
+  }
+  if (balance) {
+    runqueue_balance(rq);
+  }
+  return preempt;
+}
+   4657f:	44 89 f8             	mov    %r15d,%eax
+   46582:	48 83 c4 08          	add    $0x8,%rsp
+   46586:	5b                   	pop    %rbx
+   46587:	41 5c                	pop    %r12
+   46589:	41 5d                	pop    %r13
+   4658b:	41 5e                	pop    %r14
+   4658d:	41 5f                	pop    %r15
+   4658f:	5d                   	pop    %rbp
+   46590:	c3                   	ret
+    rq->boost_tick = 0;
+   46591:	48 8d 04 49          	lea    (%rcx,%rcx,2),%rax
+   46595:	48 c1 e0 06          	shl    $0x6,%rax
+   46599:	c7 80 94 82 05 00 00 	movl   $0x0,0x58294(%rax)
+   465a0:	00 00 00 
+  for (int level = 1; level < SCHED_NLEVELS; ++level) {
+   465a3:	49 8d 4e 60          	lea    0x60(%r14),%rcx
+    rq->boost_tick = 0;
+   465a7:	4c 89 f0             	mov    %r14,%rax
+   465aa:	eb 1f                	jmp    465cb <sched_tick+0x228>
+      top->head = l->head;
+   465ac:	89 53 08             	mov    %edx,0x8(%rbx)
+    top->tail = l->tail;
+   465af:	8b 90 2c 82 05 00    	mov    0x5822c(%rax),%edx
+   465b5:	89 53 0c             	mov    %edx,0xc(%rbx)
+    l->head = 0;
+   465b8:	c7 80 28 82 05 00 00 	movl   $0x0,0x58228(%rax)
+   465bf:	00 00 00 
+  for (int level = 1; level < SCHED_NLEVELS; ++level) {
+   465c2:	48 83 c0 20          	add    $0x20,%rax
+   465c6:	48 39 c8             	cmp    %rcx,%rax
+   465c9:	74 23                	je     465ee <sched_tick+0x24b>
+    if (!l->head) {
+   465cb:	8b 90 28 82 05 00    	mov    0x58228(%rax),%edx
+   465d1:	85 d2                	test   %edx,%edx
+   465d3:	74 ed                	je     465c2 <sched_tick+0x21f>
+    if (top->head) {
+   465d5:	83 7b 08 00          	cmpl   $0x0,0x8(%rbx)
+   465d9:	74 d1                	je     465ac <sched_tick+0x209>
+      ptable[top->tail].next = l->head;
+   465db:	48 63 73 0c          	movslq 0xc(%rbx),%rsi
+   465df:	48 69 f6 d0 01 00 00 	imul   $0x1d0,%rsi,%rsi
+   465e6:	89 96 fc f1 04 00    	mov    %edx,0x4f1fc(%rsi)
+   465ec:	eb c1                	jmp    465af <sched_tick+0x20c>
+  if (rq->bitmap) {
+   465ee:	49 63 c4             	movslq %r12d,%rax
+   465f1:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   465f5:	48 c1 e0 06          	shl    $0x6,%rax
+   465f9:	83 b8 88 82 05 00 00 	cmpl   $0x0,0x58288(%rax)
+   46600:	74 15                	je     46617 <sched_tick+0x274>
+    rq->bitmap = 1;
+   46602:	49 63 c4             	movslq %r12d,%rax
+   46605:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   46609:	48 c1 e0 06          	shl    $0x6,%rax
+   4660d:	c7 80 88 82 05 00 01 	movl   $0x1,0x58288(%rax)
+   46614:	00 00 00 
+  for (pid_t pid = top->head; pid; pid = ptable[pid].next) {
+   46617:	8b 43 08             	mov    0x8(%rbx),%eax
+   4661a:	85 c0                	test   %eax,%eax
+   4661c:	74 2d                	je     4664b <sched_tick+0x2a8>
+  p->priority = 0;
+   4661e:	48 98                	cltq
+   46620:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   46627:	c7 80 f4 f1 04 00 00 	movl   $0x0,0x4f1f4(%rax)
+   4662e:	00 00 00 
+  p->quantum = sched_quantum(0);
+   46631:	c7 80 f8 f1 04 00 01 	movl   $0x1,0x4f1f8(%rax)
+   46638:	00 00 00 
+  p->priority = 0;
+   4663b:	48 05 40 f0 04 00    	add    $0x4f040,%rax
+  for (pid_t pid = top->head; pid; pid = ptable[pid].next) {
+   46641:	8b 80 bc 01 00 00    	mov    0x1bc(%rax),%eax
+   46647:	85 c0                	test   %eax,%eax
+   46649:	75 d3                	jne    4661e <sched_tick+0x27b>
+  for (pid_t pid = rq->sleep_head; pid; pid = ptable[pid].next) {
+   4664b:	49 63 c4             	movslq %r12d,%rax
+   4664e:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   46652:	48 c1 e0 06          	shl    $0x6,%rax
+   46656:	8b 80 90 82 05 00    	mov    0x58290(%rax),%eax
+   4665c:	85 c0                	test   %eax,%eax
+   4665e:	74 2d                	je     4668d <sched_tick+0x2ea>
+  p->priority = 0;
+   46660:	48 98                	cltq
+   46662:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   46669:	c7 80 f4 f1 04 00 00 	movl   $0x0,0x4f1f4(%rax)
+   46670:	00 00 00 
+  p->quantum = sched_quantum(0);
+   46673:	c7 80 f8 f1 04 00 01 	movl   $0x1,0x4f1f8(%rax)
+   4667a:	00 00 00 
+  p->priority = 0;
+   4667d:	48 05 40 f0 04 00    	add    $0x4f040,%rax
+  for (pid_t pid = rq->sleep_head; pid; pid = ptable[pid].next) {
+   46683:	8b 80 bc 01 00 00    	mov    0x1bc(%rax),%eax
+   46689:	85 c0                	test   %eax,%eax
+   4668b:	75 d3                	jne    46660 <sched_tick+0x2bd>
+  bool preempt = false;
+   4668d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  if (running) {
+   46693:	4d 85 ed             	test   %r13,%r13
+   46696:	0f 84 93 fe ff ff    	je     4652f <sched_tick+0x18c>
+  p->priority = 0;
+   4669c:	41 c7 85 b4 01 00 00 	movl   $0x0,0x1b4(%r13)
+   466a3:	00 00 00 00 
+    if (p->priority < SCHED_NLEVELS - 1) {
+   466a7:	41 8b 85 b4 01 00 00 	mov    0x1b4(%r13),%eax
+   466ae:	83 f8 02             	cmp    $0x2,%eax
+   466b1:	7f 0a                	jg     466bd <sched_tick+0x31a>
+      ++p->priority;
+   466b3:	83 c0 01             	add    $0x1,%eax
+   466b6:	41 89 85 b4 01 00 00 	mov    %eax,0x1b4(%r13)
+static int sched_quantum(int level) { return 1 << level; }
+   466bd:	41 8b 8d b4 01 00 00 	mov    0x1b4(%r13),%ecx
+   466c4:	b8 01 00 00 00       	mov    $0x1,%eax
+   466c9:	d3 e0                	shl    %cl,%eax
+   466cb:	41 89 85 b8 01 00 00 	mov    %eax,0x1b8(%r13)
+    preempt = true;
+   466d2:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+   466d8:	e9 52 fe ff ff       	jmp    4652f <sched_tick+0x18c>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   466dd:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   466e4:	00 00 
+  int n = rq->nqueued + (p != NULL);
+   466e6:	49 83 fd 01          	cmp    $0x1,%r13
+   466ea:	83 de ff             	sbb    $0xffffffff,%esi
+    sched_kick(this_cpu()->index, n);
+   466ed:	8b 78 18             	mov    0x18(%rax),%edi
+   466f0:	e8 b0 f9 ff ff       	call   460a5 <sched_kick>
+  if (balance) {
+   466f5:	e9 85 fe ff ff       	jmp    4657f <sched_tick+0x1dc>
+    runqueue_push(rq, p);
+   466fa:	48 89 df             	mov    %rbx,%rdi
+   466fd:	e8 ac f8 ff ff       	call   45fae <runqueue_push>
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   46702:	41 c7 86 00 82 05 00 	movl   $0x0,0x58200(%r14)
+   46709:	00 00 00 00 
+  return preempt;
+   4670d:	e9 6d fe ff ff       	jmp    4657f <sched_tick+0x1dc>
+   46712:	4d 63 e4             	movslq %r12d,%r12
+   46715:	4b 8d 04 24          	lea    (%r12,%r12,1),%rax
+   46719:	4a 8d 14 20          	lea    (%rax,%r12,1),%rdx
+   4671d:	48 c1 e2 06          	shl    $0x6,%rdx
+   46721:	c7 82 98 82 05 00 00 	movl   $0x0,0x58298(%rdx)
+   46728:	00 00 00 
+  int n = rq->nqueued + (p != NULL);
+   4672b:	8b 82 8c 82 05 00    	mov    0x5828c(%rdx),%eax
+   46731:	41 c7 86 00 82 05 00 	movl   $0x0,0x58200(%r14)
+   46738:	00 00 00 00 
+  if (woke) {
+   4673c:	40 84 ff             	test   %dil,%dil
+   4673f:	75 4b                	jne    4678c <sched_tick+0x3e9>
+  int n = __atomic_load_n(&rq->nqueued, __ATOMIC_RELAXED);
+   46741:	41 8b b6 8c 82 05 00 	mov    0x5828c(%r14),%esi
+  proc *p = runqueue_steal(rq, n + SCHED_IMBALANCE);
+   46748:	83 c6 02             	add    $0x2,%esi
+   4674b:	48 89 df             	mov    %rbx,%rdi
+   4674e:	e8 aa f9 ff ff       	call   460fd <runqueue_steal>
+   46753:	48 89 c6             	mov    %rax,%rsi
+  if (p) {
+   46756:	48 85 c0             	test   %rax,%rax
+   46759:	0f 84 20 fe ff ff    	je     4657f <sched_tick+0x1dc>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4675f:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   46766:	00 00 
+    p->cpu = this_cpu()->index;
+   46768:	8b 40 18             	mov    0x18(%rax),%eax
+   4676b:	89 86 c0 01 00 00    	mov    %eax,0x1c0(%rsi)
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46771:	b9 01 00 00 00       	mov    $0x1,%ecx
+   46776:	89 ca                	mov    %ecx,%edx
+   46778:	87 13                	xchg   %edx,(%rbx)
+   4677a:	85 d2                	test   %edx,%edx
+   4677c:	0f 84 78 ff ff ff    	je     466fa <sched_tick+0x357>
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   46782:	8b 13                	mov    (%rbx),%edx
+   46784:	85 d2                	test   %edx,%edx
+   46786:	74 ee                	je     46776 <sched_tick+0x3d3>
+   46788:	f3 90                	pause
+}
+   4678a:	eb f6                	jmp    46782 <sched_tick+0x3df>
+    asm("movq %%gs:0, %0" : "=r"(c));
+   4678c:	65 48 8b 14 25 00 00 	mov    %gs:0x0,%rdx
+   46793:	00 00 
+  int n = rq->nqueued + (p != NULL);
+   46795:	49 83 fd 01          	cmp    $0x1,%r13
+   46799:	83 d8 ff             	sbb    $0xffffffff,%eax
+   4679c:	89 c6                	mov    %eax,%esi
+    sched_kick(this_cpu()->index, n);
+   4679e:	8b 7a 18             	mov    0x18(%rdx),%edi
+   467a1:	e8 ff f8 ff ff       	call   460a5 <sched_kick>
+  if (balance) {
+   467a6:	eb 99                	jmp    46741 <sched_tick+0x39e>
+
+00000000000467a8 <sched_idle_exit>:
+   467a8:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   467af:	00 00 
+  spinlock_release(&rq->lock);
+  return true;
+}
+
+void sched_idle_exit() {
+  __atomic_fetch_and(&idle_cpus, ~(1U << this_cpu()->index),
+   467b1:	8b 48 18             	mov    0x18(%rax),%ecx
+   467b4:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+   467b9:	d3 c0                	rol    %cl,%eax
+   467bb:	f0 21 05 fe 19 01 00 	lock and %eax,0x119fe(%rip)        # 581c0 <idle_cpus>
+                     __ATOMIC_RELAXED);
+}
+   467c2:	c3                   	ret
+
+00000000000467c3 <sched_idle_enter>:
+bool sched_idle_enter(size_t *wake) {
+   467c3:	55                   	push   %rbp
+   467c4:	48 89 e5             	mov    %rsp,%rbp
+   467c7:	41 54                	push   %r12
+   467c9:	53                   	push   %rbx
+   467ca:	49 89 fc             	mov    %rdi,%r12
+   467cd:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   467d4:	00 00 
+  int cpu = this_cpu()->index;
+   467d6:	8b 58 18             	mov    0x18(%rax),%ebx
+  __atomic_fetch_or(&idle_cpus, 1U << cpu, __ATOMIC_SEQ_CST);
+   467d9:	b8 01 00 00 00       	mov    $0x1,%eax
+   467de:	89 d9                	mov    %ebx,%ecx
+   467e0:	d3 e0                	shl    %cl,%eax
+   467e2:	f0 09 05 d7 19 01 00 	lock or %eax,0x119d7(%rip)        # 581c0 <idle_cpus>
+  if (runqueue_busiest(NULL, 1)) {
+   467e9:	be 01 00 00 00       	mov    $0x1,%esi
+   467ee:	bf 00 00 00 00       	mov    $0x0,%edi
+   467f3:	e8 21 f8 ff ff       	call   46019 <runqueue_busiest>
+   467f8:	48 85 c0             	test   %rax,%rax
+   467fb:	74 14                	je     46811 <sched_idle_enter+0x4e>
+    sched_idle_exit();
+   467fd:	b8 00 00 00 00       	mov    $0x0,%eax
+   46802:	e8 a1 ff ff ff       	call   467a8 <sched_idle_exit>
+    return false;
+   46807:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+   4680c:	5b                   	pop    %rbx
+   4680d:	41 5c                	pop    %r12
+   4680f:	5d                   	pop    %rbp
+   46810:	c3                   	ret
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46811:	48 63 c3             	movslq %ebx,%rax
+   46814:	48 8d 34 40          	lea    (%rax,%rax,2),%rsi
+   46818:	48 c1 e6 06          	shl    $0x6,%rsi
+   4681c:	48 8d 96 00 82 05 00 	lea    0x58200(%rsi),%rdx
+   46823:	b9 01 00 00 00       	mov    $0x1,%ecx
+   46828:	eb 08                	jmp    46832 <sched_idle_enter+0x6f>
+    asm volatile("pause" : : : "memory");
+   4682a:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   4682c:	8b 02                	mov    (%rdx),%eax
+   4682e:	85 c0                	test   %eax,%eax
+   46830:	75 f8                	jne    4682a <sched_idle_enter+0x67>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   46832:	89 c8                	mov    %ecx,%eax
+   46834:	87 02                	xchg   %eax,(%rdx)
+   46836:	85 c0                	test   %eax,%eax
+   46838:	75 f2                	jne    4682c <sched_idle_enter+0x69>
+  *wake = 0;
+   4683a:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+   46841:	00 
+  if (rq->sleep_head) {
+   46842:	48 63 db             	movslq %ebx,%rbx
+   46845:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+   46849:	48 c1 e0 06          	shl    $0x6,%rax
+   4684d:	8b 80 90 82 05 00    	mov    0x58290(%rax),%eax
+   46853:	85 c0                	test   %eax,%eax
+   46855:	74 1b                	je     46872 <sched_idle_enter+0xaf>
+    *wake = s->sleep_ts + s->sleep_time;
+   46857:	48 98                	cltq
+   46859:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   46860:	48 8b 90 10 f1 04 00 	mov    0x4f110(%rax),%rdx
+   46867:	48 03 90 18 f1 04 00 	add    0x4f118(%rax),%rdx
+   4686e:	49 89 14 24          	mov    %rdx,(%r12)
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   46872:	c7 86 00 82 05 00 00 	movl   $0x0,0x58200(%rsi)
+   46879:	00 00 00 
+  return true;
+   4687c:	b8 01 00 00 00       	mov    $0x1,%eax
+   46881:	eb 89                	jmp    4680c <sched_idle_enter+0x49>
+
+0000000000046883 <sched_sleep>:
+
+void sched_sleep(proc *p, size_t nticks) {
+   46883:	49 89 f8             	mov    %rdi,%r8
+    asm("movq %%gs:0, %0" : "=r"(c));
+   46886:	65 48 8b 04 25 00 00 	mov    %gs:0x0,%rax
+   4688d:	00 00 
+static runqueue *this_runqueue() { return &runqueues[this_cpu()->index]; }
+   4688f:	44 8b 50 18          	mov    0x18(%rax),%r10d
+   46893:	49 63 c2             	movslq %r10d,%rax
+   46896:	4c 8d 0c 40          	lea    (%rax,%rax,2),%r9
+   4689a:	49 c1 e1 06          	shl    $0x6,%r9
+   4689e:	49 8d 91 00 82 05 00 	lea    0x58200(%r9),%rdx
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   468a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+   468aa:	eb 08                	jmp    468b4 <sched_sleep+0x31>
+   468ac:	f3 90                	pause
+        while (__atomic_load_n(&l->locked, __ATOMIC_RELAXED)) {
+   468ae:	8b 02                	mov    (%rdx),%eax
+   468b0:	85 c0                	test   %eax,%eax
+   468b2:	75 f8                	jne    468ac <sched_sleep+0x29>
+    while (__atomic_exchange_n(&l->locked, 1, __ATOMIC_ACQUIRE)) {
+   468b4:	89 c8                	mov    %ecx,%eax
+   468b6:	87 02                	xchg   %eax,(%rdx)
+   468b8:	85 c0                	test   %eax,%eax
+   468ba:	75 f2                	jne    468ae <sched_sleep+0x2b>
+  runqueue *rq = this_runqueue();
+  spinlock_acquire(&rq->lock);
+  p->state = P_SLEPT;
+   468bc:	41 c7 40 0c 04 00 00 	movl   $0x4,0xc(%r8)
+   468c3:	00 
+  p->sleep_ts = ticks;
+   468c4:	48 63 05 55 87 00 00 	movslq 0x8755(%rip),%rax        # 4f020 <ticks>
+   468cb:	49 89 80 d0 00 00 00 	mov    %rax,0xd0(%r8)
+  p->sleep_time = nticks;
+   468d2:	49 89 b0 d8 00 00 00 	mov    %rsi,0xd8(%r8)
+  size_t wake = p->sleep_ts + nticks;
+   468d9:	48 01 c6             	add    %rax,%rsi
+  pid_t *link = &rq->sleep_head;
+   468dc:	49 8d b9 90 82 05 00 	lea    0x58290(%r9),%rdi
+   468e3:	49 63 c2             	movslq %r10d,%rax
+   468e6:	48 8d 04 40          	lea    (%rax,%rax,2),%rax
+   468ea:	48 c1 e0 06          	shl    $0x6,%rax
+   468ee:	8b 80 90 82 05 00    	mov    0x58290(%rax),%eax
+  while (*link &&
+   468f4:	85 c0                	test   %eax,%eax
+   468f6:	74 37                	je     4692f <sched_sleep+0xac>
+         ptable[*link].sleep_ts + ptable[*link].sleep_time <= wake) {
+   468f8:	48 63 d0             	movslq %eax,%rdx
+   468fb:	48 69 d2 d0 01 00 00 	imul   $0x1d0,%rdx,%rdx
+   46902:	48 8b 8a 10 f1 04 00 	mov    0x4f110(%rdx),%rcx
+   46909:	48 03 8a 18 f1 04 00 	add    0x4f118(%rdx),%rcx
+  while (*link &&
+   46910:	48 39 ce             	cmp    %rcx,%rsi
+   46913:	72 1a                	jb     4692f <sched_sleep+0xac>
+    link = &ptable[*link].next;
+   46915:	48 98                	cltq
+   46917:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+   4691e:	48 8d b8 fc f1 04 00 	lea    0x4f1fc(%rax),%rdi
+   46925:	8b 80 fc f1 04 00    	mov    0x4f1fc(%rax),%eax
+  while (*link &&
+   4692b:	85 c0                	test   %eax,%eax
+   4692d:	75 c9                	jne    468f8 <sched_sleep+0x75>
+  }
+  p->next = *link;
+   4692f:	41 89 80 bc 01 00 00 	mov    %eax,0x1bc(%r8)
+  *link = p->pid;
+   46936:	41 8b 40 08          	mov    0x8(%r8),%eax
+   4693a:	89 07                	mov    %eax,(%rdi)
+    __atomic_store_n(&l->locked, 0, __ATOMIC_RELEASE);
+   4693c:	41 c7 81 00 82 05 00 	movl   $0x0,0x58200(%r9)
+   46943:	00 00 00 00 
+  spinlock_release(&rq->lock);
+}
+   46947:	c3                   	ret
+
+0000000000046948 <sched_report>:
+
+void sched_report() {
+   46948:	55                   	push   %rbp
+   46949:	48 89 e5             	mov    %rsp,%rbp
+   4694c:	41 56                	push   %r14
+   4694e:	41 55                	push   %r13
+   46950:	41 54                	push   %r12
+   46952:	53                   	push   %rbx
+  for (int level = 0; level < SCHED_NLEVELS; ++level) {
+   46953:	41 bc 10 88 05 00    	mov    $0x58810,%r12d
+    uint64_t picks = 0, wait_cycles = 0, wait_max = 0;
+   46959:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+   4695f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+   46965:	eb 12                	jmp    46979 <sched_report+0x31>
+  for (int level = 0; level < SCHED_NLEVELS; ++level) {
+   46967:	49 83 c5 01          	add    $0x1,%r13
+   4696b:	49 83 c4 20          	add    $0x20,%r12
+   4696f:	49 83 fd 04          	cmp    $0x4,%r13
+   46973:	0f 84 82 00 00 00    	je     469fb <sched_report+0xb3>
+    for (int i = 0; i < MAXCPU; ++i) {
+   46979:	49 8d 94 24 00 fa ff 	lea    -0x600(%r12),%rdx
+   46980:	ff 
+    uint64_t picks = 0, wait_cycles = 0, wait_max = 0;
+   46981:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+   46987:	4c 89 f0             	mov    %r14,%rax
+   4698a:	4c 89 f7             	mov    %r14,%rdi
+      runlevel *l = &runqueues[i].levels[level];
+      picks += l->picks;
+   4698d:	48 03 3a             	add    (%rdx),%rdi
+   46990:	48 89 fb             	mov    %rdi,%rbx
+      wait_cycles += l->wait_cycles;
+   46993:	48 03 42 08          	add    0x8(%rdx),%rax
+      wait_max = l->wait_max > wait_max ? l->wait_max : wait_max;
+   46997:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+   4699b:	49 39 c9             	cmp    %rcx,%r9
+   4699e:	4c 0f 42 c9          	cmovb  %rcx,%r9
+    for (int i = 0; i < MAXCPU; ++i) {
+   469a2:	48 81 c2 c0 00 00 00 	add    $0xc0,%rdx
+   469a9:	4c 39 e2             	cmp    %r12,%rdx
+   469ac:	75 df                	jne    4698d <sched_report+0x45>
+    }
+    if (picks && picks >= 2 * reported_picks[level]) {
+   469ae:	48 85 ff             	test   %rdi,%rdi
+   469b1:	74 b4                	je     46967 <sched_report+0x1f>
+   469b3:	4a 8b 34 ed a0 81 05 	mov    0x581a0(,%r13,8),%rsi
+   469ba:	00 
+   469bb:	48 8d 14 36          	lea    (%rsi,%rsi,1),%rdx
+   469bf:	48 39 d7             	cmp    %rdx,%rdi
+   469c2:	72 a3                	jb     46967 <sched_report+0x1f>
+   469c4:	44 89 ee             	mov    %r13d,%esi
+      log_printf("sched level %d quantum %d picks %lu wait %lu max %lu "
+   469c7:	ba 00 00 00 00       	mov    $0x0,%edx
+   469cc:	48 f7 f7             	div    %rdi
+static int sched_quantum(int level) { return 1 << level; }
+   469cf:	ba 01 00 00 00       	mov    $0x1,%edx
+   469d4:	44 89 e9             	mov    %r13d,%ecx
+   469d7:	d3 e2                	shl    %cl,%edx
+      log_printf("sched level %d quantum %d picks %lu wait %lu max %lu "
+   469d9:	49 89 c0             	mov    %rax,%r8
+   469dc:	48 89 f9             	mov    %rdi,%rcx
+   469df:	bf 88 76 04 00       	mov    $0x47688,%edi
+   469e4:	b8 00 00 00 00       	mov    $0x0,%eax
+   469e9:	e8 7e d5 ff ff       	call   43f6c <log_printf>
+                 "cycles\n",
+                 level, sched_quantum(level), picks, wait_cycles / picks,
+                 wait_max);
+      reported_picks[level] = picks;
+   469ee:	4a 89 1c ed a0 81 05 	mov    %rbx,0x581a0(,%r13,8)
+   469f5:	00 
+   469f6:	e9 6c ff ff ff       	jmp    46967 <sched_report+0x1f>
+   469fb:	b8 a0 82 05 00       	mov    $0x582a0,%eax
+   46a00:	b9 a0 88 05 00       	mov    $0x588a0,%ecx
+    }
+  }
+
+  uint64_t migrations = 0;
+   46a05:	ba 00 00 00 00       	mov    $0x0,%edx
+  for (int i = 0; i < MAXCPU; ++i) {
+    migrations += runqueues[i].migrations;
+   46a0a:	48 89 d3             	mov    %rdx,%rbx
+   46a0d:	48 03 18             	add    (%rax),%rbx
+   46a10:	48 89 da             	mov    %rbx,%rdx
+  for (int i = 0; i < MAXCPU; ++i) {
+   46a13:	48 05 c0 00 00 00    	add    $0xc0,%rax
+   46a19:	48 39 c8             	cmp    %rcx,%rax
+   46a1c:	75 ec                	jne    46a0a <sched_report+0xc2>
+  }
+  if (migrations && migrations >= 2 * reported_migrations) {
+   46a1e:	48 85 db             	test   %rbx,%rbx
+   46a21:	74 0f                	je     46a32 <sched_report+0xea>
+   46a23:	48 8b 05 56 17 01 00 	mov    0x11756(%rip),%rax        # 58180 <reported_migrations>
+   46a2a:	48 01 c0             	add    %rax,%rax
+   46a2d:	48 39 c3             	cmp    %rax,%rbx
+   46a30:	73 09                	jae    46a3b <sched_report+0xf3>
+    log_printf("sched migrations %lu\n", migrations);
+    reported_migrations = migrations;
+  }
+}
+   46a32:	5b                   	pop    %rbx
+   46a33:	41 5c                	pop    %r12
+   46a35:	41 5d                	pop    %r13
+   46a37:	41 5e                	pop    %r14
+   46a39:	5d                   	pop    %rbp
+   46a3a:	c3                   	ret
+    log_printf("sched migrations %lu\n", migrations);
+   46a3b:	48 89 de             	mov    %rbx,%rsi
+   46a3e:	bf c5 76 04 00       	mov    $0x476c5,%edi
+   46a43:	b8 00 00 00 00       	mov    $0x0,%eax
+   46a48:	e8 1f d5 ff ff       	call   43f6c <log_printf>
+    reported_migrations = migrations;
+   46a4d:	48 89 1d 2c 17 01 00 	mov    %rbx,0x1172c(%rip)        # 58180 <reported_migrations>
+}
+   46a54:	eb dc                	jmp    46a32 <sched_report+0xea>
+
+0000000000046a56 <smp_delay>:
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   46a56:	0f 31                	rdtsc
+   46a58:	48 89 d1             	mov    %rdx,%rcx
+   46a5b:	48 89 c6             	mov    %rax,%rsi
+_Static_assert(__builtin_offsetof(cpustate, syscall_rsp) ==
+                   CPUSTATE_SYSCALL_RSP,
+               "exception.S uses cpustate::syscall_rsp");
+
+static void smp_delay(uint64_t us) {
+  uint64_t end = rdtsc() + tsc_per_tick * HZ * us / 1000000;
+   46a5e:	48 0f af 3d b2 85 00 	imul   0x85b2(%rip),%rdi        # 4f018 <tsc_per_tick>
+   46a65:	00 
+   46a66:	48 8d 04 bf          	lea    (%rdi,%rdi,4),%rax
+   46a6a:	48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+   46a6e:	48 c1 e2 02          	shl    $0x2,%rdx
+   46a72:	48 bf db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rdi
+   46a79:	de 1b 43 
+   46a7c:	48 89 d0             	mov    %rdx,%rax
+   46a7f:	48 f7 e7             	mul    %rdi
+   46a82:	48 c1 ea 12          	shr    $0x12,%rdx
+    return low | (high << 32);
+   46a86:	48 c1 e1 20          	shl    $0x20,%rcx
+   46a8a:	48 09 f1             	or     %rsi,%rcx
+   46a8d:	48 01 d1             	add    %rdx,%rcx
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   46a90:	0f 31                	rdtsc
+    return low | (high << 32);
+   46a92:	48 c1 e2 20          	shl    $0x20,%rdx
+   46a96:	48 09 c2             	or     %rax,%rdx
+  while (rdtsc() < end) {
+   46a99:	48 39 ca             	cmp    %rcx,%rdx
+   46a9c:	73 10                	jae    46aae <smp_delay+0x58>
+    asm volatile("pause" : : : "memory");
+   46a9e:	f3 90                	pause
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   46aa0:	0f 31                	rdtsc
+    return low | (high << 32);
+   46aa2:	48 c1 e2 20          	shl    $0x20,%rdx
+   46aa6:	48 09 c2             	or     %rax,%rdx
+   46aa9:	48 39 ca             	cmp    %rcx,%rdx
+   46aac:	72 f0                	jb     46a9e <smp_delay+0x48>
+    pause();
+  }
+}
+   46aae:	c3                   	ret
+
+0000000000046aaf <smp_ipi>:
+
+// smp_ipi(dest, icr)
+//    Send the IPI described by `icr` to the CPU with local APIC ID `dest`
+//    (ignored for broadcasts) and wait until the local APIC has delivered
+//    it.
+static void smp_ipi(int dest, uint32_t icr) {
+   46aaf:	55                   	push   %rbp
+   46ab0:	48 89 e5             	mov    %rsp,%rbp
+   46ab3:	41 55                	push   %r13
+   46ab5:	41 54                	push   %r12
+   46ab7:	53                   	push   %rbx
+   46ab8:	48 83 ec 08          	sub    $0x8,%rsp
+   46abc:	41 89 fc             	mov    %edi,%r12d
+   46abf:	41 89 f5             	mov    %esi,%r13d
+  lapicstate_t *lapic = lapic_get();
+   46ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+   46ac7:	e8 ea c9 ff ff       	call   434b6 <lapic_get>
+   46acc:	48 89 c3             	mov    %rax,%rbx
+  lapic_write(lapic, APIC_REG_ICR_HIGH, (uint32_t)dest << 24);
+   46acf:	44 89 e2             	mov    %r12d,%edx
+   46ad2:	c1 e2 18             	shl    $0x18,%edx
+   46ad5:	be 31 00 00 00       	mov    $0x31,%esi
+   46ada:	48 89 c7             	mov    %rax,%rdi
+   46add:	e8 ab c9 ff ff       	call   4348d <lapic_write>
+  lapic_write(lapic, APIC_REG_ICR_LOW, icr);
+   46ae2:	44 89 ea             	mov    %r13d,%edx
+   46ae5:	be 30 00 00 00       	mov    $0x30,%esi
+   46aea:	48 89 df             	mov    %rbx,%rdi
+   46aed:	e8 9b c9 ff ff       	call   4348d <lapic_write>
+  while (lapic_read(lapic, APIC_REG_ICR_LOW) & IPI_DELIVERY_STATUS) {
+   46af2:	eb 02                	jmp    46af6 <smp_ipi+0x47>
+    asm volatile("pause" : : : "memory");
+   46af4:	f3 90                	pause
+   46af6:	be 30 00 00 00       	mov    $0x30,%esi
+   46afb:	48 89 df             	mov    %rbx,%rdi
+   46afe:	e8 7d c9 ff ff       	call   43480 <lapic_read>
+   46b03:	f6 c4 10             	test   $0x10,%ah
+   46b06:	75 ec                	jne    46af4 <smp_ipi+0x45>
+    pause();
+  }
+}
+   46b08:	48 83 c4 08          	add    $0x8,%rsp
+   46b0c:	5b                   	pop    %rbx
+   46b0d:	41 5c                	pop    %r12
+   46b0f:	41 5d                	pop    %r13
+   46b11:	5d                   	pop    %rbp
+   46b12:	c3                   	ret
+
+0000000000046b13 <smp_init>:
+
+void smp_init() {
+   46b13:	55                   	push   %rbp
+   46b14:	48 89 e5             	mov    %rsp,%rbp
+   46b17:	41 54                	push   %r12
+   46b19:	53                   	push   %rbx
+  for (int i = 1; i < MAXCPU; ++i) {
+   46b1a:	bb 08 88 05 00       	mov    $0x58808,%ebx
+   46b1f:	41 bc 40 88 05 00    	mov    $0x58840,%r12d
+    void *stack = kalloc(PAGESIZE);
+   46b25:	bf 00 10 00 00       	mov    $0x1000,%edi
+   46b2a:	e8 be a5 ff ff       	call   410ed <kalloc>
+    if (!stack) {
+   46b2f:	48 85 c0             	test   %rax,%rax
+   46b32:	0f 84 a5 00 00 00    	je     46bdd <smp_init+0xca>
+      log_printf("smp: out of memory\n");
+      return;
+    }
+    ap_stack_top[i] = (uintptr_t)stack + PAGESIZE;
+   46b38:	48 05 00 10 00 00    	add    $0x1000,%rax
+   46b3e:	48 89 03             	mov    %rax,(%rbx)
+  for (int i = 1; i < MAXCPU; ++i) {
+   46b41:	48 83 c3 08          	add    $0x8,%rbx
+   46b45:	4c 39 e3             	cmp    %r12,%rbx
+   46b48:	75 db                	jne    46b25 <smp_init+0x12>
+  }
+  memcpy((void *)AP_TRAMPOLINE_ADDR, ap_trampoline,
+         ap_trampoline_end - ap_trampoline);
+   46b4a:	ba ce 00 04 00       	mov    $0x400ce,%edx
+   46b4f:	48 81 ea 2d 00 04 00 	sub    $0x4002d,%rdx
+  memcpy((void *)AP_TRAMPOLINE_ADDR, ap_trampoline,
+   46b56:	be 2d 00 04 00       	mov    $0x4002d,%esi
+   46b5b:	bf 00 70 00 00       	mov    $0x7000,%edi
+   46b60:	e8 46 da ff ff       	call   445ab <memcpy>
+
+  smp_ipi(0, IPI_ALL_EXCLUDING_SELF | IPI_INIT | IPI_LEVEL_ASSERT);
+   46b65:	be 00 45 0c 00       	mov    $0xc4500,%esi
+   46b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+   46b6f:	e8 3b ff ff ff       	call   46aaf <smp_ipi>
+  smp_delay(SMP_INIT_DELAY_US);
+   46b74:	bf 10 27 00 00       	mov    $0x2710,%edi
+   46b79:	e8 d8 fe ff ff       	call   46a56 <smp_delay>
+  for (int i = 0; i < 2; ++i) {
+    smp_ipi(0, IPI_ALL_EXCLUDING_SELF | IPI_STARTUP |
+   46b7e:	be 07 06 0c 00       	mov    $0xc0607,%esi
+   46b83:	bf 00 00 00 00       	mov    $0x0,%edi
+   46b88:	e8 22 ff ff ff       	call   46aaf <smp_ipi>
+                   (AP_TRAMPOLINE_ADDR >> 12));
+    smp_delay(SMP_SIPI_DELAY_US);
+   46b8d:	bf c8 00 00 00       	mov    $0xc8,%edi
+   46b92:	e8 bf fe ff ff       	call   46a56 <smp_delay>
+    smp_ipi(0, IPI_ALL_EXCLUDING_SELF | IPI_STARTUP |
+   46b97:	be 07 06 0c 00       	mov    $0xc0607,%esi
+   46b9c:	bf 00 00 00 00       	mov    $0x0,%edi
+   46ba1:	e8 09 ff ff ff       	call   46aaf <smp_ipi>
+    smp_delay(SMP_SIPI_DELAY_US);
+   46ba6:	bf c8 00 00 00       	mov    $0xc8,%edi
+   46bab:	e8 a6 fe ff ff       	call   46a56 <smp_delay>
+  }
+  smp_delay(SMP_WAIT_US);
+   46bb0:	bf 10 27 00 00       	mov    $0x2710,%edi
+   46bb5:	e8 9c fe ff ff       	call   46a56 <smp_delay>
+  ncpu = 1 + __atomic_load_n(&ap_started, __ATOMIC_ACQUIRE);
+   46bba:	8b 35 e0 23 01 00    	mov    0x123e0(%rip),%esi        # 58fa0 <ap_started>
+   46bc0:	83 c6 01             	add    $0x1,%esi
+   46bc3:	89 35 bb 14 00 00    	mov    %esi,0x14bb(%rip)        # 48084 <ncpu>
+  log_printf("smp %d cpus\n", ncpu);
+   46bc9:	bf ef 76 04 00       	mov    $0x476ef,%edi
+   46bce:	b8 00 00 00 00       	mov    $0x0,%eax
+   46bd3:	e8 94 d3 ff ff       	call   43f6c <log_printf>
+}
+   46bd8:	5b                   	pop    %rbx
+   46bd9:	41 5c                	pop    %r12
+   46bdb:	5d                   	pop    %rbp
+   46bdc:	c3                   	ret
+      log_printf("smp: out of memory\n");
+   46bdd:	bf db 76 04 00       	mov    $0x476db,%edi
+   46be2:	e8 85 d3 ff ff       	call   43f6c <log_printf>
+      return;
+   46be7:	eb ef                	jmp    46bd8 <smp_init+0xc5>
+
+0000000000046be9 <smp_wake>:
+
+void smp_wake(int cpu) {
+   46be9:	55                   	push   %rbp
+   46bea:	48 89 e5             	mov    %rsp,%rbp
+  smp_ipi(cpus[cpu].lapic_id, IPI_GIVEN | (INT_IRQ + IRQ_WAKEUP));
+   46bed:	48 63 ff             	movslq %edi,%rdi
+   46bf0:	48 69 ff e8 00 00 00 	imul   $0xe8,%rdi,%rdi
+   46bf7:	8b bf 7c 88 05 00    	mov    0x5887c(%rdi),%edi
+   46bfd:	be 22 00 00 00       	mov    $0x22,%esi
+   46c02:	e8 a8 fe ff ff       	call   46aaf <smp_ipi>
+}
+   46c07:	5d                   	pop    %rbp
+   46c08:	c3                   	ret
+
+0000000000046c09 <ap_entry>:
+
+// ap_entry(index)
+//    Called by `ap_trampoline` on CPU `index`'s kernel stack.
+__attribute__((noreturn)) void ap_entry(int index) {
+   46c09:	55                   	push   %rbp
+   46c0a:	48 89 e5             	mov    %rsp,%rbp
+  init_cpu_state(index, ap_stack_top[index]);
+   46c0d:	48 63 c7             	movslq %edi,%rax
+   46c10:	48 8b 34 c5 00 88 05 	mov    0x58800(,%rax,8),%rsi
+   46c17:	00 
+   46c18:	e8 88 b7 ff ff       	call   423a5 <init_cpu_state>
+  __atomic_add_fetch(&ap_started, 1, __ATOMIC_RELEASE);
+   46c1d:	f0 83 05 7b 23 01 00 	lock addl $0x1,0x1237b(%rip)        # 58fa0 <ap_started>
+   46c24:	01 
+  schedule();
+   46c25:	b8 00 00 00 00       	mov    $0x0,%eax
+   46c2a:	e8 70 b2 ff ff       	call   41e9f <schedule>
+
+0000000000046c2f <schedbench_spin>:
+  uint64_t gap = d->gap;
+   46c2f:	4c 8b 47 08          	mov    0x8(%rdi),%r8
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   46c33:	0f 31                	rdtsc
+    return low | (high << 32);
+   46c35:	48 c1 e2 20          	shl    $0x20,%rdx
+   46c39:	48 89 d1             	mov    %rdx,%rcx
+   46c3c:	48 09 c1             	or     %rax,%rcx
+  while (!d->stop) {
+   46c3f:	8b 47 10             	mov    0x10(%rdi),%eax
+   46c42:	85 c0                	test   %eax,%eax
+   46c44:	75 6c                	jne    46cb2 <schedbench_spin+0x83>
+      ++st->runs;
+   46c46:	48 63 f6             	movslq %esi,%rsi
+   46c49:	48 c1 e6 05          	shl    $0x5,%rsi
+   46c4d:	48 01 fe             	add    %rdi,%rsi
+   46c50:	eb 0a                	jmp    46c5c <schedbench_spin+0x2d>
+    d->last = mine = t;
+   46c52:	48 89 0f             	mov    %rcx,(%rdi)
+  while (!d->stop) {
+   46c55:	8b 47 10             	mov    0x10(%rdi),%eax
+   46c58:	85 c0                	test   %eax,%eax
+   46c5a:	75 56                	jne    46cb2 <schedbench_spin+0x83>
+    asm volatile("rdtsc" : "=a" (low), "=d" (high));
+   46c5c:	0f 31                	rdtsc
+    return low | (high << 32);
+   46c5e:	49 89 c9             	mov    %rcx,%r9
+   46c61:	48 c1 e2 20          	shl    $0x20,%rdx
+   46c65:	48 89 d1             	mov    %rdx,%rcx
+   46c68:	48 09 c1             	or     %rax,%rcx
+    if (t - mine > gap) {
+   46c6b:	48 89 c8             	mov    %rcx,%rax
+   46c6e:	4c 29 c8             	sub    %r9,%rax
+   46c71:	49 39 c0             	cmp    %rax,%r8
+   46c74:	73 dc                	jae    46c52 <schedbench_spin+0x23>
+      uint64_t latency = t - d->last;
+   46c76:	48 8b 17             	mov    (%rdi),%rdx
+   46c79:	49 89 c9             	mov    %rcx,%r9
+   46c7c:	49 29 d1             	sub    %rdx,%r9
+      ++st->runs;
+   46c7f:	48 8b 56 18          	mov    0x18(%rsi),%rdx
+   46c83:	48 83 c2 01          	add    $0x1,%rdx
+   46c87:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+      st->switch_cycles += latency;
+   46c8b:	48 8b 56 20          	mov    0x20(%rsi),%rdx
+   46c8f:	4c 01 ca             	add    %r9,%rdx
+   46c92:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+      if (latency > st->switch_max) {
+   46c96:	48 8b 56 28          	mov    0x28(%rsi),%rdx
+   46c9a:	4c 39 ca             	cmp    %r9,%rdx
+   46c9d:	73 04                	jae    46ca3 <schedbench_spin+0x74>
+        st->switch_max = latency;
+   46c9f:	4c 89 4e 28          	mov    %r9,0x28(%rsi)
+      if (t - mine > st->wait_max) {
+   46ca3:	48 8b 56 30          	mov    0x30(%rsi),%rdx
+   46ca7:	48 39 c2             	cmp    %rax,%rdx
+   46caa:	73 a6                	jae    46c52 <schedbench_spin+0x23>
+        st->wait_max = t - mine;
+   46cac:	48 89 46 30          	mov    %rax,0x30(%rsi)
+   46cb0:	eb a0                	jmp    46c52 <schedbench_spin+0x23>
+  asm volatile("syscall" : : "a"(SYSCALL_EXIT) : "rcx", "r11", "memory");
+   46cb2:	b8 0b 00 00 00       	mov    $0xb,%eax
+   46cb7:	0f 05                	syscall
+
+0000000000046cb9 <schedscale_job>:
+schedscale_job(volatile schedscale_data *d, int i) {
+   46cb9:	55                   	push   %rbp
+   46cba:	48 89 e5             	mov    %rsp,%rbp
+   46cbd:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t work = d->work;
+   46cc1:	48 8b 97 c0 03 00 00 	mov    0x3c0(%rdi),%rdx
+  while (!d->stop) {
+   46cc8:	8b 87 c8 03 00 00    	mov    0x3c8(%rdi),%eax
+   46cce:	85 c0                	test   %eax,%eax
+   46cd0:	75 58                	jne    46d2a <schedscale_job+0x71>
+   46cd2:	49 89 f8             	mov    %rdi,%r8
+   46cd5:	48 63 f6             	movslq %esi,%rsi
+   46cd8:	48 c1 e6 06          	shl    $0x6,%rsi
+   46cdc:	48 01 fe             	add    %rdi,%rsi
+  asm volatile("syscall" : "+a"(rax) : "D"(ms) : "rcx", "r11", "memory");
+   46cdf:	41 b9 0a 00 00 00    	mov    $0xa,%r9d
+    for (volatile uint64_t n = 0; n < work; ++n) {
+   46ce5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+   46cec:	00 
+   46ced:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+   46cf1:	48 39 d0             	cmp    %rdx,%rax
+   46cf4:	73 15                	jae    46d0b <schedscale_job+0x52>
+   46cf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+   46cfa:	48 83 c0 01          	add    $0x1,%rax
+   46cfe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+   46d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+   46d06:	48 39 d0             	cmp    %rdx,%rax
+   46d09:	72 eb                	jb     46cf6 <schedscale_job+0x3d>
+    ++count->jobs;
+   46d0b:	48 8b 06             	mov    (%rsi),%rax
+   46d0e:	48 83 c0 01          	add    $0x1,%rax
+   46d12:	48 89 06             	mov    %rax,(%rsi)
+  asm volatile("syscall" : "+a"(rax) : "D"(ms) : "rcx", "r11", "memory");
+   46d15:	4c 89 c8             	mov    %r9,%rax
+   46d18:	bf 00 00 00 00       	mov    $0x0,%edi
+   46d1d:	0f 05                	syscall
+  while (!d->stop) {
+   46d1f:	41 8b 80 c8 03 00 00 	mov    0x3c8(%r8),%eax
+   46d26:	85 c0                	test   %eax,%eax
+   46d28:	74 bb                	je     46ce5 <schedscale_job+0x2c>
+  asm volatile("syscall" : : "a"(SYSCALL_EXIT) : "rcx", "r11", "memory");
+   46d2a:	b8 0b 00 00 00       	mov    $0xb,%eax
+   46d2f:	0f 05                	syscall
@@ -0,0 +1,141 @@
+#include "kernel.h"
+
+// Pipes (see kernel.h)
+//    Pipe operations are system calls, so `kernel_lock` serializes them.
+//    The ring buffer's counters `head` (bytes read) and `tail` (bytes
+//    written) run freely; `tail - head` is the number of buffered bytes
+//    and PIPE_SIZE is a power of two.
+//
+//    Processes blocked on an end are chained through `proc::next`, which
+//    is free while they are off the run queues, from `readers` or
+//    `writers`. The other side wakes all of them after its next transfer
+//    and empties the chain, so a run of small writes wakes each reader
+//    once, not once per write. A woken process re-executes its `syscall`
+//    instruction, and blocks again if the pipe is still empty (or full).
+
+typedef struct pipe {
+  char *buf;      // PIPE_SIZE bytes; `nullptr` if the slot is free
+  uint64_t head;  // bytes read
+  uint64_t tail;  // bytes written
+  pid_t readers;  // first process blocked reading, or 0
+  pid_t writers;  // first process blocked writing, or 0
+  bool closed[2]; // read end, write end
+} pipe;
+
+static pipe pipes[NPIPE]; // `pipes[0]` is never used
+
+static pipe *pipe_get(int id) {
+  if (id <= 0 || id >= NPIPE || !pipes[id].buf) {
+    return NULL;
+  }
+  return &pipes[id];
+}
+
+// pipe_wake(waiters)
+//    Wake every process chained from `*waiters` and empty the chain.
+static void pipe_wake(pid_t *waiters) {
+  pid_t pid = *waiters;
+  *waiters = 0;
+  while (pid) {
+    proc *w = &ptable[pid];
+    pid = w->next; // `sched_wake` reuses the link
+    sched_wake(w);
+  }
+}
+
+// pipe_block(p, waiters)
+//    Block `p` on a pipe end's chain `*waiters` and arrange for it to
+//    retry its system call (`syscall` is 2 bytes long) when woken. Returns
+//    the system call number, which the retry needs back in %rax.
+static long pipe_block(proc *p, pid_t *waiters) {
+  p->next = *waiters;
+  *waiters = p->pid;
+  p->state = P_BLOCKED;
+  p->regs.reg_rip -= 2;
+  return p->regs.reg_rax;
+}
+
+int pipe_create() {
+  int id = 1;
+  while (id < NPIPE && pipes[id].buf) {
+    ++id;
+  }
+  if (id == NPIPE) {
+    return -1;
+  }
+  pipe *pp = &pipes[id];
+  pp->buf = kalloc(PIPE_SIZE);
+  if (!pp->buf) {
+    return -1;
+  }
+  pp->head = pp->tail = 0;
+  pp->readers = pp->writers = 0;
+  pp->closed[0] = pp->closed[1] = false;
+  return id;
+}
+
+long pipe_read(proc *p, int id, uintptr_t buf, size_t n) {
+  pipe *pp = pipe_get(id);
+  if (!pp || pp->closed[0]) {
+    return -1;
+  }
+  uint64_t head = pp->head;
+  size_t avail = pp->tail - head;
+  if (avail == 0) {
+    if (!pp->closed[1] && n > 0) {
+      return pipe_block(p, &pp->readers);
+    }
+    return 0;
+  }
+
+  n = n < avail ? n : avail;
+  if (!proc_access(p, buf, n, true)) {
+    return -1;
+  }
+  size_t off = head % PIPE_SIZE;
+  size_t first = n < PIPE_SIZE - off ? n : PIPE_SIZE - off;
+  memcpy((void *)buf, pp->buf + off, first);
+  memcpy((void *)(buf + first), pp->buf, n - first);
+  pp->head = head + n;
+  pipe_wake(&pp->writers);
+  return n;
+}
+
+long pipe_write(proc *p, int id, uintptr_t buf, size_t n) {
+  pipe *pp = pipe_get(id);
+  if (!pp || pp->closed[1] || pp->closed[0]) {
+    return -1;
+  }
+  uint64_t tail = pp->tail;
+  size_t space = PIPE_SIZE - (tail - pp->head);
+  if (space == 0) {
+    return n > 0 ? pipe_block(p, &pp->writers) : 0;
+  }
+
+  n = n < space ? n : space;
+  if (!proc_access(p, buf, n, false)) {
+    return -1;
+  }
+  size_t off = tail % PIPE_SIZE;
+  size_t first = n < PIPE_SIZE - off ? n : PIPE_SIZE - off;
+  memcpy(pp->buf + off, (const void *)buf, first);
+  memcpy(pp->buf, (const void *)(buf + first), n - first);
+  pp->tail = tail + n;
+  pipe_wake(&pp->readers);
+  return n;
+}
+
+int pipe_close(int id, int end) {
+  pipe *pp = pipe_get(id);
+  if (!pp || (end != 0 && end != 1) || pp->closed[end]) {
+    return -1;
+  }
+  pp->closed[end] = true;
+  // blocked peers retry and see end of file or an error
+  pipe_wake(end ? &pp->readers : &pp->writers);
+  if (pp->closed[0] && pp->closed[1]) {
+    kfree(pp->buf);
+    pp->buf = NULL;
+  }
+  return 0;
+}
@@ -0,0 +1,374 @@
+#include "kernel.h"
+#include "log.h"
+
+// Run queues (see kernel.h)
+//    Each CPU has its own run queue: one FIFO per priority level, linked
+//    through `proc::next` by pid, with bit `l` of `bitmap` set iff level
+//    `l` is nonempty, so the highest-priority waiting process is found
+//    with one bit scan. Sleeping processes sit on the queue's sleep list,
+//    sorted by wake-up tick. Each queue has its own lock, so CPUs schedule
+//    without `kernel_lock`; no code holds two queue locks at once.
+//
+//    A process stays with CPU `proc::cpu`, whose queue it joins when it is
+//    preempted, woken, or forked, so its cache footprint stays warm. A CPU
+//    whose queue is empty steals from the peer with the most queued
+//    processes, and every SCHED_BALANCE_TICKS each CPU pulls one process
+//    from the busiest peer if that peer has SCHED_IMBALANCE more queued
+//    than it. Both move the process that has waited longest, whose cache
+//    footprint is the coldest.
+//
+//    An idle CPU with nothing to steal halts with its timer stopped, or
+//    set for its first sleeper (see `idle` in kernel.c), after setting its
+//    bit in `idle_cpus`. Queueing work wakes it with an IPI (`sched_kick`).
+//
+//    Multi-level feedback: a process starts at level 0 and may run for
+//    its level's quantum (1 << level ticks) before it is preempted and
+//    demoted one level, so CPU hogs sink. A process that blocks or sleeps
+//    is promoted one level, with a fresh quantum, when it wakes, so
+//    interactive processes stay near the top. A process preempted for a
+//    higher-priority one keeps its level and the rest of its quantum.
+//    Every SCHED_BOOST_TICKS each CPU returns its queued, sleeping, and
+//    running processes to level 0, so hogs cannot starve.
+
+#define SCHED_BOOST_TICKS HZ
+#define SCHED_BALANCE_TICKS (HZ / 10)
+#define SCHED_IMBALANCE 2
+
+typedef struct runlevel {
+  pid_t head; // 0 if empty
+  pid_t tail;
+  // wait-time statistics for this CPU's picks: TSC cycles from enqueue
+  // to pick
+  uint64_t picks;
+  uint64_t wait_cycles;
+  uint64_t wait_max;
+} runlevel;
+
+typedef struct __attribute__((aligned(64))) runqueue {
+  spinlock lock;
+  runlevel levels[SCHED_NLEVELS];
+  uint32_t bitmap;
+  int nqueued;
+  pid_t sleep_head;
+  int boost_tick;
+  int balance_tick;
+  uint64_t migrations; // processes taken from other CPUs' queues
+} runqueue;
+
+static runqueue runqueues[MAXCPU];
+static uint32_t idle_cpus; // bit `i` set while CPU `i` is halted in `idle`
+
+// statistics at the last `sched_report`
+static uint64_t reported_picks[SCHED_NLEVELS];
+static uint64_t reported_migrations;
+
+static int sched_quantum(int level) { return 1 << level; }
+
+static void sched_refresh(proc *p) {
+  p->priority = 0;
+  p->quantum = sched_quantum(0);
+}
+
+// The `runqueue_*` functions require `rq->lock`.
+
+static void runqueue_push(runqueue *rq, proc *p) {
+  runlevel *l = &rq->levels[p->priority];
+  p->next = 0;
+  p->enqueue_tsc = rdtsc();
+  if (l->head) {
+    ptable[l->tail].next = p->pid;
+  } else {
+    l->head = p->pid;
+    rq->bitmap |= 1U << p->priority;
+  }
+  l->tail = p->pid;
+  ++rq->nqueued;
+}
+
+static proc *runqueue_pop(runqueue *rq) {
+  if (!rq->bitmap) {
+    return NULL;
+  }
+  int level = __builtin_ctz(rq->bitmap);
+  runlevel *l = &rq->levels[level];
+  proc *p = &ptable[l->head];
+  l->head = p->next;
+  if (!l->head) {
+    rq->bitmap &= ~(1U << level);
+  }
+  --rq->nqueued;
+  return p;
+}
+
+static void runqueue_wake(runqueue *rq, proc *p) {
+  if (p->priority > 0) {
+    --p->priority;
+    p->quantum = sched_quantum(p->priority);
+  }
+  p->state = P_RUNNABLE;
+  runqueue_push(rq, p);
+}
+
+// runqueue_boost(rq, running)
+//    Move every process queued or sleeping on `rq`, and `running` (if
+//    not `nullptr`), to level 0 with a fresh quantum. Queued processes
+//    keep their order, higher levels first.
+static void runqueue_boost(runqueue *rq, proc *running) {
+  runlevel *top = &rq->levels[0];
+  for (int level = 1; level < SCHED_NLEVELS; ++level) {
+    runlevel *l = &rq->levels[level];
+    if (!l->head) {
+      continue;
+    }
+    if (top->head) {
+      ptable[top->tail].next = l->head;
+    } else {
+      top->head = l->head;
+    }
+    top->tail = l->tail;
+    l->head = 0;
+  }
+  if (rq->bitmap) {
+    rq->bitmap = 1;
+  }
+  for (pid_t pid = top->head; pid; pid = ptable[pid].next) {
+    sched_refresh(&ptable[pid]);
+  }
+  for (pid_t pid = rq->sleep_head; pid; pid = ptable[pid].next) {
+    sched_refresh(&ptable[pid]);
+  }
+  if (running) {
+    sched_refresh(running);
+  }
+}
+
+static runqueue *this_runqueue() { return &runqueues[this_cpu()->index]; }
+
+// runqueue_busiest(self, min)
+//    Return the peer of `self` (any queue, if `self` is `nullptr`) with
+//    the most queued processes, or `nullptr` if none has at least `min`.
+//    Reads the counts unlocked, so the answer may be stale.
+static runqueue *runqueue_busiest(runqueue *self, int min) {
+  runqueue *busiest = NULL;
+  int most = min - 1;
+  for (int i = 0; i < MAXCPU; ++i) {
+    runqueue *rq = &runqueues[i];
+    int n = __atomic_load_n(&rq->nqueued, __ATOMIC_RELAXED);
+    if (rq != self && n > most) {
+      busiest = rq;
+      most = n;
+    }
+  }
+  return busiest;
+}
+
+// runqueue_steal(self, min)
+//    Take the longest-waiting top-priority process from the busiest peer
+//    of `self` with at least `min` queued, or return `nullptr`.
+static proc *runqueue_steal(runqueue *self, int min) {
+  runqueue *victim = runqueue_busiest(self, min);
+  if (!victim) {
+    return NULL;
+  }
+  spinlock_acquire(&victim->lock);
+  proc *p = runqueue_pop(victim);
+  spinlock_release(&victim->lock);
+  if (p) {
+    ++self->migrations;
+  }
+  return p;
+}
+
+// runqueue_balance(rq)
+//    Pull one process to `rq` (this CPU's) if a peer has SCHED_IMBALANCE
+//    more queued.
+static void runqueue_balance(runqueue *rq) {
+  int n = __atomic_load_n(&rq->nqueued, __ATOMIC_RELAXED);
+  proc *p = runqueue_steal(rq, n + SCHED_IMBALANCE);
+  if (p) {
+    p->cpu = this_cpu()->index;
+    spinlock_acquire(&rq->lock);
+    runqueue_push(rq, p);
+    spinlock_release(&rq->lock);
+  }
+}
+
+// sched_kick(cpu, nqueued)
+//    Call after queueing work on CPU `cpu`, which now has `nqueued`
+//    processes waiting, not counting one it is running. Wakes `cpu` if it
+//    is idle, or else another idle CPU to steal if `cpu` has more queued
+//    than it will run next.
+static void sched_kick(int cpu, int nqueued) {
+  // order the push before reading `idle_cpus`; `sched_idle_enter` does
+  // the reverse
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  uint32_t idle = __atomic_load_n(&idle_cpus, __ATOMIC_RELAXED);
+  int target;
+  if (idle & (1U << cpu)) {
+    target = cpu;
+  } else if (idle && nqueued > 1) {
+    target = __builtin_ctz(idle);
+  } else {
+    return;
+  }
+  // only the first kicker sends the IPI
+  if (__atomic_fetch_and(&idle_cpus, ~(1U << target), __ATOMIC_RELAXED) &
+      (1U << target)) {
+    smp_wake(target);
+  }
+}
+
+void sched_enqueue(proc *p) {
+  runqueue *rq = &runqueues[p->cpu];
+  spinlock_acquire(&rq->lock);
+  p->state = P_RUNNABLE;
+  runqueue_push(rq, p);
+  int n = rq->nqueued;
+  spinlock_release(&rq->lock);
+  sched_kick(p->cpu, n);
+}
+
+void sched_wake(proc *p) {
+  runqueue *rq = &runqueues[p->cpu];
+  spinlock_acquire(&rq->lock);
+  runqueue_wake(rq, p);
+  int n = rq->nqueued;
+  spinlock_release(&rq->lock);
+  sched_kick(p->cpu, n);
+}
+
+proc *sched_pick() {
+  cpustate *c = this_cpu();
+  runqueue *rq = &runqueues[c->index];
+  spinlock_acquire(&rq->lock);
+  proc *p = runqueue_pop(rq);
+  spinlock_release(&rq->lock);
+  if (!p && !(p = runqueue_steal(rq, 1))) {
+    return NULL;
+  }
+  p->cpu = c->index;
+
+  runlevel *l = &rq->levels[p->priority];
+  uint64_t wait = rdtsc() - p->enqueue_tsc;
+  ++l->picks;
+  l->wait_cycles += wait;
+  l->wait_max = wait > l->wait_max ? wait : l->wait_max;
+  return p;
+}
+
+void sched_init_proc(proc *p) {
+  sched_refresh(p);
+  p->cpu = this_cpu()->index;
+}
+
+bool sched_tick(proc *p) {
+  runqueue *rq = this_runqueue();
+  spinlock_acquire(&rq->lock);
+  bool woke = false;
+  while (rq->sleep_head && ptable[rq->sleep_head].sleep_ts +
+                                   ptable[rq->sleep_head].sleep_time <=
+                               (size_t)ticks) {
+    proc *s = &ptable[rq->sleep_head];
+    rq->sleep_head = s->next;
+    runqueue_wake(rq, s);
+    woke = true;
+  }
+  if (++rq->boost_tick == SCHED_BOOST_TICKS) {
+    rq->boost_tick = 0;
+    runqueue_boost(rq, p);
+  }
+
+  bool preempt = false;
+  if (p && --p->quantum <= 0) {
+    if (p->priority < SCHED_NLEVELS - 1) {
+      ++p->priority;
+    }
+    p->quantum = sched_quantum(p->priority);
+    preempt = true;
+  } else if (p) {
+    // a higher-priority process is waiting
+    preempt = (rq->bitmap & ((1U << p->priority) - 1)) != 0;
+  }
+  bool balance = ++rq->balance_tick == SCHED_BALANCE_TICKS;
+  if (balance) {
+    rq->balance_tick = 0;
+  }
+  int n = rq->nqueued + (p != NULL);
+  spinlock_release(&rq->lock);
+
+  if (woke) {
+    sched_kick(this_cpu()->index, n);
+  }
+  if (balance) {
+    runqueue_balance(rq);
+  }
+  return preempt;
+}
+
+bool sched_idle_enter(size_t *wake) {
+  int cpu = this_cpu()->index;
+  __atomic_fetch_or(&idle_cpus, 1U << cpu, __ATOMIC_SEQ_CST);
+  if (runqueue_busiest(NULL, 1)) {
+    sched_idle_exit();
+    return false;
+  }
+  runqueue *rq = &runqueues[cpu];
+  spinlock_acquire(&rq->lock);
+  *wake = 0;
+  if (rq->sleep_head) {
+    proc *s = &ptable[rq->sleep_head];
+    *wake = s->sleep_ts + s->sleep_time;
+  }
+  spinlock_release(&rq->lock);
+  return true;
+}
+
+void sched_idle_exit() {
+  __atomic_fetch_and(&idle_cpus, ~(1U << this_cpu()->index),
+                     __ATOMIC_RELAXED);
+}
+
+void sched_sleep(proc *p, size_t nticks) {
+  runqueue *rq = this_runqueue();
+  spinlock_acquire(&rq->lock);
+  p->state = P_SLEPT;
+  p->sleep_ts = ticks;
+  p->sleep_time = nticks;
+  size_t wake = p->sleep_ts + nticks;
+  pid_t *link = &rq->sleep_head;
+  while (*link &&
+         ptable[*link].sleep_ts + ptable[*link].sleep_time <= wake) {
+    link = &ptable[*link].next;
+  }
+  p->next = *link;
+  *link = p->pid;
+  spinlock_release(&rq->lock);
+}
+
+void sched_report() {
+  for (int level = 0; level < SCHED_NLEVELS; ++level) {
+    uint64_t picks = 0, wait_cycles = 0, wait_max = 0;
+    for (int i = 0; i < MAXCPU; ++i) {
+      runlevel *l = &runqueues[i].levels[level];
+      picks += l->picks;
+      wait_cycles += l->wait_cycles;
+      wait_max = l->wait_max > wait_max ? l->wait_max : wait_max;
+    }
+    if (picks && picks >= 2 * reported_picks[level]) {
+      log_printf("sched level %d quantum %d picks %lu wait %lu max %lu "
+                 "cycles\n",
+                 level, sched_quantum(level), picks, wait_cycles / picks,
+                 wait_max);
+      reported_picks[level] = picks;
+    }
+  }
+
+  uint64_t migrations = 0;
+  for (int i = 0; i < MAXCPU; ++i) {
+    migrations += runqueues[i].migrations;
+  }
+  if (migrations && migrations >= 2 * reported_migrations) {
+    log_printf("sched migrations %lu\n", migrations);
+    reported_migrations = migrations;
+  }
+}
@@ -0,0 +1,191 @@
+#include "kernel.h"
+#include "vmiter.h"
+
+// Shared memory (see kernel.h)
+//    Each segment holds one reference to each of its pages, and each
+//    mapping holds another through its page-table entry. Pages are
+//    mapped with PTE_SHARED so that `pagetable_copy` shares them instead
+//    of making them copy-on-write. The creator holds a reference of its
+//    own until its first unmap of the segment or its exit, so a segment
+//    that is never mapped is still freed.
+
+typedef struct shmseg {
+  size_t npages;    // 0 if the slot is free
+  uint32_t *frames; // page numbers
+  int nrefs;        // mappings in all processes, plus `owner`'s
+  pid_t owner;      // creator, until it drops its reference; or 0
+} shmseg;
+
+static shmseg shmsegs[NSHM]; // `shmsegs[0]` is never used
+
+#define SHM_PERM (PTE_P | PTE_W | PTE_U | PTE_SHARED)
+
+static void shm_destroy(shmseg *seg) {
+  for (size_t i = 0; i < seg->npages; ++i) {
+    kfree((void *)((uintptr_t)seg->frames[i] * PAGESIZE));
+  }
+  kmfree(seg->frames);
+  seg->npages = 0;
+}
+
+static void shm_put(shmseg *seg) {
+  if (--seg->nrefs == 0) {
+    shm_destroy(seg);
+  }
+}
+
+// shm_disown(p, seg)
+//    Drop `seg`'s creator reference if `p` holds it.
+static void shm_disown(proc *p, shmseg *seg) {
+  if (seg->npages && seg->owner == p->pid) {
+    seg->owner = 0;
+    shm_put(seg);
+  }
+}
+
+int shm_create(proc *p, size_t size) {
+  size_t n = (size + PAGESIZE - 1) / PAGESIZE;
+  if (n == 0 || n > SHM_MAXPAGES) {
+    return -1;
+  }
+  int id = 1;
+  while (id < NSHM && shmsegs[id].npages) {
+    ++id;
+  }
+  if (id == NSHM) {
+    return -1;
+  }
+
+  shmseg *seg = &shmsegs[id];
+  seg->frames = kmalloc(n * sizeof(uint32_t));
+  if (!seg->frames) {
+    return -1;
+  }
+  for (seg->npages = 0; seg->npages < n; ++seg->npages) {
+    void *page = kalloc_zeroed(PAGESIZE);
+    if (!page) {
+      shm_destroy(seg);
+      return -1;
+    }
+    seg->frames[seg->npages] = (uintptr_t)page / PAGESIZE;
+  }
+  seg->nrefs = 1;
+  seg->owner = p->pid;
+  return id;
+}
+
+// shm_region(p, addr)
+//    Return `p`'s segment mapping starting at `addr`, or `nullptr`.
+static vmregion *shm_region(proc *p, uintptr_t addr) {
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    if (p->regions[i].shm && p->regions[i].start == addr) {
+      return &p->regions[i];
+    }
+  }
+  return NULL;
+}
+
+int shm_map(proc *p, int id, uintptr_t addr) {
+  if (id <= 0 || id >= NSHM || !shmsegs[id].npages) {
+    return -1;
+  }
+  shmseg *seg = &shmsegs[id];
+  uintptr_t end = addr + seg->npages * PAGESIZE;
+  if ((addr & PAGEOFFMASK) || addr < PROC_START_ADDR || end > VA_LOWEND ||
+      end < addr) {
+    return -1;
+  }
+
+  // find a free region slot; the range must not overlap another region
+  vmregion *slot = NULL;
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    vmregion *r = &p->regions[i];
+    if (r->start == r->end) {
+      slot = slot ? slot : r;
+    } else if (r->start < end && addr < r->end) {
+      return -1;
+    }
+  }
+  // `refcount` is 8 bits wide
+  if (!slot || pages[seg->frames[0]].refcount == UINT8_MAX) {
+    return -1;
+  }
+
+  vmiter_t it = vmiter_init(p->pagetable);
+  for (vmiter_va_add(&it, addr); vmiter_va(&it) < end; vmiter_next(&it)) {
+    if (vmiter_present(&it)) {
+      return -1;
+    }
+  }
+
+  it = vmiter_init(p->pagetable);
+  vmiter_va_add(&it, addr);
+  for (size_t i = 0; i < seg->npages; ++i, vmiter_va_add(&it, PAGESIZE)) {
+    if (vmiter_map(&it, (uintptr_t)seg->frames[i] * PAGESIZE, SHM_PERM) < 0) {
+      // undo the partial mapping
+      vmiter_t undo = vmiter_init(p->pagetable);
+      vmiter_va_add(&undo, addr);
+      vmiter_unmap_range(&undo, i * PAGESIZE);
+      for (size_t j = 0; j < i; ++j) {
+        --pages[seg->frames[j]].refcount;
+      }
+      return -1;
+    }
+    ++pages[seg->frames[i]].refcount;
+  }
+
+  slot->start = addr;
+  slot->end = end;
+  slot->perm = SHM_PERM;
+  slot->shm = id;
+  ++seg->nrefs;
+  return 0;
+}
+
+int shm_unmap(proc *p, uintptr_t addr) {
+  vmregion *r = shm_region(p, addr);
+  if (!r) {
+    return -1;
+  }
+  vmiter_t it = vmiter_init(p->pagetable);
+  vmiter_va_add(&it, r->start);
+  if (vmiter_unmap_range(&it, r->end - r->start) < 0) {
+    return -1;
+  }
+  // drop stale entries for the unmapped range (kernel entries are global)
+  wrcr3(rdcr3());
+
+  // the mapping held a reference to every frame (see `shm_map`)
+  shmseg *seg = &shmsegs[r->shm];
+  for (size_t i = 0; i < seg->npages; ++i) {
+    kfree((void *)((uintptr_t)seg->frames[i] * PAGESIZE));
+  }
+  r->start = r->end = 0;
+  r->shm = 0;
+  shm_disown(p, seg);
+  shm_put(seg);
+  return 0;
+}
+
+void shm_fork(proc *p) {
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    if (p->regions[i].shm) {
+      ++shmsegs[p->regions[i].shm].nrefs;
+    }
+  }
+}
+
+void shm_release(proc *p) {
+  for (int i = 0; i < PROC_NREGIONS; ++i) {
+    vmregion *r = &p->regions[i];
+    if (r->shm) {
+      shmseg *seg = &shmsegs[r->shm];
+      r->start = r->end = 0;
+      r->shm = 0;
+      shm_put(seg);
+    }
+  }
+  for (int id = 1; id < NSHM; ++id) {
+    shm_disown(p, &shmsegs[id]);
+  }
+}
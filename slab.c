@@ -0,0 +1,164 @@
+#include "kernel.h"
+
+// Slab allocator
+//    `kmalloc` rounds requests up to a power-of-two size class between
+//    16 and KMALLOC_MAX bytes. Each class has a cache of slabs: blocks
+//    from `kalloc` that start with a `slab` header followed by equal-sized
+//    objects. Free objects are linked through their first word; objects
+//    that have never been handed out are carved off at `slab->bump`, so a
+//    new slab needs no initialization pass.
+//
+//    Slabs with free objects sit on their cache's `partial` list. A slab
+//    becoming empty stays cached if it is the cache's only empty slab;
+//    otherwise it goes back to `kalloc`. Since `kalloc` blocks are aligned
+//    to their size, `kmfree` finds an object's slab from `pages[]`.
+
+#define SLAB_MINSHIFT 4 // smallest class: 16 bytes
+#define SLAB_NCLASSES 8 // 16, 32, ..., 2048 bytes
+#define SLAB_MINOBJS 8  // slabs are sized to hold at least this many
+#define SLAB_MAXORDER 3 // order of the largest class's slabs (32 KiB)
+
+typedef struct slab {
+  struct slab_cache *cache;
+  struct slab *next; // partial list links
+  struct slab *prev;
+  void *freelist;    // freed objects
+  uintptr_t bump;    // next never-used object
+  uint32_t inuse;    // allocated objects
+  uint32_t nobjs;    // capacity
+} slab;
+
+typedef struct slab_cache {
+  size_t size;    // object size
+  int order;      // slab size is `PAGESIZE << order`
+  uint32_t nobjs; // objects per slab
+  slab *partial;  // slabs with at least one free object
+  slab *empty;    // one cached empty slab, also on `partial`
+} slab_cache;
+
+#define SLAB_HDRSIZE ((sizeof(slab) + 15) & ~15UL)
+
+static slab_cache slab_caches[SLAB_NCLASSES];
+
+static slab_cache *slab_cache_for(size_t sz) {
+  int cls = 0;
+  while ((1UL << (cls + SLAB_MINSHIFT)) < sz) {
+    ++cls;
+  }
+  slab_cache *sc = &slab_caches[cls];
+  if (!sc->size) {
+    sc->size = 1UL << (cls + SLAB_MINSHIFT);
+    while (((PAGESIZE << sc->order) - SLAB_HDRSIZE) / sc->size <
+           SLAB_MINOBJS) {
+      ++sc->order;
+    }
+    sc->nobjs = ((PAGESIZE << sc->order) - SLAB_HDRSIZE) / sc->size;
+  }
+  return sc;
+}
+
+static void slab_unlink(slab *s) {
+  if (s->prev) {
+    s->prev->next = s->next;
+  } else {
+    s->cache->partial = s->next;
+  }
+  if (s->next) {
+    s->next->prev = s->prev;
+  }
+}
+
+static void slab_link(slab *s) {
+  s->prev = NULL;
+  s->next = s->cache->partial;
+  if (s->next) {
+    s->next->prev = s;
+  }
+  s->cache->partial = s;
+}
+
+static slab *slab_create(slab_cache *sc) {
+  slab *s = kalloc(PAGESIZE << sc->order);
+  if (!s) {
+    return NULL;
+  }
+  pages[(uintptr_t)s / PAGESIZE].slab = true;
+  s->cache = sc;
+  s->freelist = NULL;
+  s->bump = (uintptr_t)s + SLAB_HDRSIZE;
+  s->inuse = 0;
+  s->nobjs = sc->nobjs;
+  slab_link(s);
+  return s;
+}
+
+// slab_find(ptr)
+//    Return the slab containing `ptr`, or `nullptr` if `ptr` is not in a
+//    slab. A slab of order `k` starts at the page number `pn` rounded down
+//    to a multiple of 2^k and is marked in that page's `pageinfo`.
+static slab *slab_find(void *ptr) {
+  uintptr_t pn = (uintptr_t)ptr / PAGESIZE;
+  for (int k = 0; k <= SLAB_MAXORDER; ++k) {
+    uintptr_t head = pn & ~((1UL << k) - 1);
+    if (pages[head].slab && pages[head].order == k &&
+        pages[head].refcount) {
+      return (slab *)(head * PAGESIZE);
+    }
+  }
+  return NULL;
+}
+
+void *kmalloc(size_t sz) {
+  if (sz > KMALLOC_MAX) {
+    return kalloc(sz);
+  }
+
+  slab_cache *sc = slab_cache_for(sz);
+  slab *s = sc->partial;
+  if (!s && !(s = slab_create(sc))) {
+    return NULL;
+  }
+  if (s == sc->empty) {
+    sc->empty = NULL;
+  }
+
+  void *obj = s->freelist;
+  if (obj) {
+    s->freelist = *(void **)obj;
+  } else {
+    obj = (void *)s->bump;
+    s->bump += sc->size;
+  }
+  if (++s->inuse == s->nobjs) {
+    slab_unlink(s);
+  }
+  return obj;
+}
+
+void kmfree(void *ptr) {
+  if (!ptr) {
+    return;
+  }
+  slab *s = slab_find(ptr);
+  if (!s) {
+    kfree(ptr);
+    return;
+  }
+
+  slab_cache *sc = s->cache;
+  *(void **)ptr = s->freelist;
+  s->freelist = ptr;
+  if (s->inuse-- == s->nobjs) {
+    slab_link(s);
+  }
+
+  if (s->inuse == 0) {
+    if (!sc->empty) {
+      sc->empty = s;
+    } else if (sc->empty != s) {
+      slab_unlink(s);
+      pages[(uintptr_t)s / PAGESIZE].slab = false;
+      kfree(s);
+    }
+  }
+}
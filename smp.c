@@ -0,0 +1,91 @@
+#include "kernel.h"
+#include "lapic.h"
+#include "log.h"
+
+// Multiprocessor startup (see kernel.h)
+//    The boot CPU wakes the application processors by broadcasting INIT
+//    and then two startup IPIs, as the Intel MultiProcessor Specification
+//    describes. Each runs `ap_trampoline` (exception.S) from
+//    AP_TRAMPOLINE_ADDR, claims the next CPU index from `ap_next`, and
+//    calls `ap_entry` on the kernel stack `smp_init` allocated for that
+//    index. No firmware tables are read: every CPU that answers joins, up
+//    to MAXCPU. Each then schedules from its own run queue (sched.c).
+
+#define SMP_INIT_DELAY_US 10000 // INIT to the first startup IPI
+#define SMP_SIPI_DELAY_US 200   // between startup IPIs
+#define SMP_WAIT_US 10000       // for the CPUs to check in
+
+cpustate cpus[MAXCPU];
+spinlock kernel_lock;
+int ncpu = 1;
+
+// read by `ap_trampoline`
+int ap_next = 1;
+uintptr_t ap_stack_top[MAXCPU];
+
+static int ap_started;
+
+extern char ap_trampoline[], ap_trampoline_end[];
+
+_Static_assert(__builtin_offsetof(cpustate, kstack_top) ==
+                   CPUSTATE_KSTACK_TOP,
+               "exception.S uses cpustate::kstack_top");
+_Static_assert(__builtin_offsetof(cpustate, syscall_rsp) ==
+                   CPUSTATE_SYSCALL_RSP,
+               "exception.S uses cpustate::syscall_rsp");
+
+static void smp_delay(uint64_t us) {
+  uint64_t end = rdtsc() + tsc_per_tick * HZ * us / 1000000;
+  while (rdtsc() < end) {
+    pause();
+  }
+}
+
+// smp_ipi(dest, icr)
+//    Send the IPI described by `icr` to the CPU with local APIC ID `dest`
+//    (ignored for broadcasts) and wait until the local APIC has delivered
+//    it.
+static void smp_ipi(int dest, uint32_t icr) {
+  lapicstate_t *lapic = lapic_get();
+  lapic_write(lapic, APIC_REG_ICR_HIGH, (uint32_t)dest << 24);
+  lapic_write(lapic, APIC_REG_ICR_LOW, icr);
+  while (lapic_read(lapic, APIC_REG_ICR_LOW) & IPI_DELIVERY_STATUS) {
+    pause();
+  }
+}
+
+void smp_init() {
+  for (int i = 1; i < MAXCPU; ++i) {
+    void *stack = kalloc(PAGESIZE);
+    if (!stack) {
+      log_printf("smp: out of memory\n");
+      return;
+    }
+    ap_stack_top[i] = (uintptr_t)stack + PAGESIZE;
+  }
+  memcpy((void *)AP_TRAMPOLINE_ADDR, ap_trampoline,
+         ap_trampoline_end - ap_trampoline);
+
+  smp_ipi(0, IPI_ALL_EXCLUDING_SELF | IPI_INIT | IPI_LEVEL_ASSERT);
+  smp_delay(SMP_INIT_DELAY_US);
+  for (int i = 0; i < 2; ++i) {
+    smp_ipi(0, IPI_ALL_EXCLUDING_SELF | IPI_STARTUP |
+                   (AP_TRAMPOLINE_ADDR >> 12));
+    smp_delay(SMP_SIPI_DELAY_US);
+  }
+  smp_delay(SMP_WAIT_US);
+  ncpu = 1 + __atomic_load_n(&ap_started, __ATOMIC_ACQUIRE);
+  log_printf("smp %d cpus\n", ncpu);
+}
+
+void smp_wake(int cpu) {
+  smp_ipi(cpus[cpu].lapic_id, IPI_GIVEN | (INT_IRQ + IRQ_WAKEUP));
+}
+
+// ap_entry(index)
+//    Called by `ap_trampoline` on CPU `index`'s kernel stack.
+__attribute__((noreturn)) void ap_entry(int index) {
+  init_cpu_state(index, ap_stack_top[index]);
+  __atomic_add_fetch(&ap_started, 1, __ATOMIC_RELEASE);
+  schedule();
+}
@@ -0,0 +1,317 @@
+#include "kernel.h"
+#include "ata.h"
+#include "bootimg.h"
+#include "log.h"
+#include "vmiter.h"
+
+// Swap (see kernel.h)
+//    The swap area is an array of page-sized slots on the boot disk.
+//    `swap_ref[s]` counts the references to slot `s`: PTE_SWAP entries
+//    naming it, plus one if a resident page caches its contents
+//    (`pageinfo::swapslot`). Slot 0 is never used, so a `swapslot` of 0
+//    means "none". A slot is free when its count is 0.
+//
+//    Victims are private pages (not PTE_SHARED, merged, or shared by
+//    fork) chosen by a clock that sweeps process page tables: a page whose
+//    PTE_A is set gets a second chance, and PTE_A is cleared; a page whose
+//    PTE_A is still clear on the next sweep is evicted. Clearing PTE_A
+//    does not flush the TLB, so a page used only through a cached entry
+//    may look idle; that costs a fault, never correctness. Processes
+//    running on other CPUs are skipped: the hardware may be updating
+//    PTE_A and PTE_D in their page tables, and their CPUs would keep
+//    stale TLB entries for evicted pages. A process with victims stays
+//    claimed (`proc_claim`) until they are evicted, so no CPU can run it
+//    and dirty them in between.
+//
+//    Evictions are batched: dirty victims get a run of consecutive slots
+//    and are written with one disk command. A victim that was swapped in
+//    earlier and still has PTE_D clear matches its slot, so it is dropped
+//    without a write.
+
+#define SWAP_SECTS_PER_PAGE (PAGESIZE / SECTORSIZE)
+#define SWAP_NSLOTS (SWAP_SECTORS / SWAP_SECTS_PER_PAGE)
+#define SWAP_BATCH (ATA_MAXSECTS / SWAP_SECTS_PER_PAGE) // pages per write
+#define SWAP_LOW_WATER 256  // free pages that start background reclaim
+#define SWAP_HIGH_WATER 512 // free pages that stop it
+
+// PTE bits kept in a PTE_SWAP entry
+#define SWAP_PERM (PTE_W | PTE_U | PTE_COW)
+
+static uint8_t swap_ref[SWAP_NSLOTS];
+static uint32_t swap_hint = 1; // where the next slot search starts
+
+// clock hand
+static pid_t swap_pid = 1;
+static uintptr_t swap_va = PROC_START_ADDR;
+
+// pages that must stay resident (see `swap_pin`)
+static proc *pin_proc;
+static uintptr_t pin_start, pin_end;
+
+// statistics
+static struct {
+  uint64_t out;      // pages evicted
+  uint64_t clean;    // evicted pages that needed no write
+  uint64_t writes;   // disk write commands
+  uint64_t in;       // pages read back
+  uint64_t reported; // `out` at the last `swap_report`
+} swap_stats;
+
+typedef struct swap_victim {
+  proc *p;
+  x86_64_pageentry_t *pep;
+  uintptr_t va;
+} swap_victim;
+
+// the batch being evicted (kept off the small kernel stack)
+static swap_victim swap_victims[SWAP_BATCH];
+
+static inline uint32_t swap_slot(x86_64_pageentry_t pe) {
+  return (pe & PTE_PAMASK) >> PAGEOFFBITS;
+}
+
+static inline uint32_t swap_sector(uint32_t slot) {
+  return SWAP_START_SECTOR + slot * SWAP_SECTS_PER_PAGE;
+}
+
+void swap_init() { ata_init(); }
+
+// swap_alloc_run(n, first)
+//    Find up to `n` consecutive free slots, starting the search at
+//    `swap_hint`. Sets `*first` and returns the number found, which is 0
+//    only if the swap area is full.
+static uint32_t swap_alloc_run(uint32_t n, uint32_t *first) {
+  uint32_t s = swap_hint;
+  for (uint32_t i = 1; i < SWAP_NSLOTS && swap_ref[s]; ++i) {
+    s = s + 1 < SWAP_NSLOTS ? s + 1 : 1;
+  }
+  if (swap_ref[s]) {
+    return 0;
+  }
+  uint32_t len = 1;
+  while (len < n && s + len < SWAP_NSLOTS && !swap_ref[s + len]) {
+    ++len;
+  }
+  *first = s;
+  swap_hint = s + len < SWAP_NSLOTS ? s + len : 1;
+  return len;
+}
+
+// swap_evictable(p, va, pe)
+//    Return true if the page mapped by `p`'s leaf entry `pe` at `va` may
+//    be swapped out.
+static bool swap_evictable(proc *p, uintptr_t va, x86_64_pageentry_t pe) {
+  uintptr_t pa = pe & PTE_PAMASK;
+  pageinfo *pi = &pages[pa / PAGESIZE];
+  return (pe & PTE_U) && !(pe & PTE_SHARED) && pi->refcount == 1 &&
+         !pi->merged && !(p == pin_proc && va >= pin_start && va < pin_end);
+}
+
+// swap_flush(p, va)
+//    Drop any TLB entry for `va` in `p`'s address space.
+static void swap_flush(proc *p, uintptr_t va) {
+  if ((rdcr3() & PTE_PAMASK) == (uintptr_t)p->pagetable) {
+    invlpg((void *)va);
+  } else {
+    proc_tlb_invalidate(p);
+  }
+}
+
+// swap_collect(v, claimed)
+//    Advance the clock hand, filling `v` with up to SWAP_BATCH victims.
+//    Gives up after two sweeps over every process. Returns the number of
+//    victims found; their processes stay claimed, and bit `pid` of
+//    `*claimed` is set for each.
+static int swap_collect(swap_victim *v, uint32_t *claimed) {
+  int n = 0;
+  *claimed = 0;
+  for (int nvisit = 0; nvisit <= 2 * NPROC; ++nvisit) {
+    proc *p = &ptable[swap_pid];
+    if (p->state != P_FREE && p->pagetable && proc_claim(p)) {
+      int first = n;
+      bool full = false;
+      vmiter_t it = vmiter_init(p->pagetable);
+      for (vmiter_va_add(&it, swap_va); vmiter_va(&it) < VA_LOWEND;
+           vmiter_next(&it)) {
+        if (!vmiter_present(&it) || it.level != 0 ||
+            !swap_evictable(p, vmiter_va(&it), *it.pep)) {
+          continue;
+        }
+        if (n == SWAP_BATCH) {
+          // resume here next time
+          swap_va = vmiter_va(&it);
+          full = true;
+          break;
+        }
+        if (*it.pep & PTE_A) {
+          *it.pep &= ~PTE_A;
+        } else {
+          v[n++] = (swap_victim){p, it.pep, vmiter_va(&it)};
+        }
+      }
+      if (n > first) {
+        *claimed |= 1U << swap_pid;
+      } else {
+        proc_unclaim(p);
+      }
+      if (full) {
+        return n;
+      }
+    }
+    swap_pid = swap_pid + 1 < NPROC ? swap_pid + 1 : 1;
+    swap_va = PROC_START_ADDR;
+  }
+  return n;
+}
+
+// swap_evict(v, slot)
+//    Replace victim `v`'s mapping with a PTE_SWAP entry for `slot`, which
+//    already holds its contents and a reference for the new entry.
+static void swap_evict(swap_victim *v, uint32_t slot) {
+  x86_64_pageentry_t pe = *v->pep;
+  *v->pep = ((uintptr_t)slot << PAGEOFFBITS) | PTE_SWAP | (pe & SWAP_PERM);
+  swap_flush(v->p, v->va);
+  kfree((void *)(pe & PTE_PAMASK));
+  ++swap_stats.out;
+}
+
+static void swap_unclaim(uint32_t claimed) {
+  for (pid_t pid = 1; pid < NPROC; ++pid) {
+    if (claimed & (1U << pid)) {
+      proc_unclaim(&ptable[pid]);
+    }
+  }
+}
+
+// swap_evict_batch()
+//    Evict one batch of victims. Returns the number of pages freed, or 0
+//    if there were no victims or the swap area is full.
+static int swap_evict_batch() {
+  swap_victim *v = swap_victims;
+  uint32_t claimed;
+  int nv = swap_collect(v, &claimed);
+
+  // clean pages with a valid slot go without a write
+  int freed = 0, ndirty = 0;
+  for (int i = 0; i < nv; ++i) {
+    x86_64_pageentry_t pe = *v[i].pep;
+    uint32_t slot = pages[(pe & PTE_PAMASK) / PAGESIZE].swapslot;
+    if (slot && !(pe & PTE_D)) {
+      ++swap_ref[slot];
+      swap_evict(&v[i], slot);
+      ++swap_stats.clean;
+      ++freed;
+    } else {
+      v[ndirty++] = v[i];
+    }
+  }
+
+  // dirty pages go to consecutive slots in one write
+  uint32_t first;
+  uint32_t nslots = ndirty ? swap_alloc_run(ndirty, &first) : 0;
+  if (nslots) {
+    void *srcs[SWAP_BATCH];
+    for (uint32_t i = 0; i < nslots; ++i) {
+      srcs[i] = (void *)(*v[i].pep & PTE_PAMASK);
+    }
+    if (ata_write_pages(swap_sector(first), srcs, nslots) < 0) {
+      log_printf("swap: write error at slot %u\n", first);
+      swap_unclaim(claimed);
+      return freed;
+    }
+    ++swap_stats.writes;
+    for (uint32_t i = 0; i < nslots; ++i) {
+      swap_ref[first + i] = 1;
+      swap_evict(&v[i], first + i);
+      ++freed;
+    }
+  }
+  swap_unclaim(claimed);
+  return freed;
+}
+
+int swap_reclaim(int n) {
+  int freed = 0, k;
+  while (freed < n && (k = swap_evict_batch()) > 0) {
+    freed += k;
+  }
+  return freed;
+}
+
+void swap_balance() {
+  static bool reclaiming;
+  size_t nfree = kalloc_nfree();
+  if (nfree < SWAP_LOW_WATER) {
+    reclaiming = true;
+  }
+  if (reclaiming &&
+      (nfree >= SWAP_HIGH_WATER || swap_reclaim(SWAP_BATCH) == 0)) {
+    reclaiming = false;
+  }
+}
+
+bool swap_in(proc *p, uintptr_t va, uint64_t err) {
+  vmiter_t it = vmiter_init(p->pagetable);
+  vmiter_va_add(&it, va & ~PAGEOFFMASK);
+  x86_64_pageentry_t pe = *it.pep;
+  if (it.level != 0 || (pe & PTE_P) || !(pe & PTE_SWAP) ||
+      ((err & PFERR_WRITE) && !(pe & (PTE_W | PTE_COW)))) {
+    return false;
+  }
+  uint32_t slot = swap_slot(pe);
+  void *page = proc_page_alloc(false);
+  if (!page) {
+    return false;
+  }
+  if (ata_read(swap_sector(slot), page, SWAP_SECTS_PER_PAGE) < 0) {
+    log_printf("swap: read error at slot %u\n", slot);
+    kfree(page);
+    return false;
+  }
+  // the new page is private, so a copy-on-write page becomes writable
+  int perm = (pe & SWAP_PERM) | PTE_P;
+  if (perm & PTE_COW) {
+    perm = (perm & ~PTE_COW) | PTE_W;
+  }
+  // `proc_page_alloc` may have reclaimed pages, but never this entry's
+  *it.pep = (uintptr_t)page | perm;
+  if (swap_ref[slot] == 1) {
+    // this entry's reference now belongs to the page: while the page
+    // stays clean, evicting it again needs no write
+    pages[(uintptr_t)page / PAGESIZE].swapslot = slot;
+  } else {
+    --swap_ref[slot];
+  }
+  ++swap_stats.in;
+  return true;
+}
+
+int swap_dup(x86_64_pageentry_t pe) {
+  uint32_t slot = swap_slot(pe);
+  if (swap_ref[slot] == UINT8_MAX) {
+    return -1;
+  }
+  ++swap_ref[slot];
+  return 0;
+}
+
+void swap_free(x86_64_pageentry_t pe) { --swap_ref[swap_slot(pe)]; }
+
+void swap_forget(uint32_t pn) {
+  --swap_ref[pages[pn].swapslot];
+  pages[pn].swapslot = 0;
+}
+
+void swap_pin(proc *p, uintptr_t va, size_t len) {
+  pin_proc = p;
+  pin_start = va & ~PAGEOFFMASK;
+  pin_end = va + len;
+}
+
+void swap_report() {
+  if (swap_stats.out && swap_stats.out >= 2 * swap_stats.reported) {
+    log_printf("swap %lu out %lu clean %lu writes %lu in\n", swap_stats.out,
+               swap_stats.clean, swap_stats.writes, swap_stats.in);
+    swap_stats.reported = swap_stats.out;
+  }
+}
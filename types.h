@@ -17,6 +17,9 @@ typedef __builtin_va_list va_list;
 #define __section(x) __attribute__((section(x)))
 #define __no_asan    __attribute__((no_sanitize_address))
 #define __noinline   __attribute__((noinline))
+// host builds (mkbootdisk) may already have a libc definition
+#ifndef __always_inline
 #define __always_inline static inline __attribute__((always_inline))
+#endif
 
 #endif /* !SIGNALOS_TYPES_H */
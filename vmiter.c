@@ -30,6 +30,8 @@ void vmiter_down(vmiter_t* it) {
 
 uintptr_t vmiter_va(vmiter_t *it) { return it->va; }
 
+bool vmiter_present(vmiter_t *it) { return *(it->pep) & PTE_P; }
+
 void vmiter_real_find(vmiter_t *it, uintptr_t va) {
   if (it->level == 3 || ((it->va ^ va) & ~pageoffmask(it->level + 1)) != 0) {
     it->level = 3;
@@ -75,11 +77,10 @@ int vmiter_map(vmiter_t *it, uintptr_t pa, int perm) {
 
   while (it->level > 0 && perm) {
     // assert(!(*pep_ & PTE_P));
-    x86_64_pagetable *pt = kalloc(PAGESIZE);
+    x86_64_pagetable *pt = kalloc_zeroed(PAGESIZE);
     if (!pt) {
       return -1;
     }
-    memset(pt, 0, PAGESIZE);
     *(it->pep) = (uintptr_t)pt | PTE_P | PTE_W | PTE_U;
     vmiter_down(it);
   }
@@ -90,6 +91,234 @@ int vmiter_map(vmiter_t *it, uintptr_t pa, int perm) {
   return 0;
 }
 
+int vmiter_unmap_range(vmiter_t *it, size_t len) {
+  uintptr_t start = it->va, end = start + len;
+  // only the large pages holding the first and last byte can stick out
+  // of the range; check both before changing anything
+  for (int i = 0; i < 2 && len; ++i) {
+    vmiter_real_find(it, i ? end - 1 : start);
+    if (it->level > 0 && (*(it->pep) & PTE_P) &&
+        ((it->va & ~pageoffmask(it->level)) < start ||
+         (it->va | pageoffmask(it->level)) > end - 1)) {
+      vmiter_real_find(it, start);
+      return -1;
+    }
+  }
+  vmiter_real_find(it, start);
+
+  while (it->va < end) {
+    uintptr_t va = it->va;
+    if (it->level == 0) {
+      x86_64_pageentry_t *pep = it->pep;
+      do {
+        *pep++ = 0;
+        va += PAGESIZE;
+      } while (va < end && pageindex(va, 0) != 0);
+    } else {
+      // an empty entry, or a large page inside the range
+      va = (va | pageoffmask(it->level)) + 1;
+      if (*(it->pep) & PTE_P) {
+        *(it->pep) = 0;
+      }
+    }
+    if (va == 0) {
+      break; // wrapped around the address space
+    }
+    vmiter_real_find(it, va);
+  }
+  return 0;
+}
+
+void vmiter_next(vmiter_t *it) {
+  vmiter_real_find(it, (it->va | pageoffmask(it->level)) + 1);
+}
+
 void vmiter_va_add(vmiter_t *it, unsigned long n) {
   vmiter_real_find(it, it->va + n);
 }
+
+// ptiter_sibling(it)
+//    Move to the entry after the current one. If the current entry is the
+//    last in its table, move up to the entry pointing to that table
+//    instead, which is next in post-order, and return false.
+static bool ptiter_sibling(ptiter_t *it) {
+  uintptr_t va = (it->va | pageoffmask(it->level)) + 1;
+  if (it->level < 3 && (va & pageoffmask(it->level + 1)) == 0) {
+    ++it->level;
+    it->va &= ~pageoffmask(it->level);
+    return false;
+  }
+  it->va = va;
+  ++it->pep[it->level];
+  return true;
+}
+
+// ptiter_down(it)
+//    Starting from the current entry, find the first entry in post-order
+//    that points to a page-table page.
+static void ptiter_down(ptiter_t *it) {
+  while (it->va < VA_LOWEND) {
+    x86_64_pageentry_t pe = *it->pep[it->level];
+    if ((pe & (PTE_P | PTE_PS)) == PTE_P) {
+      if (it->level == 1) {
+        return;
+      }
+      x86_64_pagetable *pt = (x86_64_pagetable *)(pe & PTE_PAMASK);
+      --it->level;
+      it->pep[it->level] = &pt->entry[pageindex(it->va, it->level)];
+    } else if (!ptiter_sibling(it)) {
+      return;
+    }
+  }
+}
+
+ptiter_t ptiter_init(x86_64_pagetable *pt) {
+  ptiter_t it = {.level = 3, .va = PROC_START_ADDR};
+  it.pep[3] = &pt->entry[pageindex(it.va, 3)];
+  ptiter_down(&it);
+  return it;
+}
+
+bool ptiter_done(ptiter_t *it) { return it->va >= VA_LOWEND; }
+
+void ptiter_next(ptiter_t *it) {
+  if (ptiter_sibling(it)) {
+    ptiter_down(it);
+  }
+}
+
+x86_64_pagetable *ptiter_kptr(ptiter_t *it) {
+  return (x86_64_pagetable *)(*it->pep[it->level] & PTE_PAMASK);
+}
+
+int ptiter_level(ptiter_t *it) { return it->level - 1; }
+
+x86_64_pagetable *pagetable_new() {
+  x86_64_pagetable *pt = kalloc_zeroed(PAGESIZE);
+  if (pt) {
+    pt->entry[0] = kernel_pagetable[0].entry[0];
+  }
+  return pt;
+}
+
+x86_64_pagetable *pagetable_copy(x86_64_pagetable *pt, bool cow) {
+  x86_64_pagetable *npt = pagetable_new();
+  if (!npt) {
+    return NULL;
+  }
+  vmiter_t dst = vmiter_init(npt);
+  vmiter_t src = vmiter_init(pt);
+  for (vmiter_va_add(&src, PROC_START_ADDR); vmiter_va(&src) < VA_LOWEND;
+       vmiter_next(&src)) {
+    if (src.level == 0 && (*(src.pep) & PTE_SWAP)) {
+      // both entries name the same swap slot
+      vmiter_va_add(&dst, vmiter_va(&src) - vmiter_va(&dst));
+      if (swap_dup(*(src.pep)) < 0) {
+        pagetable_free(npt);
+        return NULL;
+      }
+      if (vmiter_map(&dst, *(src.pep) & PTE_PAMASK,
+                     *(src.pep) & PAGEOFFMASK) < 0) {
+        swap_free(*(src.pep));
+        pagetable_free(npt);
+        return NULL;
+      }
+      continue;
+    }
+    if (!vmiter_present(&src) || src.level != 0) {
+      continue;
+    }
+    uintptr_t pa = *(src.pep) & PTE_PAMASK;
+    int perm = *(src.pep) & PAGEOFFMASK;
+    if (perm & PTE_SHARED) {
+      // shared memory stays shared, and writable, in the child
+      if (pages[pa / PAGESIZE].refcount == UINT8_MAX) {
+        pagetable_free(npt);
+        return NULL;
+      }
+      ++pages[pa / PAGESIZE].refcount;
+    } else if (!cow || pages[pa / PAGESIZE].refcount == UINT8_MAX) {
+      // `refcount` is 8 bits wide, so heavily shared pages are copied
+      void *copy = kalloc(PAGESIZE);
+      if (!copy) {
+        pagetable_free(npt);
+        return NULL;
+      }
+      memcpy(copy, (void *)pa, PAGESIZE);
+      pa = (uintptr_t)copy;
+    } else {
+      if (perm & PTE_W) {
+        perm = (perm & ~PTE_W) | PTE_COW;
+        *(src.pep) = pa | perm;
+      }
+      if ((void *)pa != zero_frame) {
+        ++pages[pa / PAGESIZE].refcount;
+      }
+    }
+    vmiter_va_add(&dst, vmiter_va(&src) - vmiter_va(&dst));
+    if (vmiter_map(&dst, pa, perm) < 0) {
+      kfree((void *)pa);
+      pagetable_free(npt);
+      return NULL;
+    }
+  }
+  return npt;
+}
+
+void pagetable_free(x86_64_pagetable *pt) {
+  for (ptiter_t it = ptiter_init(pt); !ptiter_done(&it); ptiter_next(&it)) {
+    x86_64_pagetable *table = ptiter_kptr(&it);
+    if (ptiter_level(&it) == 0) {
+      for (int i = 0; i < (1 << PAGEINDEXBITS); ++i) {
+        if (table->entry[i] & PTE_P) {
+          kfree((void *)(table->entry[i] & PTE_PAMASK));
+        } else if (table->entry[i] & PTE_SWAP) {
+          swap_free(table->entry[i]);
+        }
+      }
+    }
+    kfree(table);
+  }
+  kfree(pt);
+}
+
+// Page tables waiting for `pagetable_reap`, linked through their last
+// entry, which lies above VA_LOWEND and maps nothing. Entry 0, the shared
+// kernel entry, must stay: the exiting CPU walks the table until it
+// moves on in `schedule`.
+#define REAP_LINK ((1 << PAGEINDEXBITS) - 1)
+static x86_64_pagetable *pagetable_reap_list;
+
+void pagetable_free_deferred(x86_64_pagetable *pt) {
+  pt->entry[REAP_LINK] = (x86_64_pageentry_t)pagetable_reap_list;
+  pagetable_reap_list = pt;
+}
+
+// pagetable_loaded(pt)
+//    Return true if some CPU may still walk `pt`.
+static bool pagetable_loaded(x86_64_pagetable *pt) {
+  for (int i = 0; i < ncpu; ++i) {
+    if (cpus[i].pagetable == pt) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool pagetable_reap() {
+  x86_64_pagetable *prev = NULL;
+  for (x86_64_pagetable *pt = pagetable_reap_list; pt;
+       prev = pt, pt = (x86_64_pagetable *)pt->entry[REAP_LINK]) {
+    if (!pagetable_loaded(pt)) {
+      x86_64_pagetable *next = (x86_64_pagetable *)pt->entry[REAP_LINK];
+      if (prev) {
+        prev->entry[REAP_LINK] = (x86_64_pageentry_t)next;
+      } else {
+        pagetable_reap_list = next;
+      }
+      pagetable_free(pt);
+      return true;
+    }
+  }
+  return pagetable_reap_list != NULL;
+}
@@ -25,13 +25,49 @@ uintptr_t vmiter_va(vmiter_t* it);
 // initialize a new virtual memory iterator from a pagetable
 vmiter_t vmiter_init(x86_64_pagetable* pt);
 
-// advance to next page table
+// true iff the current virtual address is mapped
+bool vmiter_present(vmiter_t* it);
+
+// advance past the page-table entry covering the current address: one
+// page for a mapping, or the whole range of an empty upper-level entry.
+// Loops over `vmiter_next` visit sparse address spaces in time
+// proportional to the populated entries.
 void vmiter_next(vmiter_t* it);
 
 
 int vmiter_map(vmiter_t* it, uintptr_t pa, int perm);
 
+// unmap `len` bytes starting at the current address, skipping empty
+// upper-level entries. Does not free pages or page tables, or flush the
+// TLB. Leaves the iterator at the end of the range and returns 0, or
+// returns -1 with nothing unmapped if the range covers a present large
+// page only partly.
+int vmiter_unmap_range(vmiter_t* it, size_t len);
+
 // advance virtual address by n
 void vmiter_va_add(vmiter_t* it, unsigned long n);
 
+// Page-table page iterator
+//    Visits the page-table pages of `pt` that map [PROC_START_ADDR,
+//    VA_LOWEND) in post-order: every table comes after the tables below
+//    it, so the current table can be freed before calling `ptiter_next`.
+//    The root `pt` itself is not visited.
+typedef struct ptiter {
+  x86_64_pageentry_t* pep[4]; // current entry at each level
+  int level;                  // level of the entry pointing to the table
+  uintptr_t va;               // first virtual address the table maps
+} ptiter_t;
+
+ptiter_t ptiter_init(x86_64_pagetable* pt);
+
+// true once every table has been visited
+bool ptiter_done(ptiter_t* it);
+
+// advance to the next table
+void ptiter_next(ptiter_t* it);
+
+// current page-table page and its level (0 for a table of leaf entries)
+x86_64_pagetable* ptiter_kptr(ptiter_t* it);
+int ptiter_level(ptiter_t* it);
+
 #endif // VMITER_H
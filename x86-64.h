@@ -27,6 +27,7 @@
 #define PTE_D           0x40UL   // entry was Dirtied (written)
 // Other special-purpose flags
 #define PTE_PS          0x80UL   // entry has a large Page Size
+#define PTE_G           0x100UL  // entry is Global (kept across %cr3 loads)
 #define PTE_PWT         0x8UL
 #define PTE_PCD         0x10UL
 #define PTE_XD          0x8000000000000000UL // entry is eXecute Disabled
@@ -179,6 +180,11 @@ typedef struct x86_64_msr_t {
 #define CR4_PCE                 0x00000100      // Perfmonitor Counter Enable
 #define CR4_OSFXSR              0x00000200      // OS FXSAVE/FXRSTOR support
 #define CR4_VMXE                0x00004000      // VMX Enable
+#define CR4_PCIDE               0x00020000      // Process-Context Identifiers
+
+// %cr3 bits when CR4_PCIDE is set
+#define CR3_PCIDMASK            0xFFFUL         // PCID tagging TLB entries
+#define CR3_NOFLUSH             (1UL << 63)     // keep the PCID's entries
 
 // eflags bits (useful for rdeflags() and wreflags())
 #define EFLAGS_CF               0x00000001      // Carry Flag
@@ -551,6 +557,7 @@ typedef struct x86_64_gatedescriptor {
 #define MSR_IA32_APIC_BASE           0x1B
 #define MSR_IA32_MTRR_CAP            0xFE
 #define MSR_IA32_MTRR_BASE           0x200
+#define MSR_IA32_TSC_DEADLINE        0x6E0
 #define MSR_IA32_MTRR_FIX64K_00000   0x250
 #define MSR_IA32_MTRR_FIX16K_80000   0x258
 #define MSR_IA32_MTRR_FIX16K_A0000   0x259